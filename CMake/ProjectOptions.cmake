@@ -21,6 +21,7 @@ option( OTK_BUILD_EXAMPLES    "Enable build of OptiXToolkit examples" ON )
 option( OTK_BUILD_TESTS       "Enable build of OptiXToolkit test" ON )
 option( OTK_BUILD_DOCS        "Enable build of OptiXToolkit documentation" ON )
 option( OTK_BUILD_PYOPTIX     "Enable build of PyOptiX libraries" OFF )
+option( OTK_BUILD_BENCHMARKS  "Enable build of OptiXToolkit benchmarks" OFF )
 option( OTK_WARNINGS_AS_ERRORS "Treat compiler warnings as errors" OFF )
 
 # If vcpkg is enabled, ProjectOptions must be included before project() is called.
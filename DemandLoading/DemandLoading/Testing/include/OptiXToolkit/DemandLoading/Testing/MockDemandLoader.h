@@ -39,6 +39,7 @@ class MockDemandLoader : public demandLoading::DemandLoader
                  ( unsigned int deviceIndex, CUstream stream, const demandLoading::DeviceContext& deviceContext ) );
     MOCK_METHOD( void, abort, () );
     MOCK_METHOD( demandLoading::Statistics, getStatistics, (), ( const ) );
+    MOCK_METHOD( demandLoading::DetailedStatistics, getDetailedStatistics, (), ( const ) );
     MOCK_METHOD( std::vector<unsigned int>, getDevices, (), ( const ) );
     MOCK_METHOD( const demandLoading::Options&, getOptions, () );
     MOCK_METHOD( void, enableEviction, ( bool evictionActive ) );
@@ -49,6 +50,7 @@ class MockDemandLoader : public demandLoading::DemandLoader
     MOCK_METHOD( unsigned int, getTextureTilePageId, (unsigned int, unsigned int, unsigned int, unsigned int), ( override ) );
     MOCK_METHOD( unsigned int, getMipTailFirstLevel, (unsigned int), ( override ) );
     MOCK_METHOD( void, loadTextureTile, (CUstream, unsigned int, unsigned int, unsigned int, unsigned int), ( override ) );
+    MOCK_METHOD( void, loadTextureFootprints, (CUstream, unsigned int, const FootprintSample*, size_t), ( override ) );
     MOCK_METHOD( bool, pageResident, (unsigned int), ( override ) );
     MOCK_METHOD( bool, launchPrepare, (CUstream, demandLoading::DeviceContext&), ( override ) );
     MOCK_METHOD( demandLoading::Ticket, processRequests, (CUstream, const demandLoading::DeviceContext&), ( override ) );
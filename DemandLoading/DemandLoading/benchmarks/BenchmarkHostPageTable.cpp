@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only microbenchmark comparing the HostPageTable (flat array with lock-free reads) with the
+// std::map and mutex it replaced in the PagingSystem.  It maps a large number of resident pages,
+// then measures residency queries (as made by the request handlers on every fill) from several
+// threads while another thread stages and remaps pages, and reports the memory used.
+//
+// Usage: benchmarkHostPageTable [numResidentPages] [numReaderThreads]
+
+#include "HostPageTable.h"
+#include "Util/Stopwatch.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+const unsigned int NUM_PAGES = 64 * 1024 * 1024;  // Options::numPages default
+
+// The page table used by the PagingSystem before the HostPageTable.
+class MapPageTable
+{
+  public:
+    void set( unsigned int pageId, const HostPageTableEntry& entry )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_pageTable[pageId] = entry;
+    }
+
+    bool isResident( unsigned int pageId, unsigned long long* entry = nullptr )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        const auto                   p = m_pageTable.find( pageId );
+        const bool                   resident = p != m_pageTable.end() && p->second.resident;
+        if( resident && entry )
+            *entry = p->second.entry;
+        return resident;
+    }
+
+    void stage( unsigned int pageId )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        const auto                   p = m_pageTable.find( pageId );
+        if( p != m_pageTable.end() )
+        {
+            p->second.resident = false;
+            p->second.staged   = true;
+        }
+    }
+
+    // Approximate size of a red-black tree node: three pointers, a color, and the key/value pair.
+    size_t getMemoryUsage() const
+    {
+        return m_pageTable.size() * ( 4 * sizeof( void* ) + sizeof( std::pair<const unsigned int, HostPageTableEntry> ) );
+    }
+
+  private:
+    std::map<unsigned int, HostPageTableEntry> m_pageTable;
+    std::mutex                                 m_mutex;
+};
+
+class FlatPageTable
+{
+  public:
+    FlatPageTable()
+        : m_table( NUM_PAGES )
+    {
+    }
+
+    void set( unsigned int pageId, const HostPageTableEntry& entry ) { m_table.set( pageId, entry ); }
+
+    bool isResident( unsigned int pageId, unsigned long long* entry = nullptr ) const { return m_table.isResident( pageId, entry ); }
+
+    void stage( unsigned int pageId )
+    {
+        m_table.update( pageId, []( HostPageTableEntry& p ) -> HostPageTable::UpdateResult {
+            p.resident = false;
+            p.staged   = true;
+            return HostPageTable::MODIFY;
+        } );
+    }
+
+    size_t getMemoryUsage() const { return m_table.getMemoryUsage(); }
+
+  private:
+    HostPageTable m_table;
+};
+
+template <class Table>
+void runBenchmark( const char* name, const std::vector<unsigned int>& pages, unsigned int numReaders )
+{
+    Table table;
+
+    Stopwatch insertClock;
+    for( unsigned int pageId : pages )
+        table.set( pageId, HostPageTableEntry{pageId, true, false, false} );
+    const double insertTime = insertClock.elapsed();
+
+    // Single threaded lookups, in random order.
+    const unsigned int        numLookups = 4 * 1024 * 1024;
+    std::mt19937              rng( 1 );
+    std::vector<unsigned int> lookups( numLookups );
+    for( unsigned int& pageId : lookups )
+        pageId = pages[rng() % pages.size()];
+
+    Stopwatch    lookupClock;
+    unsigned int numResident = 0;
+    for( unsigned int pageId : lookups )
+        numResident += table.isResident( pageId ) ? 1 : 0;
+    const double lookupTime = lookupClock.elapsed();
+
+    // Concurrent lookups, while a writer stages and remaps pages.
+    std::atomic<bool> done{false};
+    std::thread       writer( [&]() {
+        unsigned int i = 0;
+        while( !done.load( std::memory_order_relaxed ) )
+        {
+            const unsigned int pageId = pages[( i++ * 7919 ) % pages.size()];
+            table.stage( pageId );
+            table.set( pageId, HostPageTableEntry{pageId, true, false, false} );
+        }
+    } );
+    std::vector<std::thread>        readers;
+    std::atomic<unsigned long long> checksum{0};
+    Stopwatch                       concurrentClock;
+    for( unsigned int t = 0; t < numReaders; ++t )
+    {
+        readers.emplace_back( [&, t]() {
+            unsigned long long sum = 0;
+            for( unsigned int i = t; i < numLookups; i += numReaders )
+            {
+                unsigned long long entry = 0;
+                table.isResident( lookups[i], &entry );
+                sum += entry;
+            }
+            checksum += sum;
+        } );
+    }
+    for( std::thread& reader : readers )
+        reader.join();
+    const double concurrentTime = concurrentClock.elapsed();
+    done = true;
+    writer.join();
+
+    // The checksum keeps the lookups from being optimized away.
+    if( numResident != numLookups || checksum == 0 )
+        printf( "%s: error, %u of %u lookups were resident\n", name, numResident, numLookups );
+    printf( "%-6s insert %7.1f ns/page, lookup %6.1f ns, concurrent lookup %6.1f ns (%u readers + 1 writer), memory %7.1f MB\n",
+            name, 1e9 * insertTime / pages.size(), 1e9 * lookupTime / numLookups, 1e9 * concurrentTime / numLookups,
+            numReaders, table.getMemoryUsage() / ( 1024.0 * 1024.0 ) );
+}
+
+}  // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    const unsigned int numResidentPages = argc > 1 ? static_cast<unsigned int>( atoi( argv[1] ) ) : 2 * 1024 * 1024;
+    const unsigned int numReaders       = argc > 2 ? static_cast<unsigned int>( atoi( argv[2] ) ) : 4;
+
+    // Resident pages are clustered (textures occupy contiguous page ranges), but spread over the
+    // whole page table.
+    std::vector<unsigned int> pages;
+    std::mt19937              rng( 0 );
+    while( pages.size() < numResidentPages )
+    {
+        const unsigned int first = rng() % ( NUM_PAGES - 4096 );
+        for( unsigned int i = 0; i < 2048 && pages.size() < numResidentPages; ++i )
+            pages.push_back( first + i );
+    }
+
+    printf( "%u resident pages of %u\n", numResidentPages, NUM_PAGES );
+    runBenchmark<MapPageTable>( "map", pages, numReaders );
+    runBenchmark<FlatPageTable>( "flat", pages, numReaders );
+    return 0;
+}
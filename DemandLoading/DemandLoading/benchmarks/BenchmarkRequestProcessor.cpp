@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only microbenchmark for the WorkStealingRequestProcessor.  Synthetic request handlers
+// busy-wait to simulate the cost of filling samplers, mip tails, and tiles, and record when each
+// request was filled.  The benchmark reports throughput, the latency until all of the samplers in
+// a batch were filled, and the CPU time used per request, for an increasing number of threads.
+//
+// Usage: benchmarkRequestProcessor [numBatches] [requestsPerBatch]
+
+#include "PageTableManager.h"
+#include "RequestHandler.h"
+#include "TicketImpl.h"
+#include "Util/Stopwatch.h"
+#include "WorkStealingRequestProcessor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+// Busy-wait for the specified number of seconds, simulating a request that is bound by
+// decompression or copying rather than by I/O.
+void spin( double seconds )
+{
+    Stopwatch stopwatch;
+    while( stopwatch.elapsed() < seconds )
+    {
+    }
+}
+
+// Synthetic request handler, which spins for a fixed time per request and records the time at
+// which the last request of this handler was filled.
+class SyntheticRequestHandler : public RequestHandler
+{
+  public:
+    SyntheticRequestHandler( const Stopwatch& clock, unsigned int priority, double seconds )
+        : m_clock( clock )
+        , m_priority( priority )
+        , m_seconds( seconds )
+    {
+    }
+
+    void fillRequest( CUstream /*stream*/, unsigned int /*pageId*/ ) override
+    {
+        spin( m_seconds );
+        const double now = m_clock.elapsed();
+        double       prev = m_lastFillTime.load();
+        while( prev < now && !m_lastFillTime.compare_exchange_weak( prev, now ) )
+        {
+        }
+    }
+
+    unsigned int getRequestPriority( unsigned int /*pageId*/ ) override { return m_priority; }
+
+    void   reset() { m_lastFillTime = 0.0; }
+    double lastFillTime() const { return m_lastFillTime.load(); }
+
+  private:
+    const Stopwatch&    m_clock;
+    unsigned int        m_priority;
+    double              m_seconds;
+    std::atomic<double> m_lastFillTime{0.0};
+};
+
+struct Result
+{
+    double requestsPerSecond;
+    double samplerLatency;  // average time until the samplers of a batch were filled (seconds)
+    double cpuPerRequest;   // process CPU time per request (seconds), including idle workers
+};
+
+Result runBenchmark( unsigned int numThreads, unsigned int numBatches, unsigned int requestsPerBatch )
+{
+    const unsigned int                numPages = 1u << 20;
+    std::shared_ptr<PageTableManager> pageTableManager( new PageTableManager( numPages, 1024u ) );
+
+    // Samplers are cheap, mip tails are moderately expensive, and tiles are the most expensive.
+    Stopwatch               clock;
+    SyntheticRequestHandler samplers( clock, REQUEST_PRIORITY_SAMPLER, 2e-6 );
+    SyntheticRequestHandler mipTails( clock, REQUEST_PRIORITY_MIP_TAIL, 10e-6 );
+    SyntheticRequestHandler tiles( clock, REQUEST_PRIORITY_TILE, 20e-6 );
+    const unsigned int      pagesPerHandler = numPages / 4;
+    const unsigned int      samplerPage     = pageTableManager->reserveUnbackedPages( pagesPerHandler, &samplers );
+    const unsigned int      mipTailPage     = pageTableManager->reserveUnbackedPages( pagesPerHandler, &mipTails );
+    const unsigned int      tilePage        = pageTableManager->reserveUnbackedPages( pagesPerHandler, &tiles );
+
+    // Each batch is 10% samplers, 10% mip tails, and 80% tiles, in random order.
+    std::mt19937 rng( 1 );
+    std::vector<unsigned int> pageIds( requestsPerBatch );
+
+    Options options;
+    options.maxThreads          = numThreads;
+    options.maxRequestQueueSize = requestsPerBatch;
+    WorkStealingRequestProcessor processor( pageTableManager, options );
+
+    double             totalSamplerLatency = 0.0;
+    double             totalTime           = 0.0;
+    const std::clock_t startCpu            = std::clock();
+    for( unsigned int batch = 0; batch < numBatches; ++batch )
+    {
+        for( unsigned int i = 0; i < requestsPerBatch; ++i )
+        {
+            const unsigned int kind   = rng() % 10;
+            const unsigned int offset = rng() % pagesPerHandler;
+            pageIds[i] = ( kind == 0 ? samplerPage : kind == 1 ? mipTailPage : tilePage ) + offset;
+        }
+        samplers.reset();
+
+        const double startTime = clock.elapsed();
+        Ticket       ticket    = TicketImpl::create( CUstream{} );
+        processor.setTicket( batch, ticket );
+        processor.addRequests( CUstream{}, batch, pageIds.data(), requestsPerBatch );
+        ticket.wait();
+        const double endTime = clock.elapsed();
+
+        totalSamplerLatency += samplers.lastFillTime() - startTime;
+        totalTime += endTime - startTime;
+    }
+    const double cpuTime = static_cast<double>( std::clock() - startCpu ) / CLOCKS_PER_SEC;
+    processor.stop();
+
+    const double numRequests = static_cast<double>( numBatches ) * requestsPerBatch;
+    return Result{numRequests / totalTime, totalSamplerLatency / numBatches, cpuTime / numRequests};
+}
+
+}  // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    const unsigned int numBatches       = argc > 1 ? static_cast<unsigned int>( atoi( argv[1] ) ) : 20;
+    const unsigned int requestsPerBatch = argc > 2 ? static_cast<unsigned int>( atoi( argv[2] ) ) : 4096;
+    const unsigned int maxThreads       = std::max( 1u, std::thread::hardware_concurrency() );
+
+    printf( "%u batches of %u requests\n", numBatches, requestsPerBatch );
+    printf( "%8s | %14s %15s %17s\n", "threads", "requests/sec", "sampler (ms)", "CPU/request (us)" );
+    for( unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+    {
+        const Result result = runBenchmark( numThreads, numBatches, requestsPerBatch );
+        printf( "%8u | %14.0f %15.3f %17.2f\n", numThreads, result.requestsPerSecond, result.samplerLatency * 1000.0,
+                result.cpuPerRequest * 1.0e6 );
+    }
+    return 0;
+}
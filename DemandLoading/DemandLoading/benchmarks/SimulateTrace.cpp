@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only tool that replays a page reference trace against the TraceSimulator, sweeping the
+// texture memory budget and eviction options, and reports the hit rate, bytes transferred, and
+// evictions for each combination.  No GPU is required.  A synthetic trace (a working set that
+// drifts across a large texture) is used when no trace file is given.
+//
+// Usage: simulateTrace [traceFile] [--texMem=MB,...] [--stagedPages=N,...] [--requestedPages=N,...]
+//                      [--noLru] [--perLaunch]
+
+#include <OptiXToolkit/DemandLoading/TraceSimulator.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+void printUsage( const char* program )
+{
+    printf( "Usage: %s [traceFile] [--texMem=MB,...] [--stagedPages=N,...] [--requestedPages=N,...] [--noLru] [--perLaunch]\n",
+            program );
+}
+
+// Parse a comma separated list of values.
+std::vector<size_t> parseList( const char* arg )
+{
+    std::vector<size_t> values;
+    std::stringstream   stream( arg );
+    std::string         item;
+    while( std::getline( stream, item, ',' ) )
+        values.push_back( static_cast<size_t>( std::strtoull( item.c_str(), nullptr, 10 ) ) );
+    return values;
+}
+
+// A synthetic trace: each launch references a window of tiles that drifts across the texture,
+// plus a few random tiles and the (non-evictable) sampler pages.
+PageTrace makeSyntheticTrace()
+{
+    PageTrace trace;
+    trace.options.numPages            = 1 << 20;
+    trace.options.numPageTableEntries = 1024;
+
+    const unsigned int numLaunches = 200;
+    const unsigned int numSamplers = 16;
+    const unsigned int windowSize  = 2048;
+    const unsigned int drift       = 64;
+    std::mt19937       rng( 7 );
+    for( unsigned int launch = 0; launch < numLaunches; ++launch )
+    {
+        std::vector<unsigned int> pages;
+        for( unsigned int i = 0; i < numSamplers; ++i )
+            pages.push_back( i );
+        const unsigned int first = trace.options.numPageTableEntries + launch * drift;
+        for( unsigned int i = 0; i < windowSize; ++i )
+            pages.push_back( first + i );
+        for( unsigned int i = 0; i < 64; ++i )
+            pages.push_back( trace.options.numPageTableEntries + rng() % ( numLaunches * drift + windowSize ) );
+        trace.launches.push_back( std::move( pages ) );
+    }
+    return trace;
+}
+
+struct Totals
+{
+    size_t referenced = 0;
+    size_t hits       = 0;
+    size_t dropped    = 0;
+    size_t restored   = 0;
+    size_t loaded     = 0;
+    size_t failed     = 0;
+    size_t bytes      = 0;
+    size_t evictions  = 0;
+    size_t maxTiles   = 0;
+};
+
+}  // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    std::string         traceFile;
+    std::vector<size_t> texMemMB{0};
+    std::vector<size_t> stagedPages;
+    std::vector<size_t> requestedPages;
+    bool                useLruTable = true;
+    bool                perLaunch   = false;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        const char* arg = argv[i];
+        if( strncmp( arg, "--texMem=", 9 ) == 0 )
+            texMemMB = parseList( arg + 9 );
+        else if( strncmp( arg, "--stagedPages=", 14 ) == 0 )
+            stagedPages = parseList( arg + 14 );
+        else if( strncmp( arg, "--requestedPages=", 17 ) == 0 )
+            requestedPages = parseList( arg + 17 );
+        else if( strcmp( arg, "--noLru" ) == 0 )
+            useLruTable = false;
+        else if( strcmp( arg, "--perLaunch" ) == 0 )
+            perLaunch = true;
+        else if( arg[0] != '-' && traceFile.empty() )
+            traceFile = arg;
+        else
+        {
+            printUsage( argv[0] );
+            return 1;
+        }
+    }
+
+    PageTrace trace;
+    try
+    {
+        trace = traceFile.empty() ? makeSyntheticTrace() : readPageTrace( traceFile );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "%s\n", e.what() );
+        return 1;
+    }
+    if( stagedPages.empty() )
+        stagedPages.push_back( trace.options.maxStagedPages );
+    if( requestedPages.empty() )
+        requestedPages.push_back( trace.options.maxRequestedPages );
+
+    printf( "%s: %zu launches\n\n", traceFile.empty() ? "synthetic trace" : traceFile.c_str(), trace.launches.size() );
+    printf( "%10s %12s %15s %9s %10s %10s %10s %10s %12s %10s\n", "texMem(MB)", "stagedPages", "requestedPages",
+            "hitRate", "dropped", "restored", "failed", "evictions", "transfer(MB)", "maxTiles" );
+
+    for( size_t texMem : texMemMB )
+    {
+        for( size_t staged : stagedPages )
+        {
+            for( size_t requested : requestedPages )
+            {
+                Options options            = trace.options;
+                options.maxTexMemPerDevice = texMem << 20;
+                options.maxStagedPages     = static_cast<unsigned int>( staged );
+                options.maxRequestedPages  = static_cast<unsigned int>( requested );
+                options.useLruTable        = useLruTable;
+
+                TraceSimulator simulator( options );
+                Totals         totals;
+                for( size_t launch = 0; launch < trace.launches.size(); ++launch )
+                {
+                    const SimulatedLaunchStatistics stats = simulator.simulateLaunch( trace.launches[launch] );
+                    totals.referenced += stats.numReferencedPages;
+                    totals.hits += stats.numHits;
+                    totals.dropped += stats.numDroppedRequests;
+                    totals.restored += stats.numRestoredPages;
+                    totals.loaded += stats.numTilesLoaded;
+                    totals.failed += stats.numFailedLoads;
+                    totals.bytes += stats.bytesTransferred;
+                    totals.evictions += stats.numEvictions;
+                    totals.maxTiles = std::max<size_t>( totals.maxTiles, stats.numResidentTiles );
+                    if( perLaunch )
+                    {
+                        printf( "  launch %zu: refs %u, hits %u, requests %u, dropped %u, loaded %u, staged %u, "
+                                "evictions %u, resident %u, threshold %u\n",
+                                launch, stats.numReferencedPages, stats.numHits, stats.numRequests,
+                                stats.numDroppedRequests, stats.numTilesLoaded, stats.numStagedPages,
+                                stats.numEvictions, stats.numResidentTiles, stats.lruThreshold );
+                    }
+                }
+
+                const double hitRate = totals.referenced ? static_cast<double>( totals.hits ) / totals.referenced : 1.0;
+                printf( "%10zu %12zu %15zu %9.4f %10zu %10zu %10zu %10zu %12.1f %10zu\n", texMem, staged, requested,
+                        hitRate, totals.dropped, totals.restored, totals.failed, totals.evictions,
+                        totals.bytes / ( 1024.0 * 1024.0 ), totals.maxTiles );
+            }
+        }
+    }
+    return 0;
+}
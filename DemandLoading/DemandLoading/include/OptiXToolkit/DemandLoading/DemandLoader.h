@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -8,7 +8,9 @@
 /// Primary interface of the Demand Loading library.
 
 #include <OptiXToolkit/DemandLoading/DemandTexture.h>
+#include <OptiXToolkit/DemandLoading/DetailedStatistics.h>
 #include <OptiXToolkit/DemandLoading/DeviceContext.h>
+#include <OptiXToolkit/DemandLoading/FootprintTiles.h>
 #include <OptiXToolkit/DemandLoading/Options.h>
 #include <OptiXToolkit/DemandLoading/Resource.h>
 #include <OptiXToolkit/DemandLoading/SparseTextureDevices.h>
@@ -97,6 +99,11 @@ class DemandLoader
     /// the given stream.
     virtual void loadTextureTile( CUstream stream, unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY ) = 0;
 
+    /// Load the texture tiles that tex2DGrad requests for a batch of samples (see getFootprintTiles),
+    /// skipping resident tiles.  This can be used to fill the cache before the first launch.  The
+    /// caller must ensure that the current CUDA context matches the given stream.
+    virtual void loadTextureFootprints( CUstream stream, unsigned int textureId, const FootprintSample* samples, size_t numSamples ) = 0;
+
     /// Return true if the requested page is resident on the device corresponding to the current
     /// CUDA context.
     virtual bool pageResident( unsigned int pageId ) = 0;
@@ -124,6 +131,10 @@ class DemandLoader
     /// Get time/space stats for the DemandLoader.
     virtual Statistics getStatistics() const = 0;
 
+    /// Get the stats for the DemandLoader, plus latency histograms for each stage of request
+    /// processing and per-texture read counts.  See toJson() in DetailedStatistics.h for export.
+    virtual DetailedStatistics getDetailedStatistics() const = 0;
+
     /// Get the current options
     virtual const Options& getOptions() const = 0;
 
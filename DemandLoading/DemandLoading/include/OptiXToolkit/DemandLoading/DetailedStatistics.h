@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/DemandLoading/Statistics.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace demandLoading {
+
+/// Stages of request processing whose latencies are recorded by the DemandLoader.
+enum LatencyStage
+{
+    STAGE_QUEUE_WAIT,         ///< time a run of page requests waits in the request queue before a worker takes it
+    STAGE_TILE_ALLOCATION,    ///< device tile block allocation (per tile, or per batch of tiles)
+    STAGE_TRANSFER_BUFFER,    ///< transfer buffer (pinned or device memory) allocation
+    STAGE_READ_TILE,          ///< ImageSource read and decode of a tile, a batch of tiles, or a mip tail
+    STAGE_FILL_TILE,          ///< copy of a tile or mip tail from the transfer buffer to the texture
+    STAGE_PULL_REQUESTS,      ///< host side of PagingSystem::pullRequests
+    STAGE_PROCESS_REQUESTS,   ///< host callback that restores staged pages, enqueues requests, and stages stale pages
+    STAGE_STAGE_STALE_PAGES,  ///< eviction staging (included in STAGE_PROCESS_REQUESTS)
+    STAGE_PUSH_MAPPINGS,      ///< host side of PagingSystem::pushMappings
+    NUM_LATENCY_STAGES
+};
+
+/// Return the name of a latency stage, as used in JSON output (e.g. "queueWait").
+const char* getLatencyStageName( LatencyStage stage );
+
+/// Histogram of latencies with power of two buckets.  Bucket 0 counts latencies under one
+/// microsecond, and bucket i > 0 counts latencies in [2^(i-1), 2^i) microseconds.  The last bucket
+/// also counts anything longer.
+struct LatencyHistogram
+{
+    static const unsigned int NUM_BUCKETS = 32;
+
+    uint64_t count;      // number of samples
+    double   totalTime;  // seconds
+    double   maxTime;    // seconds
+    uint64_t buckets[NUM_BUCKETS];
+
+    /// Return the bucket for a latency in seconds.
+    static unsigned int getBucket( double seconds );
+
+    /// Return the upper bound of a bucket in seconds.
+    static double getBucketUpperBound( unsigned int bucket );
+
+    /// Add a sample, in seconds.
+    void record( double seconds );
+
+    /// Add the samples from another histogram.
+    void merge( const LatencyHistogram& other );
+
+    /// Return the mean latency in seconds (zero if there are no samples).
+    double getMeanTime() const;
+
+    /// Return an upper bound on the given percentile (0 to 1) in seconds: the upper bound of the
+    /// bucket containing it, clamped to maxTime.
+    double getPercentile( double fraction ) const;
+};
+
+/// Per-texture statistics.  The read counts are those of the texture's ImageSource, which is
+/// shared by texture variants.
+struct TextureStatistics
+{
+    unsigned int textureId;
+    size_t       numTilesRead;
+    size_t       numBytesRead;
+    double       readTime;
+};
+
+/// Snapshot of the DemandLoader statistics, plus per-stage latency histograms and per-texture
+/// read counts.  See DemandLoader::getDetailedStatistics.
+struct DetailedStatistics
+{
+    Statistics                     totals;
+    LatencyHistogram               stages[NUM_LATENCY_STAGES];
+    std::vector<TextureStatistics> textures;  // textures that have read tiles, in texture id order
+};
+
+/// Serialize detailed statistics as a JSON object, for export to external metrics tools.
+std::string toJson( const DetailedStatistics& stats );
+
+}  // namespace demandLoading
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// \file FootprintTiles.h
+/// Host-side computation of the texture tiles requested by texture samples, for pre-warming the
+/// texture cache before the first launch (e.g. from the texture coordinates and gradients of a
+/// previous low resolution pass).
+
+#include <OptiXToolkit/DemandLoading/TextureSampler.h>
+
+#include <vector_types.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace demandLoading {
+
+/// A texture sample, with the same arguments as tex2DGrad: texture coordinates and their gradients.
+struct FootprintSample
+{
+    float  x;
+    float  y;
+    float2 ddx;
+    float2 ddy;
+};
+
+/// Get the tile pages of a sparse texture that tex2DGrad requests for a batch of samples, as a
+/// sorted list of page ids without duplicates.  The tile selection follows the software footprint
+/// in Texture2D.h, including the extra mip level requested when the mip level is near an integer
+/// boundary, so it is a superset of the tiles requested with hardware footprints.  The mip tail is
+/// reported as the first page of the texture (sampler.startPage).  Samples are processed in blocks
+/// on up to numThreads threads (0 means std::thread::hardware_concurrency).  Returns an empty list
+/// for dense textures.
+std::vector<unsigned int> getFootprintTiles( const TextureSampler& sampler, const FootprintSample* samples, size_t numSamples, unsigned int numThreads = 0 );
+
+}  // namespace demandLoading
@@ -1,8 +1,55 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #pragma once
 
+#include <algorithm>
+
 const unsigned int MAX_LRU_VAL           = 14u;
 const unsigned int NON_EVICTABLE_LRU_VAL = 15u;
+const unsigned int MIN_LRU_THRESHOLD     = 2u;
+
+#ifndef DOXYGEN_SKIP
+
+#if defined( __CUDACC__ )
+#define LRU_INLINE __host__ __device__ __forceinline__
+#else
+#define LRU_INLINE inline
+#endif
+
+namespace demandLoading {
+
+LRU_INLINE unsigned char lruInc( unsigned int count, unsigned int launchNum )
+{
+    // Logarithmic increment. Slows down as count increases, assuming launchNum increases by 1 each time.
+    // If 0 is always passed in for launchNum, the count will increment every launch.
+    unsigned int mask = ( 1u << count ) - 1;
+    return ( ( mask & launchNum ) == 0 && count < MAX_LRU_VAL ) ? count + 1u : count;
+}
+
+/// Return the updated lru threshold, given the number of stale pages returned from the device, the
+/// number requested, and the median lru value of the returned pages.
+inline unsigned int updateLruThreshold( unsigned int lruThreshold,
+                                        unsigned int returnedStalePages,
+                                        unsigned int requestedStalePages,
+                                        unsigned int medianLruVal )
+{
+    // Don't change the value if no stale pages were requested
+    if( requestedStalePages == 0 )
+        return lruThreshold;
+
+    // Heuristic to update the lruThreshold. The basic idea is to aggressively reduce the threshold
+    // if not enough stale pages are returned, but only gradually increase the threshold if it is too low.
+    if( returnedStalePages < requestedStalePages / 2 )
+        lruThreshold -= std::min( lruThreshold - MIN_LRU_THRESHOLD, 4u );
+    else if( returnedStalePages < requestedStalePages )
+        lruThreshold -= std::min( lruThreshold - MIN_LRU_THRESHOLD, 2u );
+    else if( medianLruVal > lruThreshold )
+        lruThreshold++;
+    return lruThreshold;
+}
+
+}  // namespace demandLoading
+
+#endif  // ndef DOXYGEN_SKIP
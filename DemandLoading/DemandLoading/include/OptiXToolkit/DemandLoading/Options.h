@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -31,11 +31,13 @@ struct Options
     bool useSmallTextureOptimization = false;  ///< whether to use dense textures for very small textures
     bool useCascadingTextureSizes    = false;  ///< whether to use cascading texture sizes
     bool coalesceWhiteBlackTiles     = false;  ///< whether to use the same backing store for all white/black tiles
+    bool coalesceDuplicateTiles      = false;  ///< whether to use the same backing store for tiles with identical contents
     bool coalesceDuplicateImages     = false;  ///< whether to coalesce duplicate images
 
     // Memory limits
     size_t maxTexMemPerDevice = 0;  ///< texture to allocate per device (in MB) before starting eviction (0 is unlimited)
     size_t maxPinnedMemory = 64 * 1024 * 1024;  ///< max pinned memory to use for data transfer between host and device
+    size_t maxHostTileCacheMemory = 0;  ///< host memory to retain tiles read from images, for refilling evicted tiles (0 disables)
 
     // Eviction
     unsigned int maxStalePages       = 8192;  ///< max stale (resident but not used) pages to pull from device in processRequests
@@ -46,6 +48,10 @@ struct Options
     bool useLruTable                 = true;  ///< Whether to use LRU table, or randomized eviction
     bool evictionActive              = true;  ///< whether eviction is active. (turning it off speeds up texture ops)
 
+    // Prefetching
+    unsigned int maxPrefetchPages = 0;  ///< max speculative tile requests per launch (neighbors, parents, motion); 0 disables prefetching
+    unsigned int prefetchHistory  = 4;  ///< number of previous launches used to detect motion for prefetching
+
     // Concurrency
     unsigned int maxThreads = 0;  ///< max threads for processing requests. (0 means std::thread::hardware_concurrency)
 
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,14 +13,6 @@ namespace demandLoading {
 
 #ifndef DOXYGEN_SKIP
 
-__device__ __forceinline__ unsigned char lruInc( unsigned int count, unsigned int launchNum )
-{
-    // Logarithmic increment. Slows down as count increases, assuming launchNum increases by 1 each time.
-    // If 0 is always passed in for launchNum, the count will increment every launch.
-    unsigned int mask = ( 1u << count ) - 1;
-    return ( ( mask & launchNum ) == 0 && count < MAX_LRU_VAL ) ? count + 1u : count;
-}
-
 __device__ inline void atomicSetBit( unsigned int bitIndex, unsigned int* bitVector )
 {
     const unsigned int wordIndex = bitIndex / 32;
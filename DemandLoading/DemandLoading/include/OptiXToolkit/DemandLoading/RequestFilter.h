@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,6 +13,17 @@ class RequestFilter
   public:
     virtual ~RequestFilter() { }
     virtual std::vector<unsigned int> filter( const unsigned int* requests, unsigned int numRequests ) = 0;
+
+    /// Filter a batch of requests, and append speculative requests (e.g. prefetches) to
+    /// prefetchRequests.  Speculative requests are filled at lower priority than the filtered
+    /// requests, only if the request queue has room, and are not tracked by the request ticket.
+    /// The default implementation makes no speculative requests.
+    virtual std::vector<unsigned int> filterAndPrefetch( const unsigned int* requests,
+                                                         unsigned int        numRequests,
+                                                         std::vector<unsigned int>& /*prefetchRequests*/ )
+    {
+        return filter( requests, numRequests );
+    }
 };
 
 }  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -22,6 +22,14 @@ struct Statistics
     size_t deviceMemoryUsed;
     size_t bytesTransferredToDevice;
     unsigned int numEvictions;
+    size_t numSharedTileBlocks;   // tile blocks referenced by more than one tile (coalesceDuplicateTiles)
+    size_t numSharedTiles;        // resident tiles backed by those blocks
+    double tileDedupRatio;        // numSharedTiles / numSharedTileBlocks (1 if no tiles are shared)
+    size_t hostTileCacheHits;     // tiles refilled from the host tile cache rather than read from the image
+    size_t hostTileCacheMisses;   // tiles not found in the host tile cache
+    size_t hostTileCacheEvictions;  // tiles discarded from the host tile cache to stay within its budget
+    size_t hostTileCacheBytes;    // tile data held by the host tile cache
+    double hostTileCacheHitRate;  // hostTileCacheHits / ( hostTileCacheHits + hostTileCacheMisses ) (0 if no lookups)
 };
 
 }  // namespace demandLoading
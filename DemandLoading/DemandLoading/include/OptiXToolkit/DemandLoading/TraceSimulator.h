@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// \file TraceSimulator.h
+/// Host-only simulation of demand loading, for sizing the texture cache and eviction options offline.
+
+#include <OptiXToolkit/DemandLoading/LRU.h>
+#include <OptiXToolkit/DemandLoading/Options.h>
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace demandLoading {
+
+/// A page reference trace: the pages referenced by each launch, in order.  Pages below
+/// Options::numPageTableEntries are treated as non-evictable resources (samplers, base colors),
+/// and other pages as 64 KB texture tiles.
+struct PageTrace
+{
+    Options                                options;   ///< options the trace was recorded with
+    std::vector<std::vector<unsigned int>> launches;  ///< pages referenced by each launch
+};
+
+/// Read a trace file.  The file has the same record layout as trace files written by the demand
+/// loader (options, textures, and request batches).  Each request batch for the given device is one
+/// launch.  Texture records are skipped.  Throws an exception on error.
+PageTrace readPageTrace( const std::string& filename, unsigned int deviceIndex = 0 );
+
+/// Write a trace file that can be read by readPageTrace, for device 0.  Throws an exception on error.
+void writePageTrace( const std::string& filename, const PageTrace& trace );
+
+/// Statistics for a single simulated launch.
+struct SimulatedLaunchStatistics
+{
+    unsigned int numReferencedPages = 0;  ///< distinct pages referenced by the launch
+    unsigned int numHits            = 0;  ///< referenced pages that were resident
+    unsigned int numRequests        = 0;  ///< page requests pulled from the device (at most maxRequestedPages)
+    unsigned int numDroppedRequests = 0;  ///< misses beyond maxRequestedPages, requested again next launch
+    unsigned int numRestoredPages   = 0;  ///< requests satisfied by restoring a staged page (second chance)
+    unsigned int numTilesLoaded     = 0;  ///< tiles filled from the image sources
+    unsigned int numFailedLoads     = 0;  ///< tiles that could not be loaded for lack of memory
+    size_t       bytesTransferred   = 0;  ///< bytes copied to the device
+    unsigned int numStalePages      = 0;  ///< stale pages pulled from the device
+    unsigned int numStagedPages     = 0;  ///< pages staged for eviction
+    unsigned int numEvictions       = 0;  ///< staged tiles whose memory was reused
+    unsigned int numResidentTiles   = 0;  ///< resident tiles after the launch
+    unsigned int lruThreshold       = 0;  ///< lru threshold after the launch
+
+    /// Fraction of referenced pages that were resident.
+    double hitRate() const { return numReferencedPages ? static_cast<double>( numHits ) / numReferencedPages : 1.0; }
+};
+
+/// TraceSimulator replays page references against a host-side model of a single device: the page
+/// table residency bits, the 4 bit LRU counters (updated with lruInc, and thresholded with
+/// updateLruThreshold, exactly as the paging kernels and PagingSystem do), the staged page lists,
+/// and the texture tile memory budget (maxTexMemPerDevice).  Each simulated launch follows
+/// processRequests: pull requests and stale pages, restore staged pages that were requested, stage
+/// stale pages, fill the requests (freeing staged tiles when the budget is reached), and push the
+/// new mappings.  No CUDA calls are made.
+///
+/// The model assumes every request is filled in the launch it is made, that each tile page holds
+/// one 64 KB tile (mip tails are modeled as single tiles), and that the tile pool grows in whole
+/// tiles up to the budget.
+class TraceSimulator
+{
+  public:
+    /// Construct a simulator with the given options.
+    explicit TraceSimulator( const Options& options );
+
+    /// Simulate a launch that references the given pages.
+    SimulatedLaunchStatistics simulateLaunch( const unsigned int* pageIds, unsigned int numPageIds );
+
+    /// Simulate a launch that references the given pages.
+    SimulatedLaunchStatistics simulateLaunch( const std::vector<unsigned int>& pageIds )
+    {
+        return simulateLaunch( pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    }
+
+    /// Return the options being simulated.
+    const Options& getOptions() const { return m_options; }
+
+  private:
+    struct Page
+    {
+        unsigned int lruVal;
+        bool         resident;      // resident on the device
+        bool         staged;        // staged, and not restored by second chance
+        bool         inStagedList;  // in a staged list, whether restored or not
+    };
+
+    struct StalePage
+    {
+        unsigned int pageId;
+        unsigned int lruVal;
+    };
+
+    // Pages staged by a launch.  They can be freed once the launch has pushed its mappings.
+    struct StagedPageList
+    {
+        unsigned int             launchNum;
+        std::deque<unsigned int> pageIds;
+    };
+
+    Options                      m_options;
+    std::map<unsigned int, Page> m_pageTable;  // mapped pages (resident or staged)
+    std::deque<StagedPageList>   m_stagedPages;
+    std::mt19937                 m_rng;
+    unsigned int                 m_launchNum      = 0;
+    unsigned int                 m_lruThreshold   = MIN_LRU_THRESHOLD;
+    bool                         m_evictionActive = false;
+    size_t                       m_maxTiles;          // tile budget
+    size_t                       m_numTiles     = 0;  // tiles allocated, in use or free
+    size_t                       m_numFreeTiles = 0;
+
+    bool   isTile( unsigned int pageId ) const { return pageId >= m_options.numPageTableEntries; }
+    size_t getNumStagedPages() const;
+    bool   needTilesFreed() const;
+    bool   freeStagedPage( SimulatedLaunchStatistics& stats );
+    bool   allocateTile();
+};
+
+/// Simulate a whole trace with the given options, returning the statistics for each launch.
+std::vector<SimulatedLaunchStatistics> simulatePageTrace( const PageTrace& trace, const Options& options );
+
+}  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -6,6 +6,7 @@
 
 #include "CascadeRequestFilter.h"
 #include "DemandPageLoaderImpl.h"
+#include "PrefetchRequestFilter.h"
 #include "Util/ContextSaver.h"
 #include "Util/NVTXProfiling.h"
 #include "Util/Stopwatch.h"
@@ -123,7 +124,7 @@ std::shared_ptr<demandLoading::Options> configure( demandLoading::Options option
 
 DemandLoaderImpl::DemandLoaderImpl( const Options& options )
     : m_options( configure( options ) )
-    , m_pageTableManager( std::make_shared<PageTableManager>( m_options->numPages, m_options->numPageTableEntries ) )
+    , m_pageTableManager( std::make_shared<PageTableManager>( m_options->numPages, m_options->numPageTableEntries, /*directLookup=*/true ) )
     , m_requestProcessor( m_pageTableManager, options )
     , m_pageLoader( new DemandPageLoaderImpl( m_pageTableManager, &m_requestProcessor, m_options ) )
     , m_samplerRequestHandler( this )
@@ -133,6 +134,12 @@ DemandLoaderImpl::DemandLoaderImpl( const Options& options )
     // The demand loader is for the current cuda context
     OTK_ERROR_CHECK( cuCtxGetCurrent( &m_cudaContext ) );
 
+    m_requestProcessor.setLatencyRecorder( &m_latencyRecorder );
+
+    if( m_options->maxHostTileCacheMemory > 0 )
+        m_hostTileCache.reset( new HostTileCache( m_options->maxHostTileCacheMemory ) );
+    m_pageLoader->getPagingSystem()->setLatencyRecorder( &m_latencyRecorder );
+
     // Reserve pages in the sampler request handler for all possible textures.
     m_samplerRequestHandler.setPageRange( 0, m_options->numPageTableEntries );
 
@@ -147,6 +154,22 @@ DemandLoaderImpl::DemandLoaderImpl( const Options& options )
         CascadeRequestFilter* requestFilter = new CascadeRequestFilter( cascadeStartPage, cascadeStartPage + numCascadePages, this );
         m_requestProcessor.setRequestFilter( std::shared_ptr<RequestFilter>( requestFilter ) );
     }
+
+    // Prefetch tiles near the requested tiles, applying the cascade filter (if any) first.
+    if( m_options->maxPrefetchPages > 0 )
+    {
+        auto lookupSampler = [this]( unsigned int pageId ) -> const TextureSampler* {
+            // Texture tile pages are only reserved once the texture is initialized.
+            TextureRequestHandler* handler = dynamic_cast<TextureRequestHandler*>( m_pageTableManager->getRequestHandler( pageId ) );
+            if( !handler )
+                return nullptr;
+            const TextureSampler& sampler = handler->getTexture()->getSampler();
+            return sampler.desc.isSparseTexture ? &sampler : nullptr;
+        };
+        auto isResident = [this]( unsigned int pageId ) { return m_pageLoader->getPagingSystem()->isResident( pageId ); };
+        m_requestProcessor.setRequestFilter( std::make_shared<PrefetchRequestFilter>( *m_options, lookupSampler, isResident,
+                                                                                      m_requestProcessor.getRequestFilter() ) );
+    }
 }
 
 DemandLoaderImpl::~DemandLoaderImpl()
@@ -356,6 +379,10 @@ void DemandLoaderImpl::replaceTexture( CUstream
     if( !migrateTiles )
         unloadTextureTiles( textureId );
 
+    // Tiles cached from the old image are stale.
+    if( m_hostTileCache )
+        m_hostTileCache->removeTexture( textureId );
+
     std::unique_lock<std::mutex> lock( m_mutex );
 
     // Copy the old sampler (for migrating tiles), and replace the texture
@@ -383,6 +410,8 @@ void DemandLoaderImpl::replaceTexture( CUstream
         {
             const TextureDescriptor& variantDesc = m_textures.at( variantId )->getDescriptor();
             m_textures.at( variantId )->setImage( variantDesc, image );
+            if( m_hostTileCache )
+                m_hostTileCache->removeTexture( variantId );
             m_samplerRequestHandler.loadPage( stream, variantId, true );
             if( !migrateTiles )
                 m_samplerRequestHandler.loadPage( stream, samplerIdToBaseColorId( variantId, getOptions().maxTextures ), true );
@@ -441,6 +470,24 @@ void DemandLoaderImpl::loadTextureTile( CUstream stream, unsigned int textureId,
     m_textures[textureId]->getRequestHandler()->loadPage( stream, pageId, true );
 }
 
+void DemandLoaderImpl::loadTextureFootprints( CUstream stream, unsigned int textureId, const FootprintSample* samples, size_t numSamples )
+{
+    OTK_ASSERT_CONTEXT_IS( m_cudaContext );
+    OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+    initTexture( stream, textureId );
+    DemandTextureImpl* texture = m_textures.at( textureId ).get();
+    if( !texture->useSparseTexture() )
+        return;  // Dense textures are loaded with the sampler.
+
+    // Fill the non-resident tiles as a single batch, so that the tiles are read in runs.
+    std::vector<unsigned int> pageIds = getFootprintTiles( texture->getSampler(), samples, numSamples, m_options->maxThreads );
+    PagingSystem*             pagingSystem = m_pageLoader->getPagingSystem();
+    pageIds.erase( std::remove_if( pageIds.begin(), pageIds.end(),
+                                   [pagingSystem]( unsigned int pageId ) { return pagingSystem->isResident( pageId ); } ),
+                   pageIds.end() );
+    texture->getRequestHandler()->fillRequests( stream, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+}
+
 bool DemandLoaderImpl::pageResident( unsigned int pageId )
 {
     PagingSystem* pagingSystem = m_pageLoader->getPagingSystem();
@@ -572,6 +619,24 @@ Statistics DemandLoaderImpl::getStatistics() const
     stats.numTextures           = m_textures.size();
     stats.requestProcessingTime = m_pageLoader->getTotalProcessingTime();
     stats.deviceMemoryUsed      = getDeviceMemoryManager()->getTotalDeviceMemory();
+    stats.tileDedupRatio        = 1.0;
+    if( TileDeduplicator* deduplicator = getDeviceMemoryManager()->getTileDeduplicator() )
+    {
+        stats.numSharedTileBlocks = deduplicator->getNumSharedBlocks();
+        stats.numSharedTiles      = deduplicator->getNumSharedReferences();
+        if( stats.numSharedTileBlocks > 0 )
+            stats.tileDedupRatio = static_cast<double>( stats.numSharedTiles ) / stats.numSharedTileBlocks;
+    }
+    if( m_hostTileCache )
+    {
+        stats.hostTileCacheHits      = m_hostTileCache->getNumHits();
+        stats.hostTileCacheMisses    = m_hostTileCache->getNumMisses();
+        stats.hostTileCacheEvictions = m_hostTileCache->getNumEvictions();
+        stats.hostTileCacheBytes     = m_hostTileCache->getNumResidentBytes();
+        if( stats.hostTileCacheHits + stats.hostTileCacheMisses > 0 )
+            stats.hostTileCacheHitRate =
+                static_cast<double>( stats.hostTileCacheHits ) / ( stats.hostTileCacheHits + stats.hostTileCacheMisses );
+    }
 
     // Multiple textures can share the same ImageSource. Use a set to avoid duplicate counting.
     std::set<imageSource::ImageSource*> images;
@@ -588,6 +653,25 @@ Statistics DemandLoaderImpl::getStatistics() const
     return stats;
 }
 
+DetailedStatistics DemandLoaderImpl::getDetailedStatistics() const
+{
+    DetailedStatistics stats{};
+    stats.totals = getStatistics();
+    m_latencyRecorder.getHistograms( stats.stages );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    for( const auto& texture : m_textures )
+    {
+        DemandTextureImpl* tex = texture.second.get();
+        std::shared_ptr<imageSource::ImageSource> image = tex ? tex->getImage() : nullptr;
+        if( !image || image->getNumTilesRead() == 0 )
+            continue;
+        stats.textures.push_back( TextureStatistics{texture.first, image->getNumTilesRead(), image->getNumBytesRead(),
+                                                    image->getTotalReadTime()} );
+    }
+    return stats;
+}
+
 void DemandLoaderImpl::enableEviction( bool evictionActive )
 {
     m_pageLoader->enableEviction( evictionActive );
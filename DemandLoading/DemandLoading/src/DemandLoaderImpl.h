@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -7,18 +7,20 @@
 #include <OptiXToolkit/DemandLoading/DemandLoader.h>
 
 #include "DemandPageLoaderImpl.h"
+#include "Memory/HostTileCache.h"
 #include <OptiXToolkit/Memory/Allocators.h>
 #include <OptiXToolkit/Memory/MemoryPool.h>
 #include <OptiXToolkit/Memory/RingSuballocator.h>
 #include "PageTableManager.h"
 #include "PagingSystem.h"
-#include "ThreadPoolRequestProcessor.h"
 #include "ResourceRequestHandler.h"
 #include "Textures/DemandTextureImpl.h"
 #include "Textures/SamplerRequestHandler.h"
 #include "Textures/CascadeRequestHandler.h"
 #include <OptiXToolkit/DemandLoading/TextureCascade.h>
 #include "TransferBufferDesc.h"
+#include "Util/LatencyRecorder.h"
+#include "WorkStealingRequestProcessor.h"
 
 #include <cuda.h>
 
@@ -103,6 +105,10 @@ class DemandLoaderImpl : public DemandLoader
     /// the given stream.
     void loadTextureTile( CUstream stream, unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY ) override;
 
+    /// Load the texture tiles that tex2DGrad requests for a batch of samples, skipping resident
+    /// tiles.  The caller must ensure that the current CUDA context matches the given stream.
+    void loadTextureFootprints( CUstream stream, unsigned int textureId, const FootprintSample* samples, size_t numSamples ) override;
+
     /// Return true if the requested page is resident on the device corresponding to the current
     /// CUDA context.
     bool pageResident( unsigned int pageId ) override;
@@ -128,6 +134,9 @@ class DemandLoaderImpl : public DemandLoader
     /// Get time/space stats for the DemandLoader.
     Statistics getStatistics() const override;
 
+    /// Get the statistics, plus per-stage latency histograms and per-texture read counts.
+    DetailedStatistics getDetailedStatistics() const override;
+
     /// Get the demand loading configuration options.
     const Options& getOptions() const override { return *m_options; }
 
@@ -152,6 +161,12 @@ class DemandLoaderImpl : public DemandLoader
     /// Get the PageTableManager.
     PageTableManager* getPageTableManager();
 
+    /// Get the cache of tiles read from images, or null if maxHostTileCacheMemory is zero.
+    HostTileCache* getHostTileCache() { return m_hostTileCache.get(); }
+
+    /// Get the recorder for per-stage request processing latencies.
+    LatencyRecorder* getLatencyRecorder() { return &m_latencyRecorder; }
+
     /// Free some staged tiles if there are some that are ready
     void freeStagedTiles( CUstream stream );
 
@@ -184,8 +199,9 @@ class DemandLoaderImpl : public DemandLoader
     OptixDeviceContext       m_optixContext; // The optix context
     bool                     m_isActive = false;  // Controls whether pullRequests kernel is launched.
 
+    LatencyRecorder                       m_latencyRecorder;   // Declared first, since the request processor records into it.
     std::shared_ptr<PageTableManager>     m_pageTableManager;  // Allocates ranges of virtual pages.
-    ThreadPoolRequestProcessor            m_requestProcessor;  // Asynchronously processes page requests.
+    WorkStealingRequestProcessor          m_requestProcessor;  // Asynchronously processes page requests.
     std::unique_ptr<DemandPageLoaderImpl> m_pageLoader;
 
     std::map<unsigned int, std::unique_ptr<DemandTextureImpl>> m_textures; // demand-loaded textures, indexed by textureId
@@ -197,6 +213,8 @@ class DemandLoaderImpl : public DemandLoader
 
     otk::MemoryPool<otk::DeviceAsyncAllocator, otk::RingSuballocator> m_deviceTransferPool;
 
+    std::unique_ptr<HostTileCache> m_hostTileCache;  // null if maxHostTileCacheMemory is zero.
+
     std::vector<std::unique_ptr<ResourceRequestHandler>> m_resourceRequestHandlers;  // Request handlers for arbitrary resources.
 
     unsigned int m_ticketId{};
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/DemandLoading/DetailedStatistics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <locale>
+#include <sstream>
+
+namespace demandLoading {
+
+const unsigned int LatencyHistogram::NUM_BUCKETS;
+
+const char* getLatencyStageName( LatencyStage stage )
+{
+    switch( stage )
+    {
+        case STAGE_QUEUE_WAIT:
+            return "queueWait";
+        case STAGE_TILE_ALLOCATION:
+            return "tileAllocation";
+        case STAGE_TRANSFER_BUFFER:
+            return "transferBuffer";
+        case STAGE_READ_TILE:
+            return "readTile";
+        case STAGE_FILL_TILE:
+            return "fillTile";
+        case STAGE_PULL_REQUESTS:
+            return "pullRequests";
+        case STAGE_PROCESS_REQUESTS:
+            return "processRequests";
+        case STAGE_STAGE_STALE_PAGES:
+            return "stageStalePages";
+        case STAGE_PUSH_MAPPINGS:
+            return "pushMappings";
+        case NUM_LATENCY_STAGES:
+            break;
+    }
+    return "unknown";
+}
+
+unsigned int LatencyHistogram::getBucket( double seconds )
+{
+    const double microseconds = seconds * 1.0e6;
+    if( !( microseconds >= 1.0 ) )
+        return 0;
+    if( microseconds >= std::ldexp( 1.0, NUM_BUCKETS - 2 ) )
+        return NUM_BUCKETS - 1;
+    int exponent;
+    std::frexp( microseconds, &exponent );  // microseconds is in [2^(exponent-1), 2^exponent)
+    return static_cast<unsigned int>( exponent );
+}
+
+double LatencyHistogram::getBucketUpperBound( unsigned int bucket )
+{
+    return std::ldexp( 1.0, static_cast<int>( bucket ) ) * 1.0e-6;
+}
+
+void LatencyHistogram::record( double seconds )
+{
+    ++count;
+    totalTime += seconds;
+    maxTime = std::max( maxTime, seconds );
+    ++buckets[getBucket( seconds )];
+}
+
+void LatencyHistogram::merge( const LatencyHistogram& other )
+{
+    count += other.count;
+    totalTime += other.totalTime;
+    maxTime = std::max( maxTime, other.maxTime );
+    for( unsigned int i = 0; i < NUM_BUCKETS; ++i )
+        buckets[i] += other.buckets[i];
+}
+
+double LatencyHistogram::getMeanTime() const
+{
+    return count ? totalTime / count : 0.0;
+}
+
+double LatencyHistogram::getPercentile( double fraction ) const
+{
+    if( count == 0 )
+        return 0.0;
+    const double target     = std::min( std::max( fraction, 0.0 ), 1.0 ) * count;
+    uint64_t     cumulative = 0;
+    for( unsigned int i = 0; i < NUM_BUCKETS; ++i )
+    {
+        cumulative += buckets[i];
+        if( cumulative > 0 && cumulative >= target )
+            return std::min( getBucketUpperBound( i ), maxTime );
+    }
+    return maxTime;
+}
+
+namespace {
+
+void writeHistogram( std::ostream& out, const LatencyHistogram& histogram )
+{
+    out << "{\"count\": " << histogram.count << ", \"totalTime\": " << histogram.totalTime
+        << ", \"meanTime\": " << histogram.getMeanTime() << ", \"maxTime\": " << histogram.maxTime
+        << ", \"p50\": " << histogram.getPercentile( 0.5 ) << ", \"p90\": " << histogram.getPercentile( 0.9 )
+        << ", \"p99\": " << histogram.getPercentile( 0.99 ) << ", \"buckets\": [";
+    for( unsigned int i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i )
+        out << ( i ? ", " : "" ) << histogram.buckets[i];
+    out << "]}";
+}
+
+}  // anonymous namespace
+
+std::string toJson( const DetailedStatistics& stats )
+{
+    std::ostringstream out;
+    out.imbue( std::locale::classic() );
+    out.precision( 9 );
+
+    const Statistics& totals = stats.totals;
+    out << "{\n  \"totals\": {"
+        << "\"numTilesRead\": " << totals.numTilesRead << ", \"numBytesRead\": " << totals.numBytesRead
+        << ", \"readTime\": " << totals.readTime << ", \"requestProcessingTime\": " << totals.requestProcessingTime
+        << ", \"numTextures\": " << totals.numTextures << ", \"virtualTextureBytes\": " << totals.virtualTextureBytes
+        << ", \"deviceMemoryUsed\": " << totals.deviceMemoryUsed
+        << ", \"bytesTransferredToDevice\": " << totals.bytesTransferredToDevice
+        << ", \"numEvictions\": " << totals.numEvictions << ", \"numSharedTileBlocks\": " << totals.numSharedTileBlocks
+        << ", \"numSharedTiles\": " << totals.numSharedTiles << ", \"tileDedupRatio\": " << totals.tileDedupRatio
+        << ", \"hostTileCacheHits\": " << totals.hostTileCacheHits << ", \"hostTileCacheMisses\": " << totals.hostTileCacheMisses
+        << ", \"hostTileCacheEvictions\": " << totals.hostTileCacheEvictions
+        << ", \"hostTileCacheBytes\": " << totals.hostTileCacheBytes
+        << ", \"hostTileCacheHitRate\": " << totals.hostTileCacheHitRate << "},\n";
+
+    out << "  \"stages\": {";
+    for( unsigned int stage = 0; stage < NUM_LATENCY_STAGES; ++stage )
+    {
+        out << ( stage ? ",\n" : "\n" ) << "    \"" << getLatencyStageName( static_cast<LatencyStage>( stage ) ) << "\": ";
+        writeHistogram( out, stats.stages[stage] );
+    }
+    out << "\n  },\n";
+
+    out << "  \"textures\": [";
+    for( size_t i = 0; i < stats.textures.size(); ++i )
+    {
+        const TextureStatistics& texture = stats.textures[i];
+        out << ( i ? ",\n" : "\n" ) << "    {\"textureId\": " << texture.textureId << ", \"numTilesRead\": " << texture.numTilesRead
+            << ", \"numBytesRead\": " << texture.numBytesRead << ", \"readTime\": " << texture.readTime << "}";
+    }
+    out << ( stats.textures.empty() ? "]\n}\n" : "\n  ]\n}\n" );
+    return out.str();
+}
+
+}  // namespace demandLoading
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/DemandLoading/FootprintTiles.h>
+#include <OptiXToolkit/DemandLoading/TileIndexing.h>
+#include <OptiXToolkit/ShaderUtil/TextureUtil.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+namespace demandLoading {
+
+namespace {
+
+// Mip level error allowed for the software footprint (see requestTexFootprint2DGrad).
+const float MAX_SW_MIPLEVEL_ERROR = 0.18f;
+
+// Number of samples whose mip levels and extents are computed together.
+const size_t BLOCK_SIZE = 256;
+
+// Minimum number of samples per thread, so small batches are not split across threads.
+const size_t MIN_SAMPLES_PER_THREAD = 16 * 1024;
+
+// Marks the tiles of one texture in a bit vector, indexed by page offset from the sampler's start page.
+class TileMarker
+{
+  public:
+    TileMarker( const TextureSampler& sampler )
+        : m_sampler( sampler )
+        , m_bits( ( sampler.numPages + 63 ) / 64 )
+    {
+    }
+
+    // Mark the tiles in a rectangular region centered on (x,y) having width (2*dx, 2*dy), as
+    // requestTexFootprint2DRect does.
+    void markRect( float x, float y, float dx, float dy, unsigned int mipLevel, bool singleMipLevel )
+    {
+        // Handle mip tail for fine level
+        if( mipLevel >= m_sampler.mipTailFirstLevel )
+        {
+            mark( 0 );
+            return;
+        }
+
+        const CUaddress_mode wrapMode0 = static_cast<CUaddress_mode>( m_sampler.desc.wrapMode0 );
+        const CUaddress_mode wrapMode1 = static_cast<CUaddress_mode>( m_sampler.desc.wrapMode1 );
+
+        const float x0 = wrapTexCoord( x - dx, wrapMode0 );
+        const float y0 = wrapTexCoord( y - dy, wrapMode1 );
+        const float x1 = wrapTexCoord( x + dx, wrapMode0 );
+        const float y1 = wrapTexCoord( y + dy, wrapMode1 );
+
+        const int   tileWidth              = 1 << m_sampler.desc.logTileWidth;
+        const int   tileHeight             = 1 << m_sampler.desc.logTileHeight;
+        const float fracLevelWidthInTiles  = float( m_sampler.width >> mipLevel ) / float( tileWidth );
+        const float fracLevelHeightInTiles = float( m_sampler.height >> mipLevel ) / float( tileHeight );
+
+        int xx0 = static_cast<int>( x0 * fracLevelWidthInTiles );
+        int yy0 = static_cast<int>( y0 * fracLevelHeightInTiles );
+        int xx1 = static_cast<int>( x1 * fracLevelWidthInTiles );
+        int yy1 = static_cast<int>( y1 * fracLevelHeightInTiles );
+        markQuad( mipLevel, xx0, yy0, xx1, yy1 );
+
+        if( singleMipLevel )
+            return;
+
+        // Handle mip tail for coarse level
+        if( mipLevel + 1 >= m_sampler.mipTailFirstLevel )
+        {
+            mark( 0 );
+            return;
+        }
+        markQuad( mipLevel + 1, xx0 >> 1, yy0 >> 1, xx1 >> 1, yy1 >> 1 );
+    }
+
+    // Merge the tiles marked by another marker for the same texture.
+    void merge( const TileMarker& other )
+    {
+        for( size_t i = 0; i < m_bits.size(); ++i )
+            m_bits[i] |= other.m_bits[i];
+    }
+
+    // Append the page ids of the marked tiles, in increasing order.
+    void getPageIds( std::vector<unsigned int>& pageIds ) const
+    {
+        for( size_t i = 0; i < m_bits.size(); ++i )
+        {
+            if( m_bits[i] == 0 )
+                continue;
+            for( unsigned int bit = 0; bit < 64; ++bit )
+            {
+                if( m_bits[i] & ( uint64_t( 1 ) << bit ) )
+                    pageIds.push_back( m_sampler.startPage + static_cast<unsigned int>( i * 64 ) + bit );
+            }
+        }
+    }
+
+  private:
+    const TextureSampler& m_sampler;
+    std::vector<uint64_t> m_bits;
+
+    void mark( unsigned int pageOffset )
+    {
+        if( pageOffset < m_sampler.numPages )
+            m_bits[pageOffset / 64] |= uint64_t( 1 ) << ( pageOffset % 64 );
+    }
+
+    // Mark the (up to four) tiles at the corners of a rectangle of tiles.
+    void markQuad( unsigned int mipLevel, int xx0, int yy0, int xx1, int yy1 )
+    {
+        const TextureSampler::MipLevelSizes& sizes = m_sampler.mipLevelSizes[mipLevel];
+        mark( sizes.mipLevelStart + getPageOffsetFromTileCoords( xx0, yy0, sizes.levelWidthInTiles ) );
+        mark( sizes.mipLevelStart + getPageOffsetFromTileCoords( xx1, yy0, sizes.levelWidthInTiles ) );
+        mark( sizes.mipLevelStart + getPageOffsetFromTileCoords( xx0, yy1, sizes.levelWidthInTiles ) );
+        mark( sizes.mipLevelStart + getPageOffsetFromTileCoords( xx1, yy1, sizes.levelWidthInTiles ) );
+    }
+};
+
+// Mark the tiles requested by a range of samples, as requestTexFootprint2DGrad does with software
+// footprints.  The mip levels and extents of each block of samples are computed in a separate
+// pass, which the compiler can vectorize.
+void markSamples( const TextureSampler& sampler, const FootprintSample* samples, size_t numSamples, TileMarker& marker )
+{
+    const unsigned int numMipLevels  = sampler.desc.numMipLevels;
+    const float        invAnisotropy = 1.0f / sampler.desc.maxAnisotropy;  // as requestTexFootprint2DGrad
+    const float        minDx         = 0.5f / sampler.width;
+    const float        minDy         = 0.5f / sampler.height;
+
+    float mipLevels[BLOCK_SIZE];
+    float dxmax[BLOCK_SIZE];
+    float dymax[BLOCK_SIZE];
+    for( size_t blockStart = 0; blockStart < numSamples; blockStart += BLOCK_SIZE )
+    {
+        const FootprintSample* block     = samples + blockStart;
+        const size_t           blockSize = std::min( BLOCK_SIZE, numSamples - blockStart );
+        for( size_t i = 0; i < blockSize; ++i )
+        {
+            mipLevels[i] = getMipLevel( block[i].ddx, block[i].ddy, sampler.width, sampler.height, invAnisotropy );
+            dxmax[i]     = 0.5f * std::max( std::fabs( block[i].ddx.x ), std::fabs( block[i].ddy.x ) ) + minDx;
+            dymax[i]     = 0.5f * std::max( std::fabs( block[i].ddx.y ), std::fabs( block[i].ddy.y ) ) + minDy;
+        }
+
+        for( size_t i = 0; i < blockSize; ++i )
+        {
+            const float  ml             = mipLevels[i];
+            unsigned int fineLevel      = ( ml >= 0.0f ) ? static_cast<unsigned int>( std::min( ml, 31.0f ) ) : 0;
+            fineLevel                   = std::min( fineLevel, numMipLevels - 1 );
+            const bool   swFootprint    = ( ml >= -MAX_SW_MIPLEVEL_ERROR );
+            const bool   singleMipLevel = ( ml < -MAX_SW_MIPLEVEL_ERROR || numMipLevels <= 1 );
+
+            marker.markRect( block[i].x, block[i].y, dxmax[i], dymax[i], fineLevel, singleMipLevel );
+            if( !swFootprint )
+                continue;
+
+            // Handle mip level discrepancy between SW and HW mip level calculations.  The device only
+            // requests the extra level once the first footprint is resident, which it will be after
+            // pre-warming.
+            const float fracLevel = ml - std::floor( ml );
+            if( fracLevel < MAX_SW_MIPLEVEL_ERROR && fineLevel > 0 )
+                marker.markRect( block[i].x, block[i].y, dxmax[i], dymax[i], fineLevel - 1, true );
+            else if( fracLevel > 1.0f - MAX_SW_MIPLEVEL_ERROR )
+                marker.markRect( block[i].x, block[i].y, dxmax[i], dymax[i], fineLevel + 2, true );
+        }
+    }
+}
+
+}  // anonymous namespace
+
+std::vector<unsigned int> getFootprintTiles( const TextureSampler& sampler, const FootprintSample* samples, size_t numSamples, unsigned int numThreads )
+{
+    std::vector<unsigned int> pageIds;
+    if( !sampler.desc.isSparseTexture || sampler.numPages == 0 || numSamples == 0 )
+        return pageIds;
+
+    if( numThreads == 0 )
+        numThreads = std::max( 1u, std::thread::hardware_concurrency() );
+    numThreads = static_cast<unsigned int>(
+        std::min<size_t>( numThreads, ( numSamples + MIN_SAMPLES_PER_THREAD - 1 ) / MIN_SAMPLES_PER_THREAD ) );
+
+    // Each thread marks tiles in its own bit vector, and the bit vectors are merged at the end.
+    std::vector<TileMarker> markers( numThreads, TileMarker( sampler ) );
+    const size_t            samplesPerThread = ( numSamples + numThreads - 1 ) / numThreads;
+    std::vector<std::thread> threads;
+    for( unsigned int t = 1; t < numThreads; ++t )
+    {
+        const size_t begin = std::min( numSamples, t * samplesPerThread );
+        const size_t end   = std::min( numSamples, begin + samplesPerThread );
+        threads.emplace_back( markSamples, std::cref( sampler ), samples + begin, end - begin, std::ref( markers[t] ) );
+    }
+    markSamples( sampler, samples, std::min( numSamples, samplesPerThread ), markers[0] );
+    for( unsigned int t = 1; t < numThreads; ++t )
+    {
+        threads[t - 1].join();
+        markers[0].merge( markers[t] );
+    }
+
+    markers[0].getPageIds( pageIds );
+    return pageIds;
+}
+
+}  // namespace demandLoading
@@ -0,0 +1,289 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/Error/ErrorCheck.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace demandLoading {
+
+/// Host-side state of a mapped page, used for eviction.
+struct HostPageTableEntry
+{
+    unsigned long long entry;
+    bool               resident;      // Whether a page is considered resident on the GPU
+    bool               staged;        // Pages that are currently staged (and not restored by second chance).
+    bool               inStagedList;  // All pages that are in the staged list, whether restored or not.
+};
+
+/// HostPageTable holds the host-side page table entries, indexed directly by page id.  Page ids are
+/// dense and bounded, so the table is a flat array of entries, split into chunks that are allocated
+/// when a page in them is first mapped.  Each entry is a 64-bit page table entry and a 32-bit state
+/// word (flags plus a sequence count), so a mapped page costs 12 bytes rather than a tree node.
+///
+/// Readers are lock-free: the state word acts as a per-entry sequence lock, so isResident and find
+/// return a consistent snapshot without blocking.  Writers are serialized per shard (page id modulo
+/// NUM_SHARDS), so writers to different pages rarely contend.  Chunks are not freed until the table
+/// is destroyed, so readers never see freed memory.
+class HostPageTable
+{
+  public:
+    /// Construct a table for page ids in [0, numPages).
+    explicit HostPageTable( unsigned int numPages )
+        : m_numPages( numPages )
+        , m_chunks( ( static_cast<size_t>( numPages ) + CHUNK_SIZE - 1 ) / CHUNK_SIZE )
+    {
+        for( std::atomic<Chunk*>& chunk : m_chunks )
+            chunk.store( nullptr, std::memory_order_relaxed );
+    }
+
+    ~HostPageTable()
+    {
+        for( std::atomic<Chunk*>& chunk : m_chunks )
+            delete chunk.load( std::memory_order_relaxed );
+    }
+
+    HostPageTable( const HostPageTable& )            = delete;
+    HostPageTable& operator=( const HostPageTable& ) = delete;
+
+    /// Return the number of page ids covered by the table.
+    unsigned int getNumPages() const { return m_numPages; }
+
+    /// Get the entry for a mapped page.  Returns false if the page is not mapped.  Lock-free.
+    bool find( unsigned int pageId, HostPageTableEntry* result ) const
+    {
+        const Chunk* chunk = getChunk( pageId );
+        if( !chunk )
+            return false;
+        const unsigned int index = pageId % CHUNK_SIZE;
+
+        while( true )
+        {
+            const uint32_t state = chunk->states[index].load( std::memory_order_acquire );
+            if( state & WRITING )
+                continue;
+            if( !( state & MAPPED ) )
+                return false;
+            const unsigned long long entry = chunk->entries[index].load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            if( chunk->states[index].load( std::memory_order_relaxed ) == state )
+            {
+                *result = unpack( state, entry );
+                return true;
+            }
+        }
+    }
+
+    /// Check whether the specified page is resident, optionally returning its entry.  Lock-free.
+    bool isResident( unsigned int pageId, unsigned long long* entry = nullptr ) const
+    {
+        HostPageTableEntry result;
+        if( !find( pageId, &result ) || !result.resident )
+            return false;
+        if( entry )
+            *entry = result.entry;
+        return true;
+    }
+
+    /// Map a page, replacing any existing entry.
+    void set( unsigned int pageId, const HostPageTableEntry& entry )
+    {
+        OTK_ASSERT_MSG( pageId < m_numPages, "pageId outside of host page table range." );
+        Chunk*                       chunk = getOrCreateChunk( pageId );
+        std::unique_lock<std::mutex> lock( getShardMutex( pageId ) );
+        write( *chunk, pageId % CHUNK_SIZE, &entry );
+    }
+
+    /// Unmap a page.  Returns false if the page was not mapped.
+    bool erase( unsigned int pageId )
+    {
+        return update( pageId, []( HostPageTableEntry& ) { return ERASE; } ) != NOT_FOUND;
+    }
+
+    enum UpdateResult
+    {
+        NOT_FOUND,  ///< the page is not mapped (the function was not called)
+        KEEP,       ///< keep the entry unchanged
+        MODIFY,     ///< store the modified entry
+        ERASE       ///< unmap the page
+    };
+
+    /// Atomically read, modify, and/or erase the entry for a mapped page.  The function is called
+    /// with the entry (under the shard lock) and returns KEEP, MODIFY, or ERASE.  Returns the
+    /// function's result, or NOT_FOUND if the page is not mapped.
+    template <typename Function>
+    UpdateResult update( unsigned int pageId, Function function )
+    {
+        Chunk* chunk = getChunk( pageId );
+        if( !chunk )
+            return NOT_FOUND;
+
+        std::unique_lock<std::mutex> lock( getShardMutex( pageId ) );
+        const unsigned int           index = pageId % CHUNK_SIZE;
+        const uint32_t               state = chunk->states[index].load( std::memory_order_relaxed );
+        if( !( state & MAPPED ) )
+            return NOT_FOUND;
+
+        HostPageTableEntry entry  = unpack( state, chunk->entries[index].load( std::memory_order_relaxed ) );
+        const UpdateResult result = function( entry );
+        if( result == MODIFY )
+            write( *chunk, index, &entry );
+        else if( result == ERASE )
+            write( *chunk, index, nullptr );
+        return result;
+    }
+
+    /// Call function( pageId, entry ) for each mapped page in the half open interval [startId, endId),
+    /// in page id order.  Unallocated and empty chunks are skipped.  No lock is held during the call,
+    /// so the function may modify the table.
+    template <typename Function>
+    void forEach( unsigned int startId, unsigned int endId, Function function ) const
+    {
+        endId = std::min( endId, m_numPages );
+        for( unsigned int pageId = startId; pageId < endId; )
+        {
+            const unsigned int chunkEnd = std::min( endId, ( pageId / CHUNK_SIZE + 1 ) * CHUNK_SIZE );
+            const Chunk*       chunk    = getChunk( pageId );
+            if( chunk && chunk->numMapped.load( std::memory_order_relaxed ) > 0 )
+            {
+                HostPageTableEntry entry;
+                for( ; pageId < chunkEnd; ++pageId )
+                {
+                    if( find( pageId, &entry ) )
+                        function( pageId, entry );
+                }
+            }
+            pageId = chunkEnd;
+        }
+    }
+
+    /// Return the number of mapped pages.
+    size_t size() const
+    {
+        size_t numMapped = 0;
+        for( const std::atomic<Chunk*>& chunk : m_chunks )
+        {
+            const Chunk* c = chunk.load( std::memory_order_acquire );
+            if( c )
+                numMapped += c->numMapped.load( std::memory_order_relaxed );
+        }
+        return numMapped;
+    }
+
+    /// Return the host memory used by the table, in bytes.
+    size_t getMemoryUsage() const
+    {
+        size_t numChunks = 0;
+        for( const std::atomic<Chunk*>& chunk : m_chunks )
+            numChunks += chunk.load( std::memory_order_relaxed ) ? 1 : 0;
+        return sizeof( *this ) + m_chunks.size() * sizeof( m_chunks[0] ) + numChunks * sizeof( Chunk );
+    }
+
+  private:
+    static const unsigned int CHUNK_SIZE = 4096;  // pages per chunk
+    static const unsigned int NUM_SHARDS = 64;    // writer mutexes
+
+    // State word layout: flags in the low bits, and a sequence count above them that changes on
+    // every write, so readers can detect a concurrent write.
+    static const uint32_t MAPPED         = 1u << 0;
+    static const uint32_t RESIDENT       = 1u << 1;
+    static const uint32_t STAGED         = 1u << 2;
+    static const uint32_t IN_STAGED_LIST = 1u << 3;
+    static const uint32_t WRITING        = 1u << 4;
+    static const uint32_t FLAG_MASK      = ( 1u << 5 ) - 1;
+    static const uint32_t SEQUENCE_INC   = 1u << 5;
+
+    // Entries and state words are kept in separate arrays, to avoid padding.
+    struct Chunk
+    {
+        std::atomic<unsigned long long> entries[CHUNK_SIZE];
+        std::atomic<uint32_t>           states[CHUNK_SIZE];
+        std::atomic<unsigned int>       numMapped;
+
+        Chunk()
+        {
+            for( unsigned int i = 0; i < CHUNK_SIZE; ++i )
+            {
+                entries[i].store( 0, std::memory_order_relaxed );
+                states[i].store( 0, std::memory_order_relaxed );
+            }
+            numMapped.store( 0, std::memory_order_relaxed );
+        }
+    };
+
+    // Pad the shard mutexes to avoid false sharing between writers.
+    struct ShardMutex
+    {
+        std::mutex mutex;
+        char       padding[64];
+    };
+
+    unsigned int                     m_numPages;
+    std::vector<std::atomic<Chunk*>> m_chunks;
+    ShardMutex                       m_shardMutexes[NUM_SHARDS];
+
+    static HostPageTableEntry unpack( uint32_t state, unsigned long long entry )
+    {
+        return HostPageTableEntry{entry, ( state & RESIDENT ) != 0, ( state & STAGED ) != 0, ( state & IN_STAGED_LIST ) != 0};
+    }
+
+    std::mutex& getShardMutex( unsigned int pageId ) { return m_shardMutexes[pageId % NUM_SHARDS].mutex; }
+
+    const Chunk* getChunk( unsigned int pageId ) const
+    {
+        return pageId < m_numPages ? m_chunks[pageId / CHUNK_SIZE].load( std::memory_order_acquire ) : nullptr;
+    }
+
+    Chunk* getChunk( unsigned int pageId )
+    {
+        return pageId < m_numPages ? m_chunks[pageId / CHUNK_SIZE].load( std::memory_order_acquire ) : nullptr;
+    }
+
+    Chunk* getOrCreateChunk( unsigned int pageId )
+    {
+        std::atomic<Chunk*>& chunkPtr = m_chunks[pageId / CHUNK_SIZE];
+        Chunk*               chunk    = chunkPtr.load( std::memory_order_acquire );
+        if( chunk )
+            return chunk;
+
+        // Racing writers may both allocate a chunk; the loser deletes its copy.
+        std::unique_ptr<Chunk> newChunk( new Chunk );
+        if( chunkPtr.compare_exchange_strong( chunk, newChunk.get(), std::memory_order_acq_rel ) )
+            return newChunk.release();
+        return chunk;
+    }
+
+    // Write (or erase, if entry is null) the entry at the given index in a chunk.  The shard mutex must be held.
+    static void write( Chunk& chunk, unsigned int index, const HostPageTableEntry* entry )
+    {
+        const uint32_t oldState = chunk.states[index].load( std::memory_order_relaxed );
+        const uint32_t sequence = ( oldState & ~FLAG_MASK ) + SEQUENCE_INC;
+
+        uint32_t newState = sequence;
+        if( entry )
+        {
+            newState |= MAPPED | ( entry->resident ? RESIDENT : 0 ) | ( entry->staged ? STAGED : 0 )
+                        | ( entry->inStagedList ? IN_STAGED_LIST : 0 );
+        }
+
+        chunk.states[index].store( oldState | WRITING, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        chunk.entries[index].store( entry ? entry->entry : 0, std::memory_order_relaxed );
+        chunk.states[index].store( newState, std::memory_order_release );
+
+        if( ( oldState & MAPPED ) && !( newState & MAPPED ) )
+            chunk.numMapped.fetch_sub( 1, std::memory_order_relaxed );
+        else if( !( oldState & MAPPED ) && ( newState & MAPPED ) )
+            chunk.numMapped.fetch_add( 1, std::memory_order_relaxed );
+    }
+};
+
+}  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -23,6 +23,8 @@ DeviceMemoryManager::DeviceMemoryManager( std::shared_ptr<Options> options )
     {
         m_tilePool.reset( new TilePool( new TextureTileAllocator(), new HeapSuballocator(),
                                         TextureTileAllocator::getRecommendedAllocationSize(), m_options->maxTexMemPerDevice ) );
+        if( m_options->coalesceDuplicateTiles )
+            m_tileDeduplicator.reset( new TileDeduplicator );
     }
 }
 
@@ -83,6 +85,8 @@ void DeviceMemoryManager::setMaxTextureTileMemory( size_t maxMemory )
         if( bh.handle != 0 && bh.block.arenaId >= numArenas )
             bh = otk::TileBlockHandle{0,0};
     }
+    if( m_tileDeduplicator )
+        m_tileDeduplicator->removeArenas( static_cast<uint32_t>( numArenas ) );
 }
 
 }  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -20,6 +20,7 @@
 #include <OptiXToolkit/DemandLoading/Options.h>
 #include <OptiXToolkit/DemandLoading/Statistics.h>
 #include <OptiXToolkit/DemandLoading/TextureSampler.h>
+#include "Memory/TileDeduplicator.h"
 #include "WhiteBlackTileCheck.h"
 
 #include <memory>
@@ -61,9 +62,23 @@ class DeviceMemoryManager
             if( getWhiteBlackTileType( bh ) != WB_NONE )
                 return;
         }
+        // Only free shared tiles when the last reference is released
+        if( m_tileDeduplicator && !m_tileDeduplicator->release( blockDesc ) )
+            return;
         m_tilePool->freeTextureTiles( blockDesc );
     }
 
+    /// Return the tile deduplicator, or null if coalesceDuplicateTiles is off.
+    TileDeduplicator* getTileDeduplicator() { return m_tileDeduplicator.get(); }
+
+    /// Prepare a resident tile block to be refilled in place.  Returns false if the block is shared with
+    /// other tiles, in which case the tile's reference to it is released, and the tile needs a new block.
+    bool unshareTileBlock( const otk::TileBlockDesc& blockDesc )
+    {
+        // If this was the last reference, the block is no longer tracked and now belongs to the tile.
+        return !m_tileDeduplicator || m_tileDeduplicator->release( blockDesc );
+    }
+
     /// Return the fixed tile block for a given WhiteBlackTileType. Handle will be 0 if not present.
     otk::TileBlockHandle getWhiteBlackTileBlock( WhiteBlackTileType wbtype ) { return m_whiteBlackTiles[wbtype]; }
     /// Set the tile block for a given WhiteBlackTileType.
@@ -118,6 +133,7 @@ class DeviceMemoryManager
     DeviceContextPool         m_deviceContextMemory;
     std::unique_ptr<TilePool> m_tilePool; // null if sparse textures disabled.
     std::vector<otk::TileBlockHandle> m_whiteBlackTiles;
+    std::unique_ptr<TileDeduplicator> m_tileDeduplicator; // null if coalesceDuplicateTiles is off.
 
     std::vector<DeviceContext*> m_deviceContextPool;
     std::vector<DeviceContext*> m_deviceContextFreeList;
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "Memory/HostTileCache.h"
+
+#include <cstring>
+#include <limits>
+
+namespace demandLoading {
+
+namespace {
+
+// Return true if every texel of the tile data equals the first one.
+bool isUniform( const char* data, size_t size, unsigned int texelSize )
+{
+    if( texelSize == 0 || size < texelSize || size % texelSize != 0 )
+        return false;
+    for( size_t offset = texelSize; offset < size; offset += texelSize )
+    {
+        if( memcmp( data, data + offset, texelSize ) != 0 )
+            return false;
+    }
+    return true;
+}
+
+}  // anonymous namespace
+
+HostTileCache::HostTileCache( size_t maxMemory )
+    : m_tiles( maxMemory )
+{
+}
+
+bool HostTileCache::find( unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY, char* dest, size_t size )
+{
+    std::shared_ptr<const std::vector<char>> data;
+    unsigned int                             texelSize;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        const Entry*                 entry = m_tiles.find( TileId( textureId, mipLevel, tileX, tileY ) );
+        if( entry == nullptr || entry->size != size )
+        {
+            ++m_numMisses;
+            return false;
+        }
+        ++m_numHits;
+        data      = entry->data;
+        texelSize = entry->texelSize;
+    }
+
+    // Copy the data outside the lock.  The entry may be evicted meanwhile, but the data is shared.
+    if( texelSize == 0 )
+    {
+        memcpy( dest, data->data(), size );
+        return true;
+    }
+    for( size_t offset = 0; offset < size; offset += texelSize )
+        memcpy( dest + offset, data->data(), texelSize );
+    return true;
+}
+
+void HostTileCache::insert( unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY, const char* data,
+                            size_t size, unsigned int texelSize )
+{
+    // Store uniform tiles as a single texel.  The copy is made before taking the lock.
+    if( !isUniform( data, size, texelSize ) )
+        texelSize = 0;
+    const size_t storedSize = texelSize ? texelSize : size;
+    if( storedSize > m_tiles.getMemoryBudget() )
+        return;
+    std::shared_ptr<const std::vector<char>> copy( new std::vector<char>( data, data + storedSize ) );
+
+    // Evict the least recently used tiles until the cache is within its budget.
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_tiles.insert( TileId( textureId, mipLevel, tileX, tileY ), Entry{size, texelSize, std::move( copy )}, storedSize );
+}
+
+void HostTileCache::removeTexture( unsigned int textureId )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    const unsigned int           maxValue = std::numeric_limits<unsigned int>::max();
+    m_tiles.eraseRange( TileId( textureId, 0, 0, 0 ), TileId( textureId, maxValue, maxValue, maxValue ) );
+}
+
+size_t HostTileCache::getNumHits() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_numHits;
+}
+
+size_t HostTileCache::getNumMisses() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_numMisses;
+}
+
+size_t HostTileCache::getNumEvictions() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return static_cast<size_t>( m_tiles.getNumEvictions() );
+}
+
+size_t HostTileCache::getNumResidentBytes() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_tiles.getNumResidentBytes();
+}
+
+}  // namespace demandLoading
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/ImageSource/LruCache.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace demandLoading {
+
+/// HostTileCache retains the data of texture tiles read from their ImageSources in host memory, so that
+/// tiles evicted from the device can be refilled without reading (and decoding) them again.  The cache
+/// is bounded by a memory budget, and the least recently used tiles are discarded when it is exceeded.
+/// Uniform tiles, whose texels all have the same value, are stored as a single texel.  Thread safe.
+class HostTileCache
+{
+  public:
+    /// Construct a cache that holds at most maxMemory bytes of tile data.
+    explicit HostTileCache( size_t maxMemory );
+
+    /// Copy the cached data of the specified tile into dest, which must hold size bytes.  Returns false
+    /// if the tile is not cached (or was cached with a different size).
+    bool find( unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY, char* dest, size_t size );
+
+    /// Cache size bytes of tile data with the given texel size (the block size for block compressed
+    /// formats), evicting the least recently used tiles to stay within the memory budget.
+    void insert( unsigned int textureId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY, const char* data,
+                 size_t size, unsigned int texelSize );
+
+    /// Discard the cached tiles of a texture, e.g. when its image is replaced.
+    void removeTexture( unsigned int textureId );
+
+    /// Return the number of lookups that found a cached tile.
+    size_t getNumHits() const;
+
+    /// Return the number of lookups that did not find a cached tile.
+    size_t getNumMisses() const;
+
+    /// Return the number of tiles discarded to stay within the memory budget.
+    size_t getNumEvictions() const;
+
+    /// Return the number of bytes of tile data held by the cache.
+    size_t getNumResidentBytes() const;
+
+  private:
+    using TileId = std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>;  // texture, mip level, x, y
+
+    struct Entry
+    {
+        size_t                                   size;       // size of the tile data
+        unsigned int                             texelSize;  // size of the repeated texel of a uniform tile, or 0
+        std::shared_ptr<const std::vector<char>> data;
+    };
+
+    mutable std::mutex                   m_mutex;
+    imageSource::LruCache<TileId, Entry> m_tiles;
+    size_t                               m_numHits   = 0;
+    size_t                               m_numMisses = 0;
+};
+
+}  // namespace demandLoading
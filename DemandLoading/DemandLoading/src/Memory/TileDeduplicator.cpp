@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "Memory/TileDeduplicator.h"
+
+#include <OptiXToolkit/Error/ErrorCheck.h>
+
+#include <cstring>
+
+using namespace otk;
+
+namespace demandLoading {
+
+namespace {
+
+const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+
+inline uint64_t rotl( uint64_t x, int r )
+{
+    return ( x << r ) | ( x >> ( 64 - r ) );
+}
+
+inline uint64_t round( uint64_t acc, uint64_t input )
+{
+    return rotl( acc + input * PRIME2, 31 ) * PRIME1;
+}
+
+inline uint64_t avalanche( uint64_t h )
+{
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // anonymous namespace
+
+TileKey TileDeduplicator::hashTile( const char* data, size_t size, uint64_t layout )
+{
+    OTK_ASSERT( size % 32 == 0 );
+
+    // Four independent lanes (as in xxHash64), so the loop is limited by throughput, not latency.
+    uint64_t acc[4] = {layout + PRIME1 + PRIME2, layout + PRIME2, layout, layout - PRIME1};
+    for( size_t i = 0; i < size; i += 32 )
+    {
+        uint64_t words[4];
+        memcpy( words, data + i, sizeof( words ) );
+        acc[0] = round( acc[0], words[0] );
+        acc[1] = round( acc[1], words[1] );
+        acc[2] = round( acc[2], words[2] );
+        acc[3] = round( acc[3], words[3] );
+    }
+
+    // Fold the lanes in two different orders, so that both halves of the key depend on all of the data.
+    uint64_t lo = rotl( acc[0], 1 ) + rotl( acc[1], 7 ) + rotl( acc[2], 12 ) + rotl( acc[3], 18 );
+    uint64_t hi = rotl( acc[3], 1 ) + rotl( acc[2], 7 ) + rotl( acc[1], 12 ) + rotl( acc[0], 18 );
+    lo = avalanche( lo + size );
+    hi = avalanche( hi * PRIME4 + size );
+    return TileKey{lo, hi};
+}
+
+TileDeduplicator::~TileDeduplicator()
+{
+    for( auto& entry : m_blocks )
+    {
+        if( entry.second.filled )
+            OTK_ERROR_CHECK_NOTHROW( cuEventDestroy( entry.second.filled ) );
+    }
+}
+
+TileBlockHandle TileDeduplicator::findAndAddRef( const TileKey& key, CUstream stream )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    auto                         it = m_tiles.find( key );
+    if( it == m_tiles.end() )
+        return TileBlockHandle{0, 0};
+
+    // Tiles filled on other streams can only share the block once its copy has completed.
+    BlockInfo& info = m_blocks[it->second.block.data];
+    if( info.filled && info.stream != stream )
+    {
+        const CUresult result = cuEventQuery( info.filled );
+        if( result == CUDA_ERROR_NOT_READY )
+            return TileBlockHandle{0, 0};
+        OTK_ERROR_CHECK( result );
+        OTK_ERROR_CHECK( cuEventDestroy( info.filled ) );
+        info.filled = nullptr;
+    }
+
+    addRef( info );
+    return it->second;
+}
+
+bool TileDeduplicator::insert( const TileKey& key, const TileBlockHandle& bh, CUstream stream )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if( !m_tiles.insert( std::make_pair( key, bh ) ).second )
+        return false;
+
+    CUevent filled;
+    OTK_ERROR_CHECK( cuEventCreate( &filled, CU_EVENT_DISABLE_TIMING ) );
+    OTK_ERROR_CHECK( cuEventRecord( filled, stream ) );
+    m_blocks[bh.block.data] = BlockInfo{key, 1, stream, filled};
+    return true;
+}
+
+bool TileDeduplicator::release( const TileBlockDesc& block )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    auto                         it = m_blocks.find( block.data );
+    if( it == m_blocks.end() )
+        return true;
+
+    BlockInfo& info = it->second;
+    if( info.refCount > 1 )
+    {
+        // The block stops being shared when its second to last reference is released.
+        --m_numSharedReferences;
+        if( --info.refCount == 1 )
+        {
+            --m_numSharedBlocks;
+            --m_numSharedReferences;
+        }
+        return false;
+    }
+
+    removeBlock( info );
+    m_blocks.erase( it );
+    return true;
+}
+
+void TileDeduplicator::removeArenas( uint32_t firstArenaId )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    for( auto it = m_blocks.begin(); it != m_blocks.end(); )
+    {
+        if( TileBlockDesc( it->first ).arenaId >= firstArenaId )
+        {
+            removeBlock( it->second );
+            it = m_blocks.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+size_t TileDeduplicator::getNumSharedBlocks() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_numSharedBlocks;
+}
+
+size_t TileDeduplicator::getNumSharedReferences() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_numSharedReferences;
+}
+
+void TileDeduplicator::addRef( BlockInfo& info )
+{
+    if( ++info.refCount == 2 )
+    {
+        ++m_numSharedBlocks;
+        m_numSharedReferences += 2;
+    }
+    else
+    {
+        ++m_numSharedReferences;
+    }
+}
+
+void TileDeduplicator::removeBlock( BlockInfo& info )
+{
+    if( info.refCount > 1 )
+    {
+        --m_numSharedBlocks;
+        m_numSharedReferences -= info.refCount;
+    }
+    if( info.filled )
+        OTK_ERROR_CHECK( cuEventDestroy( info.filled ) );
+    m_tiles.erase( info.key );
+}
+
+}  // namespace demandLoading
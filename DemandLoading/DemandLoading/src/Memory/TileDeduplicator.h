@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+
+#include <cuda.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace demandLoading {
+
+/// Content hash of a texture tile.  The tile layout (format and number of channels) is folded into
+/// the hash, since the device layout of a tile depends on its texel size.
+struct TileKey
+{
+    uint64_t lo;
+    uint64_t hi;
+
+    bool operator==( const TileKey& other ) const { return lo == other.lo && hi == other.hi; }
+};
+
+struct TileKeyHash
+{
+    size_t operator()( const TileKey& key ) const { return static_cast<size_t>( key.lo ); }
+};
+
+/// TileDeduplicator maps the content hash of filled texture tiles to the device memory that holds them,
+/// so that identical tiles (constant color regions, tiles repeated across UDIMs or texture variants) can
+/// share a single reference counted tile block.  Blocks that are not tracked by the deduplicator (such
+/// as mip tails, and tiles filled from device memory) are unaffected.  Thread safe.
+///
+/// A block is inserted after the copy that fills it has been enqueued, and an event is recorded behind
+/// the copy.  Until that event completes, the block is only shared with tiles filled on the same stream,
+/// whose mappings are ordered after the copy.
+class TileDeduplicator
+{
+  public:
+    TileDeduplicator() = default;
+    TileDeduplicator( const TileDeduplicator& ) = delete;
+    TileDeduplicator& operator=( const TileDeduplicator& ) = delete;
+
+    /// Destroy the events of any blocks that are still tracked.
+    ~TileDeduplicator();
+
+    /// Hash the contents of a tile.  The layout distinguishes tiles with identical bytes but different
+    /// texel formats.  The size must be a multiple of 32 bytes.
+    static TileKey hashTile( const char* data, size_t size, uint64_t layout );
+
+    /// Return the block holding a tile with the given key, adding a reference to it, or a handle of 0 if
+    /// there is no such tile, or if the copy that fills it was issued on a different stream and has not
+    /// completed yet.
+    otk::TileBlockHandle findAndAddRef( const TileKey& key, CUstream stream );
+
+    /// Track a newly filled tile block with one reference, recording an event on the stream that fills
+    /// it.  Must be called after the copy to the block has been enqueued on the stream.  Returns false
+    /// (and does not track the block) if another block with the same key was inserted first.
+    bool insert( const TileKey& key, const otk::TileBlockHandle& bh, CUstream stream );
+
+    /// Release a reference to a tile block.  Returns true if the caller should free the block, either
+    /// because it is not tracked, or because this was its last reference.
+    bool release( const otk::TileBlockDesc& block );
+
+    /// Stop tracking blocks in arenas at or beyond the given arena id (after the tile pool shrinks).
+    void removeArenas( uint32_t firstArenaId );
+
+    /// Return the number of tile blocks referenced by more than one tile.
+    size_t getNumSharedBlocks() const;
+
+    /// Return the number of tiles referencing the shared blocks.
+    size_t getNumSharedReferences() const;
+
+  private:
+    struct BlockInfo
+    {
+        TileKey      key;
+        unsigned int refCount;
+        CUstream     stream;  // stream that fills the block
+        CUevent      filled;  // recorded behind the fill, or null once it has completed
+    };
+
+    mutable std::mutex                                            m_mutex;
+    std::unordered_map<TileKey, otk::TileBlockHandle, TileKeyHash> m_tiles;   // by content
+    std::unordered_map<uint64_t, BlockInfo>                       m_blocks;  // by TileBlockDesc::data
+    size_t                                                        m_numSharedBlocks     = 0;
+    size_t                                                        m_numSharedReferences = 0;
+
+    void addRef( BlockInfo& info );
+    void removeBlock( BlockInfo& info );
+};
+
+}  // namespace demandLoading
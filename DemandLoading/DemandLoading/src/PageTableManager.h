@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,7 +10,9 @@
 #include <OptiXToolkit/Error/cuErrorCheck.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -20,15 +22,25 @@ class RequestHandler;
 
 /// The PageTableManager is used to reserve a contiguous range of page table entries.  It keeps a
 /// mapping that allows the request handler corresponding to a page table entry to be determined in
-/// log(N) time.
+/// log(N) time, or in constant time for backed pages if direct lookup is enabled.
+///
+/// Lookups (getRequestHandler) are wait-free, since they are made for every request processed.
+/// Mappings are only appended (in increasing page order, separately for backed and unbacked
+/// pages) or have their handler replaced, so readers can search a copy-on-grow array through an
+/// atomic pointer and size, without a lock.  Reservations are serialized by a mutex.
 class PageTableManager
 {
   public:
-    explicit PageTableManager( unsigned int totalPages, unsigned int backedPages )
+    /// Construct a PageTableManager for totalPages pages, of which the first backedPages are
+    /// backed.  If directLookup is true, backed pages are looked up in a direct-indexed (radix)
+    /// table, which costs 4 bytes per backed page in each 4096 page block that has been reserved.
+    explicit PageTableManager( unsigned int totalPages, unsigned int backedPages, bool directLookup = false )
         : m_totalPages( totalPages )
         , m_backedPages( backedPages )
         , m_nextUnbackedPage( backedPages )
     {
+        if( directLookup )
+            m_directTable.reset( new DirectTable( backedPages ) );
     }
 
     unsigned int getAvailableBackedPages() const
@@ -37,7 +49,7 @@ class PageTableManager
         return m_backedPages - m_nextBackedPage;
     }
 
-    unsigned int getAvailableUnbackedPages() const 
+    unsigned int getAvailableUnbackedPages() const
     {
         std::unique_lock<std::mutex> lock( m_mutex );
         return m_totalPages - m_nextUnbackedPage;
@@ -52,73 +64,193 @@ class PageTableManager
 
     /// Reserve the specified number of contiguous page table entries, associating them with the
     /// specified request handler.  Returns the first page reserved.
-    unsigned int reserveBackedPages( unsigned int numPages, RequestHandler* handler ) 
+    unsigned int reserveBackedPages( unsigned int numPages, RequestHandler* handler )
     {
         std::unique_lock<std::mutex> lock( m_mutex );
         OTK_ASSERT_MSG( m_nextBackedPage + numPages <= m_backedPages,
                            "Insufficient backed pages in demand loading page table" );
 
-        return insertPageMapping( m_nextBackedPage, numPages, handler );
+        return insertPageMapping( m_backedMappings, m_nextBackedPage, numPages, handler );
     }
 
     /// Reserve unbacked pages (pages with no backing storage on the device).
     unsigned int reserveUnbackedPages( unsigned int numPages, RequestHandler* handler )
     {
         std::unique_lock<std::mutex> lock( m_mutex );
-        OTK_ASSERT_MSG( m_nextUnbackedPage + numPages <= m_totalPages, 
+        OTK_ASSERT_MSG( m_nextUnbackedPage + numPages <= m_totalPages,
                            "Insufficient unbacked pages in demand loading page table" );
 
-        return insertPageMapping( m_nextUnbackedPage, numPages, handler );
+        return insertPageMapping( m_unbackedMappings, m_nextUnbackedPage, numPages, handler );
     }
 
     /// Find the request handler associated with the specified page.  Returns nullptr if not found.
+    /// Wait-free.
     RequestHandler* getRequestHandler( unsigned int pageId ) const
     {
-        std::unique_lock<std::mutex> lock( m_mutex );
-        // Pages are allocated in increasing order, so the array of mappings is sorted, allowing us
-        // to use binary search to find the the given page id.
-        const auto least =
-            std::lower_bound( m_mappings.cbegin(), m_mappings.cend(), pageId,
-                              []( const PageMapping& entry, unsigned int id ) { return id > entry.lastPage; } );
-        return least != m_mappings.cend() ? least->handler : nullptr;
+        const PageMapping* mapping = findMapping( pageId );
+        return mapping ? mapping->handler.load( std::memory_order_acquire ) : nullptr;
     }
 
-    void removeRequestHandler( unsigned int pageId ) 
+    void removeRequestHandler( unsigned int pageId )
     {
         std::unique_lock<std::mutex> lock( m_mutex );
 
-        const auto least =
-            std::lower_bound( m_mappings.cbegin(), m_mappings.cend(), pageId,
-                              []( const PageMapping& entry, unsigned int id ) { return id > entry.lastPage; } );
-
-        OTK_ASSERT_MSG( least != m_mappings.cend(), 
+        PageMapping* mapping = findMapping( pageId );
+        OTK_ASSERT_MSG( mapping != nullptr,
                            "Trying to replace nonexistent request handler" );
-        
-        size_t idx = least - m_mappings.begin();
-        m_mappings[idx] = PageMapping{ least->firstPage, least->lastPage, &m_nullHandler };
+        mapping->handler.store( &m_nullHandler, std::memory_order_release );
     }
 
   private:
     struct PageMapping
     {
-        unsigned int    firstPage;
-        unsigned int    lastPage;
-        RequestHandler* handler;
+        unsigned int                 firstPage;
+        unsigned int                 lastPage;
+        std::atomic<RequestHandler*> handler;
     };
 
-    unsigned int insertPageMapping( unsigned int& nextPage, unsigned int numPages, RequestHandler* handler )
+    // Append-only array of mappings, sorted by page.  When the array is full, the mappings are
+    // copied to an array twice the size, which is then published.  Old arrays are kept until
+    // destruction (so they total less than the current one), since readers may still be using them.
+    class MappingArray
+    {
+      public:
+        unsigned int size() const { return m_size.load( std::memory_order_acquire ); }
+
+        PageMapping& operator[]( unsigned int index ) const { return m_data.load( std::memory_order_acquire )[index]; }
+
+        // Append a mapping.  Calls must be serialized.
+        unsigned int push_back( unsigned int firstPage, unsigned int lastPage, RequestHandler* handler )
+        {
+            const unsigned int index = m_size.load( std::memory_order_relaxed );
+            if( index == m_capacity )
+            {
+                const unsigned int capacity = std::max( 2 * m_capacity, 1024u );
+                PageMapping*       data     = new PageMapping[capacity];
+                for( unsigned int i = 0; i < index; ++i )
+                {
+                    const PageMapping& mapping = ( *this )[i];
+                    data[i].firstPage          = mapping.firstPage;
+                    data[i].lastPage           = mapping.lastPage;
+                    data[i].handler.store( mapping.handler.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+                }
+                m_arrays.emplace_back( data );
+                m_data.store( data, std::memory_order_release );
+                m_capacity = capacity;
+            }
+
+            PageMapping& mapping = ( *this )[index];
+            mapping.firstPage    = firstPage;
+            mapping.lastPage     = lastPage;
+            mapping.handler.store( handler, std::memory_order_relaxed );
+            m_size.store( index + 1, std::memory_order_release );
+            return index;
+        }
+
+        // Find the mapping containing the given page, or return nullptr.
+        PageMapping* find( unsigned int pageId ) const
+        {
+            // The size is loaded before the array, which is published before the size grows past
+            // its capacity, so the array holds at least numMappings elements.
+            const unsigned int numMappings = size();
+            PageMapping*       mappings    = m_data.load( std::memory_order_acquire );
+
+            // Pages are allocated in increasing order, so the array of mappings is sorted, allowing us
+            // to use binary search to find the the given page id.
+            PageMapping* least = std::lower_bound( mappings, mappings + numMappings, pageId,
+                                                   []( const PageMapping& entry, unsigned int id ) { return id > entry.lastPage; } );
+            return least != mappings + numMappings && pageId >= least->firstPage ? least : nullptr;
+        }
+
+      private:
+        std::atomic<PageMapping*>                   m_data{nullptr};
+        std::atomic<unsigned int>                   m_size{0};
+        unsigned int                                m_capacity = 0;
+        std::vector<std::unique_ptr<PageMapping[]>> m_arrays;  // All arrays, current and old.
+    };
+
+    // Two-level radix table mapping backed pages to mapping indices (plus one, so zero means
+    // unmapped).  Leaves are allocated when pages in them are reserved, and not freed until the
+    // table is destroyed.
+    class DirectTable
+    {
+      public:
+        explicit DirectTable( unsigned int numPages )
+            : m_leaves( ( static_cast<size_t>( numPages ) + LEAF_SIZE - 1 ) / LEAF_SIZE )
+        {
+            for( std::atomic<Leaf*>& leaf : m_leaves )
+                leaf.store( nullptr, std::memory_order_relaxed );
+        }
+
+        ~DirectTable()
+        {
+            for( std::atomic<Leaf*>& leaf : m_leaves )
+                delete leaf.load( std::memory_order_relaxed );
+        }
+
+        unsigned int get( unsigned int pageId ) const
+        {
+            const Leaf* leaf = m_leaves[pageId / LEAF_SIZE].load( std::memory_order_acquire );
+            return leaf ? leaf->entries[pageId % LEAF_SIZE].load( std::memory_order_acquire ) : 0;
+        }
+
+        // Set the entries for a range of pages.  Calls must be serialized.
+        void set( unsigned int firstPage, unsigned int lastPage, unsigned int value )
+        {
+            for( unsigned int pageId = firstPage; pageId <= lastPage; ++pageId )
+            {
+                std::atomic<Leaf*>& leafPtr = m_leaves[pageId / LEAF_SIZE];
+                Leaf*               leaf    = leafPtr.load( std::memory_order_relaxed );
+                if( !leaf )
+                {
+                    leaf = new Leaf;
+                    leafPtr.store( leaf, std::memory_order_release );
+                }
+                leaf->entries[pageId % LEAF_SIZE].store( value, std::memory_order_release );
+            }
+        }
+
+      private:
+        static const unsigned int LEAF_SIZE = 4096;
+
+        struct Leaf
+        {
+            std::atomic<unsigned int> entries[LEAF_SIZE];
+
+            Leaf()
+            {
+                for( std::atomic<unsigned int>& entry : entries )
+                    entry.store( 0, std::memory_order_relaxed );
+            }
+        };
+
+        std::vector<std::atomic<Leaf*>> m_leaves;
+    };
+
+    PageMapping* findMapping( unsigned int pageId ) const
+    {
+        if( pageId >= m_totalPages )
+            return nullptr;
+        if( pageId >= m_backedPages )
+            return m_unbackedMappings.find( pageId );
+        if( m_directTable )
+        {
+            const unsigned int index = m_directTable->get( pageId );
+            return index ? &m_backedMappings[index - 1] : nullptr;
+        }
+        return m_backedMappings.find( pageId );
+    }
+
+    unsigned int insertPageMapping( MappingArray& mappings, unsigned int& nextPage, unsigned int numPages, RequestHandler* handler )
     {
         const unsigned int firstPage = nextPage;
         const unsigned int lastPage = firstPage + numPages - 1;
         if( handler )
             handler->setPageRange( firstPage, numPages );
 
-        const PageMapping mapping{ firstPage, lastPage, handler };
-
-        const auto least =
-            std::lower_bound( m_mappings.begin(), m_mappings.end(), firstPage,
-                              []( const PageMapping& entry, unsigned int id ) { return id > entry.lastPage; } );
-        m_mappings.insert( least, mapping );
+        const unsigned int index = mappings.push_back( firstPage, lastPage, handler );
+        if( m_directTable && &mappings == &m_backedMappings && numPages > 0 )
+            m_directTable->set( firstPage, lastPage, index + 1 );
 
         nextPage += numPages;
         return firstPage;
@@ -130,8 +262,10 @@ class PageTableManager
     unsigned int             m_nextBackedPage{};
     unsigned int             m_nextUnbackedPage{};
 
-    std::vector<PageMapping> m_mappings;
-    mutable std::mutex       m_mutex;
+    MappingArray                 m_backedMappings;
+    MappingArray                 m_unbackedMappings;
+    std::unique_ptr<DirectTable> m_directTable;
+    mutable std::mutex           m_mutex;  // Serializes reservations and handler removal.
 
     RequestHandler           m_nullHandler;
 };
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -32,6 +32,7 @@ PagingSystem::PagingSystem( std::shared_ptr<Options> options,
     , m_deviceMemoryManager( deviceMemoryManager )
     , m_requestProcessor( requestProcessor )
     , m_pinnedMemoryPool( pinnedMemoryPool )
+    , m_pageTable( options->numPages )
 {
     OTK_ASSERT( m_options->maxFilledPages >= m_options->maxRequestedPages );
 
@@ -52,22 +53,6 @@ PagingSystem::~PagingSystem()
     m_pinnedRequestContextPool.clear();
 }
 
-void PagingSystem::updateLruThreshold( unsigned int returnedStalePages, unsigned int requestedStalePages, unsigned int medianLruVal )
-{
-    // Don't change the value if no stale pages were requested
-    if( requestedStalePages == 0 )
-        return;
-
-    // Heuristic to update the lruThreshold. The basic idea is to aggressively reduce the threshold
-    // if not enough stale pages are returned, but only gradually increase the threshold if it is too low.
-    if( returnedStalePages < requestedStalePages / 2 )
-        m_lruThreshold -= std::min( m_lruThreshold - MIN_LRU_THRESHOLD, 4u );
-    else if( returnedStalePages < requestedStalePages )
-        m_lruThreshold -= std::min( m_lruThreshold - MIN_LRU_THRESHOLD, 2u );
-    else if( medianLruVal > m_lruThreshold )
-        m_lruThreshold++;
-}
-
 // This callback invokes processRequests() after the asynchronous copies in pullRequests have completed.
 class ProcessRequestsCallback : public CudaCallback
 {
@@ -93,6 +78,7 @@ class ProcessRequestsCallback : public CudaCallback
 
 void PagingSystem::pullRequests( const DeviceContext& context, CUstream stream, unsigned int id, unsigned int startPage, unsigned int endPage )
 {
+    LatencyTimer                 timer( m_latencyRecorder, STAGE_PULL_REQUESTS );
     std::unique_lock<std::mutex> lock( m_mutex );
 
     // The array lengths are accumulated across multiple device threads, so they must be initialized to zero.
@@ -142,6 +128,7 @@ void PagingSystem::pullRequests( const DeviceContext& context, CUstream stream,
 // Note: this method must not make any CUDA API calls, because it's invoked via cuLaunchHostFunc.
 void PagingSystem::processRequests( const DeviceContext& context, RequestContext* pinnedRequestContext, CUstream stream, unsigned int id )
 {
+    LatencyTimer                 timer( m_latencyRecorder, STAGE_PROCESS_REQUESTS );
     std::unique_lock<std::mutex> lock( m_mutex );
 
     // Return device context to pool.  The DeviceContext has been copied, but DeviceContextPool is designed to permit that.
@@ -183,11 +170,12 @@ void PagingSystem::processRequests( const DeviceContext& context, RequestContext
 
         if( m_evictionActive && getNumStagedPages() < m_options->maxStagedPages )
         {
+            LatencyTimer stageTimer( m_latencyRecorder, STAGE_STAGE_STALE_PAGES );
             m_stagedPages.emplace_back( StagedPageList{m_pushMappingsEvent, std::deque<PageMapping>()} );
             stageStalePages( pinnedRequestContext, m_stagedPages.back().mappings );
         }
     }
-    updateLruThreshold( numStalePages, pinnedRequestContext->maxStalePages, medianLruVal );
+    m_lruThreshold = updateLruThreshold( m_lruThreshold, numStalePages, pinnedRequestContext->maxStalePages, medianLruVal );
 
     // Return the RequestContext to its pool.
     m_pinnedRequestContextPool.push_back(pinnedRequestContext);
@@ -201,17 +189,13 @@ void PagingSystem::addMapping( unsigned int pageId, unsigned int lruVal, unsigne
 
 bool PagingSystem::isResident( unsigned int pageId, unsigned long long* entry )
 {
-    std::unique_lock<std::mutex> lock( m_mutex );
-    const auto&                  p = m_pageTable.find( pageId );
-
-    bool resident = ( p != m_pageTable.end() ) ? p->second.resident : false;
-    if( resident && entry )
-        *entry = p->second.entry;
-    return resident;
+    // Lock-free.  Residency can change once this returns, as it could once the mutex was released.
+    return m_pageTable.isResident( pageId, entry );
 }
 
 unsigned int PagingSystem::pushMappings( const DeviceContext& context, CUstream stream )
 {
+    LatencyTimer                 timer( m_latencyRecorder, STAGE_PUSH_MAPPINGS );
     std::unique_lock<std::mutex> lock( m_mutex );
 
     const unsigned int numFilledPages = m_pageMappingsContext->numFilledPages;
@@ -251,15 +235,20 @@ void PagingSystem::stageStalePages( RequestContext* requestContext, std::deque<P
         if( numStaged >= m_options->maxStagedPages || m_pageMappingsContext->numInvalidatedPages >= m_options->maxInvalidatedPages - 1 )
             break;
 
-        const auto& p = m_pageTable.find( sp.pageId );
-        if( p != m_pageTable.end() && p->second.resident == true && p->second.inStagedList == false )
-        {
-            // Stage the page
-            stagedMappings.emplace_back( PageMapping{sp.pageId, sp.lruVal, p->second.entry} );
-            p->second.resident     = false;
-            p->second.staged       = true;
-            p->second.inStagedList = true;
+        const HostPageTable::UpdateResult staged = m_pageTable.update( sp.pageId, [&]( HostPageTableEntry& p ) -> HostPageTable::UpdateResult {
+            if( !p.resident || p.inStagedList )
+                return HostPageTable::KEEP;
 
+            // Stage the page
+            stagedMappings.emplace_back( PageMapping{sp.pageId, sp.lruVal, p.entry} );
+            p.resident     = false;
+            p.staged       = true;
+            p.inStagedList = true;
+            return HostPageTable::MODIFY;
+        } );
+
+        if( staged == HostPageTable::MODIFY )
+        {
             // Schedule the page mapping to be invalidated on the device
             m_pageMappingsContext->invalidatedPages[m_pageMappingsContext->numInvalidatedPages++] = sp.pageId;
             numStaged++;
@@ -284,22 +273,14 @@ bool PagingSystem::freeStagedPage( PageMapping* m )
         *m = m_stagedPages[0].mappings.front();
         m_stagedPages[0].mappings.pop_front();
 
-        const auto& p = m_pageTable.find( m->id );
-        if( p == m_pageTable.end() )
-        {
-            // FIXME: Avoid the duplicate frees
-            //printf("PagingSystem::freeStagedPage duplicate free %d\n", m->id);
-            continue;
-        }
-
-        p->second.inStagedList = false;
-
-        // If the page is still staged, return. Otherwise, go around and look for another one
-        if( p->second.staged == true )
-        {
-            m_pageTable.erase( p );
+        // If the page is still staged, return. Otherwise, go around and look for another one.
+        // (Pages that are no longer mapped are duplicate frees, which are skipped.)
+        const HostPageTable::UpdateResult result = m_pageTable.update( m->id, []( HostPageTableEntry& p ) -> HostPageTable::UpdateResult {
+            p.inStagedList = false;
+            return p.staged ? HostPageTable::ERASE : HostPageTable::MODIFY;
+        } );
+        if( result == HostPageTable::ERASE )
             return true;
-        }
     }
     return false;
 }
@@ -333,7 +314,7 @@ void PagingSystem::addMappingBody( unsigned int pageId, unsigned int lruVal, uns
     }
 
     m_pageMappingsContext->filledPages[m_pageMappingsContext->numFilledPages++] = PageMapping{pageId, lruVal, entry};
-    m_pageTable[pageId] = HostPageTableEntry{entry, true, false, false};
+    m_pageTable.set( pageId, HostPageTableEntry{entry, true, false, false} );
 
     // If the buffer for page mappings is about to overflow, push the mappings to clear it.
     // This should not happen very often.  Usually, the mappings will be pushed from pushMappings.
@@ -352,12 +333,12 @@ bool PagingSystem::restoreMapping( unsigned int pageId )
 {
     // Mutex acquired in caller (processRequests).
 
-    const auto& p = m_pageTable.find( pageId );
-    if( p != m_pageTable.end() && p->second.staged && !p->second.resident
+    HostPageTableEntry p;
+    if( m_pageTable.find( pageId, &p ) && p.staged && !p.resident
         && m_pageMappingsContext->numFilledPages < m_pageMappingsContext->maxFilledPages )
     {
-        p->second.staged = false;
-        addMappingBody( pageId, 0, p->second.entry );
+        // Remaps the page as resident and not staged.
+        addMappingBody( pageId, 0, p.entry );
         return true;
     }
 
@@ -415,22 +396,19 @@ void PagingSystem::invalidatePages( unsigned int              startId,
 
     // Remove specified page entries from the page table.
     std::set<unsigned int> stagedInvalidatedPages;
-    auto p = m_pageTable.lower_bound( startId );
-    while( p != m_pageTable.end() && p->first < endId )
-    {
-        const unsigned int pageId = p->first;
-        const unsigned long long pageVal = p->second.entry;
+    m_pageTable.forEach( startId, endId, [&]( unsigned int pageId, const HostPageTableEntry& p ) {
+        const unsigned long long pageVal = p.entry;
 
         if( !predicate || (*predicate)( pageId, pageVal, stream ) )
         {
             OTK_ASSERT_MSG( m_pageMappingsContext->numInvalidatedPages < m_options->maxInvalidatedPages,
                             "Maximum number of invalidated pages exceeded (Options::maxInvalidPages)" );
             m_pageMappingsContext->invalidatedPages[m_pageMappingsContext->numInvalidatedPages++] = pageId;
-            if( p->second.inStagedList )
+            if( p.inStagedList )
             {
                 stagedInvalidatedPages.insert( pageId );
             }
-            p = m_pageTable.erase(p);
+            m_pageTable.erase( pageId );
 
             // If the buffer for invalidations is about to overflow, push the invalidated pages to clear it. 
             // This should not happen very often.  Usually, the mappings will be pushed from pushMappings.
@@ -440,11 +418,7 @@ void PagingSystem::invalidatePages( unsigned int              startId,
                 cuStreamSynchronize( stream ); // wait for the stream because we will reuse the context
             }
         }
-        else 
-        {
-            ++p;
-        }
-    }
+    } );
     
     if( stagedInvalidatedPages.empty() )
     {
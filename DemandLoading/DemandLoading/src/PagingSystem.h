@@ -1,10 +1,14 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #pragma once
 
+#include "HostPageTable.h"
+#include "Util/LatencyRecorder.h"
+
 #include <OptiXToolkit/DemandLoading/DeviceContext.h>  // for PageMapping
+#include <OptiXToolkit/DemandLoading/LRU.h>
 #include <OptiXToolkit/DemandLoading/Options.h>
 #include <OptiXToolkit/DemandLoading/Ticket.h>
 #include <OptiXToolkit/Error/cuErrorCheck.h>
@@ -15,7 +19,6 @@
 #include <cuda.h>
 
 #include <deque>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -60,7 +63,7 @@ class PagingSystem
     /// need to map pages.
     void addMappingBody( unsigned int pageId, unsigned int lruVal, unsigned long long entry );
 
-    /// Check whether the specified page is resident (thread safe).
+    /// Check whether the specified page is resident (thread safe, lock-free).
     bool isResident( unsigned int pageId, unsigned long long* entry = nullptr );
 
     /// Push tile mappings to the device.  Returns the total number of new mappings.
@@ -76,33 +79,29 @@ class PagingSystem
     /// Returns whether eviction is turned on or off
     bool evictionIsActive() { return m_evictionActive; }
 
+    /// Record the host-side latencies of pullRequests, processRequests, eviction staging, and
+    /// pushMappings in the given recorder.
+    void setLatencyRecorder( LatencyRecorder* latencyRecorder ) { m_latencyRecorder = latencyRecorder; }
+
     /// Invalidate a half open interval of page ids, from startId up to but not including endId, based on a predicate
     void invalidatePages( unsigned int startId, unsigned int endId, PageInvalidatorPredicate* predicate, const DeviceContext& context, CUstream stream );
 
   private:
-    struct HostPageTableEntry
-    {
-        unsigned long long entry;
-        bool               resident;      // Whether a page is considered resident on the GPU
-        bool               staged;        // Pages that are currently staged (and not restored by second chance).
-        bool               inStagedList;  // All pages that are in the staged list, whether restored or not.
-    };
-
     std::shared_ptr<Options> m_options{};
     DeviceMemoryManager*     m_deviceMemoryManager{};
     RequestProcessor*        m_requestProcessor{};
+    LatencyRecorder*         m_latencyRecorder{};
 
     otk::MemoryBlockDesc m_pageMappingsContextBlock;
     PageMappingsContext* m_pageMappingsContext; 
     otk::MemoryPool<otk::PinnedAllocator, otk::RingSuballocator>* m_pinnedMemoryPool;
 
-    std::map<unsigned int, HostPageTableEntry> m_pageTable;  // Host-side. Not copied to/from device. Used for eviction.
-    std::mutex m_mutex;  // Guards m_pageTable and filledPages list (see addMapping).
+    HostPageTable m_pageTable;  // Host-side. Not copied to/from device. Used for eviction.
+    std::mutex    m_mutex;      // Serializes page table updates and guards the filledPages list (see addMapping).
 
     std::mt19937 m_rng; // Used for randomized eviction when LRU table is not present.
 
     // Variables related to eviction
-    const unsigned int MIN_LRU_THRESHOLD = 2;
     bool               m_evictionActive  = false;
     unsigned int       m_launchNum       = 0;
     unsigned int       m_lruThreshold    = MIN_LRU_THRESHOLD;
@@ -140,9 +139,6 @@ class PagingSystem
     // Process requests, inserting them in the global request queue.
     void processRequests( const DeviceContext& context, RequestContext* pinnedRequestContext, CUstream stream, unsigned int id );
 
-    // Update the lru threshold value
-    void updateLruThreshold( unsigned int returnedStalePages, unsigned int requestedStalePages, unsigned int medianLruVal );
-
     // Stage pages for reuse (Remove their mappings on the host, and schedule removal of thier mappings on the device
     // the next time pushMappings is called.)
     void stageStalePages( RequestContext* requestContext, std::deque<PageMapping>& stagedMappings );
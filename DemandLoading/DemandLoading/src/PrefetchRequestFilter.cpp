@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "PrefetchRequestFilter.h"
+
+#include <OptiXToolkit/DemandLoading/TileIndexing.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+
+namespace demandLoading {
+
+namespace {
+
+// Minimum drift of the requests (in tiles per launch) that counts as motion.
+const double MIN_MOTION = 0.25;
+
+// Minimum number of launch to launch moves in the same direction that counts as motion.
+const unsigned int MIN_MOTION_STEPS = 2;
+
+bool isMipmapped( const TextureSampler& sampler )
+{
+    return sampler.desc.numMipLevels > sampler.mipTailFirstLevel;
+}
+
+unsigned int getTilePage( const TextureSampler& sampler, unsigned int mipLevel, unsigned int x, unsigned int y )
+{
+    const TextureSampler::MipLevelSizes& level = sampler.mipLevelSizes[mipLevel];
+    return sampler.startPage + level.mipLevelStart + getPageOffsetFromTileCoords( x, y, level.levelWidthInTiles );
+}
+
+// Return the motion along one axis, given the positions in successive launches, or zero if the
+// moves are not all in the same direction.
+int getAxisMotion( const std::vector<double>& positions )
+{
+    double total = 0.0;
+    int    sign  = 0;
+    for( size_t i = 1; i < positions.size(); ++i )
+    {
+        const double delta     = positions[i] - positions[i - 1];
+        const int    deltaSign = delta > MIN_MOTION ? 1 : delta < -MIN_MOTION ? -1 : 0;
+        if( deltaSign == 0 || ( sign != 0 && deltaSign != sign ) )
+            return 0;
+        sign = deltaSign;
+        total += delta;
+    }
+    return static_cast<int>( std::lround( total / ( positions.size() - 1 ) ) );
+}
+
+}  // anonymous namespace
+
+PrefetchRequestFilter::PrefetchRequestFilter( const Options&                 options,
+                                              SamplerLookup                  lookupSampler,
+                                              ResidencyCheck                 isResident,
+                                              std::shared_ptr<RequestFilter> next )
+    : m_maxPrefetchPages( options.maxPrefetchPages )
+    , m_historyLength( options.prefetchHistory )
+    , m_lookupSampler( std::move( lookupSampler ) )
+    , m_isResident( std::move( isResident ) )
+    , m_next( std::move( next ) )
+{
+}
+
+std::vector<unsigned int> PrefetchRequestFilter::filter( const unsigned int* requests, unsigned int numRequests )
+{
+    return m_next ? m_next->filter( requests, numRequests ) : std::vector<unsigned int>( requests, requests + numRequests );
+}
+
+bool PrefetchRequestFilter::getTile( unsigned int pageId, Tile& tile )
+{
+    const TextureSampler* sampler = m_lastSampler;
+    if( !sampler || pageId < sampler->startPage || pageId >= sampler->startPage + sampler->numPages )
+    {
+        sampler = m_lookupSampler( pageId );
+        if( !sampler || pageId < sampler->startPage || pageId >= sampler->startPage + sampler->numPages )
+            return false;
+        m_lastSampler = sampler;
+    }
+
+    tile.sampler = sampler;
+    unpackTileIndex( *sampler, pageId - sampler->startPage, tile.mipLevel, tile.x, tile.y );
+    return !( isMipmapped( *sampler ) && tile.mipLevel >= sampler->mipTailFirstLevel );
+}
+
+bool PrefetchRequestFilter::getMotion( uint64_t key, const Centroid& current, int& dx, int& dy ) const
+{
+    // Gather the centroids for the key in the most recent consecutive launches that requested it.
+    std::vector<double> xs{current.x};
+    std::vector<double> ys{current.y};
+    for( auto it = m_history.rbegin(); it != m_history.rend(); ++it )
+    {
+        const auto centroid = it->find( key );
+        if( centroid == it->end() )
+            break;
+        xs.insert( xs.begin(), centroid->second.x );
+        ys.insert( ys.begin(), centroid->second.y );
+    }
+    if( xs.size() < MIN_MOTION_STEPS + 1 )
+        return false;
+
+    dx = getAxisMotion( xs );
+    dy = getAxisMotion( ys );
+    return dx != 0 || dy != 0;
+}
+
+std::vector<unsigned int> PrefetchRequestFilter::filterAndPrefetch( const unsigned int*        requests,
+                                                                    unsigned int               numRequests,
+                                                                    std::vector<unsigned int>& prefetchRequests )
+{
+    std::vector<unsigned int> filteredRequests = filter( requests, numRequests );
+
+    // Find the requested texture tiles, and the centroid of the requests in each mip level.
+    m_lastSampler = nullptr;
+    std::vector<Tile> tiles;
+    CentroidMap       centroids;
+    tiles.reserve( filteredRequests.size() );
+    for( unsigned int pageId : filteredRequests )
+    {
+        Tile tile;
+        if( !getTile( pageId, tile ) )
+            continue;
+        tiles.push_back( tile );
+        Centroid& centroid = centroids[getKey( tile )];
+        centroid.x += tile.x;
+        centroid.y += tile.y;
+        ++centroid.count;
+    }
+    for( auto& centroid : centroids )
+    {
+        centroid.second.x /= centroid.second.count;
+        centroid.second.y /= centroid.second.count;
+    }
+
+    // Add prefetch requests up to the budget, skipping pages that are requested, already
+    // prefetched, or resident.
+    std::unordered_set<unsigned int> seen( filteredRequests.begin(), filteredRequests.end() );
+    unsigned int                     numPrefetches = 0;
+    auto addPrefetch = [&]( unsigned int pageId ) {
+        if( seen.insert( pageId ).second && !m_isResident( pageId ) )
+        {
+            prefetchRequests.push_back( pageId );
+            ++numPrefetches;
+        }
+    };
+
+    // Parents in the next coarser mip level (or the mip tail) are filled first.
+    for( size_t i = 0; i < tiles.size() && numPrefetches < m_maxPrefetchPages; ++i )
+    {
+        const Tile&           tile    = tiles[i];
+        const TextureSampler& sampler = *tile.sampler;
+        const unsigned int    parent  = tile.mipLevel + 1;
+        if( parent >= sampler.desc.numMipLevels )
+            continue;
+        if( parent >= sampler.mipTailFirstLevel )
+            addPrefetch( sampler.startPage );
+        else
+        {
+            const TextureSampler::MipLevelSizes& level = sampler.mipLevelSizes[parent];
+            addPrefetch( getTilePage( sampler, parent, std::min<unsigned int>( tile.x / 2, level.levelWidthInTiles - 1 ),
+                                      std::min<unsigned int>( tile.y / 2, level.levelHeightInTiles - 1 ) ) );
+        }
+    }
+
+    // Next, the requested tiles offset by the motion of the requests over the previous launches.
+    std::map<uint64_t, std::pair<int, int>> motions;
+    for( const auto& centroid : centroids )
+    {
+        int dx, dy;
+        if( getMotion( centroid.first, centroid.second, dx, dy ) )
+            motions[centroid.first] = std::make_pair( dx, dy );
+    }
+    for( size_t i = 0; i < tiles.size() && numPrefetches < m_maxPrefetchPages && !motions.empty(); ++i )
+    {
+        const Tile& tile   = tiles[i];
+        const auto  motion = motions.find( getKey( tile ) );
+        if( motion == motions.end() )
+            continue;
+        const TextureSampler::MipLevelSizes& level = tile.sampler->mipLevelSizes[tile.mipLevel];
+        const int                            x     = static_cast<int>( tile.x ) + motion->second.first;
+        const int                            y     = static_cast<int>( tile.y ) + motion->second.second;
+        if( x >= 0 && x < level.levelWidthInTiles && y >= 0 && y < level.levelHeightInTiles )
+            addPrefetch( getTilePage( *tile.sampler, tile.mipLevel, x, y ) );
+    }
+
+    // Finally, the 3x3 neighbors of the requested tiles in the same mip level.
+    for( size_t i = 0; i < tiles.size() && numPrefetches < m_maxPrefetchPages; ++i )
+    {
+        const Tile&                          tile  = tiles[i];
+        const TextureSampler::MipLevelSizes& level = tile.sampler->mipLevelSizes[tile.mipLevel];
+        for( int dy = -1; dy <= 1 && numPrefetches < m_maxPrefetchPages; ++dy )
+        {
+            for( int dx = -1; dx <= 1 && numPrefetches < m_maxPrefetchPages; ++dx )
+            {
+                const int x = static_cast<int>( tile.x ) + dx;
+                const int y = static_cast<int>( tile.y ) + dy;
+                if( ( dx != 0 || dy != 0 ) && x >= 0 && x < level.levelWidthInTiles && y >= 0 && y < level.levelHeightInTiles )
+                    addPrefetch( getTilePage( *tile.sampler, tile.mipLevel, x, y ) );
+            }
+        }
+    }
+
+    // Remember the centroids of this launch for motion detection.
+    m_history.push_back( std::move( centroids ) );
+    while( m_history.size() > m_historyLength )
+        m_history.pop_front();
+
+    return filteredRequests;
+}
+
+}  // namespace demandLoading
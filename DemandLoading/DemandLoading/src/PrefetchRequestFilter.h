@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/DemandLoading/Options.h>
+#include <OptiXToolkit/DemandLoading/RequestFilter.h>
+#include <OptiXToolkit/DemandLoading/TextureSampler.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace demandLoading {
+
+/// PrefetchRequestFilter adds speculative requests for texture tiles that are likely to be needed
+/// soon to each batch of requests: the parent of each requested tile in the next coarser mip level,
+/// the 3x3 neighbors of each requested tile in the same mip level, and, when the requests for a mip
+/// level of a texture have drifted in a consistent direction over the previous launches (e.g. during
+/// a camera move), the requested tiles offset by that motion.  Parents are added first, then
+/// predicted tiles, then neighbors, up to Options::maxPrefetchPages per launch, skipping tiles
+/// that are resident or already requested.  The prefetches are filled at lower priority than the
+/// requests (see RequestFilter::filterAndPrefetch).
+///
+/// Requests are first passed to an optional downstream filter (e.g. the CascadeRequestFilter).
+/// Batches must be filtered one at a time, as they are by the request processors.
+class PrefetchRequestFilter : public RequestFilter
+{
+  public:
+    /// Returns the sampler of the sparse texture that owns the given page, or nullptr if the page is
+    /// not a tile of a sparse texture.
+    using SamplerLookup = std::function<const TextureSampler*( unsigned int pageId )>;
+
+    /// Returns true if the given page is resident.
+    using ResidencyCheck = std::function<bool( unsigned int pageId )>;
+
+    PrefetchRequestFilter( const Options& options, SamplerLookup lookupSampler, ResidencyCheck isResident,
+                           std::shared_ptr<RequestFilter> next = nullptr );
+
+    /// Apply the downstream filter (if any), without prefetching.
+    std::vector<unsigned int> filter( const unsigned int* requests, unsigned int numRequests ) override;
+
+    /// Apply the downstream filter (if any), and append prefetch requests to prefetchRequests.
+    std::vector<unsigned int> filterAndPrefetch( const unsigned int* requests, unsigned int numRequests,
+                                                 std::vector<unsigned int>& prefetchRequests ) override;
+
+  private:
+    struct Tile
+    {
+        const TextureSampler* sampler;
+        unsigned int          mipLevel;
+        unsigned int          x;
+        unsigned int          y;
+    };
+
+    // Mean tile coordinates of the requests for one mip level of a texture in one launch.
+    struct Centroid
+    {
+        double       x     = 0.0;
+        double       y     = 0.0;
+        unsigned int count = 0;
+    };
+
+    // Centroids keyed by texture start page and mip level.
+    using CentroidMap = std::map<uint64_t, Centroid>;
+
+    unsigned int                   m_maxPrefetchPages;
+    unsigned int                   m_historyLength;
+    SamplerLookup                  m_lookupSampler;
+    ResidencyCheck                 m_isResident;
+    std::shared_ptr<RequestFilter> m_next;
+    std::deque<CentroidMap>        m_history;        // most recent launch last
+    const TextureSampler*          m_lastSampler{};  // sampler of the last tile page, to skip repeated lookups
+
+    static uint64_t getKey( const Tile& tile ) { return ( uint64_t( tile.sampler->startPage ) << 8 ) | tile.mipLevel; }
+
+    // Get the texture tile for a page.  Returns false for the mip tail and pages that are not texture tiles.
+    bool getTile( unsigned int pageId, Tile& tile );
+
+    // Get the motion of the requests for a mip level of a texture, in tiles per launch, given the
+    // centroid of the current requests.  Returns false if no consistent motion was detected.
+    bool getMotion( uint64_t key, const Centroid& current, int& dx, int& dy ) const;
+};
+
+}  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,6 +13,17 @@
 
 namespace demandLoading {
 
+/// Request priorities, which are used by the WorkStealingRequestProcessor to order the filling of
+/// page requests.  Lower values are filled first.  Tile priorities are offset by the distance from
+/// the mip tail, so that tiles are filled from coarse to fine.
+const unsigned int REQUEST_PRIORITY_SAMPLER  = 0;  // Texture samplers and base colors
+const unsigned int REQUEST_PRIORITY_MIP_TAIL = 1;
+const unsigned int REQUEST_PRIORITY_TILE     = 2;
+
+/// Speculative (prefetch) requests have their priority offset by REQUEST_PRIORITY_PREFETCH, so that
+/// they are filled after all other requests.
+const unsigned int REQUEST_PRIORITY_PREFETCH = 1u << 16;
+
 /// A RequestHandler fills page requests for a particular resource, e.g. a demand-loaded texture.
 /// RequestHandlers are associated with a range of pages by the PageTableManager and are invoked by
 /// the RequestProcessor.
@@ -47,6 +58,19 @@ class RequestHandler
     /// Fill a request for the specified page using the given stream.
     virtual void fillRequest( CUstream /*stream*/, unsigned int /*pageId*/ ) {}
 
+    /// Fill requests for a batch of pages using the given stream.  The pages all belong to this
+    /// handler and are sorted in increasing order.  The default implementation calls fillRequest
+    /// for each page; handlers that can amortize work across adjacent pages (e.g. reading several
+    /// texture tiles with one I/O operation) override it.
+    virtual void fillRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds )
+    {
+        for( unsigned int i = 0; i < numPageIds; ++i )
+            fillRequest( stream, pageIds[i] );
+    }
+
+    /// Get the priority of a request for the specified page (lower values are filled first).
+    virtual unsigned int getRequestPriority( unsigned int /*pageId*/ ) { return REQUEST_PRIORITY_TILE; }
+
     /// Get the start page for the request handler
     unsigned int getStartPage() { return m_startPage; }
 
@@ -361,6 +361,17 @@ bool DemandTextureImpl::readTile( unsigned int mipLevel, unsigned int tileX, uns
     return m_image->readTile( tileBuffer, mipLevel, { tileX, tileY, getTileWidth(), getTileHeight() }, stream );
 }
 
+bool DemandTextureImpl::readTiles( unsigned int mipLevel, const imageSource::Tile* tiles, unsigned int numTiles, char* tileBuffer,
+                                   size_t tileBufferSize, CUstream stream ) const
+{
+    OTK_ASSERT( m_isInitialized );
+    OTK_ASSERT( mipLevel < m_info.numMipLevels );
+    OTK_ASSERT_MSG( numTiles * TILE_SIZE_IN_BYTES <= tileBufferSize, "Maximum tile size exceeded" );
+    (void)tileBufferSize;
+
+    return m_image->readTiles( tileBuffer, TILE_SIZE_IN_BYTES, mipLevel, tiles, numTiles, stream );
+}
+
 // Tiles can be filled concurrently.
 void DemandTextureImpl::fillTile( CUstream                     stream,
                                   unsigned int                 mipLevel,
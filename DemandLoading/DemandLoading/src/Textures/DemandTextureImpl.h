@@ -127,6 +127,12 @@ class DemandTextureImpl : public DemandTexture
     bool readTile( unsigned int mipLevel, unsigned int tileX, unsigned int tileY, char* tileBuffer,
                    size_t tileBufferSize, CUstream stream ) const;
 
+    /// Read a batch of tiles from the specified mip level into the given buffer, which holds
+    /// consecutive tiles of TILE_SIZE_IN_BYTES each.
+    /// Throws an exception on error.
+    bool readTiles( unsigned int mipLevel, const imageSource::Tile* tiles, unsigned int numTiles, char* tileBuffer,
+                    size_t tileBufferSize, CUstream stream ) const;
+
     /// Fill the device tile backing storage for a texture tile and with the given data.
     void fillTile( CUstream                     stream,
                    unsigned int                 mipLevel,
@@ -23,6 +23,9 @@ class SamplerRequestHandler : public RequestHandler
     /// Fill a request for the specified page using the given stream.  
     void fillRequest( CUstream stream, unsigned int pageId ) override;
 
+    /// Samplers and base colors are filled before any texture tiles.
+    unsigned int getRequestPriority( unsigned int /*pageId*/ ) override { return REQUEST_PRIORITY_SAMPLER; }
+
     /// Load or reload a page on the given stream
     void loadPage( CUstream stream, unsigned int pageId, bool reloadIfResident = true );
 
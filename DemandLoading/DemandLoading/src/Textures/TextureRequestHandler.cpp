@@ -1,13 +1,15 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include "Textures/TextureRequestHandler.h"
 #include "DemandLoaderImpl.h"
+#include "Memory/HostTileCache.h"
 #include <OptiXToolkit/Memory/MemoryBlockDesc.h>
 #include "PagingSystem.h"
 #include "Textures/DemandTextureImpl.h"
 #include "TransferBufferDesc.h"
+#include "Util/LatencyRecorder.h"
 #include "Util/NVTXProfiling.h"
 
 #include <OptiXToolkit/DemandLoading/DemandLoadLogger.h>
@@ -15,15 +17,75 @@
 
 #include "WhiteBlackTileCheck.h"
 
+#include <algorithm>
+
 using namespace otk;
 
 namespace demandLoading {
 
+namespace {
+
+// Maximum number of tiles read into a single transfer buffer by fillRequests.
+const unsigned int MAX_TILES_PER_READ = 16;
+
+}  // anonymous namespace
+
 void TextureRequestHandler::fillRequest( CUstream stream, unsigned int pageId )
 {
    loadPage( stream, pageId, false );
 }
 
+void TextureRequestHandler::fillRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds )
+{
+    // The mip tail is always the first page of a mipmapped texture, and it is filled individually.
+    if( numPageIds > 0 && pageIds[0] == m_startPage && m_texture->isMipmapped() )
+    {
+        loadPage( stream, pageIds[0], false );
+        ++pageIds;
+        --numPageIds;
+    }
+
+    // Only sparse texture tiles are batched.
+    if( numPageIds < 2 || !m_texture->useSparseTexture() )
+    {
+        RequestHandler::fillRequests( stream, pageIds, numPageIds );
+        return;
+    }
+
+    // Split the batch into runs of tiles from a single mip level, limiting the transfer buffer size.
+    const TextureSampler& sampler = m_texture->getSampler();
+    unsigned int          begin   = 0;
+    while( begin < numPageIds )
+    {
+        unsigned int mipLevel;
+        unsigned int tileX;
+        unsigned int tileY;
+        unpackTileIndex( sampler, pageIds[begin] - m_startPage, mipLevel, tileX, tileY );
+        const unsigned int levelEnd = m_startPage + ( mipLevel > 0 ? sampler.mipLevelSizes[mipLevel - 1].mipLevelStart : sampler.numPages );
+
+        unsigned int end = begin + 1;
+        while( end < numPageIds && end - begin < MAX_TILES_PER_READ && pageIds[end] < levelEnd )
+            ++end;
+
+        fillTileRequests( stream, pageIds + begin, end - begin );
+        begin = end;
+    }
+}
+
+unsigned int TextureRequestHandler::getRequestPriority( unsigned int pageId )
+{
+    if( pageId == m_startPage && m_texture->isMipmapped() )
+        return REQUEST_PRIORITY_MIP_TAIL;
+
+    // The sampler is invariant once it's created, and tile requests never occur before that.
+    const TextureSampler& sampler = m_texture->getSampler();
+    unsigned int          mipLevel;
+    unsigned int          tileX;
+    unsigned int          tileY;
+    unpackTileIndex( sampler, pageId - m_startPage, mipLevel, tileX, tileY );
+    return REQUEST_PRIORITY_TILE + ( sampler.mipTailFirstLevel - std::min( mipLevel, sampler.mipTailFirstLevel ) );
+}
+
 void TextureRequestHandler::loadPage( CUstream stream, unsigned int pageId, bool reloadIfResident )
 {
     // Try to make sure there are free tiles to handle the request
@@ -79,11 +141,18 @@ void TextureRequestHandler::fillTileRequest( CUstream stream, unsigned int pageI
     if( coalesceWhiteBlackTiles && bh.handle != 0 && deviceMemoryManager->getWhiteBlackTileType(bh) != WB_NONE )
         bh = TileBlockHandle{0, 0};
 
+    // A tile block shared with identical tiles cannot be refilled in place.
+    if( bh.handle != 0 && !deviceMemoryManager->unshareTileBlock( bh.block ) )
+        bh = TileBlockHandle{0, 0};
+
     // Make sure to have device memory for the tile
     bool useNewBlock = bh.block.isBad();
     if( useNewBlock )
     {
-        bh = deviceMemoryManager->allocateTileBlock( TILE_SIZE_IN_BYTES );
+        {
+            LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TILE_ALLOCATION );
+            bh = deviceMemoryManager->allocateTileBlock( TILE_SIZE_IN_BYTES );
+        }
         if( bh.block.isBad() )
         {
             // If the allocation failed, set max memory to current size to prevent repeat requests.
@@ -93,78 +162,251 @@ void TextureRequestHandler::fillTileRequest( CUstream stream, unsigned int pageI
     }
 
     // Allocate a transfer buffer.
-    TransferBufferDesc transferBuffer = m_loader->allocateTransferBuffer( m_texture->getFillType(), TILE_SIZE_IN_BYTES, stream );
+    TransferBufferDesc transferBuffer;
+    {
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TRANSFER_BUFFER );
+        transferBuffer = m_loader->allocateTransferBuffer( m_texture->getFillType(), TILE_SIZE_IN_BYTES, stream );
+    }
     if( transferBuffer.memoryBlock.size == 0 && useNewBlock )
     {
         deviceMemoryManager->freeTileBlock( bh.block );
         return;
     }
 
-    // Read the tile (possibly from disk) into the transfer buffer.
-    bool satisfied;
-    try
+    // Copy the tile from the host tile cache, or read it (possibly from disk) into the transfer buffer.
+    char*          tileData      = reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr );
+    HostTileCache* hostTileCache = getHostTileCache();
+    bool satisfied = hostTileCache && hostTileCache->find( m_texture->getId(), mipLevel, tileX, tileY, tileData, getTileSizeInBytes() );
+    if( !satisfied )
     {
-        satisfied = m_texture->readTile( mipLevel, tileX, tileY, reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr ),
-                                         transferBuffer.memoryBlock.size, stream );
+        try
+        {
+            LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_READ_TILE );
+            satisfied = m_texture->readTile( mipLevel, tileX, tileY, tileData, transferBuffer.memoryBlock.size, stream );
+        }
+        catch( const std::exception& e )
+        {
+            std::stringstream ss;
+            ss << "readTile call failed: " << e.what() << ": " << __FILE__ << " (" << __LINE__ << ")";
+            throw std::runtime_error( ss.str().c_str() );
+        }
+        if( satisfied && hostTileCache )
+            hostTileCache->insert( m_texture->getId(), mipLevel, tileX, tileY, tileData, getTileSizeInBytes(), getTexelBlockSizeInBytes() );
     }
-    catch( const std::exception& e )
+
+    if( satisfied )
     {
-        std::stringstream ss;
-        ss << "readTile call failed: " << e.what() << ": " << __FILE__ << " (" << __LINE__ << ")";
-        throw std::runtime_error( ss.str().c_str() );
+        fillTileFromBuffer( stream, pageId, mipLevel, tileX, tileY, tileData, transferBuffer.memoryType, bh, useNewBlock );
+    }
+    else
+    {
+        deviceMemoryManager->freeTileBlock( bh.block );
     }
 
-    if( satisfied )
+    m_loader->freeTransferBuffer( transferBuffer, stream );
+}
+
+void TextureRequestHandler::fillTileRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds )
+{
+    SCOPED_NVTX_RANGE_FUNCTION_NAME();
+    DeviceMemoryManager* deviceMemoryManager = m_loader->getDeviceMemoryManager();
+
+    // Try to make sure there are free tiles to handle the requests
+    m_loader->freeStagedTiles( stream );
+
+    // Lock the pages, skipping any that are already resident.  The pages are locked in increasing
+    // order, so concurrent batches cannot deadlock.
+    std::vector<std::unique_ptr<MutexArrayLock>> locks;
+    std::vector<unsigned int>                    tilePageIds;
+    locks.reserve( numPageIds );
+    tilePageIds.reserve( numPageIds );
+    for( unsigned int i = 0; i < numPageIds; ++i )
+    {
+        std::unique_ptr<MutexArrayLock> lock( new MutexArrayLock( m_mutex.get(), pageIds[i] - m_startPage ) );
+        if( m_loader->getPagingSystem()->isResident( pageIds[i] ) )
+            continue;
+        locks.push_back( std::move( lock ) );
+        tilePageIds.push_back( pageIds[i] );
+    }
+    if( tilePageIds.size() < 2 )
+    {
+        if( !tilePageIds.empty() )
+            fillTileRequest( stream, tilePageIds[0], TileBlockHandle{0, 0} );
+        return;
+    }
+
+    // Unpack the tile indices.  The tiles all belong to the same mip level.
+    const TextureSampler&          sampler  = m_texture->getSampler();
+    unsigned int                   mipLevel = 0;
+    std::vector<imageSource::Tile> tiles( tilePageIds.size() );
+    for( size_t i = 0; i < tilePageIds.size(); ++i )
+    {
+        unpackTileIndex( sampler, tilePageIds[i] - m_startPage, mipLevel, tiles[i].x, tiles[i].y );
+        tiles[i].width  = m_texture->getTileWidth();
+        tiles[i].height = m_texture->getTileHeight();
+        DL_LOG(5, "[Page " + std::to_string(tilePageIds[i]) + "] Tile(tex=" + std::to_string(m_texture->getId())
+            + ", mip=" + std::to_string(mipLevel) + ", x=" + std::to_string(tiles[i].x) + ", y=" + std::to_string(tiles[i].y) + ")");
+    }
+
+    // Allocate device memory for the tiles, stopping at the first failure.
+    std::vector<TileBlockHandle> blocks;
+    blocks.reserve( tiles.size() );
     {
-        // Coalesce white/black tiles
-        bool evictable = true;
-        WhiteBlackTileType wbtype = WB_NONE;
-        if( coalesceWhiteBlackTiles && useNewBlock && m_texture->getFillType() == CU_MEMORYTYPE_HOST )
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TILE_ALLOCATION );
+        for( size_t i = 0; i < tiles.size(); ++i )
         {
-            char* tbuff = reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr );
-            const imageSource::TextureInfo& info = m_texture->getInfo();
-            wbtype = classifyTileAsWhiteOrBlack( tbuff, info.format, info.numChannels );
-            if( wbtype != WB_NONE )
+            TileBlockHandle bh = deviceMemoryManager->allocateTileBlock( TILE_SIZE_IN_BYTES );
+            if( bh.block.isBad() )
             {
-                evictable = false;
-                if( deviceMemoryManager->getWhiteBlackTileBlock( wbtype ).handle != 0 )
-                {
-                    deviceMemoryManager->freeTileBlock( bh.block );
-                    m_loader->freeTransferBuffer( transferBuffer, stream );
-                    otk::TileBlockHandle cbh = deviceMemoryManager->getWhiteBlackTileBlock( wbtype );
-                    m_texture->mapTile( stream, mipLevel, tileX, tileY, cbh.handle, cbh.block.offset() );
-                    m_loader->setPageTableEntry( pageId, evictable, cbh.block.data );
-                    return;
-                }
-                else
-                {
-                    deviceMemoryManager->setWhiteBlackTileBlock( wbtype, bh );
-                }
+                // If the allocation failed, set max memory to current size to prevent repeat requests.
+                m_loader->setMaxTextureMemory( deviceMemoryManager->getTextureTileMemory() );
+                break;
             }
+            blocks.push_back( bh );
         }
+    }
+    const unsigned int numTiles = static_cast<unsigned int>( blocks.size() );
+    if( numTiles == 0 )
+        return;
 
-        // Copy data from transfer buffer to the sparse texture on the device
-        m_texture->fillTile( stream,
-                             mipLevel, tileX, tileY,                                     // Tile to fill
-                             reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr ),  // Src buffer
-                             transferBuffer.memoryType, TILE_SIZE_IN_BYTES,              // Src type and size
-                             bh.handle, bh.block.offset()                                // Dest
-                             );
+    // Allocate a single transfer buffer for all the tiles.
+    const size_t       bufferSize = numTiles * TILE_SIZE_IN_BYTES;
+    TransferBufferDesc transferBuffer;
+    {
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TRANSFER_BUFFER );
+        transferBuffer = m_loader->allocateTransferBuffer( m_texture->getFillType(), bufferSize, stream );
+    }
+    if( transferBuffer.memoryBlock.size == 0 )
+    {
+        for( TileBlockHandle& bh : blocks )
+            deviceMemoryManager->freeTileBlock( bh.block );
+        return;
+    }
 
-        // Add a mapping for the tile, which will be sent to the device in pushMappings().
-        if( useNewBlock )
+    // Copy the tiles found in the host tile cache to the front of the transfer buffer, moving them to the
+    // front of the batch (the tile blocks are interchangeable), so that the remaining tiles are contiguous.
+    char*          buffer        = reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr );
+    HostTileCache* hostTileCache = getHostTileCache();
+    unsigned int   numCached     = 0;
+    for( unsigned int i = 0; hostTileCache && i < numTiles; ++i )
+    {
+        if( hostTileCache->find( m_texture->getId(), mipLevel, tiles[i].x, tiles[i].y, buffer + numCached * TILE_SIZE_IN_BYTES,
+                                 getTileSizeInBytes() ) )
         {
-            m_loader->setPageTableEntry( pageId, evictable, static_cast<unsigned long long>( bh.block.data ) );
+            std::swap( tiles[i], tiles[numCached] );
+            std::swap( tilePageIds[i], tilePageIds[numCached] );
+            ++numCached;
         }
     }
-    else
+
+    // Read the remaining tiles (possibly from disk) into the transfer buffer.
+    bool satisfied = true;
+    if( numCached < numTiles )
     {
-        deviceMemoryManager->freeTileBlock( bh.block );
+        char* readBuffer = buffer + numCached * TILE_SIZE_IN_BYTES;
+        try
+        {
+            LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_READ_TILE );
+            satisfied = m_texture->readTiles( mipLevel, tiles.data() + numCached, numTiles - numCached, readBuffer,
+                                              transferBuffer.memoryBlock.size - numCached * TILE_SIZE_IN_BYTES, stream );
+        }
+        catch( const std::exception& e )
+        {
+            std::stringstream ss;
+            ss << "readTiles call failed: " << e.what() << ": " << __FILE__ << " (" << __LINE__ << ")";
+            throw std::runtime_error( ss.str().c_str() );
+        }
+        for( unsigned int i = numCached; satisfied && hostTileCache && i < numTiles; ++i )
+            hostTileCache->insert( m_texture->getId(), mipLevel, tiles[i].x, tiles[i].y, buffer + i * TILE_SIZE_IN_BYTES,
+                                   getTileSizeInBytes(), getTexelBlockSizeInBytes() );
+    }
+
+    for( unsigned int i = 0; i < numTiles; ++i )
+    {
+        if( i < numCached || satisfied )
+            fillTileFromBuffer( stream, tilePageIds[i], mipLevel, tiles[i].x, tiles[i].y, buffer + i * TILE_SIZE_IN_BYTES,
+                                transferBuffer.memoryType, blocks[i], true );
+        else
+            deviceMemoryManager->freeTileBlock( blocks[i].block );
     }
 
     m_loader->freeTransferBuffer( transferBuffer, stream );
 }
 
+void TextureRequestHandler::fillTileFromBuffer( CUstream stream, unsigned int pageId, unsigned int mipLevel, unsigned int tileX,
+                                                unsigned int tileY, char* tileData, CUmemorytype tileDataType,
+                                                TileBlockHandle bh, bool useNewBlock )
+{
+    DeviceMemoryManager* deviceMemoryManager = m_loader->getDeviceMemoryManager();
+
+    // Coalesce white/black tiles
+    bool evictable = true;
+    WhiteBlackTileType wbtype = WB_NONE;
+    if( m_loader->getOptions().coalesceWhiteBlackTiles && useNewBlock && m_texture->getFillType() == CU_MEMORYTYPE_HOST )
+    {
+        const imageSource::TextureInfo& info = m_texture->getInfo();
+        wbtype = classifyTileAsWhiteOrBlack( tileData, info.format, info.numChannels );
+        if( wbtype != WB_NONE )
+        {
+            evictable = false;
+            if( deviceMemoryManager->getWhiteBlackTileBlock( wbtype ).handle != 0 )
+            {
+                deviceMemoryManager->freeTileBlock( bh.block );
+                otk::TileBlockHandle cbh = deviceMemoryManager->getWhiteBlackTileBlock( wbtype );
+                m_texture->mapTile( stream, mipLevel, tileX, tileY, cbh.handle, cbh.block.offset() );
+                m_loader->setPageTableEntry( pageId, evictable, cbh.block.data );
+                return;
+            }
+            else
+            {
+                deviceMemoryManager->setWhiteBlackTileBlock( wbtype, bh );
+            }
+        }
+    }
+
+    // Coalesce tiles with identical contents.  The first tile with given contents is filled as usual, and
+    // later ones map its block (adding a reference to it) instead of being copied to the device.  The block
+    // is published to the deduplicator only after the copy that fills it is enqueued (see below).
+    TileDeduplicator* deduplicator = deviceMemoryManager->getTileDeduplicator();
+    const bool        deduplicate =
+        deduplicator && useNewBlock && wbtype == WB_NONE && m_texture->getFillType() == CU_MEMORYTYPE_HOST;
+    TileKey           key{};
+    if( deduplicate )
+    {
+        const imageSource::TextureInfo& info   = m_texture->getInfo();
+        const uint64_t                  layout = ( static_cast<uint64_t>( info.format ) << 32 ) | info.numChannels;
+        key                                    = TileDeduplicator::hashTile( tileData, TILE_SIZE_IN_BYTES, layout );
+
+        TileBlockHandle sbh = deduplicator->findAndAddRef( key, stream );
+        if( sbh.handle != 0 )
+        {
+            deviceMemoryManager->freeTileBlock( bh.block );
+            m_texture->mapTile( stream, mipLevel, tileX, tileY, sbh.handle, sbh.block.offset() );
+            m_loader->setPageTableEntry( pageId, evictable, sbh.block.data );
+            return;
+        }
+    }
+
+    // Copy data from transfer buffer to the sparse texture on the device
+    {
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_FILL_TILE );
+        m_texture->fillTile( stream,
+                             mipLevel, tileX, tileY,            // Tile to fill
+                             tileData,                          // Src buffer
+                             tileDataType, TILE_SIZE_IN_BYTES,  // Src type and size
+                             bh.handle, bh.block.offset()       // Dest
+                             );
+    }
+    if( deduplicate )
+        deduplicator->insert( key, bh, stream );
+
+    // Add a mapping for the tile, which will be sent to the device in pushMappings().
+    if( useNewBlock )
+    {
+        m_loader->setPageTableEntry( pageId, evictable, static_cast<unsigned long long>( bh.block.data ) );
+    }
+}
+
 void TextureRequestHandler::fillMipTailRequest( CUstream stream, unsigned int pageId, TileBlockHandle bh )
 {
     SCOPED_NVTX_RANGE_FUNCTION_NAME();
@@ -178,7 +420,10 @@ void TextureRequestHandler::fillMipTailRequest( CUstream stream, unsigned int pa
     bool useNewBlock = bh.block.isBad();
     if( useNewBlock )
     {
-        bh = deviceMemoryManager->allocateTileBlock( mipTailSize );
+        {
+            LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TILE_ALLOCATION );
+            bh = deviceMemoryManager->allocateTileBlock( mipTailSize );
+        }
         if( bh.block.isBad() )
         {
             // If the allocation failed, set max memory to current size and turn on eviction.
@@ -188,7 +433,11 @@ void TextureRequestHandler::fillMipTailRequest( CUstream stream, unsigned int pa
     }
 
     // Allocate a transfer buffer.
-    TransferBufferDesc transferBuffer = m_loader->allocateTransferBuffer( m_texture->getFillType(), mipTailSize, stream );
+    TransferBufferDesc transferBuffer;
+    {
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_TRANSFER_BUFFER );
+        transferBuffer = m_loader->allocateTransferBuffer( m_texture->getFillType(), mipTailSize, stream );
+    }
     if( transferBuffer.memoryBlock.size == 0 )
     {
         deviceMemoryManager->freeTileBlock( bh.block );
@@ -199,6 +448,7 @@ void TextureRequestHandler::fillMipTailRequest( CUstream stream, unsigned int pa
     bool satisfied;
     try
     {
+        LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_READ_TILE );
         satisfied = m_texture->readMipTail( reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr ), mipTailSize, stream );
     }
     catch( const std::exception& e )
@@ -211,11 +461,14 @@ void TextureRequestHandler::fillMipTailRequest( CUstream stream, unsigned int pa
     if( satisfied )
     {
         // Copy data from the transfer buffer to the sparse texture on the device
-        m_texture->fillMipTail( stream,
-                                reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr ),  // Src buffer
-                                transferBuffer.memoryType, mipTailSize,                     // Src type and size
-                                bh.handle, bh.block.offset()                                // Dest
-                                );
+        {
+            LatencyTimer timer( m_loader->getLatencyRecorder(), STAGE_FILL_TILE );
+            m_texture->fillMipTail( stream,
+                                    reinterpret_cast<char*>( transferBuffer.memoryBlock.ptr ),  // Src buffer
+                                    transferBuffer.memoryType, mipTailSize,                     // Src type and size
+                                    bh.handle, bh.block.offset()                                // Dest
+                                    );
+        }
 
         // Add a mapping for the mip tail, which will be sent to the device in pushMappings().
 
@@ -261,6 +514,25 @@ void TextureRequestHandler::unmapTileResource( CUstream stream, unsigned int pag
     }
 }
 
+HostTileCache* TextureRequestHandler::getHostTileCache() const
+{
+    // Only tiles read into host memory are cached.
+    return m_texture->getFillType() == CU_MEMORYTYPE_HOST ? m_loader->getHostTileCache() : nullptr;
+}
+
+unsigned int TextureRequestHandler::getTexelBlockSizeInBytes() const
+{
+    // Tiles of block compressed textures are uniform if all of their 4x4 blocks are the same.
+    const imageSource::TextureInfo& info      = m_texture->getInfo();
+    const unsigned int              blockSize = imageSource::isBcFormat( info.format ) ? 4 : 1;
+    return static_cast<unsigned int>( imageSource::getImageSizeInBytes( info, blockSize, blockSize ) );
+}
+
+size_t TextureRequestHandler::getTileSizeInBytes() const
+{
+    return imageSource::getImageSizeInBytes( m_texture->getInfo(), m_texture->getTileWidth(), m_texture->getTileHeight() );
+}
+
 unsigned int TextureRequestHandler::getTextureTilePageId( unsigned int mipLevel, unsigned int tileX, unsigned int tileY )
 {
     const demandLoading::TextureSampler& sampler = getTexture()->getSampler();
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,6 +13,7 @@ namespace demandLoading {
 
 class DemandLoaderImpl;
 class DemandTextureImpl;
+class HostTileCache;
 
 class TextureRequestHandler : public RequestHandler
 {
@@ -30,6 +31,14 @@ class TextureRequestHandler : public RequestHandler
     /// Fill a request for the specified page using the given stream.  
     void fillRequest( CUstream stream, unsigned int pageId ) override;
 
+    /// Fill requests for a batch of pages using the given stream.  Adjacent tiles from the same
+    /// mip level are read with a single call to the ImageSource into one transfer buffer.
+    void fillRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds ) override;
+
+    /// Get the priority of a request for the specified page.  The mip tail is filled first,
+    /// followed by tiles from coarse to fine mip levels.
+    unsigned int getRequestPriority( unsigned int pageId ) override;
+
     // Load or reload a page
     void loadPage( CUstream stream, unsigned int pageId, bool reloadIfResident );
 
@@ -47,7 +56,13 @@ class TextureRequestHandler : public RequestHandler
     DemandLoaderImpl*  m_loader = nullptr;
 
     void fillTileRequest( CUstream stream, unsigned int pageId, otk::TileBlockHandle bh );
+    void fillTileRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds );
+    void fillTileFromBuffer( CUstream stream, unsigned int pageId, unsigned int mipLevel, unsigned int tileX, unsigned int tileY,
+                             char* tileData, CUmemorytype tileDataType, otk::TileBlockHandle bh, bool useNewBlock );
     void fillMipTailRequest( CUstream stream, unsigned int pageId, otk::TileBlockHandle bh );
+    HostTileCache* getHostTileCache() const;
+    unsigned int getTexelBlockSizeInBytes() const;  // size of a texel, or of a 4x4 block of a BC format
+    size_t getTileSizeInBytes() const;
 };
 
 }  // namespace demandLoading
@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/DemandLoading/TraceSimulator.h>
+
+#include "Util/TraceFile.h"
+
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace demandLoading {
+
+PageTrace readPageTrace( const std::string& filename, unsigned int deviceIndex )
+{
+    std::ifstream file( filename, std::ios::in | std::ios::binary );
+    if( !file )
+        throw std::runtime_error( "Cannot open trace file " + filename );
+    TraceInput input( file );
+    PageTrace  trace;
+    bool       foundOptions = false;
+
+    TraceRecordType recordType;
+    while( input.read( &recordType ) )
+    {
+        const unsigned int recordDevice = input.readValue<unsigned int>();
+        if( recordType == TRACE_OPTIONS )
+        {
+            const Options options = input.readOptions();
+            if( recordDevice == deviceIndex && !foundOptions )
+            {
+                trace.options = options;
+                foundOptions  = true;
+            }
+        }
+        else if( recordType == TRACE_TEXTURE )
+        {
+            // Skip the serialized image reader (filename and readBaseColor flag) and texture descriptor
+            // (address modes, filter mode, mipmap filter mode, max anisotropy, and flags).
+            input.readString();
+            input.readValue<bool>();
+            int32_t descriptor[6];
+            if( !input.read( descriptor, 6 ) )
+                throw std::runtime_error( "Unexpected end of trace file" );
+        }
+        else if( recordType == TRACE_REQUESTS )
+        {
+            unsigned int              streamId;
+            std::vector<unsigned int> pageIds = input.readRequests( &streamId );
+            if( recordDevice == deviceIndex )
+                trace.launches.push_back( std::move( pageIds ) );
+        }
+        else
+        {
+            throw std::runtime_error( "Unknown record type in trace file" );
+        }
+    }
+
+    if( !foundOptions )
+        throw std::runtime_error( "No options record for the device in trace file " + filename );
+    return trace;
+}
+
+void writePageTrace( const std::string& filename, const PageTrace& trace )
+{
+    std::ofstream file( filename, std::ios::out | std::ios::binary );
+    if( !file )
+        throw std::runtime_error( "Cannot open trace file " + filename );
+    TraceOutput        output( file );
+    const unsigned int deviceIndex = 0;
+    const unsigned int streamId    = 0;
+
+    output.writeValue( TRACE_OPTIONS );
+    output.writeValue( deviceIndex );
+    output.writeOptions( trace.options );
+    for( const std::vector<unsigned int>& pageIds : trace.launches )
+        output.writeRequests( deviceIndex, streamId, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+
+    file.flush();
+    if( !file )
+        throw std::runtime_error( "Error writing trace file " + filename );
+}
+
+TraceSimulator::TraceSimulator( const Options& options )
+    : m_options( options )
+    , m_maxTiles( options.maxTexMemPerDevice ? options.maxTexMemPerDevice / otk::TILE_SIZE_IN_BYTES :
+                                               std::numeric_limits<size_t>::max() )
+{
+}
+
+SimulatedLaunchStatistics TraceSimulator::simulateLaunch( const unsigned int* pageIds, unsigned int numPageIds )
+{
+    SimulatedLaunchStatistics stats;
+    ++m_launchNum;
+
+    // The reference bits are a set, visited in page order by the pull requests kernel.
+    std::vector<unsigned int> referenced( pageIds, pageIds + numPageIds );
+    std::sort( referenced.begin(), referenced.end() );
+    referenced.erase( std::unique( referenced.begin(), referenced.end() ), referenced.end() );
+    referenced.erase( std::lower_bound( referenced.begin(), referenced.end(), m_options.numPages ), referenced.end() );
+    stats.numReferencedPages = static_cast<unsigned int>( referenced.size() );
+
+    // Pull requests: gather requested pages (referenced but not resident).  If stale pages are
+    // requested, reset the lru counters of fresh pages (referenced and resident), and increment the
+    // counters of stale pages (resident but not referenced), gathering those above the threshold.
+    std::vector<unsigned int> requests;
+    std::vector<StalePage>    stalePages;
+    auto                      ref = referenced.begin();
+    for( auto it = m_pageTable.begin(); it != m_pageTable.end() || ref != referenced.end(); )
+    {
+        const bool isReferenced = ref != referenced.end() && ( it == m_pageTable.end() || *ref <= it->first );
+        const bool isMapped     = it != m_pageTable.end() && ( ref == referenced.end() || it->first <= *ref );
+        const bool isResident   = isMapped && it->second.resident;
+
+        if( isReferenced && !isResident )
+        {
+            if( requests.size() < m_options.maxRequestedPages )
+                requests.push_back( *ref );
+            else
+                ++stats.numDroppedRequests;
+        }
+        else if( isReferenced )
+        {
+            ++stats.numHits;
+            if( m_options.maxStalePages > 0 && m_options.useLruTable && it->second.lruVal != NON_EVICTABLE_LRU_VAL )
+                it->second.lruVal = 0;
+        }
+        else if( isResident && m_options.maxStalePages > 0 )
+        {
+            Page&              page   = it->second;
+            const unsigned int lruVal = m_options.useLruTable ? lruInc( page.lruVal, m_launchNum + it->first ) : MAX_LRU_VAL;
+            if( m_options.useLruTable )
+                page.lruVal = lruVal;
+            if( lruVal >= m_lruThreshold && lruVal != NON_EVICTABLE_LRU_VAL && stalePages.size() < m_options.maxStalePages )
+                stalePages.push_back( StalePage{it->first, lruVal} );
+        }
+
+        if( isReferenced )
+            ++ref;
+        if( isMapped )
+            ++it;
+    }
+    stats.numStalePages = static_cast<unsigned int>( stalePages.size() );
+
+    // Restore staged pages that were requested (second chance).
+    for( size_t i = 0; i < requests.size(); )
+    {
+        auto it = m_pageTable.find( requests[i] );
+        if( it != m_pageTable.end() && it->second.staged && !it->second.resident )
+        {
+            it->second.staged   = false;
+            it->second.resident = true;
+            it->second.lruVal   = 0;
+            ++stats.numRestoredPages;
+            requests[i] = requests.back();
+            requests.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    stats.numRequests = static_cast<unsigned int>( requests.size() ) + stats.numRestoredPages;
+
+    // Sort and stage stale pages, and update the lru threshold.
+    unsigned int medianLruVal = 0;
+    if( !stalePages.empty() )
+    {
+        if( m_options.useLruTable )
+        {
+            std::stable_sort( stalePages.begin(), stalePages.end(), []( StalePage a, StalePage b ) { return a.lruVal < b.lruVal; } );
+            medianLruVal = stalePages[stalePages.size() / 2].lruVal;
+        }
+        else
+        {
+            std::shuffle( stalePages.begin(), stalePages.end(), m_rng );
+        }
+
+        size_t numStaged = getNumStagedPages();
+        if( m_evictionActive && numStaged < m_options.maxStagedPages )
+        {
+            m_stagedPages.push_back( StagedPageList{m_launchNum, std::deque<unsigned int>()} );
+            unsigned int numInvalidated = 0;
+            for( auto sp = stalePages.rbegin(); sp != stalePages.rend(); ++sp )
+            {
+                if( numStaged >= m_options.maxStagedPages || numInvalidated + 1 >= m_options.maxInvalidatedPages )
+                    break;
+                Page& page = m_pageTable[sp->pageId];
+                if( page.resident && !page.inStagedList )
+                {
+                    page.resident     = false;
+                    page.staged       = true;
+                    page.inStagedList = true;
+                    m_stagedPages.back().pageIds.push_back( sp->pageId );
+                    ++numInvalidated;
+                    ++numStaged;
+                    ++stats.numStagedPages;
+                }
+            }
+        }
+    }
+    m_lruThreshold = updateLruThreshold( m_lruThreshold, stats.numStalePages, m_options.maxStalePages, medianLruVal );
+
+    // Fill the requests, freeing staged tiles as needed.  Requests are filled in page order.
+    std::sort( requests.begin(), requests.end() );
+    for( unsigned int pageId : requests )
+    {
+        if( isTile( pageId ) )
+        {
+            while( needTilesFreed() )
+            {
+                m_evictionActive = m_options.evictionActive;
+                if( !freeStagedPage( stats ) )
+                    break;
+            }
+            if( !allocateTile() )
+            {
+                ++stats.numFailedLoads;
+                continue;
+            }
+            ++stats.numTilesLoaded;
+            stats.bytesTransferred += otk::TILE_SIZE_IN_BYTES;
+        }
+        m_pageTable[pageId] = Page{isTile( pageId ) ? 0 : NON_EVICTABLE_LRU_VAL, true, false, false};
+    }
+
+    // Push mappings.  The new mappings become resident, and the pages staged by this launch are
+    // invalidated on the device, so they can be freed by the next launch.
+    for( const auto& entry : m_pageTable )
+    {
+        if( entry.second.resident && isTile( entry.first ) )
+            ++stats.numResidentTiles;
+    }
+    stats.lruThreshold = m_lruThreshold;
+    return stats;
+}
+
+size_t TraceSimulator::getNumStagedPages() const
+{
+    size_t numPages = 0;
+    for( const StagedPageList& list : m_stagedPages )
+        numPages += list.pageIds.size();
+    return numPages;
+}
+
+bool TraceSimulator::needTilesFreed() const
+{
+    // The same condition as DeviceMemoryManager::needTileBlocksFreed.
+    return m_numTiles >= m_maxTiles && m_numFreeTiles < m_options.maxStagedPages;
+}
+
+bool TraceSimulator::freeStagedPage( SimulatedLaunchStatistics& stats )
+{
+    // Pages staged by the current launch have not been invalidated on the device yet.
+    while( !m_stagedPages.empty() && m_stagedPages.front().launchNum < m_launchNum )
+    {
+        std::deque<unsigned int>& pageIds = m_stagedPages.front().pageIds;
+        if( pageIds.empty() )
+        {
+            m_stagedPages.pop_front();
+            continue;
+        }
+
+        const unsigned int pageId = pageIds.front();
+        pageIds.pop_front();
+
+        auto it = m_pageTable.find( pageId );
+        if( it == m_pageTable.end() )
+            continue;
+        it->second.inStagedList = false;
+
+        // Pages restored by second chance are not freed.
+        if( it->second.staged )
+        {
+            m_pageTable.erase( it );
+            if( isTile( pageId ) )
+            {
+                ++m_numFreeTiles;
+                ++stats.numEvictions;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TraceSimulator::allocateTile()
+{
+    if( m_numFreeTiles > 0 )
+    {
+        --m_numFreeTiles;
+        return true;
+    }
+    if( m_numTiles < m_maxTiles )
+    {
+        ++m_numTiles;
+        return true;
+    }
+    return false;
+}
+
+std::vector<SimulatedLaunchStatistics> simulatePageTrace( const PageTrace& trace, const Options& options )
+{
+    TraceSimulator                         simulator( options );
+    std::vector<SimulatedLaunchStatistics> stats;
+    stats.reserve( trace.launches.size() );
+    for( const std::vector<unsigned int>& pageIds : trace.launches )
+        stats.push_back( simulator.simulateLaunch( pageIds ) );
+    return stats;
+}
+
+}  // namespace demandLoading
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/DemandLoading/DetailedStatistics.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace demandLoading {
+
+/// LatencyRecorder accumulates per-stage latency histograms from many threads.  Each thread records
+/// into its own shard of counters (threads are assigned shards round robin), using relaxed atomic
+/// increments, so recording costs a few uncontended adds.  Shards are summed when a snapshot is
+/// taken, which may be concurrent with recording.
+class LatencyRecorder
+{
+  public:
+    LatencyRecorder()
+    {
+        for( Shard& shard : m_shards )
+        {
+            for( Counters& counters : shard.stages )
+            {
+                counters.count.store( 0, std::memory_order_relaxed );
+                counters.totalNanoseconds.store( 0, std::memory_order_relaxed );
+                counters.maxNanoseconds.store( 0, std::memory_order_relaxed );
+                for( std::atomic<uint64_t>& bucket : counters.buckets )
+                    bucket.store( 0, std::memory_order_relaxed );
+            }
+        }
+    }
+
+    LatencyRecorder( const LatencyRecorder& )            = delete;
+    LatencyRecorder& operator=( const LatencyRecorder& ) = delete;
+
+    /// Record a latency for the given stage, in seconds.
+    void record( LatencyStage stage, double seconds )
+    {
+        Counters&      counters    = m_shards[getShardIndex()].stages[stage];
+        const uint64_t nanoseconds = seconds > 0.0 ? static_cast<uint64_t>( seconds * 1.0e9 + 0.5 ) : 0;
+        counters.count.fetch_add( 1, std::memory_order_relaxed );
+        counters.totalNanoseconds.fetch_add( nanoseconds, std::memory_order_relaxed );
+        counters.buckets[LatencyHistogram::getBucket( seconds )].fetch_add( 1, std::memory_order_relaxed );
+
+        // Only the owning thread usually writes the shard's maximum, so the loop rarely repeats.
+        uint64_t maxNanoseconds = counters.maxNanoseconds.load( std::memory_order_relaxed );
+        while( nanoseconds > maxNanoseconds
+               && !counters.maxNanoseconds.compare_exchange_weak( maxNanoseconds, nanoseconds, std::memory_order_relaxed ) )
+        {
+        }
+    }
+
+    /// Sum the shards into an array of NUM_LATENCY_STAGES histograms.
+    void getHistograms( LatencyHistogram* histograms ) const
+    {
+        for( unsigned int stage = 0; stage < NUM_LATENCY_STAGES; ++stage )
+        {
+            LatencyHistogram& histogram = histograms[stage];
+            histogram                   = LatencyHistogram{};
+            uint64_t totalNanoseconds   = 0;
+            uint64_t maxNanoseconds     = 0;
+            for( const Shard& shard : m_shards )
+            {
+                const Counters& counters = shard.stages[stage];
+                histogram.count += counters.count.load( std::memory_order_relaxed );
+                totalNanoseconds += counters.totalNanoseconds.load( std::memory_order_relaxed );
+                maxNanoseconds = std::max( maxNanoseconds, counters.maxNanoseconds.load( std::memory_order_relaxed ) );
+                for( unsigned int i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i )
+                    histogram.buckets[i] += counters.buckets[i].load( std::memory_order_relaxed );
+            }
+            histogram.totalTime = totalNanoseconds * 1.0e-9;
+            histogram.maxTime   = maxNanoseconds * 1.0e-9;
+        }
+    }
+
+  private:
+    static const unsigned int NUM_SHARDS = 16;
+
+    struct Counters
+    {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> totalNanoseconds;
+        std::atomic<uint64_t> maxNanoseconds;
+        std::atomic<uint64_t> buckets[LatencyHistogram::NUM_BUCKETS];
+    };
+
+    // Pad the shards to avoid false sharing between threads.
+    struct Shard
+    {
+        Counters stages[NUM_LATENCY_STAGES];
+        char     padding[64];
+    };
+
+    Shard m_shards[NUM_SHARDS];
+
+    static unsigned int getShardIndex()
+    {
+        static std::atomic<unsigned int> nextIndex{0};
+        static thread_local unsigned int index = nextIndex.fetch_add( 1, std::memory_order_relaxed ) % NUM_SHARDS;
+        return index;
+    }
+};
+
+/// Records the time from construction to destruction in a LatencyRecorder.  Does nothing (and
+/// does not read the clock) if the recorder is null.
+class LatencyTimer
+{
+  public:
+    LatencyTimer( LatencyRecorder* recorder, LatencyStage stage )
+        : m_recorder( recorder )
+        , m_stage( stage )
+    {
+        if( m_recorder )
+            m_startTime = std::chrono::steady_clock::now();
+    }
+
+    ~LatencyTimer()
+    {
+        if( m_recorder )
+            m_recorder->record( m_stage, std::chrono::duration<double>( std::chrono::steady_clock::now() - m_startTime ).count() );
+    }
+
+    LatencyTimer( const LatencyTimer& )            = delete;
+    LatencyTimer& operator=( const LatencyTimer& ) = delete;
+
+  private:
+    LatencyRecorder*                      m_recorder;
+    LatencyStage                          m_stage;
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+}  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -15,13 +15,6 @@
 
 namespace demandLoading {
 
-enum RecordType
-{
-    OPTIONS,
-    TEXTURE,
-    REQUESTS
-};
-
 // Check that the current CUDA context matches the one associated with the given stream
 // and return the associated device index.
 static unsigned int getDeviceIndex( CUstream /*stream*/ )
@@ -49,30 +42,12 @@ TraceFileWriter::~TraceFileWriter()
     m_file.close();
 }
 
-template <>
-void TraceFileWriter::write( const std::string& str )
-{
-    write( str.size() );
-    write( str.data(), str.size() );
-}
-
 void TraceFileWriter::recordOptions( const Options& options )
 {
     std::unique_lock<std::mutex> lock( m_mutex );
-    write( OPTIONS );
-    write( getDeviceIndex( CUstream{0} ) );
-    writeOption( "numPages", options.numPages );
-    writeOption( "numPageTableEntries", options.numPageTableEntries );
-    writeOption( "maxRequestedPages", options.maxRequestedPages );
-    writeOption( "maxFilledPages", options.maxFilledPages );
-    writeOption( "maxStalePages", options.maxStalePages );
-    writeOption( "maxEvictablePages", options.maxEvictablePages );
-    writeOption( "maxInvalidatedPages", options.maxInvalidatedPages );
-    writeOption( "maxStagedPages", options.maxStagedPages );
-    writeOption( "useLruTable", options.useLruTable );
-    writeOption( "maxTexMemPerDevice", options.maxTexMemPerDevice );
-    writeOption( "maxPinnedMemory", options.maxPinnedMemory );
-    writeOption( "maxThreads", options.maxThreads );
+    m_output.writeValue( TRACE_OPTIONS );
+    m_output.writeValue( getDeviceIndex( CUstream{0} ) );
+    m_output.writeOptions( options );
 }
 
 void TraceFileWriter::recordTexture( std::shared_ptr<imageSource::ImageSource> imageSource, const TextureDescriptor& desc )
@@ -84,17 +59,17 @@ void TraceFileWriter::recordTexture( std::shared_ptr<imageSource::ImageSource> i
     if( !exrReader )
         throw std::runtime_error( "Cannot serialize ImageSource (expected EXRReader)" );
 
-    write( TEXTURE );
-    write( getDeviceIndex( CUstream{0} ) );
+    m_output.writeValue( TRACE_TEXTURE );
+    m_output.writeValue( getDeviceIndex( CUstream{0} ) );
     exrReader->serialize( m_file );
 
     // Serialize TextureDescriptor.
-    write( desc.addressMode[0] );
-    write( desc.addressMode[1] );
-    write( desc.filterMode );
-    write( desc.mipmapFilterMode );
-    write( desc.maxAnisotropy );
-    write( desc.flags );
+    m_output.writeValue( desc.addressMode[0] );
+    m_output.writeValue( desc.addressMode[1] );
+    m_output.writeValue( desc.filterMode );
+    m_output.writeValue( desc.mipmapFilterMode );
+    m_output.writeValue( desc.maxAnisotropy );
+    m_output.writeValue( desc.flags );
 }
 
 // CUDA streams are assigned integer identifiers as they are encountered.
@@ -117,11 +92,7 @@ void TraceFileWriter::recordRequests( CUstream stream, const unsigned int* pageI
     unsigned int deviceIndex = getDeviceIndex( stream );
     unsigned int streamId = getStreamId( stream ) ;
 
-    write( REQUESTS );
-    write( deviceIndex );
-    write( streamId );
-    write( numPageIds );
-    write( pageIds, numPageIds );
+    m_output.writeRequests( deviceIndex, streamId, pageIds, numPageIds );
 }
 
 class TraceFileReader
@@ -134,41 +105,24 @@ class TraceFileReader
 
     Options readOptions()
     {
-        RecordType recordType;
-        read( &recordType );
-        assert( recordType == OPTIONS );
-
-        Options options;
-        unsigned int deviceIndex = 0;
-        read( &deviceIndex );
-        readOption( "numPages", &options.numPages );
-        readOption( "numPageTableEntries", &options.numPageTableEntries );
-        readOption( "maxRequestedPages", &options.maxRequestedPages );
-        readOption( "maxFilledPages", &options.maxFilledPages );
-        readOption( "maxStalePages", &options.maxStalePages );
-        readOption( "maxEvictablePages", &options.maxEvictablePages );
-        readOption( "maxInvalidatedPages", &options.maxInvalidatedPages );
-        readOption( "maxStagedPages", &options.maxStagedPages );
-        readOption( "useLruTable", &options.useLruTable );
-        readOption( "maxTexMemPerDevice", &options.maxTexMemPerDevice );
-        readOption( "maxPinnedMemory", &options.maxPinnedMemory );
-        readOption( "maxThreads", &options.maxThreads );
-        return options;
+        if( m_input.readValue<TraceRecordType>() != TRACE_OPTIONS )
+            throw std::runtime_error( "Expected options record in trace file" );
+        m_input.readValue<unsigned int>();  // device index
+        return m_input.readOptions();
     }
 
     void replay( std::vector<DemandLoader*>& loaders )
     {
         while( true )
         {
-            RecordType recordType;
-            read( &recordType );
-            if( m_file.eof() )
+            TraceRecordType recordType;
+            if( !m_input.read( &recordType ) )
                 break;
-            if( recordType == TEXTURE )
+            if( recordType == TRACE_TEXTURE )
             {
                 replayCreateTexture( loaders );
             }
-            else if( recordType == REQUESTS )
+            else if( recordType == TRACE_REQUESTS )
             {
                 replayRequests( loaders );
             }
@@ -201,59 +155,25 @@ class TraceFileReader
 
   private:
     std::ifstream          m_file;
+    TraceInput             m_input{ m_file };
     std::vector<CUcontext> m_contexts;
     std::vector<CUstream>  m_streams;
 
-    template <typename T>
-    void read( T* dest )
-    {
-        m_file.read( reinterpret_cast<char*>( dest ), sizeof( T ) );
-    }
-
-    std::string readString()
-    {
-        size_t size;
-        read( &size );
-        std::vector<char> buffer( size );
-        m_file.read( buffer.data(), size );
-        return std::string( buffer.data(), size );
-    }
-
-    template <typename T>
-    void read( T* dest, unsigned int count )
-    {
-        m_file.read( reinterpret_cast<char*>( dest ), count * sizeof( T ) );
-    }
-
-    template <typename T>
-    void readOption( const std::string& expected, T* option )
-    {
-        std::string found = readString();
-        if( found != expected )
-        {
-            std::stringstream stream;
-            stream << "Error reading option from trace file.  Expected " << expected << ", found " << found;
-            throw std::runtime_error( stream.str().c_str() );
-        }
-        read( option );
-    }
-
     void replayCreateTexture( std::vector<DemandLoader*>& loaders )
     {
-        unsigned int deviceIndex = 0;
-        read( &deviceIndex );
+        const unsigned int deviceIndex = m_input.readValue<unsigned int>();
 
         // FIXME: The image sources can be shared between devices and variant textures.
         // This should be handled.
         std::shared_ptr<imageSource::ImageSource> imageSource( imageSource::EXRReader::deserialize( m_file ) );
 
         TextureDescriptor desc;
-        read( &desc.addressMode[0] );
-        read( &desc.addressMode[1] );
-        read( &desc.filterMode );
-        read( &desc.mipmapFilterMode );
-        read( &desc.maxAnisotropy );
-        read( &desc.flags );
+        m_input.read( &desc.addressMode[0] );
+        m_input.read( &desc.addressMode[1] );
+        m_input.read( &desc.filterMode );
+        m_input.read( &desc.mipmapFilterMode );
+        m_input.read( &desc.maxAnisotropy );
+        m_input.read( &desc.flags );
 
         OTK_ERROR_CHECK( cuCtxSetCurrent( m_contexts[deviceIndex] ) );
         loaders[deviceIndex]->createTexture( imageSource, desc );
@@ -278,17 +198,10 @@ class TraceFileReader
 
     void replayRequests( std::vector<DemandLoader*>& loaders )
     {
-        unsigned int deviceIndex;
-        read( &deviceIndex );
-
-        unsigned int streamId;
-        read( &streamId );
-
-        unsigned int numPageIds;
-        read( &numPageIds );
-
-        std::vector<unsigned int> pageIds( numPageIds );
-        read( pageIds.data(), numPageIds );
+        const unsigned int        deviceIndex = m_input.readValue<unsigned int>();
+        unsigned int              streamId;
+        std::vector<unsigned int> pageIds    = m_input.readRequests( &streamId );
+        const unsigned int        numPageIds = static_cast<unsigned int>( pageIds.size() );
 
         CUcontext context = getContext( deviceIndex );
         OTK_ERROR_CHECK( cuCtxSetCurrent( context ) );
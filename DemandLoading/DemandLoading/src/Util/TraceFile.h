@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/DemandLoading/Options.h>
+#include <OptiXToolkit/DemandLoading/Statistics.h>
+
+#include <cuda.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace imageSource {
+class ImageSource;
+}  // namespace imageSource
+
+namespace demandLoading {
+
+struct TextureDescriptor;
+
+/// Trace file record types.  Each record starts with its type and the index of the device that
+/// made it, followed by the options, a serialized texture, or a batch of requests (stream id,
+/// number of pages, and page ids).
+enum TraceRecordType : int32_t
+{
+    TRACE_OPTIONS,
+    TRACE_TEXTURE,
+    TRACE_REQUESTS
+};
+
+/// TraceOutput writes the binary encoding of trace file values to a stream.  Errors are left in
+/// the stream state.
+class TraceOutput
+{
+  public:
+    explicit TraceOutput( std::ostream& stream )
+        : m_stream( stream )
+    {
+    }
+
+    template <typename T>
+    void write( const T* values, size_t count = 1 )
+    {
+        m_stream.write( reinterpret_cast<const char*>( values ), count * sizeof( T ) );
+    }
+
+    template <typename T>
+    void writeValue( const T& value )
+    {
+        write( &value );
+    }
+
+    void writeString( const std::string& str )
+    {
+        writeValue( str.size() );
+        write( str.data(), str.size() );
+    }
+
+    template <typename T>
+    void writeOption( const std::string& name, const T& value )
+    {
+        writeString( name );
+        writeValue( value );
+    }
+
+    /// Write the body of an options record.
+    void writeOptions( const Options& options )
+    {
+        writeOption( "numPages", options.numPages );
+        writeOption( "numPageTableEntries", options.numPageTableEntries );
+        writeOption( "maxRequestedPages", options.maxRequestedPages );
+        writeOption( "maxFilledPages", options.maxFilledPages );
+        writeOption( "maxStalePages", options.maxStalePages );
+        writeOption( "maxEvictablePages", options.maxEvictablePages );
+        writeOption( "maxInvalidatedPages", options.maxInvalidatedPages );
+        writeOption( "maxStagedPages", options.maxStagedPages );
+        writeOption( "useLruTable", options.useLruTable );
+        writeOption( "maxTexMemPerDevice", options.maxTexMemPerDevice );
+        writeOption( "maxPinnedMemory", options.maxPinnedMemory );
+        writeOption( "maxThreads", options.maxThreads );
+    }
+
+    /// Write a requests record.
+    void writeRequests( unsigned int deviceIndex, unsigned int streamId, const unsigned int* pageIds, unsigned int numPageIds )
+    {
+        writeValue( TRACE_REQUESTS );
+        writeValue( deviceIndex );
+        writeValue( streamId );
+        writeValue( numPageIds );
+        write( pageIds, numPageIds );
+    }
+
+  private:
+    std::ostream& m_stream;
+};
+
+/// TraceInput reads the binary encoding of trace file values from a stream.  Throws an exception
+/// if a value is truncated or an option has an unexpected name.
+class TraceInput
+{
+  public:
+    explicit TraceInput( std::istream& stream )
+        : m_stream( stream )
+    {
+    }
+
+    /// Read count values, returning false at the end of the stream.
+    template <typename T>
+    bool read( T* dest, size_t count = 1 )
+    {
+        m_stream.read( reinterpret_cast<char*>( dest ), count * sizeof( T ) );
+        return static_cast<bool>( m_stream );
+    }
+
+    template <typename T>
+    T readValue()
+    {
+        T value;
+        if( !read( &value ) )
+            throw std::runtime_error( "Unexpected end of trace file" );
+        return value;
+    }
+
+    std::string readString()
+    {
+        const size_t      size = readValue<size_t>();
+        std::vector<char> buffer( size );
+        if( size > 0 && !read( buffer.data(), size ) )
+            throw std::runtime_error( "Unexpected end of trace file" );
+        return std::string( buffer.data(), size );
+    }
+
+    template <typename T>
+    void readOption( const std::string& expected, T* option )
+    {
+        const std::string found = readString();
+        if( found != expected )
+        {
+            std::stringstream stream;
+            stream << "Error reading option from trace file.  Expected " << expected << ", found " << found;
+            throw std::runtime_error( stream.str() );
+        }
+        *option = readValue<T>();
+    }
+
+    /// Read the body of an options record.
+    Options readOptions()
+    {
+        Options options;
+        readOption( "numPages", &options.numPages );
+        readOption( "numPageTableEntries", &options.numPageTableEntries );
+        readOption( "maxRequestedPages", &options.maxRequestedPages );
+        readOption( "maxFilledPages", &options.maxFilledPages );
+        readOption( "maxStalePages", &options.maxStalePages );
+        readOption( "maxEvictablePages", &options.maxEvictablePages );
+        readOption( "maxInvalidatedPages", &options.maxInvalidatedPages );
+        readOption( "maxStagedPages", &options.maxStagedPages );
+        readOption( "useLruTable", &options.useLruTable );
+        readOption( "maxTexMemPerDevice", &options.maxTexMemPerDevice );
+        readOption( "maxPinnedMemory", &options.maxPinnedMemory );
+        readOption( "maxThreads", &options.maxThreads );
+        return options;
+    }
+
+    /// Read the body of a requests record (after the device index), returning the page ids.
+    std::vector<unsigned int> readRequests( unsigned int* streamId )
+    {
+        *streamId                           = readValue<unsigned int>();
+        const unsigned int        numPageIds = readValue<unsigned int>();
+        std::vector<unsigned int> pageIds( numPageIds );
+        if( numPageIds > 0 && !read( pageIds.data(), numPageIds ) )
+            throw std::runtime_error( "Unexpected end of trace file" );
+        return pageIds;
+    }
+
+  private:
+    std::istream& m_stream;
+};
+
+/// TraceFileWriter records the options, textures, and requests of a demand loader, so that they
+/// can be replayed with replayTraceFile.  Thread safe.
+class TraceFileWriter
+{
+  public:
+    /// Open the trace file for writing.
+    explicit TraceFileWriter( const char* filename );
+
+    /// Close the trace file.
+    ~TraceFileWriter();
+
+    /// Record the demand loader options.
+    void recordOptions( const Options& options );
+
+    /// Record the creation of a texture.  Only EXRReader images can be recorded.
+    void recordTexture( std::shared_ptr<imageSource::ImageSource> imageSource, const TextureDescriptor& desc );
+
+    /// Record a batch of page requests.
+    void recordRequests( CUstream stream, const unsigned int* pageIds, unsigned int numPageIds );
+
+  private:
+    std::ofstream                    m_file;
+    TraceOutput                      m_output{ m_file };
+    std::mutex                       m_mutex;
+    std::map<CUstream, unsigned int> m_streamIds;
+    unsigned int                     m_nextStreamId = 0;
+
+    unsigned int getStreamId( CUstream stream );
+};
+
+/// Replay a trace file, creating a demand loader for each device.  Returns the statistics of the
+/// loader for the first device.
+Statistics replayTraceFile( const char* filename );
+
+}  // namespace demandLoading
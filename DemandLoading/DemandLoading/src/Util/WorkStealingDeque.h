@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace demandLoading {
+
+/// WorkStealingDeque is a fixed-capacity, lock-free Chase-Lev deque of pointers.  A single owner
+/// thread pushes and pops items at the bottom of the deque (LIFO), while any number of thief
+/// threads may concurrently steal items from the top (FIFO).  The memory orderings follow Le et
+/// al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+template <typename T>
+class WorkStealingDeque
+{
+  public:
+    /// Construct a deque that holds up to the specified number of items, which is rounded up to a
+    /// power of two.
+    explicit WorkStealingDeque( unsigned int capacity )
+    {
+        uint64_t size = 1;
+        while( size < capacity )
+            size <<= 1;
+        m_mask = size - 1;
+        m_items.reset( new std::atomic<T*>[size] );
+    }
+
+    /// Push an item on the bottom of the deque (owner only).  Returns false if the deque is full.
+    bool push( T* item )
+    {
+        const int64_t bottom = m_bottom.load( std::memory_order_relaxed );
+        const int64_t top    = m_top.load( std::memory_order_acquire );
+        if( bottom - top > static_cast<int64_t>( m_mask ) )
+            return false;
+        m_items[bottom & m_mask].store( item, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        m_bottom.store( bottom + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    /// Pop an item from the bottom of the deque (owner only).  Returns nullptr if the deque is empty.
+    T* pop()
+    {
+        const int64_t bottom = m_bottom.load( std::memory_order_relaxed ) - 1;
+        m_bottom.store( bottom, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t top = m_top.load( std::memory_order_relaxed );
+
+        if( top > bottom )
+        {
+            // The deque was empty.
+            m_bottom.store( bottom + 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+
+        T* item = m_items[bottom & m_mask].load( std::memory_order_relaxed );
+        if( top == bottom )
+        {
+            // Last item, which might be contended by a thief.
+            if( !m_top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+                item = nullptr;
+            m_bottom.store( bottom + 1, std::memory_order_relaxed );
+        }
+        return item;
+    }
+
+    /// Steal an item from the top of the deque (any thread).  Returns nullptr if the deque is
+    /// empty or if the steal lost a race with another thread.
+    T* steal()
+    {
+        int64_t top = m_top.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        const int64_t bottom = m_bottom.load( std::memory_order_acquire );
+        if( top >= bottom )
+            return nullptr;
+
+        T* item = m_items[top & m_mask].load( std::memory_order_relaxed );
+        if( !m_top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+            return nullptr;
+        return item;
+    }
+
+    /// Return the approximate number of items in the deque (any thread).
+    unsigned int size() const
+    {
+        const int64_t bottom = m_bottom.load( std::memory_order_relaxed );
+        const int64_t top    = m_top.load( std::memory_order_relaxed );
+        return bottom > top ? static_cast<unsigned int>( bottom - top ) : 0U;
+    }
+
+    /// Not copyable.
+    WorkStealingDeque( const WorkStealingDeque& ) = delete;
+
+    /// Not assignable.
+    WorkStealingDeque& operator=( const WorkStealingDeque& ) = delete;
+
+  private:
+    // The top and bottom indices are modified by different threads, so pad them onto separate cache lines.
+    std::atomic<int64_t>               m_top{0};
+    char                               m_padding[64 - sizeof( std::atomic<int64_t> )];
+    std::atomic<int64_t>               m_bottom{0};
+    uint64_t                           m_mask{};
+    std::unique_ptr<std::atomic<T*>[]> m_items;
+};
+
+}  // namespace demandLoading
@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "WorkStealingRequestProcessor.h"
+
+#include "PageTableManager.h"
+#include "RequestHandler.h"
+#include "TicketImpl.h"
+
+#include <OptiXToolkit/Error/ErrorCheck.h>
+#include <OptiXToolkit/Error/cuErrorCheck.h>
+
+#include <algorithm>
+#include <iostream>
+
+namespace demandLoading {
+
+namespace {
+
+// Capacity of each per-worker deque.
+const unsigned int WORKER_DEQUE_CAPACITY = 1024;
+
+// Maximum number of pages in a run of requests that is filled with a single handler call.
+const unsigned int MAX_PAGES_PER_REQUEST = 16;
+
+// Maximum number of requests a worker moves from an injection queue to its own deque at once.
+// Small chunks keep the work spread across workers, while still amortizing the injection lock.
+const unsigned int INJECTION_CHUNK_SIZE = 16;
+
+unsigned int getPriorityClass( unsigned int priority )
+{
+    if( priority >= REQUEST_PRIORITY_PREFETCH )
+        return NUM_REQUEST_PRIORITY_CLASSES - 1;
+    return std::min( priority, REQUEST_PRIORITY_TILE );
+}
+
+}  // anonymous namespace
+
+WorkStealingRequestProcessor::Worker::Worker( unsigned int capacity )
+{
+    for( std::unique_ptr<WorkStealingDeque<Request>>& deque : deques )
+        deque.reset( new WorkStealingDeque<Request>( capacity ) );
+}
+
+WorkStealingRequestProcessor::WorkStealingRequestProcessor( std::shared_ptr<PageTableManager> pageTableManager, const Options& options )
+    : m_pageTableManager( std::move( pageTableManager ) )
+    , m_options( options )
+{
+    for( std::atomic<size_t>& numInjected : m_numInjected )
+        numInjected = 0;
+}
+
+WorkStealingRequestProcessor::~WorkStealingRequestProcessor()
+{
+    stop();
+}
+
+void WorkStealingRequestProcessor::start()
+{
+    if( m_started )
+        return;
+
+    unsigned int maxThreads = m_options.maxThreads;
+    if( maxThreads == 0 )
+        maxThreads = std::thread::hardware_concurrency();
+    maxThreads = std::max( maxThreads, 1U );
+
+    m_isShutDown = false;
+    m_workers.clear();
+    for( unsigned int i = 0; i < maxThreads; ++i )
+        m_workers.emplace_back( new Worker( WORKER_DEQUE_CAPACITY ) );
+
+    m_threads.reserve( maxThreads );
+    for( unsigned int i = 0; i < maxThreads; ++i )
+    {
+        m_threads.emplace_back( &WorkStealingRequestProcessor::worker, this, i );
+    }
+    m_started = true;
+}
+
+void WorkStealingRequestProcessor::stop()
+{
+    std::unique_lock<std::mutex> lock( m_ticketsMutex );
+
+    if( !m_started )
+        return;
+
+    // Wake any sleeping workers, which exit when they see the shut down flag.
+    {
+        std::unique_lock<std::mutex> sleepLock( m_sleepMutex );
+        m_isShutDown = true;
+    }
+    m_workAvailable.notify_all();
+
+    for( std::thread& thread : m_threads )
+    {
+        thread.join();
+    }
+    m_threads.clear();
+    drainRequests();
+    m_workers.clear();
+    m_started = false;
+}
+
+void WorkStealingRequestProcessor::addRequests( CUstream /*stream*/, unsigned int id, const unsigned int* pageIds, unsigned int numPageIds )
+{
+    std::unique_lock<std::mutex> lock( m_ticketsMutex );
+    start();
+
+    auto it = m_tickets.find( id );
+    OTK_ASSERT( it != m_tickets.end() );
+    Ticket ticket = it->second;
+    // We won't issue this id again, so we can discard it from the map.
+    m_tickets.erase( it );
+
+    // Filter the batch of requests, which might also yield prefetch requests.
+    std::vector<unsigned int> filteredRequests;
+    std::vector<unsigned int> prefetchRequests;
+    if( numPageIds > 0 && m_requestFilter )
+    {
+        filteredRequests = m_requestFilter->filterAndPrefetch( pageIds, numPageIds, prefetchRequests );
+        pageIds          = filteredRequests.data();
+        numPageIds       = static_cast<unsigned int>( filteredRequests.size() );
+    }
+
+    // Don't overfill the queue.
+    size_t numPending = m_numPending.load();
+    if( numPending >= m_options.maxRequestQueueSize )
+        numPageIds = 0;
+    else if( numPageIds + numPending > m_options.maxRequestQueueSize )
+        numPageIds = static_cast<unsigned int>( m_options.maxRequestQueueSize - numPending );
+
+    // Update the ticket, now that the number of tasks is known.
+    TicketImpl::getImpl( ticket )->update( numPageIds );
+    if( numPageIds > 0 )
+        enqueueBatch( ticket, pageIds, numPageIds, false );
+
+    // Prefetch requests are only queued if there is room left, and are tracked by a separate
+    // ticket, so that waiting on the ticket for the requests does not wait for the prefetches.
+    numPending                 = m_numPending.load();
+    unsigned int numPrefetches = static_cast<unsigned int>( prefetchRequests.size() );
+    if( numPending >= m_options.maxRequestQueueSize )
+        numPrefetches = 0;
+    else if( numPrefetches + numPending > m_options.maxRequestQueueSize )
+        numPrefetches = static_cast<unsigned int>( m_options.maxRequestQueueSize - numPending );
+    if( numPrefetches > 0 )
+    {
+        Ticket prefetchTicket = TicketImpl::create( TicketImpl::getImpl( ticket )->getStream() );
+        TicketImpl::getImpl( prefetchTicket )->update( numPrefetches );
+        enqueueBatch( prefetchTicket, prefetchRequests.data(), numPrefetches, true );
+    }
+}
+
+void WorkStealingRequestProcessor::enqueueBatch( Ticket ticket, const unsigned int* pageIds, unsigned int numPageIds, bool prefetch )
+{
+    // Sort the pages by priority, and then by page id.  Tiles from coarser mip levels have lower
+    // priority values, so tiles are filled from coarse to fine.
+    struct PageInfo
+    {
+        unsigned int    pageId;
+        unsigned int    priority;
+        RequestHandler* handler;
+    };
+    std::vector<PageInfo> pages( numPageIds );
+    for( unsigned int i = 0; i < numPageIds; ++i )
+    {
+        RequestHandler*    handler  = m_pageTableManager->getRequestHandler( pageIds[i] );
+        const unsigned int priority = ( handler ? handler->getRequestPriority( pageIds[i] ) : REQUEST_PRIORITY_SAMPLER )
+                                      + ( prefetch ? REQUEST_PRIORITY_PREFETCH : 0 );
+        pages[i]                    = PageInfo{pageIds[i], priority, handler};
+    }
+    std::sort( pages.begin(), pages.end(), []( const PageInfo& a, const PageInfo& b ) {
+        return a.priority < b.priority || ( a.priority == b.priority && a.pageId < b.pageId );
+    } );
+
+    // Group the pages into runs of contiguous pages with the same handler and priority.
+    RequestBatch* batch = new RequestBatch;
+    batch->ticket       = ticket;
+    batch->queueTime    = std::chrono::steady_clock::now();
+    batch->pageIds.resize( numPageIds );
+    for( unsigned int i = 0; i < numPageIds; ++i )
+    {
+        batch->pageIds[i]    = pages[i].pageId;
+        const PageInfo& prev = pages[i > 0 ? i - 1 : 0];
+        Request*        run  = batch->requests.empty() ? nullptr : &batch->requests.back();
+        if( run && run->numPages < MAX_PAGES_PER_REQUEST && pages[i].handler == prev.handler
+            && pages[i].priority == prev.priority && pages[i].pageId == prev.pageId + 1 )
+            ++run->numPages;
+        else
+            batch->requests.push_back( Request{i, 1, pages[i].priority, pages[i].handler, batch} );
+    }
+    const unsigned int numRequests = static_cast<unsigned int>( batch->requests.size() );
+    batch->numRemaining            = numRequests;
+
+    // Publish the requests to the injection queues with a single lock acquisition.  The pending
+    // count is updated first, so that it never underestimates the number of queued requests.
+    m_numPending += numPageIds;
+    unsigned int numPerClass[NUM_REQUEST_PRIORITY_CLASSES] = {};
+    {
+        std::unique_lock<std::mutex> injectionLock( m_injectionMutex );
+        for( Request& request : batch->requests )
+        {
+            const unsigned int priorityClass = getPriorityClass( request.priority );
+            m_injected[priorityClass].push_back( &request );
+            ++numPerClass[priorityClass];
+        }
+        for( unsigned int priorityClass = 0; priorityClass < NUM_REQUEST_PRIORITY_CLASSES; ++priorityClass )
+            m_numInjected[priorityClass] += numPerClass[priorityClass];
+    }
+
+    // Wake only as many workers as there are chunks of work, rather than all of them.
+    notifyWorkers( ( numRequests + INJECTION_CHUNK_SIZE - 1 ) / INJECTION_CHUNK_SIZE );
+}
+
+void WorkStealingRequestProcessor::notifyWorkers( unsigned int numToWake )
+{
+    std::unique_lock<std::mutex> sleepLock( m_sleepMutex );
+    ++m_workEpoch;
+    numToWake = std::min( numToWake, m_numSleeping );
+    for( unsigned int i = 0; i < numToWake; ++i )
+        m_workAvailable.notify_one();
+}
+
+void WorkStealingRequestProcessor::setTicket( unsigned int id, Ticket ticket )
+{
+    std::unique_lock<std::mutex> lock( m_ticketsMutex );
+    OTK_ASSERT( m_tickets.find( id ) == m_tickets.end() );
+    m_tickets[id] = ticket;
+}
+
+WorkStealingRequestProcessor::Request* WorkStealingRequestProcessor::grabInjected( Worker* worker, unsigned int priorityClass )
+{
+    if( m_numInjected[priorityClass].load( std::memory_order_relaxed ) == 0 )
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock( m_injectionMutex );
+    std::deque<Request*>&        injected = m_injected[priorityClass];
+    if( injected.empty() )
+        return nullptr;
+
+    // Take one request to fill immediately, and move the rest of the chunk to the worker's deque.
+    // The chunk is pushed in reverse order, since the owner pops its deque in LIFO order.
+    Request* result = injected.front();
+    injected.pop_front();
+    unsigned int numTaken = 1;
+
+    const unsigned int numChunk = std::min( static_cast<unsigned int>( injected.size() ), INJECTION_CHUNK_SIZE - 1 );
+    WorkStealingDeque<Request>* deque = worker->deques[priorityClass].get();
+    for( int i = static_cast<int>( numChunk ) - 1; i >= 0; --i )
+    {
+        if( !deque->push( injected[i] ) )
+            break;
+        injected[i] = nullptr;
+        ++numTaken;
+    }
+    injected.erase( std::remove( injected.begin(), injected.begin() + numChunk, nullptr ), injected.begin() + numChunk );
+    m_numInjected[priorityClass] -= numTaken;
+    lock.unlock();
+
+    // The rest of the chunk can now be stolen, so wake workers to steal it.
+    if( numTaken > 1 )
+        notifyWorkers( numTaken - 1 );
+    return result;
+}
+
+WorkStealingRequestProcessor::Request* WorkStealingRequestProcessor::findRequest( unsigned int workerIndex )
+{
+    Worker*            self       = m_workers[workerIndex].get();
+    const unsigned int numWorkers = static_cast<unsigned int>( m_workers.size() );
+
+    for( unsigned int priorityClass = 0; priorityClass < NUM_REQUEST_PRIORITY_CLASSES; ++priorityClass )
+    {
+        // Check the worker's own deque first, since that doesn't contend with other workers.
+        if( Request* request = self->deques[priorityClass]->pop() )
+            return request;
+
+        // Next, grab a chunk of newly injected requests.
+        if( Request* request = grabInjected( self, priorityClass ) )
+            return request;
+
+        // Finally, try to steal from the other workers, starting with the next worker.
+        for( unsigned int i = 1; i < numWorkers; ++i )
+        {
+            Worker* victim = m_workers[( workerIndex + i ) % numWorkers].get();
+            if( Request* request = victim->deques[priorityClass]->steal() )
+                return request;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingRequestProcessor::worker( unsigned int workerIndex )
+{
+    try
+    {
+        while( true )
+        {
+            // Read the work epoch before searching, so that requests published during the search
+            // prevent the worker from sleeping.
+            const unsigned int epoch   = m_workEpoch.load();
+            Request*           request = findRequest( workerIndex );
+            if( request )
+            {
+                m_numPending -= request->numPages;
+                fillRequest( request );
+                continue;
+            }
+            ++m_numIdleSearches;
+
+            // Sleep until more requests are published or the processor is shut down.  Requests
+            // that are pending in another worker's deque are filled by that worker if they cannot
+            // be stolen, so idle workers never spin while waiting for long fills to finish.
+            std::unique_lock<std::mutex> lock( m_sleepMutex );
+            ++m_numSleeping;
+            m_workAvailable.wait( lock, [this, epoch] { return m_workEpoch.load() != epoch || m_isShutDown; } );
+            --m_numSleeping;
+            if( m_isShutDown )
+                return;  // Exit thread when the processor is shut down.
+        }
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+#ifndef NDEBUG
+        std::terminate();
+#endif
+    }
+}
+
+void WorkStealingRequestProcessor::fillRequest( Request* request )
+{
+    // The request handler associated with the range of pages in which the request occurred was
+    // obtained from the PageTableManager when the request was added.
+    RequestHandler* handler = request->handler;
+    OTK_ASSERT_MSG( handler != nullptr, "Invalid page requested (no associated handler)" );
+
+    if( m_latencyRecorder )
+    {
+        const std::chrono::duration<double> waitTime = std::chrono::steady_clock::now() - request->batch->queueTime;
+        m_latencyRecorder->record( STAGE_QUEUE_WAIT, waitTime.count() );
+    }
+
+    // Use the CUDA context associated with the stream in the ticket.
+    std::shared_ptr<TicketImpl>& ticket = TicketImpl::getImpl( request->batch->ticket );
+    CUstream                     stream = ticket->getStream();
+    if( stream )
+    {
+        CUcontext context;
+        OTK_ERROR_CHECK( cuStreamGetCtx( stream, &context ) );
+        OTK_ERROR_CHECK( cuCtxSetCurrent( context ) );
+    }
+
+    // Process the run of pages.  Page table updates are accumulated in the PagingSystem.
+    const unsigned int* pageIds = &request->batch->pageIds[request->firstIndex];
+    if( request->numPages == 1 )
+        handler->fillRequest( stream, pageIds[0] );
+    else
+        handler->fillRequests( stream, pageIds, request->numPages );
+
+    // Notify the associated Ticket that the pages have been filled.
+    for( unsigned int i = 0; i < request->numPages; ++i )
+        ticket->notify();
+    releaseRequest( request );
+}
+
+void WorkStealingRequestProcessor::releaseRequest( Request* request )
+{
+    RequestBatch* batch = request->batch;
+    if( --batch->numRemaining == 0 )
+        delete batch;
+}
+
+void WorkStealingRequestProcessor::drainRequests()
+{
+    // Worker threads have been joined, so the deques can be popped from this thread.
+    for( std::unique_ptr<Worker>& worker : m_workers )
+    {
+        for( std::unique_ptr<WorkStealingDeque<Request>>& deque : worker->deques )
+        {
+            while( Request* request = deque->pop() )
+                releaseRequest( request );
+        }
+    }
+
+    std::unique_lock<std::mutex> lock( m_injectionMutex );
+    for( unsigned int priorityClass = 0; priorityClass < NUM_REQUEST_PRIORITY_CLASSES; ++priorityClass )
+    {
+        for( Request* request : m_injected[priorityClass] )
+            releaseRequest( request );
+        m_injected[priorityClass].clear();
+        m_numInjected[priorityClass] = 0;
+    }
+    m_numPending = 0;
+}
+
+}  // namespace demandLoading
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/DemandLoading/Options.h>
+#include <OptiXToolkit/DemandLoading/RequestProcessor.h>
+
+#include "RequestHandler.h"
+#include "Util/LatencyRecorder.h"
+#include "Util/WorkStealingDeque.h"
+
+#include <cuda.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace demandLoading {
+
+class PageTableManager;
+
+/// Number of priority classes used by the WorkStealingRequestProcessor: samplers and base colors,
+/// mip tails, texture tiles, and prefetches (see REQUEST_PRIORITY_SAMPLER, etc. in RequestHandler.h).
+const unsigned int NUM_REQUEST_PRIORITY_CLASSES = REQUEST_PRIORITY_TILE + 2;
+
+/// WorkStealingRequestProcessor fills page requests with a pool of worker threads, each of which
+/// owns a lock-free deque per priority class.  Batches of requests are sorted by priority and
+/// grouped into runs of contiguous pages that share a RequestHandler, which are filled with a
+/// single call to RequestHandler::fillRequests.  The runs are published to a shared injection
+/// queue, from which workers grab them in chunks.  Idle workers steal runs from the deques of
+/// other workers.  Workers always look for the most urgent priority class first, so samplers and
+/// base colors are filled before mip tails, which are filled before texture tiles (coarse to fine).
+/// Prefetch requests made by the request filter are filled last, in a batch of their own, so that
+/// the ticket for the requests does not wait for them.
+class WorkStealingRequestProcessor : public RequestProcessor
+{
+  public:
+    /// Construct request processor, which uses the given PageTableManager to
+    /// find the RequestHandler associated with a range of pages.
+    WorkStealingRequestProcessor( std::shared_ptr<PageTableManager> pageTableManager, const Options& options );
+    ~WorkStealingRequestProcessor() override;
+
+    /// Stop processing requests, terminating threads.
+    void stop() override;
+
+    /// Add a batch of page requests to the request queue.  Requests with a null stream are filled
+    /// without making a CUDA context current (e.g. host-only benchmarks).
+    void addRequests( CUstream stream, unsigned id, const unsigned int* pageIds, unsigned int numPageIds ) override;
+
+    /// Add a request filter to preprocess batches of requests
+    void setRequestFilter( std::shared_ptr<RequestFilter> requestFilter ) { m_requestFilter = requestFilter; }
+
+    /// Get the request filter, if any.
+    std::shared_ptr<RequestFilter> getRequestFilter() const { return m_requestFilter; }
+
+    /// Record the time requests wait in the queue (STAGE_QUEUE_WAIT) in the given recorder.
+    void setLatencyRecorder( LatencyRecorder* latencyRecorder ) { m_latencyRecorder = latencyRecorder; }
+
+    /// Set the ticket that will track requests with the given ticket id
+    void setTicket( unsigned int id, Ticket ticket );
+
+    /// Get the number of times a worker searched for requests without finding any (for testing).
+    /// An idle worker searches once and then sleeps until the work epoch changes, so the count is
+    /// at most the number of workers times the number of epochs.
+    unsigned int getNumIdleSearches() const { return m_numIdleSearches.load(); }
+
+    /// Get the work epoch, which is advanced whenever requests are published (for testing).
+    unsigned int getWorkEpoch() const { return m_workEpoch.load(); }
+
+  private:
+    struct RequestBatch;
+
+    // A run of contiguous pages that share a request handler and priority.  Requests are allocated
+    // in arrays owned by a RequestBatch.
+    struct Request
+    {
+        unsigned int    firstIndex;  // index of the first page in RequestBatch::pageIds
+        unsigned int    numPages;
+        unsigned int    priority;
+        RequestHandler* handler;
+        RequestBatch*   batch;
+    };
+
+    // A batch of requests that share a ticket.  The batch is deleted when its last request is filled.
+    struct RequestBatch
+    {
+        Ticket                                ticket;
+        std::chrono::steady_clock::time_point queueTime;  // when the batch was added
+        std::vector<unsigned int>             pageIds;    // sorted by priority, then page id
+        std::vector<Request>                  requests;
+        std::atomic<unsigned int>             numRemaining{};
+    };
+
+    // Per-worker state.
+    struct Worker
+    {
+        explicit Worker( unsigned int capacity );
+        std::unique_ptr<WorkStealingDeque<Request>> deques[NUM_REQUEST_PRIORITY_CLASSES];
+    };
+
+    std::shared_ptr<PageTableManager>    m_pageTableManager;
+    std::map<unsigned int, Ticket>       m_tickets;
+    std::mutex                           m_ticketsMutex;
+    Options                              m_options;
+    bool                                 m_started = false;
+    std::shared_ptr<RequestFilter>       m_requestFilter;
+    LatencyRecorder*                     m_latencyRecorder = nullptr;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread>             m_threads;
+
+    // Shared injection queues (one per priority class), from which workers grab chunks of requests.
+    std::mutex           m_injectionMutex;
+    std::deque<Request*> m_injected[NUM_REQUEST_PRIORITY_CLASSES];
+    std::atomic<size_t>  m_numInjected[NUM_REQUEST_PRIORITY_CLASSES];
+
+    // Number of pages that have been queued but not yet taken by a worker.
+    std::atomic<size_t> m_numPending{};
+
+    // Idle workers sleep on a condition variable until the work epoch changes (an eventcount).
+    // The epoch is advanced whenever requests are published where other workers can take them, so
+    // a worker that finds no requests after reading the epoch cannot miss requests published
+    // during its search.  Waking is proportional to the work available.
+    std::mutex                m_sleepMutex;
+    std::condition_variable   m_workAvailable;
+    unsigned int              m_numSleeping = 0;
+    std::atomic<unsigned int> m_workEpoch{0};
+    std::atomic<bool>         m_isShutDown{false};
+    std::atomic<unsigned int> m_numIdleSearches{0};
+
+    /// Start processing requests.
+    void start();
+
+    // Sort a batch of pages by priority, group them into requests, and publish them to the
+    // injection queues.  Prefetch pages have their priority offset by REQUEST_PRIORITY_PREFETCH.
+    void enqueueBatch( Ticket ticket, const unsigned int* pageIds, unsigned int numPageIds, bool prefetch );
+
+    // Advance the work epoch and wake up to the given number of sleeping workers.
+    void notifyWorkers( unsigned int numToWake );
+
+    // Per-thread worker function.
+    void worker( unsigned int workerIndex );
+
+    // Find a request for the specified worker, in priority order.  Returns nullptr if none was found.
+    Request* findRequest( unsigned int workerIndex );
+
+    // Move a chunk of requests from the injection queue of the given priority class to the
+    // worker's deque, returning one of them.
+    Request* grabInjected( Worker* worker, unsigned int priorityClass );
+
+    // Fill a request and notify its ticket.
+    void fillRequest( Request* request );
+
+    // Release a request, deleting its batch if it was the last one in the batch.
+    static void releaseRequest( Request* request );
+
+    // Release all requests that are still queued (after the worker threads have been joined).
+    void drainRequests();
+};
+
+}  // namespace demandLoading
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -6,6 +6,7 @@
 
 #include "DemandLoaderImpl.h"
 #include "Memory/DeviceMemoryManager.h"
+#include "Memory/HostTileCache.h"
 #include "PageTableManager.h"
 #include "Textures/DemandTextureImpl.h"
 
@@ -14,15 +15,20 @@
 #include <OptiXToolkit/DemandLoading/TextureDescriptor.h>
 #include <OptiXToolkit/Error/cuErrorCheck.h>
 #include <OptiXToolkit/Error/cudaErrorCheck.h>
+#include <OptiXToolkit/ImageSource/BCnEncoder.h>
 #include <OptiXToolkit/ImageSource/CheckerBoardImage.h>
+#include <OptiXToolkit/ImageSource/DDSImageReader.h>
 #include <OptiXToolkit/Memory/MemoryBlockDesc.h>
 
 #include <gtest/gtest.h>
 
 #include <cuda.h>
 
+#include <cstdio>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 using namespace demandLoading;
 using namespace imageSource;
@@ -182,6 +188,58 @@ TEST_F( TestDemandTexture, TestFillTile )
     OTK_ERROR_CHECK( cuMemFree( reinterpret_cast<CUdeviceptr>( devOutput ) ) );
 }
 
+TEST_F( TestDemandTexture, TestHostTileCacheWithBC1Texture )
+{
+    // Skip test if sparse textures not supported
+    if( m_deviceIndex == demandLoading::MAX_DEVICES )
+        return;
+
+    // BC1 has 4 bits per texel, so cached tiles must be sized (and checked for uniformity) in blocks.
+    // With 2 squares per side, the 512x256 tiles of the finest level are uniform, and are cached as a
+    // single block.
+    const std::string fileName = "TestDemandTextureBC1.dds";
+    for( unsigned int squaresPerSide : {2u, 16u} )
+    {
+        BCEncoderOptions encoderOptions;
+        encoderOptions.format = BCFormat::BC1;
+        ASSERT_TRUE( writeBCFile( std::make_shared<CheckerBoardImage>( 1024, 1024, squaresPerSide ), fileName, encoderOptions ) );
+
+        demandLoading::Options options{};
+        options.maxHostTileCacheMemory = 16 << 20;
+        m_loader.reset( new DemandLoaderImpl( options ) );
+        m_desc.addressMode[0]   = CU_TR_ADDRESS_MODE_CLAMP;
+        m_desc.addressMode[1]   = CU_TR_ADDRESS_MODE_CLAMP;
+        m_desc.filterMode       = CU_TR_FILTER_MODE_POINT;
+        m_desc.mipmapFilterMode = CU_TR_FILTER_MODE_POINT;
+        m_desc.maxAnisotropy    = 16;
+        std::shared_ptr<ImageSource> image = std::make_shared<DDSImageReader>( fileName, false );
+        DemandTextureImpl* texture = m_loader->getTexture( m_loader->createTexture( image, m_desc ).getId() );
+        texture->open();
+        texture->init();
+        ASSERT_EQ( CU_AD_FORMAT_BC1_UNORM, texture->getInfo().format );
+
+        // Load a tile, then reload it from the host tile cache.
+        TextureRequestHandler* handler = texture->getRequestHandler();
+        const unsigned int     pageId  = handler->getTextureTilePageId( 0, 1, 1 );
+        handler->loadPage( m_stream, pageId, false );
+        handler->loadPage( m_stream, pageId, true );
+        OTK_ERROR_CHECK( cuStreamSynchronize( m_stream ) );
+
+        HostTileCache* cache = m_loader->getHostTileCache();
+        EXPECT_EQ( 1U, cache->getNumHits() );
+        EXPECT_EQ( squaresPerSide == 2 ? 8U : TILE_SIZE_IN_BYTES, cache->getNumResidentBytes() );
+
+        // The cached tile matches the tile read from the image.
+        std::vector<char> cached( TILE_SIZE_IN_BYTES, 0 ), expected( TILE_SIZE_IN_BYTES, 1 );
+        ASSERT_TRUE( cache->find( texture->getId(), 0, 1, 1, cached.data(), TILE_SIZE_IN_BYTES ) );
+        ASSERT_TRUE( texture->readTile( 0, 1, 1, expected.data(), TILE_SIZE_IN_BYTES, CUstream{} ) );
+        EXPECT_EQ( expected, cached );
+
+        m_loader.reset();
+    }
+    std::remove( fileName.c_str() );
+}
+
 TEST_F( TestDemandTexture, TestReadMipTail )
 {
     // Skip test if sparse textures not supported
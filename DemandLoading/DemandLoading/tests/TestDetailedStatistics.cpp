@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "Util/LatencyRecorder.h"
+
+#include <OptiXToolkit/DemandLoading/DetailedStatistics.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+
+TEST( TestLatencyHistogram, Buckets )
+{
+    EXPECT_EQ( 0U, LatencyHistogram::getBucket( 0.0 ) );
+    EXPECT_EQ( 0U, LatencyHistogram::getBucket( 0.5e-6 ) );
+    EXPECT_EQ( 1U, LatencyHistogram::getBucket( 1.0e-6 ) );
+    EXPECT_EQ( 1U, LatencyHistogram::getBucket( 1.9e-6 ) );
+    EXPECT_EQ( 2U, LatencyHistogram::getBucket( 2.0e-6 ) );
+    EXPECT_EQ( 11U, LatencyHistogram::getBucket( 1.5e-3 ) );  // 1500 us is in [1024, 2048)
+    EXPECT_EQ( LatencyHistogram::NUM_BUCKETS - 1, LatencyHistogram::getBucket( 1.0e6 ) );
+
+    for( unsigned int bucket = 0; bucket < LatencyHistogram::NUM_BUCKETS - 1; ++bucket )
+    {
+        const double upperBound = LatencyHistogram::getBucketUpperBound( bucket );
+        EXPECT_EQ( bucket, LatencyHistogram::getBucket( upperBound * 0.99 ) );
+        EXPECT_EQ( bucket + 1, LatencyHistogram::getBucket( upperBound ) );
+    }
+}
+
+TEST( TestLatencyHistogram, RecordAndPercentiles )
+{
+    LatencyHistogram histogram{};
+    EXPECT_EQ( 0.0, histogram.getMeanTime() );
+    EXPECT_EQ( 0.0, histogram.getPercentile( 0.5 ) );
+
+    for( int i = 0; i < 90; ++i )
+        histogram.record( 10.0e-6 );
+    for( int i = 0; i < 10; ++i )
+        histogram.record( 5.0e-3 );
+
+    EXPECT_EQ( 100U, histogram.count );
+    EXPECT_NEAR( 90 * 10.0e-6 + 10 * 5.0e-3, histogram.totalTime, 1e-12 );
+    EXPECT_DOUBLE_EQ( 5.0e-3, histogram.maxTime );
+    EXPECT_EQ( 90U, histogram.buckets[LatencyHistogram::getBucket( 10.0e-6 )] );
+
+    // The median is in the [8, 16) us bucket, and the 99th percentile is clamped to the maximum.
+    EXPECT_DOUBLE_EQ( 16.0e-6, histogram.getPercentile( 0.5 ) );
+    EXPECT_DOUBLE_EQ( 5.0e-3, histogram.getPercentile( 0.99 ) );
+}
+
+TEST( TestLatencyHistogram, Merge )
+{
+    LatencyHistogram a{};
+    LatencyHistogram b{};
+    a.record( 1.0e-3 );
+    b.record( 2.0e-3 );
+    b.record( 3.0e-6 );
+    a.merge( b );
+
+    EXPECT_EQ( 3U, a.count );
+    EXPECT_DOUBLE_EQ( 2.0e-3, a.maxTime );
+    EXPECT_EQ( 1U, a.buckets[LatencyHistogram::getBucket( 3.0e-6 )] );
+}
+
+TEST( TestLatencyRecorder, SumsThreads )
+{
+    LatencyRecorder recorder;
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < 20; ++t )
+    {
+        threads.emplace_back( [&recorder, t]() {
+            for( int i = 0; i < 1000; ++i )
+                recorder.record( STAGE_READ_TILE, ( t + 1 ) * 1.0e-6 );
+            recorder.record( STAGE_QUEUE_WAIT, 1.0e-3 );
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+
+    LatencyHistogram histograms[NUM_LATENCY_STAGES];
+    recorder.getHistograms( histograms );
+    EXPECT_EQ( 20000U, histograms[STAGE_READ_TILE].count );
+    EXPECT_NEAR( 1000 * 210 * 1.0e-6, histograms[STAGE_READ_TILE].totalTime, 1e-6 );
+    EXPECT_NEAR( 20.0e-6, histograms[STAGE_READ_TILE].maxTime, 1e-9 );
+    EXPECT_EQ( 20U, histograms[STAGE_QUEUE_WAIT].count );
+    EXPECT_EQ( 0U, histograms[STAGE_PUSH_MAPPINGS].count );
+
+    uint64_t bucketTotal = 0;
+    for( uint64_t bucket : histograms[STAGE_READ_TILE].buckets )
+        bucketTotal += bucket;
+    EXPECT_EQ( 20000U, bucketTotal );
+}
+
+TEST( TestLatencyRecorder, TimerWithNullRecorder )
+{
+    // Does nothing, without crashing.
+    LatencyTimer timer( nullptr, STAGE_FILL_TILE );
+}
+
+TEST( TestLatencyRecorder, Timer )
+{
+    LatencyRecorder recorder;
+    {
+        LatencyTimer timer( &recorder, STAGE_FILL_TILE );
+    }
+    LatencyHistogram histograms[NUM_LATENCY_STAGES];
+    recorder.getHistograms( histograms );
+    EXPECT_EQ( 1U, histograms[STAGE_FILL_TILE].count );
+}
+
+TEST( TestDetailedStatistics, StageNames )
+{
+    EXPECT_STREQ( "queueWait", getLatencyStageName( STAGE_QUEUE_WAIT ) );
+    EXPECT_STREQ( "pushMappings", getLatencyStageName( STAGE_PUSH_MAPPINGS ) );
+    for( unsigned int stage = 0; stage < NUM_LATENCY_STAGES; ++stage )
+        EXPECT_STRNE( "unknown", getLatencyStageName( static_cast<LatencyStage>( stage ) ) );
+}
+
+TEST( TestDetailedStatistics, ToJson )
+{
+    DetailedStatistics stats{};
+    stats.totals.numTilesRead = 42;
+    stats.totals.tileDedupRatio = 1.5;
+    stats.totals.hostTileCacheHitRate = 0.75;
+    stats.stages[STAGE_READ_TILE].record( 3.0e-6 );
+    stats.textures.push_back( TextureStatistics{7, 42, 42 * 65536, 0.25} );
+
+    const std::string json = toJson( stats );
+    EXPECT_EQ( '{', json.front() );
+    EXPECT_NE( std::string::npos, json.find( "\"numTilesRead\": 42," ) );
+    EXPECT_NE( std::string::npos, json.find( "\"tileDedupRatio\": 1.5" ) );
+    EXPECT_NE( std::string::npos, json.find( "\"hostTileCacheHitRate\": 0.75" ) );
+    EXPECT_NE( std::string::npos, json.find( "\"readTile\": {\"count\": 1," ) );
+    EXPECT_NE( std::string::npos, json.find( "\"buckets\": [0, 0, 1, 0, " ) );
+    EXPECT_NE( std::string::npos, json.find( "{\"textureId\": 7, \"numTilesRead\": 42, \"numBytesRead\": 2752512, \"readTime\": 0.25}" ) );
+
+    // Every stage is present, and braces and brackets balance.
+    for( unsigned int stage = 0; stage < NUM_LATENCY_STAGES; ++stage )
+        EXPECT_NE( std::string::npos, json.find( std::string( "\"" ) + getLatencyStageName( static_cast<LatencyStage>( stage ) ) + "\": {" ) );
+    int depth = 0;
+    for( char c : json )
+    {
+        depth += ( c == '{' || c == '[' ) ? 1 : ( c == '}' || c == ']' ) ? -1 : 0;
+        EXPECT_GE( depth, 0 );
+    }
+    EXPECT_EQ( 0, depth );
+}
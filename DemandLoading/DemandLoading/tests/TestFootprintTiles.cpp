@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/DemandLoading/FootprintTiles.h>
+#include <OptiXToolkit/DemandLoading/TileIndexing.h>
+#include <OptiXToolkit/ShaderUtil/TextureUtil.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace demandLoading;
+
+class TestFootprintTiles : public testing::Test
+{
+  public:
+    // A 512x512 texture with 64x64 tiles: levels 0-2 have 8x8, 4x4 and 2x2 tiles, and the mip
+    // tail starts at level 3.
+    TextureSampler sampler{};
+
+    void SetUp() override
+    {
+        const unsigned int texWidth  = 512;
+        const unsigned int tileWidth = 64;
+
+        sampler.desc.numMipLevels    = 10;
+        sampler.desc.logTileWidth    = 6;
+        sampler.desc.logTileHeight   = 6;
+        sampler.desc.isSparseTexture = 1;
+        sampler.desc.wrapMode0       = CU_TR_ADDRESS_MODE_WRAP;
+        sampler.desc.wrapMode1       = CU_TR_ADDRESS_MODE_CLAMP;
+        sampler.desc.maxAnisotropy   = 16;
+        sampler.width                = texWidth;
+        sampler.height               = texWidth;
+        sampler.mipTailFirstLevel    = 3;
+        sampler.startPage            = 1000;
+
+        TextureSampler::MipLevelSizes* mls = sampler.mipLevelSizes;
+        memset( mls, 0, MAX_TILE_LEVELS * sizeof( TextureSampler::MipLevelSizes ) );
+        for( int mipLevel = static_cast<int>( sampler.mipTailFirstLevel ); mipLevel >= 0; --mipLevel )
+        {
+            if( mipLevel < static_cast<int>( sampler.mipTailFirstLevel ) )
+                mls[mipLevel].mipLevelStart =
+                    mls[mipLevel + 1].mipLevelStart + mls[mipLevel + 1].levelWidthInTiles * mls[mipLevel + 1].levelHeightInTiles;
+            mls[mipLevel].levelWidthInTiles  = static_cast<unsigned short>( getLevelDimInTiles( texWidth, mipLevel, tileWidth ) );
+            mls[mipLevel].levelHeightInTiles = static_cast<unsigned short>( getLevelDimInTiles( texWidth, mipLevel, tileWidth ) );
+        }
+        sampler.numPages = mls[0].mipLevelStart + 64;
+    }
+
+    unsigned int getPage( unsigned int mipLevel, unsigned int x, unsigned int y ) const
+    {
+        const TextureSampler::MipLevelSizes& level = sampler.mipLevelSizes[mipLevel];
+        return sampler.startPage + level.mipLevelStart + getPageOffsetFromTileCoords( x, y, level.levelWidthInTiles );
+    }
+
+    // Return the mip level of a page (the mip tail is treated as a single level).
+    unsigned int getLevel( unsigned int pageId ) const
+    {
+        for( unsigned int mipLevel = 0; mipLevel < sampler.mipTailFirstLevel; ++mipLevel )
+        {
+            const TextureSampler::MipLevelSizes& level = sampler.mipLevelSizes[mipLevel];
+            if( pageId - sampler.startPage >= level.mipLevelStart )
+                return mipLevel;
+        }
+        return sampler.mipTailFirstLevel;
+    }
+
+    std::vector<unsigned int> getTiles( float x, float y, float gradient ) const
+    {
+        const FootprintSample sample{x, y, float2{gradient, 0.0f}, float2{0.0f, gradient}};
+        return getFootprintTiles( sampler, &sample, 1 );
+    }
+};
+
+TEST_F( TestFootprintTiles, Magnified )
+{
+    // A magnified sample on the corner of four tiles requests the four tiles in the finest level only.
+    const std::vector<unsigned int> expected{getPage( 0, 3, 3 ), getPage( 0, 4, 3 ), getPage( 0, 3, 4 ), getPage( 0, 4, 4 )};
+    EXPECT_EQ( expected, getTiles( 0.5f, 0.5f, 1.0e-5f ) );
+}
+
+TEST_F( TestFootprintTiles, TwoMipLevels )
+{
+    // One texel per pixel samples the finest level and the next coarser level.
+    const std::vector<unsigned int> expected{getPage( 1, 0, 0 ), getPage( 0, 1, 1 )};
+    EXPECT_EQ( expected, getTiles( 0.2f, 0.2f, 1.0f / 512.0f ) );
+}
+
+TEST_F( TestFootprintTiles, NearMipLevelBoundary )
+{
+    // A mip level just below 1 also requests the footprint in level 2 (the next level after the
+    // two sampled levels), as the device does to allow for hardware rounding.
+    const std::vector<unsigned int> expected{getPage( 2, 0, 0 ), getPage( 1, 0, 0 ), getPage( 0, 1, 1 )};
+    EXPECT_EQ( expected, getTiles( 0.2f, 0.2f, 1.9f / 512.0f ) );
+}
+
+TEST_F( TestFootprintTiles, MipTail )
+{
+    EXPECT_EQ( std::vector<unsigned int>{sampler.startPage}, getTiles( 0.5f, 0.5f, 0.5f ) );
+}
+
+TEST_F( TestFootprintTiles, WrapModes )
+{
+    // The x coordinate wraps, and the y coordinate is clamped.
+    const std::vector<unsigned int> expected{getPage( 0, 0, 0 ), getPage( 0, 7, 0 )};
+    EXPECT_EQ( expected, getTiles( 0.0f, -0.5f, 1.0e-5f ) );
+}
+
+TEST_F( TestFootprintTiles, DenseTexture )
+{
+    sampler.desc.isSparseTexture = 0;
+    EXPECT_TRUE( getTiles( 0.5f, 0.5f, 1.0e-5f ).empty() );
+    EXPECT_TRUE( getFootprintTiles( sampler, nullptr, 0 ).empty() );
+}
+
+TEST_F( TestFootprintTiles, MatchesPerSampleUnion )
+{
+    std::mt19937                          rng( 7 );
+    std::uniform_real_distribution<float> coord( -0.5f, 1.5f );
+    std::uniform_real_distribution<float> logGradient( -12.0f, 0.0f );
+    std::vector<FootprintSample>          samples( 100000 );
+    for( FootprintSample& sample : samples )
+    {
+        const float gradient = std::exp2( logGradient( rng ) );
+        sample               = FootprintSample{coord( rng ), coord( rng ), float2{gradient, 0.0f}, float2{0.0f, 0.5f * gradient}};
+    }
+
+    std::set<unsigned int> expected;
+    for( size_t i = 0; i < samples.size(); i += 97 )
+    {
+        const std::vector<unsigned int> tiles = getFootprintTiles( sampler, &samples[i], 1 );
+        expected.insert( tiles.begin(), tiles.end() );
+    }
+    std::vector<FootprintSample> subset;
+    for( size_t i = 0; i < samples.size(); i += 97 )
+        subset.push_back( samples[i] );
+    const std::vector<unsigned int> tiles = getFootprintTiles( sampler, subset.data(), subset.size() );
+    EXPECT_EQ( std::vector<unsigned int>( expected.begin(), expected.end() ), tiles );
+
+    // The result does not depend on the number of threads.
+    EXPECT_EQ( getFootprintTiles( sampler, samples.data(), samples.size(), 1 ),
+               getFootprintTiles( sampler, samples.data(), samples.size(), 8 ) );
+}
+
+TEST_F( TestFootprintTiles, MatchesDeviceMipLevel )
+{
+    // The sampled mip levels follow the device's getMipLevel (ShaderUtil/TextureUtil.h), including its
+    // handling of anisotropy, for gradients whose mip level is not near an integer boundary.
+    std::mt19937                          rng( 11 );
+    std::uniform_real_distribution<float> coord( 0.0f, 1.0f );
+    std::uniform_real_distribution<float> logGradient( -9.0f, -6.0f );
+    std::uniform_real_distribution<float> angle( 0.0f, 6.2831853f );
+    std::uniform_real_distribution<float> logAspect( 0.0f, 5.0f );
+    unsigned int                          numChecked = 0;
+    for( unsigned int maxAnisotropy : {1u, 2u, 16u} )
+    {
+        sampler.desc.maxAnisotropy = maxAnisotropy;
+        for( int i = 0; i < 2000; ++i )
+        {
+            // An elliptical footprint with a random orientation and aspect ratio.
+            const float  gradient = std::exp2( logGradient( rng ) );
+            const float  aspect   = std::exp2( logAspect( rng ) );
+            const float  theta    = angle( rng );
+            const float2 ddx{gradient * aspect * std::cos( theta ), gradient * aspect * std::sin( theta )};
+            const float2 ddy{-gradient * std::sin( theta ), gradient * std::cos( theta )};
+
+            const float ml        = getMipLevel( ddx, ddy, sampler.width, sampler.height, 1.0f / maxAnisotropy );
+            const float fracLevel = ml - std::floor( ml );
+            if( ml < 0.0f || ml >= 2.0f || fracLevel < 0.2f || fracLevel > 0.8f )
+                continue;
+
+            // The fine level and the next coarser level are requested.
+            const FootprintSample  sample{coord( rng ), coord( rng ), ddx, ddy};
+            const unsigned int     fineLevel = static_cast<unsigned int>( ml );
+            std::set<unsigned int> levels;
+            for( unsigned int pageId : getFootprintTiles( sampler, &sample, 1 ) )
+                levels.insert( getLevel( pageId ) );
+            EXPECT_EQ( ( std::set<unsigned int>{fineLevel, fineLevel + 1} ), levels ) << "maxAnisotropy " << maxAnisotropy;
+            ++numChecked;
+        }
+    }
+    EXPECT_GT( numChecked, 1000U );
+}
+
+TEST_F( TestFootprintTiles, ZeroAnisotropy )
+{
+    // As on the device, a maxAnisotropy of zero is not clamped, so every sample selects the coarsest level.
+    sampler.desc.maxAnisotropy = 0;
+    EXPECT_EQ( std::vector<unsigned int>{sampler.startPage}, getTiles( 0.5f, 0.5f, 1.0e-5f ) );
+}
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "HostPageTable.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+
+class TestHostPageTable : public testing::Test
+{
+  protected:
+    HostPageTable m_table{1 << 20};
+};
+
+TEST_F( TestHostPageTable, InitiallyEmpty )
+{
+    HostPageTableEntry entry;
+    EXPECT_FALSE( m_table.find( 0, &entry ) );
+    EXPECT_FALSE( m_table.isResident( 12345 ) );
+    EXPECT_FALSE( m_table.isResident( 1 << 20 ) );
+    EXPECT_EQ( 0U, m_table.size() );
+}
+
+TEST_F( TestHostPageTable, SetAndFind )
+{
+    m_table.set( 10, HostPageTableEntry{1234, true, false, false} );
+    m_table.set( 5000, HostPageTableEntry{5678, false, true, true} );
+
+    unsigned long long value = 0;
+    EXPECT_TRUE( m_table.isResident( 10, &value ) );
+    EXPECT_EQ( 1234ULL, value );
+    EXPECT_FALSE( m_table.isResident( 5000 ) );
+
+    HostPageTableEntry entry{};
+    ASSERT_TRUE( m_table.find( 5000, &entry ) );
+    EXPECT_EQ( 5678ULL, entry.entry );
+    EXPECT_FALSE( entry.resident );
+    EXPECT_TRUE( entry.staged );
+    EXPECT_TRUE( entry.inStagedList );
+    EXPECT_EQ( 2U, m_table.size() );
+}
+
+TEST_F( TestHostPageTable, Erase )
+{
+    m_table.set( 10, HostPageTableEntry{1234, true, false, false} );
+    EXPECT_TRUE( m_table.erase( 10 ) );
+    EXPECT_FALSE( m_table.erase( 10 ) );
+    EXPECT_FALSE( m_table.isResident( 10 ) );
+    EXPECT_EQ( 0U, m_table.size() );
+}
+
+TEST_F( TestHostPageTable, Update )
+{
+    m_table.set( 10, HostPageTableEntry{1234, true, false, false} );
+
+    auto stage = []( HostPageTableEntry& entry ) -> HostPageTable::UpdateResult {
+        if( !entry.resident )
+            return HostPageTable::KEEP;
+        entry.resident = false;
+        entry.staged   = true;
+        return HostPageTable::MODIFY;
+    };
+    EXPECT_EQ( HostPageTable::MODIFY, m_table.update( 10, stage ) );
+    EXPECT_EQ( HostPageTable::KEEP, m_table.update( 10, stage ) );
+    EXPECT_EQ( HostPageTable::NOT_FOUND, m_table.update( 11, stage ) );
+
+    HostPageTableEntry entry{};
+    ASSERT_TRUE( m_table.find( 10, &entry ) );
+    EXPECT_FALSE( entry.resident );
+    EXPECT_TRUE( entry.staged );
+    EXPECT_EQ( 1234ULL, entry.entry );
+}
+
+TEST_F( TestHostPageTable, ForEachVisitsRangeInOrder )
+{
+    const std::vector<unsigned int> pages{3, 4095, 4096, 100000, 500000, 700000};
+    for( unsigned int pageId : pages )
+        m_table.set( pageId, HostPageTableEntry{pageId * 2ULL, true, false, false} );
+
+    std::vector<unsigned int> found;
+    m_table.forEach( 4, 600000, [&]( unsigned int pageId, const HostPageTableEntry& entry ) {
+        EXPECT_EQ( pageId * 2ULL, entry.entry );
+        found.push_back( pageId );
+    } );
+    EXPECT_EQ( std::vector<unsigned int>( {4095, 4096, 100000, 500000} ), found );
+}
+
+TEST_F( TestHostPageTable, ForEachCanErase )
+{
+    for( unsigned int pageId = 0; pageId < 10000; ++pageId )
+        m_table.set( pageId, HostPageTableEntry{pageId, true, false, false} );
+
+    m_table.forEach( 0, 10000, [this]( unsigned int pageId, const HostPageTableEntry& ) {
+        if( pageId % 2 )
+            m_table.erase( pageId );
+    } );
+    EXPECT_EQ( 5000U, m_table.size() );
+}
+
+TEST_F( TestHostPageTable, MemoryIsProportionalToMappedChunks )
+{
+    const size_t emptySize = m_table.getMemoryUsage();
+    m_table.set( 0, HostPageTableEntry{0, true, false, false} );
+    const size_t oneChunk = m_table.getMemoryUsage();
+    m_table.set( 1, HostPageTableEntry{0, true, false, false} );
+    EXPECT_EQ( oneChunk, m_table.getMemoryUsage() );
+    EXPECT_GT( oneChunk, emptySize );
+}
+
+TEST_F( TestHostPageTable, ConcurrentReadersSeeConsistentEntries )
+{
+    // Each write stores an entry whose value encodes its residency, so a torn read is detectable.
+    const unsigned int numPages = 1024;
+    std::atomic<bool>  done{false};
+    std::atomic<int>   numErrors{0};
+
+    std::vector<std::thread> readers;
+    for( int t = 0; t < 3; ++t )
+    {
+        readers.emplace_back( [&]() {
+            while( !done.load() )
+            {
+                for( unsigned int pageId = 0; pageId < numPages; ++pageId )
+                {
+                    HostPageTableEntry entry;
+                    if( m_table.find( pageId, &entry ) && ( entry.entry & 1 ) != static_cast<unsigned long long>( entry.resident ) )
+                        ++numErrors;
+                }
+            }
+        } );
+    }
+
+    std::vector<std::thread> writers;
+    for( unsigned int t = 0; t < 2; ++t )
+    {
+        writers.emplace_back( [&, t]() {
+            for( unsigned int i = 0; i < 200; ++i )
+            {
+                for( unsigned int pageId = t; pageId < numPages; pageId += 2 )
+                {
+                    const bool resident = ( ( i + pageId ) % 3 ) != 0;
+                    if( ( i + pageId ) % 7 == 0 )
+                        m_table.erase( pageId );
+                    else
+                        m_table.set( pageId, HostPageTableEntry{( i << 1 ) | static_cast<unsigned long long>( resident ), resident, !resident, false} );
+                }
+            }
+        } );
+    }
+
+    for( std::thread& writer : writers )
+        writer.join();
+    done = true;
+    for( std::thread& reader : readers )
+        reader.join();
+    EXPECT_EQ( 0, numErrors.load() );
+}
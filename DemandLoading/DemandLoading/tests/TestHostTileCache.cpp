@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "Memory/HostTileCache.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+const size_t       TILE_SIZE  = 4096;
+const unsigned int TEXEL_SIZE = 4;
+
+// A tile whose bytes are all different from those of tiles with other seeds.
+std::vector<char> makeTile( int seed )
+{
+    std::vector<char> tile( TILE_SIZE );
+    for( size_t i = 0; i < tile.size(); ++i )
+        tile[i] = static_cast<char>( i * 7 + seed );
+    return tile;
+}
+
+}  // namespace
+
+TEST( TestHostTileCache, FindInsertedTile )
+{
+    HostTileCache           cache( 4 * TILE_SIZE );
+    const std::vector<char> tile = makeTile( 1 );
+    std::vector<char>       dest( TILE_SIZE );
+
+    EXPECT_FALSE( cache.find( 1, 2, 3, 4, dest.data(), dest.size() ) );
+    cache.insert( 1, 2, 3, 4, tile.data(), tile.size(), TEXEL_SIZE );
+    EXPECT_TRUE( cache.find( 1, 2, 3, 4, dest.data(), dest.size() ) );
+    EXPECT_EQ( tile, dest );
+
+    // Tiles of other textures, mip levels, or coordinates are not found.
+    EXPECT_FALSE( cache.find( 2, 2, 3, 4, dest.data(), dest.size() ) );
+    EXPECT_FALSE( cache.find( 1, 1, 3, 4, dest.data(), dest.size() ) );
+    EXPECT_FALSE( cache.find( 1, 2, 4, 3, dest.data(), dest.size() ) );
+
+    EXPECT_EQ( 1U, cache.getNumHits() );
+    EXPECT_EQ( 4U, cache.getNumMisses() );
+    EXPECT_EQ( TILE_SIZE, cache.getNumResidentBytes() );
+}
+
+TEST( TestHostTileCache, SizeMismatchIsMiss )
+{
+    HostTileCache           cache( 4 * TILE_SIZE );
+    const std::vector<char> tile = makeTile( 1 );
+    std::vector<char>       dest( TILE_SIZE / 2 );
+
+    cache.insert( 1, 0, 0, 0, tile.data(), tile.size(), TEXEL_SIZE );
+    EXPECT_FALSE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+}
+
+TEST( TestHostTileCache, LeastRecentlyUsedTileIsEvicted )
+{
+    HostTileCache     cache( 2 * TILE_SIZE );
+    std::vector<char> dest( TILE_SIZE );
+
+    cache.insert( 1, 0, 0, 0, makeTile( 1 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.insert( 1, 0, 1, 0, makeTile( 2 ).data(), TILE_SIZE, TEXEL_SIZE );
+    EXPECT_TRUE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+    cache.insert( 1, 0, 2, 0, makeTile( 3 ).data(), TILE_SIZE, TEXEL_SIZE );
+
+    EXPECT_EQ( 1U, cache.getNumEvictions() );
+    EXPECT_EQ( 2 * TILE_SIZE, cache.getNumResidentBytes() );
+    EXPECT_TRUE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+    EXPECT_FALSE( cache.find( 1, 0, 1, 0, dest.data(), dest.size() ) );
+    EXPECT_TRUE( cache.find( 1, 0, 2, 0, dest.data(), dest.size() ) );
+    EXPECT_EQ( makeTile( 3 ), dest );
+}
+
+TEST( TestHostTileCache, ReinsertedTileIsReplaced )
+{
+    HostTileCache     cache( 4 * TILE_SIZE );
+    std::vector<char> dest( TILE_SIZE );
+
+    cache.insert( 1, 0, 0, 0, makeTile( 1 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.insert( 1, 0, 0, 0, makeTile( 2 ).data(), TILE_SIZE, TEXEL_SIZE );
+
+    EXPECT_EQ( TILE_SIZE, cache.getNumResidentBytes() );
+    EXPECT_TRUE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+    EXPECT_EQ( makeTile( 2 ), dest );
+}
+
+TEST( TestHostTileCache, UniformTileIsStoredAsTexel )
+{
+    HostTileCache     cache( 4 * TILE_SIZE );
+    std::vector<char> tile( TILE_SIZE );
+    for( size_t i = 0; i < tile.size(); ++i )
+        tile[i] = static_cast<char>( i % TEXEL_SIZE + 1 );
+    std::vector<char> dest( TILE_SIZE );
+
+    cache.insert( 1, 0, 0, 0, tile.data(), tile.size(), TEXEL_SIZE );
+    EXPECT_EQ( TEXEL_SIZE, cache.getNumResidentBytes() );
+    EXPECT_TRUE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+    EXPECT_EQ( tile, dest );
+}
+
+TEST( TestHostTileCache, RemoveTexture )
+{
+    HostTileCache     cache( 4 * TILE_SIZE );
+    std::vector<char> dest( TILE_SIZE );
+
+    cache.insert( 1, 0, 0, 0, makeTile( 1 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.insert( 2, 0, 0, 0, makeTile( 2 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.insert( 2, 3, 1, 1, makeTile( 3 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.insert( 3, 0, 0, 0, makeTile( 4 ).data(), TILE_SIZE, TEXEL_SIZE );
+    cache.removeTexture( 2 );
+
+    EXPECT_EQ( 2 * TILE_SIZE, cache.getNumResidentBytes() );
+    EXPECT_EQ( 0U, cache.getNumEvictions() );
+    EXPECT_TRUE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+    EXPECT_FALSE( cache.find( 2, 0, 0, 0, dest.data(), dest.size() ) );
+    EXPECT_FALSE( cache.find( 2, 3, 1, 1, dest.data(), dest.size() ) );
+    EXPECT_TRUE( cache.find( 3, 0, 0, 0, dest.data(), dest.size() ) );
+}
+
+TEST( TestHostTileCache, TileLargerThanBudgetIsNotCached )
+{
+    HostTileCache     cache( TILE_SIZE / 2 );
+    std::vector<char> dest( TILE_SIZE );
+
+    cache.insert( 1, 0, 0, 0, makeTile( 1 ).data(), TILE_SIZE, TEXEL_SIZE );
+    EXPECT_EQ( 0U, cache.getNumResidentBytes() );
+    EXPECT_FALSE( cache.find( 1, 0, 0, 0, dest.data(), dest.size() ) );
+}
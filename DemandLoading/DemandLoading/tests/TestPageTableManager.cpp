@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -6,6 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace demandLoading;
 
 class DummyRequestHandler : public RequestHandler
@@ -110,3 +114,95 @@ TEST_F( TestPageTableManager, TestMappingOrderPreserved )
     EXPECT_EQ( &handler2, mgr.getRequestHandler( pageId2 ) );
     EXPECT_EQ( &handler3, mgr.getRequestHandler( pageId3 ) );
 }
+
+TEST_F( TestPageTableManager, TestRemoveRequestHandler )
+{
+    DummyRequestHandler handler2;
+    const unsigned int  pageId1 = mgr.reserveUnbackedPages( 4, &handler );
+    const unsigned int  pageId2 = mgr.reserveUnbackedPages( 4, &handler2 );
+
+    mgr.removeRequestHandler( pageId1 + 2 );
+    RequestHandler* removed = mgr.getRequestHandler( pageId1 );
+    EXPECT_NE( nullptr, removed );
+    EXPECT_NE( &handler, removed );
+    EXPECT_EQ( removed, mgr.getRequestHandler( pageId1 + 3 ) );
+    EXPECT_EQ( &handler2, mgr.getRequestHandler( pageId2 ) );
+}
+
+TEST_F( TestPageTableManager, TestLookupDuringReservation )
+{
+    // Lookups do not take a lock, so they can run while pages are being reserved.
+    const unsigned int               count = 2000;
+    std::vector<DummyRequestHandler> handlers( count );
+    std::vector<unsigned int>        firstPages( count );
+    std::atomic<unsigned int>        numReserved{0};
+    std::atomic<int>                 numErrors{0};
+
+    std::thread reader( [&]() {
+        while( numReserved.load() < count )
+        {
+            const unsigned int n = numReserved.load();
+            for( unsigned int i = 0; i < n; ++i )
+            {
+                if( mgr.getRequestHandler( firstPages[i] ) != &handlers[i] )
+                    ++numErrors;
+            }
+        }
+    } );
+    for( unsigned int i = 0; i < count; ++i )
+    {
+        firstPages[i] = ( i % 2 ) ? mgr.reserveUnbackedPages( 3, &handlers[i] ) : mgr.reserveBackedPages( 1, &handlers[i] );
+        numReserved.store( i + 1 );
+    }
+    reader.join();
+    EXPECT_EQ( 0, numErrors.load() );
+}
+
+class TestPageTableManagerDirect : public testing::Test
+{
+  public:
+    PageTableManager    mgr;
+    DummyRequestHandler handler;
+
+    TestPageTableManagerDirect()
+        : mgr( 1024u * 1024u, 64u * 1024u, /*directLookup=*/true )
+    {
+    }
+};
+
+TEST_F( TestPageTableManagerDirect, TestNotFound )
+{
+    EXPECT_EQ( nullptr, mgr.getRequestHandler( 0 ) );
+    const unsigned int firstPage = mgr.reserveBackedPages( 1, &handler );
+    EXPECT_EQ( nullptr, mgr.getRequestHandler( firstPage + 1 ) );
+    EXPECT_EQ( nullptr, mgr.getRequestHandler( 8000 ) );
+}
+
+TEST_F( TestPageTableManagerDirect, TestFindExhaustive )
+{
+    // Ranges straddle the direct table's leaves, and include both backed and unbacked pages.
+    const unsigned int               count = 100;
+    std::vector<unsigned int>        firstPages( count );
+    std::vector<DummyRequestHandler> handlers( count );
+    for( unsigned int i = 0; i < count; ++i )
+    {
+        const unsigned int numPages = 13 * i + 1;
+        firstPages[i] = ( i % 3 ) ? mgr.reserveBackedPages( numPages, &handlers[i] ) : mgr.reserveUnbackedPages( numPages, &handlers[i] );
+    }
+
+    for( unsigned int i = 0; i < count; ++i )
+    {
+        const unsigned int lastPage = firstPages[i] + 13 * i;
+        EXPECT_EQ( &handlers[i], mgr.getRequestHandler( firstPages[i] ) );
+        EXPECT_EQ( &handlers[i], mgr.getRequestHandler( ( firstPages[i] + lastPage ) / 2 ) );
+        EXPECT_EQ( &handlers[i], mgr.getRequestHandler( lastPage ) );
+    }
+}
+
+TEST_F( TestPageTableManagerDirect, TestRemoveRequestHandler )
+{
+    const unsigned int pageId = mgr.reserveBackedPages( 10, &handler );
+    mgr.removeRequestHandler( pageId + 5 );
+    EXPECT_NE( &handler, mgr.getRequestHandler( pageId ) );
+    EXPECT_NE( nullptr, mgr.getRequestHandler( pageId ) );
+}
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -7,7 +7,7 @@
 #include "Memory/DeviceMemoryManager.h"
 #include "PageTableManager.h"
 #include "PagingSystem.h"
-#include "ThreadPoolRequestProcessor.h"
+#include "WorkStealingRequestProcessor.h"
 
 #include <OptiXToolkit/Error/cuErrorCheck.h>
 #include <OptiXToolkit/Error/cudaErrorCheck.h>
@@ -114,7 +114,7 @@ class TestPagingSystem : public testing::Test
         m_options->useLruTable         = true;
 
         m_pageTableManager = std::make_shared<PageTableManager>( m_options->numPages, m_options->numPageTableEntries );
-        m_requestProcessor.reset( new ThreadPoolRequestProcessor( m_pageTableManager, *m_options ) );
+        m_requestProcessor.reset( new WorkStealingRequestProcessor( m_pageTableManager, *m_options ) );
 
         // Create per-device PagingSystem, etc.
         int numDevices;
@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "PrefetchRequestFilter.h"
+
+#include <OptiXToolkit/DemandLoading/TileIndexing.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+// Drops odd pages.
+class EvenPageFilter : public RequestFilter
+{
+  public:
+    std::vector<unsigned int> filter( const unsigned int* requests, unsigned int numRequests ) override
+    {
+        std::vector<unsigned int> result;
+        std::copy_if( requests, requests + numRequests, std::back_inserter( result ), []( unsigned int pageId ) { return pageId % 2 == 0; } );
+        return result;
+    }
+};
+
+}  // anonymous namespace
+
+class TestPrefetchRequestFilter : public testing::Test
+{
+  public:
+    // A 512x512 texture with 64x64 tiles: levels 0-2 have 8x8, 4x4 and 2x2 tiles, and the mip
+    // tail starts at level 3.
+    TextureSampler         sampler{};
+    std::set<unsigned int> residentPages;
+    Options                options;
+
+    void SetUp() override
+    {
+        const unsigned int texWidth  = 512;
+        const unsigned int tileWidth = 64;
+
+        sampler.desc.numMipLevels    = 10;
+        sampler.desc.logTileWidth    = 6;
+        sampler.desc.logTileHeight   = 6;
+        sampler.desc.isSparseTexture = 1;
+        sampler.width                = texWidth;
+        sampler.height               = texWidth;
+        sampler.mipTailFirstLevel    = 3;
+        sampler.startPage            = 1000;
+
+        TextureSampler::MipLevelSizes* mls = sampler.mipLevelSizes;
+        memset( mls, 0, MAX_TILE_LEVELS * sizeof( TextureSampler::MipLevelSizes ) );
+        for( int mipLevel = static_cast<int>( sampler.mipTailFirstLevel ); mipLevel >= 0; --mipLevel )
+        {
+            if( mipLevel < static_cast<int>( sampler.mipTailFirstLevel ) )
+                mls[mipLevel].mipLevelStart =
+                    mls[mipLevel + 1].mipLevelStart + mls[mipLevel + 1].levelWidthInTiles * mls[mipLevel + 1].levelHeightInTiles;
+            mls[mipLevel].levelWidthInTiles  = static_cast<unsigned short>( getLevelDimInTiles( texWidth, mipLevel, tileWidth ) );
+            mls[mipLevel].levelHeightInTiles = static_cast<unsigned short>( getLevelDimInTiles( texWidth, mipLevel, tileWidth ) );
+        }
+        sampler.numPages = mls[0].mipLevelStart + 64;
+
+        options.maxPrefetchPages = 64;
+        options.prefetchHistory  = 4;
+    }
+
+    unsigned int getPage( unsigned int mipLevel, unsigned int x, unsigned int y ) const
+    {
+        const TextureSampler::MipLevelSizes& level = sampler.mipLevelSizes[mipLevel];
+        return sampler.startPage + level.mipLevelStart + getPageOffsetFromTileCoords( x, y, level.levelWidthInTiles );
+    }
+
+    PrefetchRequestFilter makeFilter( std::shared_ptr<RequestFilter> next = nullptr )
+    {
+        return PrefetchRequestFilter(
+            options,
+            [this]( unsigned int pageId ) -> const TextureSampler* {
+                return pageId >= sampler.startPage && pageId < sampler.startPage + sampler.numPages ? &sampler : nullptr;
+            },
+            [this]( unsigned int pageId ) { return residentPages.count( pageId ) != 0; }, next );
+    }
+
+    std::vector<unsigned int> prefetch( PrefetchRequestFilter& filter, std::vector<unsigned int> requests )
+    {
+        std::vector<unsigned int> prefetches;
+        const std::vector<unsigned int> filtered =
+            filter.filterAndPrefetch( requests.data(), static_cast<unsigned int>( requests.size() ), prefetches );
+        EXPECT_EQ( requests, filtered );
+        return prefetches;
+    }
+};
+
+TEST_F( TestPrefetchRequestFilter, ParentAndNeighbors )
+{
+    PrefetchRequestFilter     filter     = makeFilter();
+    std::vector<unsigned int> prefetches = prefetch( filter, {getPage( 0, 3, 3 )} );
+
+    // The parent comes first, followed by the eight neighbors.
+    ASSERT_EQ( 9u, prefetches.size() );
+    EXPECT_EQ( getPage( 1, 1, 1 ), prefetches[0] );
+    std::set<unsigned int> expected;
+    for( unsigned int y = 2; y <= 4; ++y )
+        for( unsigned int x = 2; x <= 4; ++x )
+            if( x != 3 || y != 3 )
+                expected.insert( getPage( 0, x, y ) );
+    EXPECT_EQ( expected, std::set<unsigned int>( prefetches.begin() + 1, prefetches.end() ) );
+}
+
+TEST_F( TestPrefetchRequestFilter, NeighborsStayInBounds )
+{
+    PrefetchRequestFilter     filter     = makeFilter();
+    std::vector<unsigned int> prefetches = prefetch( filter, {getPage( 0, 7, 0 )} );
+
+    const std::vector<unsigned int> expected{getPage( 1, 3, 0 ), getPage( 0, 6, 0 ), getPage( 0, 6, 1 ), getPage( 0, 7, 1 )};
+    EXPECT_EQ( expected, prefetches );
+}
+
+TEST_F( TestPrefetchRequestFilter, MipTailParent )
+{
+    // The parent of a tile in the finest level above the mip tail is the mip tail, and the mip tail
+    // itself does not trigger prefetches.
+    PrefetchRequestFilter filter = makeFilter();
+    EXPECT_EQ( sampler.startPage, prefetch( filter, {getPage( 2, 0, 0 )} )[0] );
+    EXPECT_TRUE( prefetch( filter, {sampler.startPage} ).empty() );
+}
+
+TEST_F( TestPrefetchRequestFilter, Budget )
+{
+    options.maxPrefetchPages = 2;
+    PrefetchRequestFilter     filter     = makeFilter();
+    std::vector<unsigned int> prefetches = prefetch( filter, {getPage( 0, 3, 3 ), getPage( 0, 5, 5 )} );
+
+    const std::vector<unsigned int> expected{getPage( 1, 1, 1 ), getPage( 1, 2, 2 )};
+    EXPECT_EQ( expected, prefetches );
+}
+
+TEST_F( TestPrefetchRequestFilter, SkipsResidentAndRequestedPages )
+{
+    residentPages.insert( getPage( 1, 1, 1 ) );
+    residentPages.insert( getPage( 0, 2, 2 ) );
+    PrefetchRequestFilter     filter     = makeFilter();
+    std::vector<unsigned int> prefetches = prefetch( filter, {getPage( 0, 3, 3 ), getPage( 0, 4, 3 )} );
+
+    const std::set<unsigned int> unique( prefetches.begin(), prefetches.end() );
+    EXPECT_EQ( unique.size(), prefetches.size() );
+    EXPECT_EQ( 0u, unique.count( getPage( 1, 1, 1 ) ) );
+    EXPECT_EQ( 0u, unique.count( getPage( 0, 2, 2 ) ) );
+    EXPECT_EQ( 0u, unique.count( getPage( 0, 3, 3 ) ) );
+    EXPECT_EQ( 0u, unique.count( getPage( 0, 4, 3 ) ) );
+    EXPECT_EQ( 1u, unique.count( getPage( 1, 2, 1 ) ) );
+    EXPECT_EQ( 1u, unique.count( getPage( 0, 5, 4 ) ) );
+}
+
+TEST_F( TestPrefetchRequestFilter, IgnoresOtherPages )
+{
+    PrefetchRequestFilter filter = makeFilter();
+    EXPECT_TRUE( prefetch( filter, {0, 1, 2, sampler.startPage + sampler.numPages} ).empty() );
+}
+
+TEST_F( TestPrefetchRequestFilter, PredictsMotion )
+{
+    // The requests move two tiles to the right per launch.  Once the motion is established, the
+    // tile two to the right of the last request is prefetched ahead of the neighbors.
+    options.maxPrefetchPages = 2;
+    PrefetchRequestFilter filter = makeFilter();
+    EXPECT_EQ( getPage( 0, 0, 3 ), prefetch( filter, {getPage( 0, 0, 4 )} )[1] );
+    EXPECT_EQ( getPage( 0, 1, 3 ), prefetch( filter, {getPage( 0, 2, 4 )} )[1] );
+
+    const std::vector<unsigned int> expected{getPage( 1, 2, 2 ), getPage( 0, 6, 4 )};
+    EXPECT_EQ( expected, prefetch( filter, {getPage( 0, 4, 4 )} ) );
+
+    // Reversing direction cancels the prediction.
+    EXPECT_EQ( getPage( 0, 1, 3 ), prefetch( filter, {getPage( 0, 2, 4 )} )[1] );
+}
+
+TEST_F( TestPrefetchRequestFilter, AppliesDownstreamFilter )
+{
+    PrefetchRequestFilter filter = makeFilter( std::make_shared<EvenPageFilter>() );
+
+    const std::vector<unsigned int> requests{2, 3, 4, 5};
+    std::vector<unsigned int>       prefetches;
+    const std::vector<unsigned int> expected{2, 4};
+    EXPECT_EQ( expected, filter.filter( requests.data(), 4 ) );
+    EXPECT_EQ( expected, filter.filterAndPrefetch( requests.data(), 4, prefetches ) );
+    EXPECT_TRUE( prefetches.empty() );
+}
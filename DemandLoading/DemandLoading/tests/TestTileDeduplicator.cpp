@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "Memory/TileDeduplicator.h"
+
+#include <OptiXToolkit/Error/cuErrorCheck.h>
+#include <OptiXToolkit/Error/cudaErrorCheck.h>
+
+#include <cuda.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+using namespace otk;
+
+class TestTileDeduplicator : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        OTK_ERROR_CHECK( cudaSetDevice( 0 ) );
+        OTK_ERROR_CHECK( cudaFree( nullptr ) );
+        OTK_ERROR_CHECK( cuStreamCreate( &m_stream, 0U ) );
+        OTK_ERROR_CHECK( cuStreamCreate( &m_otherStream, 0U ) );
+    }
+
+    void TearDown() override
+    {
+        OTK_ERROR_CHECK( cuStreamDestroy( m_stream ) );
+        OTK_ERROR_CHECK( cuStreamDestroy( m_otherStream ) );
+    }
+
+  protected:
+    std::vector<char> m_tile = std::vector<char>( TILE_SIZE_IN_BYTES, 7 );
+    CUstream          m_stream{};
+    CUstream          m_otherStream{};
+
+    TileKey key( uint64_t layout = 0 ) const { return TileDeduplicator::hashTile( m_tile.data(), m_tile.size(), layout ); }
+};
+
+TEST_F( TestTileDeduplicator, HashDependsOnContents )
+{
+    const TileKey key1 = key();
+    EXPECT_TRUE( key1 == key() );
+
+    // Every byte of the tile contributes to both halves of the key.
+    for( size_t i : {size_t( 0 ), size_t( 13 ), m_tile.size() / 2 + 8, m_tile.size() - 1} )
+    {
+        ++m_tile[i];
+        const TileKey key2 = key();
+        EXPECT_NE( key1.lo, key2.lo );
+        EXPECT_NE( key1.hi, key2.hi );
+        --m_tile[i];
+    }
+    EXPECT_TRUE( key1 == key() );
+}
+
+TEST_F( TestTileDeduplicator, HashDependsOnLayout )
+{
+    EXPECT_FALSE( key( 1 ) == key( 2 ) );
+}
+
+TEST_F( TestTileDeduplicator, FindAndRelease )
+{
+    TileDeduplicator      dedup;
+    const TileBlockHandle bh{1234, TileBlockDesc( 1, 2, 1 )};
+
+    EXPECT_EQ( 0ULL, dedup.findAndAddRef( key(), m_stream ).handle );
+    EXPECT_TRUE( dedup.insert( key(), bh, m_stream ) );
+
+    TileBlockHandle found = dedup.findAndAddRef( key(), m_stream );
+    EXPECT_EQ( bh.handle, found.handle );
+    EXPECT_EQ( bh.block.data, found.block.data );
+    dedup.findAndAddRef( key(), m_stream );
+    EXPECT_EQ( 1U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 3U, dedup.getNumSharedReferences() );
+
+    // The block is freed when the last reference is released, and can no longer be found.
+    EXPECT_FALSE( dedup.release( bh.block ) );
+    EXPECT_FALSE( dedup.release( bh.block ) );
+    EXPECT_TRUE( dedup.release( bh.block ) );
+    EXPECT_EQ( 0U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 0U, dedup.getNumSharedReferences() );
+    EXPECT_EQ( 0ULL, dedup.findAndAddRef( key(), m_stream ).handle );
+}
+
+TEST_F( TestTileDeduplicator, UntrackedBlocksAreFreed )
+{
+    TileDeduplicator dedup;
+    EXPECT_TRUE( dedup.release( TileBlockDesc( 3, 4, 1 ) ) );
+}
+
+TEST_F( TestTileDeduplicator, FirstInsertWins )
+{
+    TileDeduplicator      dedup;
+    const TileBlockHandle bh1{1, TileBlockDesc( 0, 1, 1 )};
+    const TileBlockHandle bh2{1, TileBlockDesc( 0, 2, 1 )};
+
+    EXPECT_TRUE( dedup.insert( key(), bh1, m_stream ) );
+    EXPECT_FALSE( dedup.insert( key(), bh2, m_stream ) );
+    EXPECT_TRUE( dedup.release( bh2.block ) );
+    EXPECT_EQ( bh1.block.data, dedup.findAndAddRef( key(), m_stream ).block.data );
+}
+
+TEST_F( TestTileDeduplicator, RemoveArenas )
+{
+    TileDeduplicator dedup;
+    dedup.insert( key( 0 ), TileBlockHandle{1, TileBlockDesc( 0, 0, 1 )}, m_stream );
+    dedup.insert( key( 1 ), TileBlockHandle{2, TileBlockDesc( 1, 0, 1 )}, m_stream );
+    dedup.insert( key( 2 ), TileBlockHandle{3, TileBlockDesc( 2, 0, 1 )}, m_stream );
+
+    dedup.findAndAddRef( key( 0 ), m_stream );
+    dedup.findAndAddRef( key( 1 ), m_stream );
+    EXPECT_EQ( 2U, dedup.getNumSharedBlocks() );
+
+    dedup.removeArenas( 1 );
+    EXPECT_EQ( 1U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 2U, dedup.getNumSharedReferences() );
+    EXPECT_EQ( 1ULL, dedup.findAndAddRef( key( 0 ), m_stream ).handle );
+    EXPECT_EQ( 0ULL, dedup.findAndAddRef( key( 1 ), m_stream ).handle );
+    EXPECT_EQ( 0ULL, dedup.findAndAddRef( key( 2 ), m_stream ).handle );
+}
+
+TEST_F( TestTileDeduplicator, OnlyBlocksWithSeveralReferencesAreShared )
+{
+    TileDeduplicator      dedup;
+    const TileBlockHandle bh{1, TileBlockDesc( 0, 1, 1 )};
+
+    EXPECT_TRUE( dedup.insert( key(), bh, m_stream ) );
+    EXPECT_EQ( 0U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 0U, dedup.getNumSharedReferences() );
+
+    dedup.findAndAddRef( key(), m_stream );
+    EXPECT_EQ( 1U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 2U, dedup.getNumSharedReferences() );
+
+    EXPECT_FALSE( dedup.release( bh.block ) );
+    EXPECT_EQ( 0U, dedup.getNumSharedBlocks() );
+    EXPECT_EQ( 0U, dedup.getNumSharedReferences() );
+    EXPECT_TRUE( dedup.release( bh.block ) );
+}
+
+TEST_F( TestTileDeduplicator, OtherStreamsWaitForFill )
+{
+    // Block the stream with a host function, standing in for a tile copy that has not completed.
+    std::atomic<bool> copyDone{false};
+    CUhostFn          waitForCopy = []( void* done ) {
+        while( !static_cast<std::atomic<bool>*>( done )->load() )
+            std::this_thread::yield();
+    };
+    OTK_ERROR_CHECK( cuLaunchHostFunc( m_stream, waitForCopy, &copyDone ) );
+
+    TileDeduplicator      dedup;
+    const TileBlockHandle bh{1, TileBlockDesc( 0, 1, 1 )};
+    EXPECT_TRUE( dedup.insert( key(), bh, m_stream ) );
+
+    // The block can be shared on the stream that fills it, since later work on that stream is ordered
+    // after the copy, but not on other streams until the copy completes.
+    EXPECT_EQ( 0ULL, dedup.findAndAddRef( key(), m_otherStream ).handle );
+    EXPECT_EQ( bh.handle, dedup.findAndAddRef( key(), m_stream ).handle );
+
+    copyDone = true;
+    OTK_ERROR_CHECK( cuStreamSynchronize( m_stream ) );
+    EXPECT_EQ( bh.handle, dedup.findAndAddRef( key(), m_otherStream ).handle );
+    EXPECT_EQ( 3U, dedup.getNumSharedReferences() );
+}
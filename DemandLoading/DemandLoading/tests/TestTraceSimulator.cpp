@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/DemandLoading/TraceSimulator.h>
+
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+using namespace demandLoading;
+
+class TestTraceSimulator : public testing::Test
+{
+  protected:
+    Options m_options;
+
+    void SetUp() override
+    {
+        m_options.numPages            = 4096;
+        m_options.numPageTableEntries = 1024;
+        m_options.maxRequestedPages   = 64;
+        m_options.maxStalePages       = 256;
+        m_options.maxStagedPages      = 16;
+        m_options.maxInvalidatedPages = 256;
+        m_options.useLruTable         = true;
+        m_options.maxTexMemPerDevice  = 0;
+    }
+
+    static std::vector<unsigned int> pageRange( unsigned int first, unsigned int count )
+    {
+        std::vector<unsigned int> pages( count );
+        std::iota( pages.begin(), pages.end(), first );
+        return pages;
+    }
+};
+
+TEST_F( TestTraceSimulator, HitsAfterLoad )
+{
+    TraceSimulator                  sim( m_options );
+    const std::vector<unsigned int> pages = pageRange( 2000, 10 );
+
+    SimulatedLaunchStatistics stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( 10U, stats.numReferencedPages );
+    EXPECT_EQ( 0U, stats.numHits );
+    EXPECT_EQ( 10U, stats.numRequests );
+    EXPECT_EQ( 10U, stats.numTilesLoaded );
+    EXPECT_EQ( 10 * otk::TILE_SIZE_IN_BYTES, stats.bytesTransferred );
+
+    stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( 10U, stats.numHits );
+    EXPECT_EQ( 0U, stats.numRequests );
+    EXPECT_DOUBLE_EQ( 1.0, stats.hitRate() );
+}
+
+TEST_F( TestTraceSimulator, DuplicateAndOutOfRangeReferences )
+{
+    TraceSimulator                  sim( m_options );
+    const std::vector<unsigned int> pages{5, 5, 2000, 2000, m_options.numPages + 1};
+
+    SimulatedLaunchStatistics stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( 2U, stats.numReferencedPages );
+    EXPECT_EQ( 2U, stats.numRequests );
+    EXPECT_EQ( 1U, stats.numTilesLoaded );
+}
+
+TEST_F( TestTraceSimulator, MaxRequestedPagesDropsRequests )
+{
+    m_options.maxRequestedPages = 4;
+    TraceSimulator                  sim( m_options );
+    const std::vector<unsigned int> pages = pageRange( 2000, 10 );
+
+    SimulatedLaunchStatistics stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( 4U, stats.numRequests );
+    EXPECT_EQ( 6U, stats.numDroppedRequests );
+
+    stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( 4U, stats.numHits );
+    EXPECT_EQ( 4U, stats.numRequests );
+    EXPECT_EQ( 2U, stats.numDroppedRequests );
+}
+
+TEST_F( TestTraceSimulator, EvictionWithinBudget )
+{
+    const unsigned int maxTiles = 32;
+    m_options.maxTexMemPerDevice = maxTiles * otk::TILE_SIZE_IN_BYTES;
+    m_options.maxStagedPages     = 8;
+    TraceSimulator sim( m_options );
+
+    // Alternate between two working sets, each of which fits in the budget, but not together.
+    const std::vector<unsigned int> setA = pageRange( 2000, 24 );
+    const std::vector<unsigned int> setB = pageRange( 3000, 24 );
+    unsigned int                    numEvictions = 0;
+    for( int i = 0; i < 40; ++i )
+    {
+        const SimulatedLaunchStatistics stats = sim.simulateLaunch( ( i / 10 ) % 2 ? setB : setA );
+        EXPECT_LE( stats.numResidentTiles, maxTiles );
+        numEvictions += stats.numEvictions;
+    }
+    EXPECT_GT( numEvictions, 0U );
+
+    // Once the working set has settled, every reference hits.
+    const SimulatedLaunchStatistics stats = sim.simulateLaunch( setB );
+    EXPECT_EQ( 24U, stats.numHits );
+}
+
+TEST_F( TestTraceSimulator, NoEvictionFailsLoads )
+{
+    m_options.maxTexMemPerDevice = 8 * otk::TILE_SIZE_IN_BYTES;
+    m_options.evictionActive     = false;
+    TraceSimulator sim( m_options );
+
+    const SimulatedLaunchStatistics stats = sim.simulateLaunch( pageRange( 2000, 10 ) );
+    EXPECT_EQ( 8U, stats.numTilesLoaded );
+    EXPECT_EQ( 2U, stats.numFailedLoads );
+    EXPECT_EQ( 0U, stats.numEvictions );
+}
+
+TEST_F( TestTraceSimulator, ResourcesAreNotEvicted )
+{
+    m_options.maxTexMemPerDevice = 4 * otk::TILE_SIZE_IN_BYTES;
+    TraceSimulator sim( m_options );
+
+    sim.simulateLaunch( pageRange( 10, 4 ) );
+    for( int i = 0; i < 40; ++i )
+        sim.simulateLaunch( pageRange( 2000 + 4 * ( i % 4 ), 4 ) );
+
+    const SimulatedLaunchStatistics stats = sim.simulateLaunch( pageRange( 10, 4 ) );
+    EXPECT_EQ( 4U, stats.numHits );
+}
+
+TEST_F( TestTraceSimulator, StagedPagesAreRestored )
+{
+    m_options.maxTexMemPerDevice = 16 * otk::TILE_SIZE_IN_BYTES;
+    m_options.maxStagedPages     = 16;
+    TraceSimulator sim( m_options );
+
+    // Fill the budget, then request one more tile to activate eviction.
+    const std::vector<unsigned int> pages = pageRange( 2000, 16 );
+    sim.simulateLaunch( pages );
+    sim.simulateLaunch( std::vector<unsigned int>{3000} );
+
+    // Let the original pages go stale until some are staged, then reference them again.
+    unsigned int numStaged = 0;
+    for( int i = 0; i < 64 && numStaged == 0; ++i )
+        numStaged = sim.simulateLaunch( std::vector<unsigned int>{3000} ).numStagedPages;
+    ASSERT_GT( numStaged, 0U );
+
+    const SimulatedLaunchStatistics stats = sim.simulateLaunch( pages );
+    EXPECT_EQ( numStaged, stats.numRestoredPages );
+    EXPECT_EQ( 0U, stats.numTilesLoaded );
+}
+
+TEST_F( TestTraceSimulator, WriteAndReadTrace )
+{
+    PageTrace trace;
+    trace.options = m_options;
+    trace.launches.push_back( pageRange( 2000, 10 ) );
+    trace.launches.push_back( std::vector<unsigned int>() );
+    trace.launches.push_back( pageRange( 5, 3 ) );
+
+    const std::string filename = "TestTraceSimulator.trace";
+    writePageTrace( filename, trace );
+    const PageTrace found = readPageTrace( filename );
+    std::remove( filename.c_str() );
+
+    EXPECT_EQ( trace.options.numPages, found.options.numPages );
+    EXPECT_EQ( trace.options.numPageTableEntries, found.options.numPageTableEntries );
+    EXPECT_EQ( trace.options.maxStagedPages, found.options.maxStagedPages );
+    EXPECT_EQ( trace.options.useLruTable, found.options.useLruTable );
+    EXPECT_EQ( trace.launches, found.launches );
+}
+
+TEST_F( TestTraceSimulator, ReadMissingTraceThrows )
+{
+    EXPECT_THROW( readPageTrace( "TestTraceSimulator.missing" ), std::runtime_error );
+}
+
+TEST_F( TestTraceSimulator, SimulatePageTrace )
+{
+    PageTrace trace;
+    trace.launches = {pageRange( 2000, 10 ), pageRange( 2000, 10 )};
+
+    const std::vector<SimulatedLaunchStatistics> stats = simulatePageTrace( trace, m_options );
+    ASSERT_EQ( 2U, stats.size() );
+    EXPECT_EQ( 10U, stats[0].numTilesLoaded );
+    EXPECT_EQ( 10U, stats[1].numHits );
+}
+
+TEST( TestLru, LruIncIsLogarithmic )
+{
+    unsigned int count = 0;
+    for( unsigned int launchNum = 1; launchNum <= 1024; ++launchNum )
+        count = lruInc( count, launchNum );
+    EXPECT_GT( count, 5U );
+    EXPECT_LT( count, 12U );
+
+    // lruInc saturates at MAX_LRU_VAL.
+    EXPECT_EQ( MAX_LRU_VAL, lruInc( MAX_LRU_VAL, 0 ) );
+}
+
+TEST( TestLru, UpdateLruThreshold )
+{
+    // Unchanged if no stale pages were requested.
+    EXPECT_EQ( 8U, updateLruThreshold( 8, 0, 0, 0 ) );
+    // Lowered quickly if too few stale pages are returned, but not below the minimum.
+    EXPECT_EQ( 4U, updateLruThreshold( 8, 10, 100, 0 ) );
+    EXPECT_EQ( 6U, updateLruThreshold( 8, 60, 100, 0 ) );
+    EXPECT_EQ( MIN_LRU_THRESHOLD, updateLruThreshold( 3, 10, 100, 0 ) );
+    // Raised slowly if the median stale page is above the threshold.
+    EXPECT_EQ( 9U, updateLruThreshold( 8, 100, 100, 12 ) );
+    EXPECT_EQ( 8U, updateLruThreshold( 8, 100, 100, 8 ) );
+}
@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "PageTableManager.h"
+#include "TicketImpl.h"
+#include "Util/WorkStealingDeque.h"
+#include "WorkStealingRequestProcessor.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace demandLoading;
+
+namespace {
+
+// Records the pages it fills, and reports a fixed request priority.
+class RecordingRequestHandler : public RequestHandler
+{
+  public:
+    RecordingRequestHandler( std::mutex& mutex, std::vector<unsigned int>& filled, unsigned int priority )
+        : m_mutex( mutex )
+        , m_filled( filled )
+        , m_priority( priority )
+    {
+    }
+
+    void fillRequest( CUstream /*stream*/, unsigned int pageId ) override
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_filled.push_back( pageId );
+    }
+
+    unsigned int getRequestPriority( unsigned int /*pageId*/ ) override { return m_priority; }
+
+  private:
+    std::mutex&                m_mutex;
+    std::vector<unsigned int>& m_filled;
+    unsigned int               m_priority;
+};
+
+// Records the batches of pages it fills.
+class BatchRecordingRequestHandler : public RequestHandler
+{
+  public:
+    void fillRequests( CUstream /*stream*/, const unsigned int* pageIds, unsigned int numPageIds ) override
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        batches.push_back( std::vector<unsigned int>( pageIds, pageIds + numPageIds ) );
+    }
+
+    void fillRequest( CUstream stream, unsigned int pageId ) override { fillRequests( stream, &pageId, 1 ); }
+
+    std::vector<std::vector<unsigned int>> batches;
+
+  private:
+    std::mutex m_mutex;
+};
+
+// Sleeps for a fixed time per request, simulating a fill that waits on a slow read.
+class SleepingRequestHandler : public RequestHandler
+{
+  public:
+    explicit SleepingRequestHandler( std::chrono::milliseconds duration )
+        : m_duration( duration )
+    {
+    }
+
+    void fillRequest( CUstream /*stream*/, unsigned int /*pageId*/ ) override { std::this_thread::sleep_for( m_duration ); }
+
+  private:
+    std::chrono::milliseconds m_duration;
+};
+
+// Passes requests through unchanged, and prefetches a fixed list of pages.
+class FixedPrefetchFilter : public RequestFilter
+{
+  public:
+    FixedPrefetchFilter( std::vector<unsigned int> prefetches )
+        : m_prefetches( std::move( prefetches ) )
+    {
+    }
+
+    std::vector<unsigned int> filter( const unsigned int* requests, unsigned int numRequests ) override
+    {
+        return std::vector<unsigned int>( requests, requests + numRequests );
+    }
+
+    std::vector<unsigned int> filterAndPrefetch( const unsigned int* requests, unsigned int numRequests, std::vector<unsigned int>& prefetchRequests ) override
+    {
+        prefetchRequests.insert( prefetchRequests.end(), m_prefetches.begin(), m_prefetches.end() );
+        return filter( requests, numRequests );
+    }
+
+  private:
+    std::vector<unsigned int> m_prefetches;
+};
+
+}  // anonymous namespace
+
+class TestWorkStealingRequestProcessor : public testing::Test
+{
+  public:
+    std::mutex                        mutex;
+    std::vector<unsigned int>         filled;
+    RecordingRequestHandler           samplerHandler{mutex, filled, REQUEST_PRIORITY_SAMPLER};
+    RecordingRequestHandler           mipTailHandler{mutex, filled, REQUEST_PRIORITY_MIP_TAIL};
+    RecordingRequestHandler           tileHandler{mutex, filled, REQUEST_PRIORITY_TILE};
+    std::shared_ptr<PageTableManager> pageTableManager{new PageTableManager( 1024u * 1024u, 1024u )};
+    unsigned int                      samplerPage;
+    unsigned int                      mipTailPage;
+    unsigned int                      tilePage;
+
+    void SetUp() override
+    {
+        samplerPage = pageTableManager->reserveUnbackedPages( 1000u, &samplerHandler );
+        mipTailPage = pageTableManager->reserveUnbackedPages( 1000u, &mipTailHandler );
+        tilePage    = pageTableManager->reserveUnbackedPages( 1000u, &tileHandler );
+    }
+
+    Options makeOptions( unsigned int maxThreads ) const
+    {
+        Options options;
+        options.maxThreads = maxThreads;
+        return options;
+    }
+};
+
+TEST_F( TestWorkStealingRequestProcessor, TestEmptyBatch )
+{
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 2 ) );
+    Ticket                       ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, nullptr, 0 );
+    ticket.wait();
+    EXPECT_EQ( 0, ticket.numTasksTotal() );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestAllRequestsFilled )
+{
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 4 ) );
+
+    std::vector<unsigned int> pageIds;
+    for( unsigned int i = 0; i < 1000u; ++i )
+    {
+        pageIds.push_back( tilePage + i );
+        pageIds.push_back( samplerPage + i );
+        pageIds.push_back( mipTailPage + i );
+    }
+
+    std::vector<Ticket> tickets;
+    const unsigned int  numBatches = 3;
+    for( unsigned int id = 0; id < numBatches; ++id )
+    {
+        Ticket ticket = TicketImpl::create( CUstream{} );
+        tickets.push_back( ticket );
+        processor.setTicket( id, ticket );
+        processor.addRequests( CUstream{}, id, pageIds.data() + id * 1000u, 1000u );
+    }
+    for( Ticket& ticket : tickets )
+    {
+        ticket.wait();
+        EXPECT_EQ( 1000, ticket.numTasksTotal() );
+        EXPECT_EQ( 0, ticket.numTasksRemaining() );
+    }
+
+    std::sort( filled.begin(), filled.end() );
+    std::sort( pageIds.begin(), pageIds.end() );
+    EXPECT_EQ( pageIds, filled );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestPriorityOrder )
+{
+    // With a single worker, requests are filled strictly in priority order, and in page order
+    // within each priority class.
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 1 ) );
+
+    const std::vector<unsigned int> pageIds{tilePage, mipTailPage + 1, samplerPage + 2, tilePage + 3, samplerPage + 4, mipTailPage + 5};
+    Ticket ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    ticket.wait();
+
+    const std::vector<unsigned int> expected{samplerPage + 2, samplerPage + 4, mipTailPage + 1, mipTailPage + 5, tilePage, tilePage + 3};
+    EXPECT_EQ( expected, filled );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestQueueLimit )
+{
+    Options options             = makeOptions( 1 );
+    options.maxRequestQueueSize = 10;
+    WorkStealingRequestProcessor processor( pageTableManager, options );
+
+    std::vector<unsigned int> pageIds;
+    for( unsigned int i = 0; i < 100u; ++i )
+        pageIds.push_back( tilePage + i );
+
+    Ticket ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    ticket.wait();
+    EXPECT_EQ( 10, ticket.numTasksTotal() );
+    EXPECT_EQ( 10u, filled.size() );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestContiguousPagesAreBatched )
+{
+    BatchRecordingRequestHandler batchHandler;
+    const unsigned int           startPage = pageTableManager->reserveUnbackedPages( 100u, &batchHandler );
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 1 ) );
+
+    // Pages 0-39 are submitted in reverse order, followed by an isolated page.
+    std::vector<unsigned int> pageIds;
+    for( unsigned int i = 0; i < 40u; ++i )
+        pageIds.push_back( startPage + 39u - i );
+    pageIds.push_back( startPage + 50u );
+
+    Ticket ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    ticket.wait();
+    EXPECT_EQ( 41, ticket.numTasksTotal() );
+
+    // Contiguous pages are filled in sorted runs of bounded length.
+    ASSERT_EQ( 4u, batchHandler.batches.size() );
+    unsigned int expectedPage = startPage;
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        const std::vector<unsigned int>& batch = batchHandler.batches[i];
+        EXPECT_EQ( i < 2 ? 16u : 8u, batch.size() );
+        for( unsigned int pageId : batch )
+            EXPECT_EQ( expectedPage++, pageId );
+    }
+    EXPECT_EQ( std::vector<unsigned int>{startPage + 50u}, batchHandler.batches[3] );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestIdleWorkersSleepDuringLongFills )
+{
+    // Six slow requests on four workers, so two workers are idle while the last two requests are
+    // filled.  Idle workers should sleep rather than spin, so each searches for requests at most
+    // once per work epoch, however long the fills take.
+    SleepingRequestHandler       sleepingHandler( std::chrono::milliseconds( 50 ) );
+    const unsigned int           startPage  = pageTableManager->reserveUnbackedPages( 100u, &sleepingHandler );
+    const unsigned int           numWorkers = 4;
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( numWorkers ) );
+
+    // Isolated pages, so that each is filled by a separate request.
+    std::vector<unsigned int> pageIds;
+    for( unsigned int i = 0; i < 6u; ++i )
+        pageIds.push_back( startPage + 2 * i );
+
+    Ticket ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    ticket.wait();
+    processor.stop();
+
+    EXPECT_EQ( 6, ticket.numTasksTotal() );
+    EXPECT_LE( processor.getNumIdleSearches(), numWorkers * ( processor.getWorkEpoch() + 1 ) );
+}
+
+TEST( TestWorkStealingDeque, TestPushPopSteal )
+{
+    WorkStealingDeque<int> deque( 3 );
+    int                    items[4] = {0, 1, 2, 3};
+    for( int& item : items )
+        EXPECT_TRUE( deque.push( &item ) );
+    EXPECT_FALSE( deque.push( &items[0] ) );
+    EXPECT_EQ( 4u, deque.size() );
+
+    EXPECT_EQ( &items[3], deque.pop() );
+    EXPECT_EQ( &items[0], deque.steal() );
+    EXPECT_EQ( &items[2], deque.pop() );
+    EXPECT_EQ( &items[1], deque.steal() );
+    EXPECT_EQ( nullptr, deque.pop() );
+    EXPECT_EQ( nullptr, deque.steal() );
+}
+
+TEST( TestWorkStealingDeque, TestConcurrentSteal )
+{
+    const int              numItems = 100000;
+    std::vector<int>       items( numItems );
+    std::vector<int>       taken( numItems );
+    WorkStealingDeque<int> deque( numItems );
+    for( int& item : items )
+        deque.push( &item );
+
+    std::atomic<int>         numTaken{0};
+    std::vector<std::thread> thieves;
+    for( int i = 0; i < 4; ++i )
+    {
+        thieves.emplace_back( [&] {
+            while( numTaken.load() < numItems )
+            {
+                if( int* item = deque.steal() )
+                {
+                    ++taken[item - items.data()];
+                    ++numTaken;
+                }
+            }
+        } );
+    }
+    while( int* item = deque.pop() )
+    {
+        ++taken[item - items.data()];
+        ++numTaken;
+    }
+    for( std::thread& thief : thieves )
+        thief.join();
+
+    EXPECT_EQ( numItems, numTaken.load() );
+    EXPECT_TRUE( std::all_of( taken.begin(), taken.end(), []( int count ) { return count == 1; } ) );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestQueueWaitRecorded )
+{
+    LatencyRecorder              recorder;
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 2 ) );
+    processor.setLatencyRecorder( &recorder );
+
+    // Two runs of contiguous pages (one per handler), so two queue waits are recorded.
+    std::vector<unsigned int> pageIds{tilePage, tilePage + 1, samplerPage};
+    Ticket                    ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, pageIds.data(), static_cast<unsigned int>( pageIds.size() ) );
+    ticket.wait();
+    processor.stop();
+
+    LatencyHistogram histograms[NUM_LATENCY_STAGES];
+    recorder.getHistograms( histograms );
+    EXPECT_EQ( 2U, histograms[STAGE_QUEUE_WAIT].count );
+}
+
+TEST_F( TestWorkStealingRequestProcessor, TestPrefetchesFilledLast )
+{
+    // The sampler page is prefetched, so it is filled after the tile, and the ticket only tracks the tile.
+    WorkStealingRequestProcessor processor( pageTableManager, makeOptions( 1 ) );
+    processor.setRequestFilter( std::make_shared<FixedPrefetchFilter>( std::vector<unsigned int>{samplerPage} ) );
+
+    const unsigned int pageId = tilePage;
+    Ticket             ticket = TicketImpl::create( CUstream{} );
+    processor.setTicket( 0, ticket );
+    processor.addRequests( CUstream{}, 0, &pageId, 1 );
+    ticket.wait();
+    EXPECT_EQ( 1, ticket.numTasksTotal() );
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+    while( std::chrono::steady_clock::now() < timeout )
+    {
+        {
+            std::unique_lock<std::mutex> lock( mutex );
+            if( filled.size() == 2 )
+                break;
+        }
+        std::this_thread::yield();
+    }
+    processor.stop();
+    const std::vector<unsigned int> expected{tilePage, samplerPage};
+    EXPECT_EQ( expected, filled );
+}
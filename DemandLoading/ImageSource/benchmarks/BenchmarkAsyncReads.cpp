@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only benchmark for the AsyncReadEngine.  It reads random 64 KB tiles from a tiled DDS file
+// through each engine at queue depths from 1 to 256, then compares DDSImageReader::readTiles with
+// and without a read engine on a few threads, as the demand loader's request processor would call it.
+// If no file is given, a synthetic BC1 file is written and converted to a tiled file.  To measure
+// the drive rather than the page cache, use a file larger than memory or drop the page cache
+// between runs (e.g. "echo 3 > /proc/sys/vm/drop_caches").
+//
+// Usage: benchmarkAsyncReads [tiledFile.dds] [numReads]
+
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
+#include <OptiXToolkit/ImageSource/DDSImageReader.h>
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace imageSource;
+
+namespace {
+
+const unsigned int TILES_PER_BATCH = 16;  // MAX_TILES_PER_READ in the demand loader
+const unsigned int NUM_THREADS     = 4;
+
+double secondsSince( std::chrono::steady_clock::time_point start )
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+// Write a flat BC1 file with a single mip level of random blocks.
+void writeFlatDDS( const std::string& fileName, unsigned int size )
+{
+    DDSFileHeader header{};
+    header.magicNumber           = DDS_MAGIC_NUMBER;
+    header.sizeCheck             = 124;
+    header.width                 = size;
+    header.height                = size;
+    header.mipMapCount           = 1;
+    header.pixelFormat.sizeCheck = 32;
+    memcpy( header.pixelFormat.fourCCcode, "DXT1", 4 );
+
+    std::ofstream     file( fileName, std::ios::binary );
+    std::mt19937      rng( 0 );
+    std::vector<char> row( size / BC_BLOCK_WIDTH * 8 );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    for( unsigned int y = 0; y < size / BC_BLOCK_HEIGHT; ++y )
+    {
+        for( char& c : row )
+            c = static_cast<char>( rng() );
+        file.write( row.data(), row.size() );
+    }
+}
+
+// Read numReads random tiles through the engine, keeping up to the queue depth in flight.
+void benchmarkEngine( AsyncReadEngine& engine, const PositionalFile& file, uint64_t firstTileOffset, unsigned int numTiles, unsigned int numReads )
+{
+    const unsigned int      queueDepth = engine.getQueueDepth();
+    std::vector<char>       buffers( static_cast<size_t>( queueDepth ) * TILE_SIZE_IN_BYTES );
+    std::vector<char*>      freeBuffers;
+    std::mutex              mutex;
+    std::condition_variable bufferFreed;
+    std::atomic<unsigned>   numFailed{0};
+    for( unsigned int i = 0; i < queueDepth; ++i )
+        freeBuffers.push_back( &buffers[static_cast<size_t>( i ) * TILE_SIZE_IN_BYTES] );
+
+    std::mt19937 rng( 1 );
+    const auto   start = std::chrono::steady_clock::now();
+    for( unsigned int i = 0; i < numReads; ++i )
+    {
+        char* buffer;
+        {
+            std::unique_lock<std::mutex> lock( mutex );
+            bufferFreed.wait( lock, [&] { return !freeBuffers.empty(); } );
+            buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+        }
+        const uint64_t offset = firstTileOffset + static_cast<uint64_t>( rng() % numTiles ) * TILE_SIZE_IN_BYTES;
+        engine.submit( file, buffer, TILE_SIZE_IN_BYTES, offset, [&, buffer]( bool success ) {
+            if( !success )
+                ++numFailed;
+            std::unique_lock<std::mutex> lock( mutex );
+            freeBuffers.push_back( buffer );
+            bufferFreed.notify_one();
+        } );
+    }
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        bufferFreed.wait( lock, [&] { return freeBuffers.size() == queueDepth; } );
+    }
+    const double seconds = secondsSince( start );
+
+    printf( "%-12s depth %3u: %9.0f reads/s %8.1f MB/s%s\n", engine.getName(), queueDepth, numReads / seconds,
+            numReads * ( TILE_SIZE_IN_BYTES / ( 1024.0 * 1024.0 ) ) / seconds, numFailed ? " (reads failed)" : "" );
+}
+
+// Read batches of random tiles from mip level 0 with DDSImageReader::readTiles on several threads.
+void benchmarkReader( const std::string& fileName, std::shared_ptr<AsyncReadEngine> engine, unsigned int numReads )
+{
+    DDSImageReader reader( fileName, false, DDSFileAccess::POSITIONAL_READ, engine );
+    TextureInfo    info;
+    reader.open( &info );
+    const unsigned int widthInTiles  = ( info.width + reader.getTileWidth() - 1 ) / reader.getTileWidth();
+    const unsigned int heightInTiles = ( info.height + reader.getTileHeight() - 1 ) / reader.getTileHeight();
+
+    std::atomic<unsigned int> numFailed{0};
+    std::vector<std::thread>  threads;
+    const auto                start = std::chrono::steady_clock::now();
+    for( unsigned int t = 0; t < NUM_THREADS; ++t )
+    {
+        threads.emplace_back( [&, t] {
+            std::mt19937                                gen( t );
+            std::uniform_int_distribution<unsigned int> randomX( 0, widthInTiles - 1 );
+            std::uniform_int_distribution<unsigned int> randomY( 0, heightInTiles - 1 );
+            std::vector<Tile>                           tiles( TILES_PER_BATCH );
+            std::vector<char>                           dest( TILES_PER_BATCH * TILE_SIZE_IN_BYTES );
+            for( unsigned int i = t * TILES_PER_BATCH; i < numReads; i += NUM_THREADS * TILES_PER_BATCH )
+            {
+                for( Tile& tile : tiles )
+                    tile = Tile{randomX( gen ), randomY( gen ), reader.getTileWidth(), reader.getTileHeight()};
+                if( !reader.readTiles( dest.data(), TILE_SIZE_IN_BYTES, 0, tiles.data(), TILES_PER_BATCH, CUstream{} ) )
+                    ++numFailed;
+            }
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+    const double seconds = secondsSince( start );
+
+    printf( "readTiles, %u threads, %-28s %9.0f tiles/s%s\n", NUM_THREADS,
+            engine ? ( std::string( engine->getName() ) + " depth " + std::to_string( engine->getQueueDepth() ) + ":" ).c_str() : "blocking reads:",
+            reader.getNumTilesRead() / seconds, numFailed ? " (reads failed)" : "" );
+}
+
+}  // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    std::string        fileName = argc > 1 ? argv[1] : "";
+    const unsigned int numReads = argc > 2 ? static_cast<unsigned int>( atoi( argv[2] ) ) : 16384;
+
+    if( fileName.empty() )
+    {
+        const std::string flatFileName = "benchmarkAsyncReadsFlat.dds";
+        fileName                       = "benchmarkAsyncReadsTiled.dds";
+        writeFlatDDS( flatFileName, 8192 );
+        DDSImageReader flatReader( flatFileName, false );
+        flatReader.open( nullptr );
+        const bool saved = flatReader.saveAsTiledFile( fileName.c_str() );
+        flatReader.close();
+        std::remove( flatFileName.c_str() );
+        if( !saved )
+        {
+            fprintf( stderr, "Failed to write %s\n", fileName.c_str() );
+            return 1;
+        }
+    }
+
+    // The tiles of mip level 0 follow the header.
+    DDSImageReader reader( fileName, false );
+    TextureInfo    info;
+    reader.open( &info );
+    if( !info.isValid || !reader.isFileTiled() )
+    {
+        fprintf( stderr, "%s is not a tiled DDS file\n", fileName.c_str() );
+        return 1;
+    }
+    PositionalFile file;
+    file.open( fileName, false );
+    DDSFileHeader header{};
+    file.read( reinterpret_cast<char*>( &header ), sizeof( header ), 0 );
+    const uint64_t firstTileOffset =
+        sizeof( DDSFileHeader ) + ( memcmp( header.pixelFormat.fourCCcode, "DX10", 4 ) == 0 ? sizeof( DDSHeaderExtension ) : 0 );
+    const unsigned int numTiles = static_cast<unsigned int>( ( file.size() - firstTileOffset ) / TILE_SIZE_IN_BYTES );
+    printf( "%s: %ux%u, %u tiles, %u reads\n", fileName.c_str(), info.width, info.height, numTiles, numReads );
+
+    const AsyncReadEngineType types[] = {AsyncReadEngineType::THREAD_POOL, AsyncReadEngineType::IO_URING};
+    for( AsyncReadEngineType type : types )
+    {
+        for( unsigned int queueDepth = 1; queueDepth <= 256; queueDepth *= 4 )
+        {
+            std::shared_ptr<AsyncReadEngine> engine;
+            try
+            {
+                engine = createAsyncReadEngine( queueDepth, type );
+            }
+            catch( const std::runtime_error& e )
+            {
+                printf( "Skipped: %s\n", e.what() );
+                break;
+            }
+            benchmarkEngine( *engine, file, firstTileOffset, numTiles, numReads );
+        }
+    }
+
+    benchmarkReader( fileName, nullptr, numReads );
+    benchmarkReader( fileName, createAsyncReadEngine( 64 ), numReads );
+    return 0;
+}
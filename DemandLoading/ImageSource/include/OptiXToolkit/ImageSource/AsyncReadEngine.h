@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// \file AsyncReadEngine.h
+/// Asynchronous positional reads for file-backed ImageSources.
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace imageSource {
+
+class PositionalFile;
+
+/// The implementation of an AsyncReadEngine.
+enum class AsyncReadEngineType
+{
+    /// io_uring if the kernel supports it, otherwise a thread pool.
+    DEFAULT,
+
+    /// Blocking positional reads on a pool of threads, one per read in flight.  Portable.
+    THREAD_POOL,
+
+    /// Linux io_uring, which keeps many reads in flight with a single completion thread.
+    IO_URING
+};
+
+/// AsyncReadEngine performs positional reads from PositionalFiles in the background, keeping up to
+/// a given number of reads (the queue depth) in flight, and invokes a callback when each read
+/// completes.  This lets a few request processing threads keep enough reads in flight to saturate
+/// an NVMe drive, rather than blocking a thread per read.  Reads from memory mapped files are
+/// copied immediately.  Thread safe.
+///
+/// Callbacks run on an engine thread (or on the submitting thread, before submit returns, if the
+/// read completes immediately), and must not throw, block on other reads, or destroy the engine.
+/// The file and the destination must remain valid until the callback is invoked.
+class AsyncReadEngine
+{
+  public:
+    using Callback = std::function<void( bool success )>;
+
+    /// Wait for the reads in flight to complete.
+    virtual ~AsyncReadEngine() = default;
+
+    /// Read size bytes at the given offset of the file into dest, invoking the callback when done.
+    /// The read fails if it extends past the end of the file.  Reads beyond the queue depth are
+    /// queued until earlier reads complete.
+    void submit( const PositionalFile& file, char* dest, size_t size, uint64_t offset, Callback callback );
+
+    /// Get the maximum number of reads in flight.
+    unsigned int getQueueDepth() const { return m_queueDepth; }
+
+    /// Get the name of the implementation, e.g. for logging.
+    virtual const char* getName() const = 0;
+
+  protected:
+    explicit AsyncReadEngine( unsigned int queueDepth )
+        : m_queueDepth( queueDepth )
+    {
+    }
+
+    /// Read from a file that is open and not memory mapped.  The read is within the file.
+    virtual void submitRead( const PositionalFile& file, char* dest, size_t size, uint64_t offset, Callback callback ) = 0;
+
+  private:
+    unsigned int m_queueDepth;
+};
+
+/// Create an AsyncReadEngine with the given queue depth.  Throws std::runtime_error if io_uring is
+/// requested but is not supported (or permitted) on this system.
+std::shared_ptr<AsyncReadEngine> createAsyncReadEngine( unsigned int        queueDepth,
+                                                        AsyncReadEngineType type = AsyncReadEngineType::DEFAULT );
+
+/// AsyncReadBatch submits a group of reads to an AsyncReadEngine and waits for all of them, which
+/// lets a synchronous reader such as ImageSource::readTiles keep the reads of a batch in flight at
+/// once.  Not thread safe.
+class AsyncReadBatch
+{
+  public:
+    explicit AsyncReadBatch( AsyncReadEngine& engine )
+        : m_engine( engine )
+    {
+    }
+
+    /// Wait for the submitted reads, since they refer to the batch.
+    ~AsyncReadBatch() { wait(); }
+
+    /// Submit a read of size bytes at the given offset of the file into dest.
+    void read( const PositionalFile& file, char* dest, size_t size, uint64_t offset );
+
+    /// Wait for the submitted reads to complete.  Returns false if any read failed.
+    bool wait();
+
+    /// Not copyable.
+    AsyncReadBatch( const AsyncReadBatch& ) = delete;
+
+    /// Not assignable.
+    AsyncReadBatch& operator=( const AsyncReadBatch& ) = delete;
+
+  private:
+    AsyncReadEngine&        m_engine;
+    std::mutex              m_mutex;
+    std::condition_variable m_completed;
+    unsigned int            m_numPending = 0;
+    bool                    m_failed     = false;
+};
+
+}  // namespace imageSource
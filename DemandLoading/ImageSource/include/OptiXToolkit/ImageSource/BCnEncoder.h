@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/ImageSource/ImageSource.h>
+
+#include <vector_types.h>
+
+#include <memory>
+#include <string>
+
+namespace imageSource {
+
+/// Block compressed formats written by the built-in encoder.
+enum class BCFormat
+{
+    BC1,   ///< RGB, 8 bytes per block (four color mode).
+    BC4,   ///< R, 8 bytes per block.
+    BC5,   ///< RG, 16 bytes per block.
+    BC6H,  ///< Unsigned half float RGB, 16 bytes per block (mode 11).
+    BC7    ///< RGBA, 16 bytes per block (mode 6).
+};
+
+/// Get the size in bytes of a 4x4 block in the given format.
+unsigned int getBCBlockSizeInBytes( BCFormat format );
+
+/// Encode a 4x4 block of texels, given in row-major order, writing getBCBlockSizeInBytes(format)
+/// bytes to dest.  Values are clamped to [0,1], except for BC6H, which clamps them to the finite
+/// non-negative half range.  BC4 encodes the x component, and BC5 the x and y components.
+void encodeBCBlock( BCFormat format, const float4 texels[16], unsigned char* dest );
+
+/// Options for writing a block compressed DDS file.
+struct BCEncoderOptions
+{
+    /// The block compressed format.
+    BCFormat format = BCFormat::BC7;
+
+    /// The first mip level of the source image to write.  Finer levels are dropped.
+    unsigned int firstMipLevel = 0;
+
+    /// Whether to write the tiled layout read tile-wise by DDSImageReader, rather than a standard
+    /// DDS file.
+    bool tiled = true;
+
+    /// Maximum number of threads used to encode bands of blocks (0 means the hardware concurrency).
+    unsigned int maxThreads = 0;
+};
+
+/// Encode an image as a block compressed DDS file, without intermediate files.  Images with a
+/// single mip level are mipmapped with MipMapImageSource.  Unsigned 8- and 16-bit, half, and
+/// float formats with 1-4 channels are supported; single channel images are treated as
+/// luminance.  Every mip level from firstMipLevel down is written; partial blocks at the right and
+/// bottom edges replicate the edge texels.  (DDSImageReader reads only the levels whose dimensions
+/// are multiples of four.)  Returns false if the image cannot be read or encoded, or the file cannot
+/// be written.
+bool writeBCFile( std::shared_ptr<ImageSource> image, const std::string& fileName, const BCEncoderOptions& options = BCEncoderOptions() );
+
+}  // namespace imageSource
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -8,6 +8,7 @@
 #include <string>
 #include <array>
 
+#include <OptiXToolkit/ImageSource/CompressedTextureCacheManifest.h>
 #include <OptiXToolkit/ImageSource/DDSImageReader.h>
 #include <OptiXToolkit/ImageSource/CoreEXRReader.h>
 
@@ -25,6 +26,8 @@ struct CompressedTextureCacheOptions
     unsigned int minImageSize = 512;              // Don't drop mip levels of cached images to below this size
     unsigned int hdrCheckSize = 256;              // Size of image to read to see if an exr is an hdr image
 
+    bool builtInEncoder = true;                  // Encode DDS images in process rather than with nvcompress
+    unsigned int encoderThreads = 0;             // Threads per image for the built-in encoder (0 means all cores)
     std::string nvcompress;                      // nvcompress executable
     bool saveTiled = true;                       // Save images as tiled or regular dds images
     const char** exrToDdsFormats = EXR_TO_DDS_FORMATS_STANDARD.data();
@@ -37,15 +40,24 @@ class CompressedTextureCacheManager
 {
   public:
     /// Create a compressed texture cache manager with the given options
-    CompressedTextureCacheManager( const CompressedTextureCacheOptions& options ) { m_options = options; }
+    CompressedTextureCacheManager( const CompressedTextureCacheOptions& options )
+        : m_options( options )
+        , m_manifest( options.cacheFolder )
+    {
+    }
 
     /// Get the cache file path that will be used for a given input file
     std::string getCacheFilePath( const std::string& cacheFileName, const std::string& extension );
 
+    /// Get the path of the DDS file cached for an input file with the current options, or an empty
+    /// string if the input file has not been cached or has changed since it was cached.
+    std::string findCacheFileAsDDS( const std::string& inputFilePath ) const;
+
     /// Put a texture set into the compressed cache using Neural Texture Compression
     bool cacheTextureSetAsNtc( const std::vector<std::string>& inputFilePaths, int deviceId = 0 );
 
-    /// Put an input file into the compressed cache as a DDS image
+    /// Put an input file into the compressed cache as a DDS image.  The cache file is named by the
+    /// contents of the input file and the conversion options, and recorded in the cache manifest.
     bool cacheFileAsDDS( const std::string& inputFilePath, int deviceId = 0 );
 
     /// Determine if a file extension is of a known type for compression
@@ -56,9 +68,14 @@ class CompressedTextureCacheManager
     
   private:
     CompressedTextureCacheOptions m_options;
+    CompressedTextureCacheManifest m_manifest;
     bool m_verbose = false;
 
+    std::string getOptionsKey() const;
+
     void printCommand( const std::string& command );
+    bool convertFileToDDS( const std::string& inputFilePath, const std::string& cacheFilePath, int deviceId );
+    bool encodeFileAsDDS( const std::string& inputFilePath, const std::string& suffix, const std::string& cacheFilePath );
     bool isHighDynamicRange( CoreEXRReader& exrReader, TextureInfo& texInfo );
     bool convertEXRtoHDR( CoreEXRReader& exrReader, TextureInfo& texInfo, const std::string& outFile );
     bool convertEXRtoTGA4( CoreEXRReader& exrReader, TextureInfo& texInfo, float exposure, float gamma, std::string& outFileName );
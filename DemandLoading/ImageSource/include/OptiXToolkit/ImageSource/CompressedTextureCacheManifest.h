@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace imageSource {
+
+/// A source image recorded in a CompressedTextureCacheManifest.
+struct CacheManifestEntry
+{
+    std::string        sourcePath;   ///< Absolute path of the source image.
+    unsigned long long sourceSize;   ///< Size of the source file when it was cached.
+    long long          sourceTime;   ///< Modification time of the source file when it was cached.
+    unsigned long long contentHash;  ///< Hash of the source file contents.
+    std::string        optionsKey;   ///< Conversion options (format, dropped mip levels, tiling, etc.)
+    std::string        cacheFile;    ///< Name of the cache file, relative to the cache folder.
+};
+
+/// A manifest of the source images in a compressed texture cache folder, stored in the folder as
+/// manifest.txt.  Cache files are named by a hash of the source contents and the conversion
+/// options, so identical sources share a cache file.  A source whose size or modification time
+/// has changed since it was cached is stale.
+///
+/// Several processes may build the same cache folder.  Updates hold an exclusive lock on the
+/// folder's manifest.lock file while they merge the manifest on disk, and replace it with an
+/// atomic rename, so readers never see a partially written manifest.
+class CompressedTextureCacheManifest
+{
+  public:
+    /// Open the manifest in the given cache folder, reading it if it exists.
+    explicit CompressedTextureCacheManifest( const std::string& cacheFolder );
+
+    /// Re-read the manifest, picking up entries added by other processes.
+    void reload();
+
+    /// Get the path of the cache file for a source image converted with the given options, or of
+    /// the most recently cached conversion if the options key is empty.  Returns an empty string
+    /// if the source is not in the manifest, the source has changed since it was cached, or the
+    /// cache file is missing.  The lookup is a hash table query plus two file status checks.
+    std::string findCacheFile( const std::string& sourcePath, const std::string& optionsKey = std::string() ) const;
+
+    /// Record that a source image with the given content hash was converted to the named cache
+    /// file, and write the manifest.  The source size and modification time must be obtained with
+    /// getSourceStatus before the source is hashed; the entry is rejected if the source has changed
+    /// since, as the hash and cache file may not match its contents.  The options key must not
+    /// contain tabs or newlines.  A cache file superseded by this entry is deleted if no other
+    /// entry refers to it.  Returns false if the entry was rejected or the manifest could not be
+    /// written.
+    bool addEntry( const std::string& sourcePath,
+                   unsigned long long sourceSize,
+                   long long          sourceTime,
+                   unsigned long long contentHash,
+                   const std::string& optionsKey,
+                   const std::string& cacheFile );
+
+    /// Get the number of entries in the manifest.
+    size_t getNumEntries() const;
+
+    /// Get the cache folder.
+    const std::string& getCacheFolder() const { return m_cacheFolder; }
+
+    /// Get the path of a file in the cache folder.
+    std::string getCachePath( const std::string& cacheFile ) const;
+
+    /// Get the cache file name for source contents converted with the given options, which is a
+    /// hexadecimal hash of both followed by the extension.
+    static std::string getCacheFileName( unsigned long long contentHash, const std::string& optionsKey, const std::string& extension );
+
+    /// Get the size and modification time of a source file.  Returns false if it is not a regular file.
+    static bool getSourceStatus( const std::string& path, unsigned long long& size, long long& time );
+
+    /// Hash the contents of a file.  Returns false if the file cannot be read.
+    static bool hashFile( const std::string& path, unsigned long long& hash );
+
+  private:
+    std::string        m_cacheFolder;
+    mutable std::mutex m_mutex;
+
+    // Entries keyed by absolute source path and options key, and the key of the most recent entry
+    // for each source path.
+    std::unordered_map<std::string, CacheManifestEntry> m_entries;
+    std::unordered_map<std::string, std::string>        m_latestEntries;
+
+    void read();
+    bool write() const;
+    void insert( const CacheManifestEntry& entry );
+};
+
+}  // namespace imageSource
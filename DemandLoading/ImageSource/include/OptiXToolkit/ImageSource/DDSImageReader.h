@@ -1,14 +1,13 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #pragma once
 
-#include <fstream>
-
 #include <OptiXToolkit/ImageSource/ImageSource.h>
 #include <OptiXToolkit/ImageSource/TextureInfo.h>
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -16,6 +15,9 @@
 
 namespace imageSource {
 
+class AsyncReadEngine;
+class PositionalFile;
+
 const uint32_t DDS_MAGIC_NUMBER = 0x20534444U; // "DDS "
 const uint32_t BC_BLOCK_WIDTH = 4;
 const uint32_t BC_BLOCK_HEIGHT = 4;
@@ -102,34 +104,29 @@ struct DDSHeaderExtension
 };
 
 /// DDSImageReader, reads direct draw surface (.dds) image files that 
-/// encode BC1-BC7 compressed formats.
+/// encode BC1-BC7 compressed formats.  Reads do not share a file position, so tiles can be
+/// read concurrently from multiple threads.
 class DDSImageReader : public ImageSourceBase
 {
   public:
-    /// Create a test image with the specified dimensions.
-    DDSImageReader( const std::string& fileName, bool readBaseColor );
+    /// Create a reader for the given file.  If a read engine is given, the reads of a batch of
+    /// tiles from a tiled file are submitted to it together rather than performed one at a time.
+    DDSImageReader( const std::string&               fileName,
+                    bool                             readBaseColor,
+                    DDSFileAccess                    fileAccess = DDSFileAccess::POSITIONAL_READ,
+                    std::shared_ptr<AsyncReadEngine> readEngine = nullptr );
 
     /// The destructor is virtual.
-    ~DDSImageReader() override { close(); }
+    ~DDSImageReader() override;
 
     /// The open method simply initializes the given image info struct.
     void open( imageSource::TextureInfo* info ) override;
 
-    /// Close the image
-    void close() override
-    {
-        // Read paths use m_file under m_mutex, so take it here too rather than closing the
-        // stream out from under an in-flight read.
-        std::lock_guard<std::mutex> lock( m_mutex );
-        m_file.close();
-    }
+    /// Close the image, waiting for in-flight reads to finish.
+    void close() override;
 
     /// Check if image is currently open.
-    bool isOpen() const override
-    {
-        std::lock_guard<std::mutex> lock( m_mutex );
-        return m_file.is_open();
-    }
+    bool isOpen() const override;
 
     /// Get the image info.  Valid only after calling open().
     const imageSource::TextureInfo& getInfo() const override { return m_info; }
@@ -140,6 +137,10 @@ class DDSImageReader : public ImageSourceBase
     /// Read the specified tile or mip level, returning the data in dest. 
     bool readTile( char* dest, unsigned int mipLevel, const imageSource::Tile& tile, CUstream stream ) override;
 
+    /// Read a batch of tiles.  For tiled files, runs of tiles that are adjacent on disk are read
+    /// with a single positional read, and the runs are read concurrently if there is a read engine.
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const imageSource::Tile* tiles, unsigned int numTiles, CUstream stream ) override;
+
     /// Read the specified mipLevel.  Returns true for success.
     bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int width, unsigned int height, CUstream stream ) override;
 
@@ -150,6 +151,12 @@ class DDSImageReader : public ImageSourceBase
     bool readMipTail( char* dest, unsigned int mipTailFirstLevel, unsigned int numMipLevels, 
                       const uint2* mipLevelDims, CUstream stream ) override;
 
+    /// Get how the file is accessed.
+    DDSFileAccess getFileAccess() const { return m_fileAccess; }
+
+    /// Get the engine to which batched reads are submitted, if any.
+    const std::shared_ptr<AsyncReadEngine>& getReadEngine() const { return m_readEngine; }
+
     /// Whether the file is tiled.  Valid only after calling open().
     bool isFileTiled() { return m_fileIsTiled; }
 
@@ -177,11 +184,22 @@ class DDSImageReader : public ImageSourceBase
     /// Returns the time in seconds spent reading image tiles.
     double getTotalReadTime() const override { return m_totalReadTime; }
 
+    /// Returns the size of the cached mip levels of a flat file, which are released on close().
+    size_t getHostMemoryUsage() const override;
+
   private:
+    // m_mutex guards opening and closing the file.  Reads run without it, and close() waits for
+    // in-flight reads to drain (see ReadScope).
     mutable std::mutex m_mutex;
-    std::mutex m_mipCacheMutex;
+    std::condition_variable m_readsDoneCv;  // guarded by m_mutex
+    unsigned int m_activeReads = 0;
+    bool m_closing = false;
+
+    mutable std::mutex m_mipCacheMutex;
     std::string m_fileName;
-    std::ifstream m_file;
+    DDSFileAccess m_fileAccess;
+    std::unique_ptr<PositionalFile> m_file;
+    std::shared_ptr<AsyncReadEngine> m_readEngine;
     int m_fileHeaderOffset;
     int m_blockSizeInBytes;
 
@@ -200,6 +218,31 @@ class DDSImageReader : public ImageSourceBase
     unsigned long long m_numBytesRead  = 0;
     double             m_totalReadTime = 0.0;
 
+    // Open the file (m_mutex must be held).
+    void openFile( imageSource::TextureInfo* info );
+
+    // Drain guard: register an in-flight read, opening the file if necessary.  beginRead() returns
+    // false if the file is closing or could not be opened.
+    bool beginRead();
+    void endRead();
+    class ReadScope
+    {
+      public:
+        explicit ReadScope( DDSImageReader& reader )
+            : m_reader( reader )
+            , m_engaged( reader.beginRead() )
+        {
+        }
+        ~ReadScope() { if( m_engaged ) m_reader.endRead(); }
+        bool engaged() const { return m_engaged; }
+        ReadScope( const ReadScope& )            = delete;
+        ReadScope& operator=( const ReadScope& ) = delete;
+
+      private:
+        DDSImageReader& m_reader;
+        bool            m_engaged;
+    };
+
     // Saving the file
     int getMipTailStartLevel();
     int getMipTailSize();
@@ -212,6 +255,7 @@ class DDSImageReader : public ImageSourceBase
 
     // Reading tiled files
     bool readTileTiled( char* dest, unsigned int mipLevel, const Tile& tile );
+    bool readTileRunTiled( char* dest, unsigned int mipLevel, const Tile& firstTile, unsigned int numTiles );
     bool readMipLevelTiled( char* dest, unsigned int mipLevel );
     bool readMipTailTiled( char* dest, unsigned int mipTailFirstLevel );
     int getMipLevelOffsetInBytesTiled( int mipLevel );
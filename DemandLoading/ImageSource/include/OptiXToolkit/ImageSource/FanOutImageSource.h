@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// \file FanOutImageSource.h
+/// Share the reads of an ImageSource among the demand loaders of several devices.
+
+#include <OptiXToolkit/ImageSource/WrappedImageSource.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace imageSource {
+
+/// Statistics for the process-wide cache of reads shared by all FanOutImageSources.
+struct FanOutImageCacheStatistics
+{
+    unsigned long long numReads;          ///< Reads performed by the wrapped image sources.
+    unsigned long long numSharedReads;    ///< Reads satisfied by data that was read for another consumer.
+    unsigned long long numEvictions;      ///< Reads evicted before every consumer copied them.
+    size_t             numResidentBytes;  ///< Current size of resident reads.
+    size_t             memoryBudget;      ///< Current memory budget in bytes.
+};
+
+/// FanOutImageSource shares the reads of an image among several consumers, typically the demand
+/// loaders of the devices in a multi-GPU process, which would otherwise each read and decode the
+/// same tiles.  Each tile, mip level, or mip tail is read from the wrapped image once.  Concurrent
+/// requests for the same data wait for that read, and the data is kept in host memory until every
+/// consumer has copied it into its own transfer buffer.  Consumers are identified by the stream they
+/// read with (and by the current context for the null stream), so each consumer must read with its
+/// own streams; a consumer that copies the same data twice does not take another consumer's share.
+///
+/// The retained data lives in a cache shared by all FanOutImageSources in the process.  The cache
+/// is bounded by a host memory budget, and the least recently used reads are evicted (and read
+/// again on demand) when the budget is exceeded, e.g. when some devices never request a tile.
+///
+/// The contents of the wrapped image must not change while it is open.  Images that fill device
+/// memory are not shared, since the consumers' destinations are on different devices.
+class FanOutImageSource : public WrappedImageSource
+{
+  public:
+    /// The default process-wide memory budget for shared reads.
+    static const size_t DEFAULT_MEMORY_BUDGET = size_t( 1 ) << 30;
+
+    /// Share the reads of the given image among numConsumers consumers.
+    FanOutImageSource( std::shared_ptr<ImageSource> imageSource, unsigned int numConsumers );
+
+    /// Release the shared reads of the image.
+    ~FanOutImageSource() override;
+
+    /// Delegate to the wrapped ImageSource and release the shared reads of the image.
+    void close() override;
+
+    /// Copy the tile from a shared read, reading it from the wrapped ImageSource if necessary.
+    bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream ) override;
+
+    /// Copy the shared tiles, reading the others from the wrapped ImageSource with a single call.
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream ) override;
+
+    /// Copy the mip level from a shared read, reading it from the wrapped ImageSource if necessary.
+    bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream ) override;
+
+    /// Copy the mip tail from a shared read, reading it from the wrapped ImageSource if necessary.
+    bool readMipTail( char*        dest,
+                      unsigned int mipTailFirstLevel,
+                      unsigned int numMipLevels,
+                      const uint2* mipLevelDims,
+                      CUstream     stream ) override;
+
+    /// Get the number of consumers that share the reads of the image.
+    unsigned int getNumConsumers() const { return m_numConsumers; }
+
+    /// Set the process-wide host memory budget for shared reads, evicting reads as needed.
+    static void setMemoryBudget( size_t numBytes );
+
+    /// Get the process-wide host memory budget for shared reads.
+    static size_t getMemoryBudget();
+
+    /// Get statistics for the process-wide cache of shared reads.
+    static FanOutImageCacheStatistics getCacheStatistics();
+
+  private:
+    unsigned int m_numConsumers;
+
+    bool isShared() const;
+};
+
+/// Share the reads of an image among numConsumers consumers, e.g. the demand loaders of every
+/// device.  The image is returned unchanged if there are fewer than two consumers.
+inline std::shared_ptr<ImageSource> createFanOutImageSource( std::shared_ptr<ImageSource> imageSource, unsigned int numConsumers )
+{
+    if( !imageSource || numConsumers < 2 )
+        return imageSource;
+
+    return std::make_shared<FanOutImageSource>( std::move( imageSource ), numConsumers );
+}
+
+}  // namespace imageSource
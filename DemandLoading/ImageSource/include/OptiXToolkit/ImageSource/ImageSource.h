@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -11,6 +11,7 @@
 #include <vector_types.h>
 
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -18,6 +19,7 @@ typedef struct OptixDeviceContext_t* OptixDeviceContext;
 
 namespace imageSource {
 
+class AsyncReadEngine;
 struct TextureInfo;
 
 struct PixelPosition
@@ -72,6 +74,13 @@ class ImageSource
     /// Returns true if the request was satisfied and data was copied into dest.
     virtual bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream ) = 0;
 
+    /// Read a batch of tiles from the specified mip level, returning the data for tile i at
+    /// dest + i * tileStride.  The default implementation calls readTile for each tile; readers
+    /// that can fetch adjacent tiles with a single I/O operation override it.
+    /// Throws an exception on error.
+    /// Returns true if all of the tiles were read.
+    virtual bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream );
+
     /// Read the specified mipLevel. Throws an exception on error.
     /// Returns true if the request was satisfied and data was copied into dest.
     virtual bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream ) = 0;
@@ -107,6 +116,10 @@ class ImageSource
     /// be zero if the reader does not load tiles from disk, e.g. for procedural textures.
     virtual double getTotalReadTime() const = 0;
 
+    /// Returns the number of bytes of host memory held by the image while it is open, e.g. for
+    /// headers and cached mip levels.  Used for memory accounting by ImageSourceCache.
+    virtual size_t getHostMemoryUsage() const { return 0; }
+
     /// Return true if the image has a cascade (larger size) that could be switched to.
     virtual bool hasCascade() const = 0;
 
@@ -148,6 +161,35 @@ inline unsigned int calculateNumMipLevels( unsigned int width, unsigned int heig
     return 1 + static_cast<unsigned int>( std::log2f( static_cast<float>( dim ) ) );
 }
 
-std::shared_ptr<ImageSource> createImageSource( const std::string& filename, const std::string& directory = "" );
+/// How a DDSImageReader accesses the file on disk.
+enum class DDSFileAccess
+{
+    /// Positional reads (pread) straight into the destination buffer, e.g. the pinned transfer
+    /// buffer used by the demand loader, without an intermediate stream buffer.
+    POSITIONAL_READ,
+
+    /// Map the file into memory and copy tiles out of the mapping.  Flat files are copied from the
+    /// mapping directly rather than caching whole mip levels.
+    MEMORY_MAP
+};
+
+/// Options for the ImageSources created by createImageSource.
+struct ImageSourceOptions
+{
+    /// How DDS files are accessed.  Tiled DDS files, such as those written by the
+    /// CompressedTextureCacheManager, can be memory mapped.
+    DDSFileAccess ddsFileAccess = DDSFileAccess::POSITIONAL_READ;
+
+    /// An optional engine to which DDS readers submit the reads of a batch of tiles (see
+    /// ImageSource::readTiles), keeping them in flight together rather than reading one at a time.
+    /// The engine can be shared by any number of readers.
+    std::shared_ptr<AsyncReadEngine> readEngine;
+};
+
+/// Create an ImageSource for the given file, based on its extension.  A relative filename is
+/// looked up in the given directory if it is not found in the current directory.
+std::shared_ptr<ImageSource> createImageSource( const std::string&        filename,
+                                                const std::string&        directory = "",
+                                                const ImageSourceOptions& options   = ImageSourceOptions() );
 
 }  // namespace imageSource
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,23 +10,36 @@
 #include <OptiXToolkit/ImageSource/ImageSource.h>
 #include <OptiXToolkit/ImageSource/ImageSourceCacheStatistics.h>
 
+#include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace imageSource {
 
-/// Cache for ImageSource instances.
+class OpenImageSourceList;
+
+/// Cache for ImageSource instances.  Thread safe; the cache is divided into shards by path, each
+/// with its own lock.
+///
+/// Every open ImageSource holds a file (and possibly header and mip level buffers), so the number
+/// of ImageSources created by get() that are open at once is limited.  When the limit is exceeded,
+/// the least recently used ImageSource is closed, and it is reopened transparently by its next read.
+/// (The limit can be exceeded temporarily when more ImageSources are being read at once.)
+/// ImageSources inserted with set() are not subject to the limit.
 class ImageSourceCache
 {
   public:
+    /// The default maximum number of ImageSources created by get() that are open at once.
+    static const unsigned int DEFAULT_MAX_OPEN_IMAGE_SOURCES = 512;
+
+    /// Construct a cache with the given maximum number of open ImageSources (zero for no limit).
+    explicit ImageSourceCache( unsigned int maxOpenImageSources = DEFAULT_MAX_OPEN_IMAGE_SOURCES );
+
     /// Returns the image source from the cache associated with the given path.
     /// If no such image source exists, returns an empty shared_ptr.
-    std::shared_ptr<ImageSource> find( const std::string& path ) const
-    {
-        auto it = m_cache.find( path );
-        return it == m_cache.end() ? std::shared_ptr<ImageSource>() : it->second;
-    }
+    std::shared_ptr<ImageSource> find( const std::string& path ) const;
 
     /// Get the specified ImageSource.  Returns a cached ImageSource if possible; otherwise a new
     /// instance is created.  The type of the ImageSource is determined by the filename extension.
@@ -37,13 +50,45 @@ class ImageSourceCache
     /// to insert their own ImageSources into the cache without relying on createImageSource to create
     /// the image from the associated filename.  For instance, this allows tiled or mipmap adapted
     /// images to be inserted into the cache.
-    void set( const std::string& path, const std::shared_ptr<ImageSource>& image ) { m_cache[path] = image; }
+    void set( const std::string& path, const std::shared_ptr<ImageSource>& image );
+
+    /// Set the maximum number of open ImageSources (zero for no limit), closing ImageSources as needed.
+    void setMaxOpenImageSources( unsigned int maxOpenImageSources );
+
+    /// Get the maximum number of open ImageSources.
+    unsigned int getMaxOpenImageSources() const;
+
+    /// Set the options for the ImageSources subsequently created by get().
+    void setImageSourceOptions( const ImageSourceOptions& options );
+
+    /// Get the options for the ImageSources created by get().
+    ImageSourceOptions getImageSourceOptions() const;
 
     /// Return aggregate statistics for all ImageSources in the cache
     CacheStatistics getStatistics() const;
 
-private:
-    std::map<std::string, std::shared_ptr<ImageSource>> m_cache;
+    /// Not copyable.
+    ImageSourceCache( const ImageSourceCache& ) = delete;
+
+    /// Not assignable.
+    ImageSourceCache& operator=( const ImageSourceCache& ) = delete;
+
+  private:
+    static const unsigned int NUM_SHARDS = 16;
+
+    struct Shard
+    {
+        mutable std::mutex                                  mutex;
+        std::map<std::string, std::shared_ptr<ImageSource>> cache;
+    };
+
+    std::array<Shard, NUM_SHARDS>        m_shards;
+    std::shared_ptr<OpenImageSourceList> m_openImageSources;
+    mutable std::mutex                   m_optionsMutex;
+    ImageSourceOptions                   m_imageSourceOptions;
+
+    Shard&       getShard( const std::string& path );
+    const Shard& getShard( const std::string& path ) const;
 };
 
 }  // namespace imageSource
@@ -1,9 +1,11 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #pragma once
 
+#include <cstddef>
+
 namespace imageSource {
 
 struct CacheStatistics
@@ -12,6 +14,10 @@ struct CacheStatistics
     unsigned long long totalTilesRead;
     unsigned long long totalBytesRead;
     double             totalReadTime;
+    unsigned int       numOpenImageSources;  ///< ImageSources created by the cache whose files are open.
+    unsigned long long numClosed;            ///< ImageSources closed to stay within the open file budget.
+    unsigned long long numReopened;          ///< ImageSources reopened after being closed.
+    size_t             hostMemoryUsage;      ///< Host memory held by the cached ImageSources, in bytes.
 };
 
 }  // namespace imageSource
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// \file LruCache.h
+/// A map of values bounded by a memory budget, evicting the least recently used values.
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace imageSource {
+
+/// LruCache maps keys to values, each of which is charged a size in bytes against a memory budget.
+/// When the budget is exceeded, the least recently used values are evicted.  The most recently used
+/// value is never evicted, so a value larger than the budget can still be inserted and used; callers
+/// that should not retain such values must check their size before inserting them.
+///
+/// LruCache is not thread safe; callers are expected to guard it with their own mutex.
+template <typename Key, typename Value>
+class LruCache
+{
+  public:
+    /// Construct a cache with the given memory budget in bytes.
+    explicit LruCache( size_t memoryBudget )
+        : m_memoryBudget( memoryBudget )
+    {
+    }
+
+    /// Find the value with the given key, marking it as most recently used.  Returns null on a miss.
+    Value* find( const Key& key )
+    {
+        auto it = m_index.find( key );
+        if( it == m_index.end() )
+            return nullptr;
+        m_lru.splice( m_lru.begin(), m_lru, it->second );
+        return &it->second->value;
+    }
+
+    /// Insert a value of the given size as the most recently used, replacing any value with the same
+    /// key, and evict the least recently used values to stay within the budget.
+    void insert( const Key& key, Value value, size_t size )
+    {
+        erase( key );
+        m_lru.push_front( Entry{ key, std::move( value ), size } );
+        m_index[key] = m_lru.begin();
+        m_numResidentBytes += size;
+        evict();
+    }
+
+    /// Erase the value with the given key, if any.  Returns false if it was not resident.
+    bool erase( const Key& key )
+    {
+        auto it = m_index.find( key );
+        if( it == m_index.end() )
+            return false;
+        erase( it );
+        return true;
+    }
+
+    /// Erase the values with keys between first and last, inclusive.
+    void eraseRange( const Key& first, const Key& last )
+    {
+        auto it  = m_index.lower_bound( first );
+        auto end = m_index.upper_bound( last );
+        while( it != end )
+            erase( it++ );
+    }
+
+    /// Set the memory budget in bytes, evicting values as needed.
+    void setMemoryBudget( size_t numBytes )
+    {
+        m_memoryBudget = numBytes;
+        evict();
+    }
+
+    /// Get the memory budget in bytes.
+    size_t getMemoryBudget() const { return m_memoryBudget; }
+
+    /// Get the total size of the resident values in bytes.
+    size_t getNumResidentBytes() const { return m_numResidentBytes; }
+
+    /// Get the number of values evicted to stay within the budget.
+    unsigned long long getNumEvictions() const { return m_numEvictions; }
+
+    /// Get the total size of the values evicted to stay within the budget.
+    unsigned long long getNumEvictedBytes() const { return m_numEvictedBytes; }
+
+  private:
+    struct Entry
+    {
+        Key    key;
+        Value  value;
+        size_t size;
+    };
+    using EntryList = std::list<Entry>;
+    using Index     = std::map<Key, typename EntryList::iterator>;
+
+    EntryList          m_lru;  // most recently used first
+    Index              m_index;
+    size_t             m_memoryBudget;
+    size_t             m_numResidentBytes = 0;
+    unsigned long long m_numEvictions     = 0;
+    unsigned long long m_numEvictedBytes  = 0;
+
+    // Evict least recently used values until the resident size is within the budget, keeping the
+    // most recently used value.
+    void evict()
+    {
+        while( m_numResidentBytes > m_memoryBudget && m_lru.size() > 1 )
+        {
+            ++m_numEvictions;
+            m_numEvictedBytes += m_lru.back().size;
+            erase( m_index.find( m_lru.back().key ) );
+        }
+    }
+
+    void erase( typename Index::iterator it )
+    {
+        m_numResidentBytes -= it->second->size;
+        m_lru.erase( it->second );
+        m_index.erase( it );
+    }
+};
+
+}  // namespace imageSource
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,10 +13,47 @@
 
 namespace imageSource {
 
+/// Filter used to downsample mip levels.
+enum class MipFilterType
+{
+    BOX,    ///< 2x2 average.
+    TENT,   ///< 4x4 tent (bilinear) filter.
+    KAISER  ///< 8x8 Kaiser-windowed sinc filter, which gives the sharpest alias-free mip levels.
+};
+
+/// Options for generating mip levels.
+struct MipFilterOptions
+{
+    /// The downsampling filter.
+    MipFilterType filter = MipFilterType::KAISER;
+
+    /// Whether the color channels of 8- and 16-bit unsigned formats are sRGB encoded, in which case
+    /// they are filtered in linear space.  The alpha channel (of 4-channel images) is always linear.
+    bool sRGB = false;
+
+    /// Maximum number of threads used to filter bands of rows (0 means the hardware concurrency).
+    /// The default is one, since mip levels are usually generated by the request processor, whose
+    /// worker threads already read in parallel.
+    unsigned int maxThreads = 1;
+};
+
+/// Get the mip filter options for an image with the given info.  Images with 8-bit unsigned
+/// channels (e.g. PNG and JPEG files) are assumed to be sRGB encoded, whereas 16-bit and floating
+/// point images (e.g. EXR files) are assumed to be linear.
+inline MipFilterOptions getMipFilterOptions( const TextureInfo& info )
+{
+    MipFilterOptions options;
+    options.sRGB = info.format == CU_AD_FORMAT_UNSIGNED_INT8;
+    return options;
+}
+
+/// MipMapImageSource adapts an image source with a single mip level, generating the coarser mip
+/// levels by filtering.  Unsigned 8- and 16-bit, half, and float formats with 1-4 channels are
+/// filtered; other formats are point sampled.
 class MipMapImageSource : public WrappedImageSource
 {
   public:
-    MipMapImageSource( std::shared_ptr<ImageSource> baseImage );
+    MipMapImageSource( std::shared_ptr<ImageSource> baseImage, const MipFilterOptions& options = MipFilterOptions() );
 
     void open( TextureInfo* info ) override;
 
@@ -26,6 +63,8 @@ class MipMapImageSource : public WrappedImageSource
 
     bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream ) override;
 
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream ) override;
+
     bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream ) override;
 
     bool readMipTail( char*        dest,
@@ -42,6 +81,7 @@ class MipMapImageSource : public WrappedImageSource
     // Must be called while the mutex is locked.
     const char* getMipLevelBuffer( unsigned int mipLevel, CUstream stream );
 
+    MipFilterOptions   m_options;
     mutable std::mutex m_dataMutex;
     unsigned int       m_numTilesRead{};
     TextureInfo        m_mipMapInfo{};
@@ -51,7 +91,7 @@ class MipMapImageSource : public WrappedImageSource
     std::vector<char*> m_mipLevels;
 };
 
-inline std::shared_ptr<ImageSource> createMipMapImageSource( std::shared_ptr<ImageSource> baseImage )
+inline std::shared_ptr<ImageSource> createMipMapImageSource( std::shared_ptr<ImageSource> baseImage, const MipFilterOptions& options )
 {
     if( !baseImage )
         return {};
@@ -62,7 +102,21 @@ inline std::shared_ptr<ImageSource> createMipMapImageSource( std::shared_ptr<Ima
     if( baseImage->getInfo().numMipLevels > 1 )
         return baseImage;
 
-    return std::make_shared<MipMapImageSource>( std::move( baseImage ) );
+    return std::make_shared<MipMapImageSource>( std::move( baseImage ), options );
+}
+
+/// Create a MipMapImageSource for an image with a single mip level, filtering it with the options
+/// given by getMipFilterOptions for the image's format.
+inline std::shared_ptr<ImageSource> createMipMapImageSource( std::shared_ptr<ImageSource> baseImage )
+{
+    if( !baseImage )
+        return {};
+
+    if( !baseImage->isOpen() )
+        baseImage->open( nullptr );
+
+    const MipFilterOptions options = getMipFilterOptions( baseImage->getInfo() );
+    return createMipMapImageSource( std::move( baseImage ), options );
 }
 
 }  // namespace imageSource
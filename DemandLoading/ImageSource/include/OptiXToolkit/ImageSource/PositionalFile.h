@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace imageSource {
+
+/// PositionalFile is a read-only file that supports concurrent reads at arbitrary offsets.  Unlike
+/// std::ifstream, a read does not depend on a shared file position, so any number of threads can
+/// read without serializing on a mutex (pread on POSIX, overlapped ReadFile on Windows).  The file
+/// can optionally be memory mapped, in which case reads copy directly out of the mapping.
+///
+/// open() and close() are not thread safe with respect to read(); callers must ensure that no
+/// reads are in flight when the file is closed.
+class PositionalFile
+{
+  public:
+    PositionalFile() = default;
+    ~PositionalFile() { close(); }
+
+    /// Open the specified file for reading, optionally memory mapping it.  If mapping fails, the
+    /// file falls back to positional reads.  Returns false if the file could not be opened.
+    bool open( const std::string& fileName, bool memoryMap );
+
+    /// Close the file, unmapping it if necessary.
+    void close();
+
+    /// Check whether the file is open.
+    bool isOpen() const;
+
+    /// Get the size of the file in bytes.  Valid only when the file is open.
+    uint64_t size() const { return m_size; }
+
+    /// Get a pointer to the mapped file contents, or nullptr if the file is not memory mapped.
+    const char* data() const { return m_data; }
+
+#ifndef _WIN32
+    /// Get the file descriptor, e.g. for submitting reads to an AsyncReadEngine.  Valid only when
+    /// the file is open.
+    int getDescriptor() const { return m_fd; }
+#endif
+
+    /// Read size bytes at the given offset into dest.  Thread safe.  Returns false if the read
+    /// failed or extends past the end of the file.
+    bool read( char* dest, size_t size, uint64_t offset ) const;
+
+    /// Not copyable.
+    PositionalFile( const PositionalFile& ) = delete;
+
+    /// Not assignable.
+    PositionalFile& operator=( const PositionalFile& ) = delete;
+
+  private:
+#ifdef _WIN32
+    void* m_handle  = nullptr;
+    void* m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+    uint64_t    m_size = 0;
+    const char* m_data = nullptr;
+};
+
+}  // namespace imageSource
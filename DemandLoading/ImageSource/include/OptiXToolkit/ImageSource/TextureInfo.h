@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -31,6 +31,10 @@ unsigned int getBitsPerChannel( CUarray_format format );
 unsigned int getBitsPerPixel( const TextureInfo& info );
 size_t getTextureSizeInBytes( const TextureInfo& info );
 
+/// Get the size in bytes of a width x height region of the texture (a mip level or tile).  Block
+/// compressed formats are sized in whole 4x4 blocks, so levels smaller than a block take a full block.
+size_t getImageSizeInBytes( const TextureInfo& info, unsigned int width, unsigned int height );
+
 /// Check equality
 inline bool operator==( const TextureInfo& ainfo, const TextureInfo& binfo )
 {
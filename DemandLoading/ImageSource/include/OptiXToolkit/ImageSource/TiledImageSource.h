@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -9,18 +9,37 @@
 
 #include <vector_types.h>
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <utility>
-#include <vector>
 
 namespace imageSource {
 
+/// Statistics for the process-wide cache of decoded mip levels shared by all TiledImageSources.
+struct TiledImageCacheStatistics
+{
+    unsigned long long numHits;           ///< Tile reads satisfied by a resident mip level.
+    unsigned long long numMisses;         ///< Tile reads that decoded a mip level.
+    unsigned long long numEvictions;      ///< Mip levels evicted to stay within the memory budget.
+    unsigned long long numEvictedBytes;   ///< Total size of evicted mip levels.
+    size_t             numResidentBytes;  ///< Current size of resident mip levels.
+    size_t             memoryBudget;      ///< Current memory budget in bytes.
+};
+
+/// TiledImageSource adapts an untiled image source (e.g. PNG or JPG via OIIO) to return tiles.
+/// Tiles are copied from decoded mip levels, which are kept in a cache that is shared by all
+/// TiledImageSources in the process.  The cache is bounded by a host memory budget, and the least
+/// recently used mip levels are evicted (and re-decoded on demand) when the budget is exceeded.
 class TiledImageSource : public WrappedImageSource
 {
   public:
+    /// The default process-wide memory budget for decoded mip levels.
+    static const size_t DEFAULT_MEMORY_BUDGET = size_t( 4 ) << 30;
+
     explicit TiledImageSource( std::shared_ptr<ImageSource> baseImage );
-    ~TiledImageSource() override = default;
+    ~TiledImageSource() override;
 
     void open( TextureInfo* info ) override;
 
@@ -30,6 +49,8 @@ class TiledImageSource : public WrappedImageSource
 
     bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream ) override;
 
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream ) override;
+
     bool readMipTail( char*        dest,
                       unsigned int mipTailFirstLevel,
                       unsigned int numMipLevels,
@@ -38,16 +59,23 @@ class TiledImageSource : public WrappedImageSource
 
     unsigned long long getNumTilesRead() const override;
 
+    /// Set the process-wide host memory budget for decoded mip levels, evicting levels as needed.
+    /// A mip level that is larger than the budget is still decoded, but is the first to be evicted.
+    static void setMemoryBudget( size_t numBytes );
+
+    /// Get the process-wide host memory budget for decoded mip levels.
+    static size_t getMemoryBudget();
+
+    /// Get statistics for the process-wide mip level cache.
+    static TiledImageCacheStatistics getCacheStatistics();
+
   private:
     void getBaseInfo();
 
-    mutable std::mutex m_dataMutex;
-    bool               m_baseIsTiled{};
-    TextureInfo        m_tiledInfo{};
-    unsigned long long m_numTilesRead{};
-    std::vector<char>  m_buffer;
-    std::vector<char*> m_mipLevels;
-    std::vector<uint2> m_mipDimensions;
+    mutable std::mutex              m_dataMutex;
+    bool                            m_baseIsTiled{};
+    TextureInfo                     m_tiledInfo{};
+    std::atomic<unsigned long long> m_numTilesRead{};
 };
 
 /// A simple convenience function to reliably get a tiled image source.
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -47,6 +47,13 @@ class WrappedImageSource : public ImageSource
         return m_imageSource->readTile( dest, mipLevel, tile, stream);
     }
 
+    /// Delegates to the wrapped ImageSource, so that a batch reaches readers that read adjacent
+    /// tiles together.  Derived classes that override readTile must override readTiles as well.
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream ) override
+    {
+        return m_imageSource->readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+    }
+
     /// Delegates to the wrapped ImageSource.
     bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream ) override
     {
@@ -81,6 +88,9 @@ class WrappedImageSource : public ImageSource
     /// Delegates to the wrapped ImageSource.
     double getTotalReadTime() const override { return m_imageSource->getTotalReadTime(); }
 
+    /// Delegates to the wrapped ImageSource.
+    size_t getHostMemoryUsage() const override { return m_imageSource->getHostMemoryUsage(); }
+
     /// Delegates to the wrapped ImageSource.
     bool hasCascade() const override { return m_imageSource->hasCascade(); }
 
@@ -0,0 +1,445 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined( __linux__ ) && defined( __has_include )
+#if __has_include( <linux/io_uring.h> )
+#define OTK_HAS_IO_URING 1
+#include <cerrno>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace imageSource {
+
+namespace {
+
+// ThreadPoolReadEngine performs blocking positional reads on one thread per read in flight.
+class ThreadPoolReadEngine : public AsyncReadEngine
+{
+  public:
+    explicit ThreadPoolReadEngine( unsigned int queueDepth )
+        : AsyncReadEngine( queueDepth )
+    {
+        for( unsigned int i = 0; i < queueDepth; ++i )
+            m_threads.emplace_back( [this] { worker(); } );
+    }
+
+    ~ThreadPoolReadEngine() override
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_stopping = true;
+        }
+        m_queued.notify_all();
+        for( std::thread& thread : m_threads )
+            thread.join();
+    }
+
+    const char* getName() const override { return "thread pool"; }
+
+  protected:
+    void submitRead( const PositionalFile& file, char* dest, size_t size, uint64_t offset, Callback callback ) override
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_queue.push_back( Read{&file, dest, size, offset, std::move( callback )} );
+        }
+        m_queued.notify_one();
+    }
+
+  private:
+    struct Read
+    {
+        const PositionalFile* file;
+        char*                 dest;
+        size_t                size;
+        uint64_t              offset;
+        Callback              callback;
+    };
+
+    std::mutex               m_mutex;
+    std::condition_variable  m_queued;
+    std::deque<Read>         m_queue;
+    bool                     m_stopping = false;
+    std::vector<std::thread> m_threads;
+
+    // Perform queued reads until the engine is stopping and the queue is empty.
+    void worker()
+    {
+        while( true )
+        {
+            Read read;
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_queued.wait( lock, [this] { return m_stopping || !m_queue.empty(); } );
+                if( m_queue.empty() )
+                    return;
+                read = std::move( m_queue.front() );
+                m_queue.pop_front();
+            }
+            read.callback( read.file->read( read.dest, read.size, read.offset ) );
+        }
+    }
+};
+
+#ifdef OTK_HAS_IO_URING
+
+int ioUringSetup( unsigned int numEntries, io_uring_params* params )
+{
+    return static_cast<int>( syscall( __NR_io_uring_setup, numEntries, params ) );
+}
+
+int ioUringEnter( int ringFd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags )
+{
+    return static_cast<int>( syscall( __NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0 ) );
+}
+
+// IoUringReadEngine submits reads to an io_uring.  Submission is serialized by a mutex, and a single
+// completion thread reaps completed reads, resubmits short reads, and invokes the callbacks.  The
+// rings are accessed directly (as liburing does), so there is no dependency on liburing.
+class IoUringReadEngine : public AsyncReadEngine
+{
+  public:
+    explicit IoUringReadEngine( unsigned int queueDepth )
+        : AsyncReadEngine( queueDepth )
+    {
+        // Positional IORING_OP_READ requires Linux 5.6, which introduced IORING_FEAT_RW_CUR_POS.
+        io_uring_params params{};
+        m_ringFd = ioUringSetup( queueDepth, &params );
+        if( m_ringFd < 0 )
+            throw std::runtime_error( std::string( "io_uring_setup failed: " ) + strerror( errno ) );
+        if( !( params.features & IORING_FEAT_RW_CUR_POS ) )
+        {
+            release();
+            throw std::runtime_error( "io_uring does not support positional reads (requires Linux 5.6)" );
+        }
+
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof( unsigned int );
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe );
+        if( params.features & IORING_FEAT_SINGLE_MMAP )
+            m_sqRingSize = m_cqRingSize = std::max( m_sqRingSize, m_cqRingSize );
+        m_sqRing = map( m_sqRingSize, IORING_OFF_SQ_RING );
+        m_cqRing = ( params.features & IORING_FEAT_SINGLE_MMAP ) ? m_sqRing : map( m_cqRingSize, IORING_OFF_CQ_RING );
+        m_sqesSize = params.sq_entries * sizeof( io_uring_sqe );
+        m_sqes     = static_cast<io_uring_sqe*>( map( m_sqesSize, IORING_OFF_SQES ) );
+        if( m_sqRing == nullptr || m_cqRing == nullptr || m_sqes == nullptr )
+        {
+            release();
+            throw std::runtime_error( "failed to map io_uring" );
+        }
+
+        m_sqHead  = ringField( m_sqRing, params.sq_off.head );
+        m_sqTail  = ringField( m_sqRing, params.sq_off.tail );
+        m_sqMask  = *ringField( m_sqRing, params.sq_off.ring_mask );
+        m_sqArray = ringField( m_sqRing, params.sq_off.array );
+        m_cqHead  = ringField( m_cqRing, params.cq_off.head );
+        m_cqTail  = ringField( m_cqRing, params.cq_off.tail );
+        m_cqMask  = *ringField( m_cqRing, params.cq_off.ring_mask );
+        m_cqes    = reinterpret_cast<io_uring_cqe*>( static_cast<char*>( m_cqRing ) + params.cq_off.cqes );
+
+        // The submission queue is emptied by every submission, so it only limits the reads in flight
+        // to keep the completion queue (twice as large) from overflowing.
+        m_maxInFlight = std::min( queueDepth, params.sq_entries );
+
+        m_completionThread = std::thread( [this] { reap(); } );
+    }
+
+    ~IoUringReadEngine() override
+    {
+        // Wait for the reads in flight, then wake the completion thread with a no-op to stop it.
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_idle.wait( lock, [this] { return m_numInFlight == 0 && m_pending.empty(); } );
+            io_uring_sqe* sqe = nextSqe();
+            sqe->opcode       = IORING_OP_NOP;
+            while( submitQueued() < 0 && ( errno == EINTR || errno == EAGAIN ) )
+                std::this_thread::yield();
+        }
+        m_completionThread.join();
+        release();
+    }
+
+    const char* getName() const override { return "io_uring"; }
+
+  protected:
+    void submitRead( const PositionalFile& file, char* dest, size_t size, uint64_t offset, Callback callback ) override
+    {
+        std::vector<Read*> failed;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_pending.push_back( new Read{file.getDescriptor(), dest, size, offset, std::move( callback )} );
+            submitPending( failed );
+        }
+        complete( failed, false );
+    }
+
+  private:
+    struct Read
+    {
+        int      fd;
+        char*    dest;
+        size_t   size;  // remaining after short reads
+        uint64_t offset;
+        Callback callback;
+    };
+
+    int           m_ringFd = -1;
+    void*         m_sqRing = nullptr;
+    void*         m_cqRing = nullptr;
+    io_uring_sqe* m_sqes   = nullptr;
+    size_t        m_sqRingSize = 0;
+    size_t        m_cqRingSize = 0;
+    size_t        m_sqesSize   = 0;
+    unsigned int* m_sqHead  = nullptr;
+    unsigned int* m_sqTail  = nullptr;
+    unsigned int* m_sqArray = nullptr;
+    unsigned int  m_sqMask  = 0;
+    unsigned int* m_cqHead  = nullptr;
+    unsigned int* m_cqTail  = nullptr;
+    io_uring_cqe* m_cqes    = nullptr;
+    unsigned int  m_cqMask  = 0;
+
+    std::mutex              m_mutex;  // guards submission and the counts below
+    std::condition_variable m_idle;
+    std::deque<Read*>       m_pending;  // reads beyond the queue depth
+    unsigned int            m_maxInFlight = 0;
+    unsigned int            m_numInFlight = 0;
+    std::thread             m_completionThread;
+
+    void* map( size_t size, off_t offset )
+    {
+        void* addr = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, offset );
+        return addr == MAP_FAILED ? nullptr : addr;
+    }
+
+    static unsigned int* ringField( void* ring, unsigned int offset )
+    {
+        return reinterpret_cast<unsigned int*>( static_cast<char*>( ring ) + offset );
+    }
+
+    void release()
+    {
+        if( m_sqes != nullptr )
+            munmap( m_sqes, m_sqesSize );
+        if( m_cqRing != nullptr && m_cqRing != m_sqRing )
+            munmap( m_cqRing, m_cqRingSize );
+        if( m_sqRing != nullptr )
+            munmap( m_sqRing, m_sqRingSize );
+        if( m_ringFd >= 0 )
+            close( m_ringFd );
+        m_sqes   = nullptr;
+        m_sqRing = m_cqRing = nullptr;
+        m_ringFd = -1;
+    }
+
+    // Get a cleared submission queue entry and add it to the ring.  m_mutex must be held.
+    io_uring_sqe* nextSqe()
+    {
+        const unsigned int tail  = *m_sqTail;
+        const unsigned int index = tail & m_sqMask;
+        io_uring_sqe*      sqe   = &m_sqes[index];
+        memset( sqe, 0, sizeof( io_uring_sqe ) );
+        m_sqArray[index] = index;
+        __atomic_store_n( m_sqTail, tail + 1, __ATOMIC_RELEASE );
+        return sqe;
+    }
+
+    // Submit the entries added to the ring.  Returns the result of io_uring_enter.  m_mutex must be held.
+    int submitQueued()
+    {
+        const unsigned int numQueued = *m_sqTail - __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+        return numQueued > 0 ? ioUringEnter( m_ringFd, numQueued, 0, 0 ) : 0;
+    }
+
+    // Submit pending reads up to the queue depth.  Reads that cannot be submitted are moved to the
+    // failed list, to complete after the lock is released.  m_mutex must be held.
+    void submitPending( std::vector<Read*>& failed )
+    {
+        std::vector<Read*> submitted;
+        while( !m_pending.empty() && m_numInFlight + submitted.size() < m_maxInFlight )
+        {
+            Read* read = m_pending.front();
+            m_pending.pop_front();
+            io_uring_sqe* sqe = nextSqe();
+            sqe->opcode       = IORING_OP_READ;
+            sqe->fd           = read->fd;
+            sqe->addr         = reinterpret_cast<uint64_t>( read->dest );
+            sqe->len          = static_cast<uint32_t>( std::min<size_t>( read->size, 1u << 30 ) );
+            sqe->off          = read->offset;
+            sqe->user_data    = reinterpret_cast<uint64_t>( read );
+            submitted.push_back( read );
+        }
+        if( submitted.empty() )
+            return;
+
+        int result;
+        while( ( result = submitQueued() ) < 0 && ( errno == EINTR || errno == EAGAIN ) )
+            std::this_thread::yield();
+        m_numInFlight += static_cast<unsigned int>( submitted.size() );
+        if( result >= 0 )
+            return;
+
+        // The kernel did not consume the entries, so withdraw them and fail the reads.
+        __atomic_store_n( m_sqTail, __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE ), __ATOMIC_RELEASE );
+        m_numInFlight -= static_cast<unsigned int>( submitted.size() );
+        failed.insert( failed.end(), submitted.begin(), submitted.end() );
+    }
+
+    static void complete( const std::vector<Read*>& reads, bool success )
+    {
+        for( Read* read : reads )
+        {
+            read->callback( success );
+            delete read;
+        }
+    }
+
+    // Reap completed reads until the no-op submitted by the destructor completes.
+    void reap()
+    {
+        bool stopping = false;
+        while( !stopping )
+        {
+            if( ioUringEnter( m_ringFd, 0, 1, IORING_ENTER_GETEVENTS ) < 0 && errno != EINTR )
+                std::this_thread::yield();
+
+            std::vector<Read*> succeeded;
+            std::vector<Read*> failed;
+            std::vector<Read*> resubmitted;
+            unsigned int       numReaped = 0;
+            unsigned int       head      = *m_cqHead;
+            const unsigned int tail      = __atomic_load_n( m_cqTail, __ATOMIC_ACQUIRE );
+            for( ; head != tail; ++head )
+            {
+                const io_uring_cqe& cqe  = m_cqes[head & m_cqMask];
+                Read*               read = reinterpret_cast<Read*>( cqe.user_data );
+                if( read == nullptr )
+                {
+                    stopping = true;
+                    continue;
+                }
+                ++numReaped;
+                if( cqe.res == -EINTR || cqe.res == -EAGAIN )
+                    resubmitted.push_back( read );
+                else if( cqe.res <= 0 )
+                    failed.push_back( read );
+                else if( static_cast<size_t>( cqe.res ) < read->size )
+                {
+                    // Short read: continue from where it stopped.
+                    read->dest += cqe.res;
+                    read->size -= cqe.res;
+                    read->offset += cqe.res;
+                    resubmitted.push_back( read );
+                }
+                else
+                    succeeded.push_back( read );
+            }
+            __atomic_store_n( m_cqHead, head, __ATOMIC_RELEASE );
+
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_numInFlight -= numReaped;
+                m_pending.insert( m_pending.begin(), resubmitted.begin(), resubmitted.end() );
+                submitPending( failed );
+            }
+            complete( succeeded, true );
+            complete( failed, false );
+            if( numReaped > 0 )
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_idle.notify_all();
+            }
+        }
+    }
+};
+
+#endif  // OTK_HAS_IO_URING
+
+}  // anonymous namespace
+
+void AsyncReadEngine::submit( const PositionalFile& file, char* dest, size_t size, uint64_t offset, Callback callback )
+{
+    if( !file.isOpen() || offset > file.size() || size > file.size() - offset )
+    {
+        callback( false );
+        return;
+    }
+    if( size == 0 )
+    {
+        callback( true );
+        return;
+    }
+    if( file.data() != nullptr )
+    {
+        memcpy( dest, file.data() + offset, size );
+        callback( true );
+        return;
+    }
+    submitRead( file, dest, size, offset, std::move( callback ) );
+}
+
+std::shared_ptr<AsyncReadEngine> createAsyncReadEngine( unsigned int queueDepth, AsyncReadEngineType type )
+{
+    queueDepth = std::max( queueDepth, 1u );
+#ifdef OTK_HAS_IO_URING
+    if( type == AsyncReadEngineType::IO_URING )
+        return std::make_shared<IoUringReadEngine>( queueDepth );
+    if( type == AsyncReadEngineType::DEFAULT )
+    {
+        try
+        {
+            return std::make_shared<IoUringReadEngine>( queueDepth );
+        }
+        catch( const std::runtime_error& )
+        {
+            // io_uring is unavailable (e.g. an old kernel, or blocked by a seccomp policy).
+        }
+    }
+#else
+    if( type == AsyncReadEngineType::IO_URING )
+        throw std::runtime_error( "io_uring is not supported on this platform" );
+#endif
+    return std::make_shared<ThreadPoolReadEngine>( queueDepth );
+}
+
+void AsyncReadBatch::read( const PositionalFile& file, char* dest, size_t size, uint64_t offset )
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        ++m_numPending;
+    }
+    m_engine.submit( file, dest, size, offset, [this]( bool success ) {
+        // Notify while holding the lock, since the batch may be destroyed as soon as wait() returns.
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_failed = m_failed || !success;
+        if( --m_numPending == 0 )
+            m_completed.notify_all();
+    } );
+}
+
+bool AsyncReadBatch::wait()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_completed.wait( lock, [this] { return m_numPending == 0; } );
+    const bool succeeded = !m_failed;
+    m_failed             = false;
+    return succeeded;
+}
+
+}  // namespace imageSource
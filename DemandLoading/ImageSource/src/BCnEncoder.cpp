@@ -0,0 +1,820 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/BCnEncoder.h>
+
+#include <OptiXToolkit/ImageSource/DDSImageReader.h>
+#include <OptiXToolkit/ImageSource/MipMapImageSource.h>
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
+
+#include <cuda_fp16.h>
+#include <vector_functions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace imageSource {
+
+namespace {
+
+const unsigned int NUM_TEXELS = BC_BLOCK_WIDTH * BC_BLOCK_HEIGHT;
+
+// Bands are not split below this many block rows, so small levels are encoded on one thread.
+const unsigned int MIN_BLOCK_ROWS_PER_BAND = 8;
+
+// DDS header flags.
+const uint32_t DDSD_CAPS        = 0x1;
+const uint32_t DDSD_HEIGHT      = 0x2;
+const uint32_t DDSD_WIDTH       = 0x4;
+const uint32_t DDSD_PIXELFORMAT = 0x1000;
+const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+const uint32_t DDSD_LINEARSIZE  = 0x80000;
+const uint32_t DDPF_FOURCC      = 0x4;
+const uint32_t DDSCAPS_COMPLEX  = 0x8;
+const uint32_t DDSCAPS_TEXTURE  = 0x1000;
+const uint32_t DDSCAPS_MIPMAP   = 0x400000;
+const uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+
+// Interpolation weights (out of 64) for 4-bit BC6H and BC7 indices.
+const int BC_WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Largest finite half, in bits.
+const int MAX_HALF_BITS = 0x7BFF;
+
+// A block of texels, with up to four channels.
+typedef float Texels[NUM_TEXELS][4];
+
+float saturate( float value )
+{
+    return value > 0.0f ? std::min( value, 1.0f ) : 0.0f;
+}
+
+int clampInt( int value, int lo, int hi )
+{
+    return std::max( lo, std::min( value, hi ) );
+}
+
+// Writes bit fields to a block, least significant bit first.
+class BitWriter
+{
+  public:
+    BitWriter( unsigned char* dest, unsigned int numBytes )
+        : m_dest( dest )
+    {
+        memset( dest, 0, numBytes );
+    }
+
+    void write( uint32_t value, unsigned int numBits )
+    {
+        for( unsigned int i = 0; i < numBits; ++i, ++m_bit )
+        {
+            if( value & ( 1u << i ) )
+                m_dest[m_bit / 8] |= static_cast<unsigned char>( 1u << ( m_bit % 8 ) );
+        }
+    }
+
+  private:
+    unsigned char* m_dest;
+    unsigned int   m_bit = 0;
+};
+
+// Find endpoints spanning the texels along their principal axis, over the first numChannels channels.
+void getPrincipalEndpoints( const Texels& texels, unsigned int numChannels, float e0[4], float e1[4] )
+{
+    float mean[4] = {};
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+        for( unsigned int c = 0; c < numChannels; ++c )
+            mean[c] += texels[t][c] / NUM_TEXELS;
+
+    float covariance[4][4] = {};
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+        for( unsigned int i = 0; i < numChannels; ++i )
+            for( unsigned int j = 0; j < numChannels; ++j )
+                covariance[i][j] += ( texels[t][i] - mean[i] ) * ( texels[t][j] - mean[j] );
+
+    // Power iteration, starting from the column with the largest variance.
+    unsigned int largest = 0;
+    for( unsigned int c = 1; c < numChannels; ++c )
+        largest = covariance[c][c] > covariance[largest][largest] ? c : largest;
+    float axis[4] = {};
+    for( unsigned int c = 0; c < numChannels; ++c )
+        axis[c] = covariance[c][largest];
+    for( int iteration = 0; iteration < 8; ++iteration )
+    {
+        float next[4] = {};
+        float norm    = 0.0f;
+        for( unsigned int i = 0; i < numChannels; ++i )
+        {
+            for( unsigned int j = 0; j < numChannels; ++j )
+                next[i] += covariance[i][j] * axis[j];
+            norm = std::max( norm, std::fabs( next[i] ) );
+        }
+        if( norm == 0.0f )
+            break;
+        for( unsigned int c = 0; c < numChannels; ++c )
+            axis[c] = next[c] / norm;
+    }
+
+    float axisLength2 = 0.0f;
+    for( unsigned int c = 0; c < numChannels; ++c )
+        axisLength2 += axis[c] * axis[c];
+    float tMin = 0.0f;
+    float tMax = 0.0f;
+    if( axisLength2 > 0.0f )
+    {
+        for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+        {
+            float projection = 0.0f;
+            for( unsigned int c = 0; c < numChannels; ++c )
+                projection += ( texels[t][c] - mean[c] ) * axis[c];
+            projection /= axisLength2;
+            tMin = t == 0 ? projection : std::min( tMin, projection );
+            tMax = t == 0 ? projection : std::max( tMax, projection );
+        }
+    }
+    for( unsigned int c = 0; c < 4; ++c )
+    {
+        e0[c] = mean[c] + tMin * axis[c];
+        e1[c] = mean[c] + tMax * axis[c];
+    }
+}
+
+// Refit the endpoints to the texels by least squares, given the fraction of e1 in each texel.
+// Returns false if the weights do not determine the endpoints.
+bool refitEndpoints( const Texels& texels, const float weights[NUM_TEXELS], unsigned int numChannels, float e0[4], float e1[4] )
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[4] = {}, bx[4] = {};
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        const float a = 1.0f - weights[t];
+        const float b = weights[t];
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for( unsigned int c = 0; c < numChannels; ++c )
+        {
+            ax[c] += a * texels[t][c];
+            bx[c] += b * texels[t][c];
+        }
+    }
+    const float det = aa * bb - ab * ab;
+    if( std::fabs( det ) < 1.0e-6f )
+        return false;
+    for( unsigned int c = 0; c < numChannels; ++c )
+    {
+        e0[c] = ( ax[c] * bb - bx[c] * ab ) / det;
+        e1[c] = ( bx[c] * aa - ax[c] * ab ) / det;
+    }
+    return true;
+}
+
+//
+// BC1
+//
+
+uint16_t packRGB565( const float color[4] )
+{
+    const int r = static_cast<int>( std::lround( saturate( color[0] ) * 31.0f ) );
+    const int g = static_cast<int>( std::lround( saturate( color[1] ) * 63.0f ) );
+    const int b = static_cast<int>( std::lround( saturate( color[2] ) * 31.0f ) );
+    return static_cast<uint16_t>( ( r << 11 ) | ( g << 5 ) | b );
+}
+
+void unpackRGB565( uint16_t packed, float color[4] )
+{
+    const int r = packed >> 11;
+    const int g = ( packed >> 5 ) & 0x3F;
+    const int b = packed & 0x1F;
+    color[0]    = ( ( r << 3 ) | ( r >> 2 ) ) / 255.0f;
+    color[1]    = ( ( g << 2 ) | ( g >> 4 ) ) / 255.0f;
+    color[2]    = ( ( b << 3 ) | ( b >> 2 ) ) / 255.0f;
+}
+
+struct BC1Block
+{
+    uint16_t color0;
+    uint16_t color1;
+    uint32_t indices;
+    float    weights[NUM_TEXELS];
+    float    error;
+};
+
+// Quantize the endpoints and choose the nearest of the four palette colors for each texel.
+BC1Block encodeBC1Endpoints( const Texels& texels, const float e0[4], const float e1[4] )
+{
+    // The four color mode requires color0 > color1.  Colors that quantize to the same value use
+    // index 0 throughout.
+    BC1Block block{packRGB565( e0 ), packRGB565( e1 ), 0, {}, 0.0f};
+    if( block.color0 < block.color1 )
+        std::swap( block.color0, block.color1 );
+
+    const float weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+    float       palette[4][4];
+    unpackRGB565( block.color0, palette[0] );
+    unpackRGB565( block.color1, palette[1] );
+    const unsigned int numColors = block.color0 == block.color1 ? 1 : 4;
+    for( unsigned int i = 2; i < 4; ++i )
+        for( unsigned int c = 0; c < 3; ++c )
+            palette[i][c] = ( 1.0f - weights[i] ) * palette[0][c] + weights[i] * palette[1][c];
+
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        unsigned int best      = 0;
+        float        bestError = 0.0f;
+        for( unsigned int i = 0; i < numColors; ++i )
+        {
+            float error = 0.0f;
+            for( unsigned int c = 0; c < 3; ++c )
+            {
+                const float d = saturate( texels[t][c] ) - palette[i][c];
+                error += d * d;
+            }
+            if( i == 0 || error < bestError )
+            {
+                best      = i;
+                bestError = error;
+            }
+        }
+        block.indices |= best << ( 2 * t );
+        block.weights[t] = weights[best];
+        block.error += bestError;
+    }
+    return block;
+}
+
+void encodeBC1( const Texels& texels, unsigned char* dest )
+{
+    float e0[4], e1[4];
+    getPrincipalEndpoints( texels, 3, e0, e1 );
+    BC1Block block = encodeBC1Endpoints( texels, e0, e1 );
+
+    // Endpoints are ordered by their packed value, so the weights are relative to the larger one.
+    float c0[4], c1[4];
+    unpackRGB565( block.color0, c0 );
+    unpackRGB565( block.color1, c1 );
+    if( block.color0 != block.color1 && refitEndpoints( texels, block.weights, 3, c0, c1 ) )
+    {
+        const BC1Block refit = encodeBC1Endpoints( texels, c0, c1 );
+        if( refit.error < block.error )
+            block = refit;
+    }
+
+    BitWriter writer( dest, 8 );
+    writer.write( block.color0, 16 );
+    writer.write( block.color1, 16 );
+    writer.write( block.indices, 32 );
+}
+
+//
+// BC4 and BC5
+//
+
+void encodeBC4Channel( const Texels& texels, unsigned int channel, unsigned char* dest )
+{
+    float lo = 1.0f, hi = 0.0f;
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        lo = std::min( lo, saturate( texels[t][channel] ) );
+        hi = std::max( hi, saturate( texels[t][channel] ) );
+    }
+
+    // With red0 > red1 the palette has eight evenly spaced values: index 0 is red0, index 1 is
+    // red1, and index i in [2,7] is ((8-i)*red0 + (i-1)*red1) / 7.
+    const int red0 = static_cast<int>( std::lround( hi * 255.0f ) );
+    const int red1 = static_cast<int>( std::lround( lo * 255.0f ) );
+    BitWriter writer( dest, 8 );
+    writer.write( red0, 8 );
+    writer.write( red1, 8 );
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        unsigned int index = 0;
+        if( red0 > red1 )
+        {
+            const float step = ( saturate( texels[t][channel] ) * 255.0f - red1 ) * 7.0f / ( red0 - red1 );
+            const int   k    = clampInt( static_cast<int>( std::lround( step ) ), 0, 7 );
+            index            = k == 7 ? 0 : k == 0 ? 1 : 8 - k;
+        }
+        writer.write( index, 3 );
+    }
+}
+
+//
+// BC7 (mode 6: one subset, 7-bit RGBA endpoints with unique p-bits, 4-bit indices)
+//
+
+struct BC7Block
+{
+    int          endpoints[2][4];  // 7-bit endpoints
+    int          pbits[2];
+    unsigned int indices[NUM_TEXELS];
+    float        weights[NUM_TEXELS];
+    float        error;
+};
+
+// Quantize an endpoint to 7 bits per channel, choosing the p-bit with the lower error.
+void quantizeBC7Endpoint( const float endpoint[4], int quantized[4], int& pbit )
+{
+    float bestError = 0.0f;
+    for( int p = 0; p < 2; ++p )
+    {
+        int   q[4];
+        float error = 0.0f;
+        for( unsigned int c = 0; c < 4; ++c )
+        {
+            const float value = saturate( endpoint[c] ) * 255.0f;
+            q[c]              = clampInt( static_cast<int>( std::lround( ( value - p ) * 0.5f ) ), 0, 127 );
+            const float d     = ( q[c] * 2 + p ) - value;
+            error += d * d;
+        }
+        if( p == 0 || error < bestError )
+        {
+            bestError = error;
+            pbit      = p;
+            std::copy( q, q + 4, quantized );
+        }
+    }
+}
+
+BC7Block encodeBC7Endpoints( const Texels& texels, const float e0[4], const float e1[4] )
+{
+    BC7Block block{};
+    quantizeBC7Endpoint( e0, block.endpoints[0], block.pbits[0] );
+    quantizeBC7Endpoint( e1, block.endpoints[1], block.pbits[1] );
+
+    float palette[16][4];
+    for( unsigned int i = 0; i < 16; ++i )
+    {
+        for( unsigned int c = 0; c < 4; ++c )
+        {
+            const int a   = block.endpoints[0][c] * 2 + block.pbits[0];
+            const int b   = block.endpoints[1][c] * 2 + block.pbits[1];
+            palette[i][c] = static_cast<float>( ( ( 64 - BC_WEIGHTS4[i] ) * a + BC_WEIGHTS4[i] * b + 32 ) >> 6 );
+        }
+    }
+
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        float value[4];
+        for( unsigned int c = 0; c < 4; ++c )
+            value[c] = saturate( texels[t][c] ) * 255.0f;
+        unsigned int best      = 0;
+        float        bestError = 0.0f;
+        for( unsigned int i = 0; i < 16; ++i )
+        {
+            float error = 0.0f;
+            for( unsigned int c = 0; c < 4; ++c )
+                error += ( value[c] - palette[i][c] ) * ( value[c] - palette[i][c] );
+            if( i == 0 || error < bestError )
+            {
+                best      = i;
+                bestError = error;
+            }
+        }
+        block.indices[t] = best;
+        block.weights[t] = BC_WEIGHTS4[best] / 64.0f;
+        block.error += bestError;
+    }
+    return block;
+}
+
+void encodeBC7( const Texels& texels, unsigned char* dest )
+{
+    float e0[4], e1[4];
+    getPrincipalEndpoints( texels, 4, e0, e1 );
+    BC7Block block = encodeBC7Endpoints( texels, e0, e1 );
+    if( refitEndpoints( texels, block.weights, 4, e0, e1 ) )
+    {
+        const BC7Block refit = encodeBC7Endpoints( texels, e0, e1 );
+        if( refit.error < block.error )
+            block = refit;
+    }
+
+    // The most significant bit of the first index is implicitly zero.  The weights are symmetric,
+    // so swapping the endpoints and inverting the indices gives the same colors.
+    if( block.indices[0] >= 8 )
+    {
+        std::swap( block.endpoints[0], block.endpoints[1] );
+        std::swap( block.pbits[0], block.pbits[1] );
+        for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+            block.indices[t] = 15 - block.indices[t];
+    }
+
+    BitWriter writer( dest, 16 );
+    writer.write( 1u << 6, 7 );  // mode 6
+    for( unsigned int c = 0; c < 4; ++c )
+    {
+        writer.write( block.endpoints[0][c], 7 );
+        writer.write( block.endpoints[1][c], 7 );
+    }
+    writer.write( block.pbits[0], 1 );
+    writer.write( block.pbits[1], 1 );
+    writer.write( block.indices[0], 3 );
+    for( unsigned int t = 1; t < NUM_TEXELS; ++t )
+        writer.write( block.indices[t], 4 );
+}
+
+//
+// BC6H unsigned (mode 11: one region, 10-bit RGB endpoints, 4-bit indices).  Texels are fit in
+// half float bit space, where squared errors approximate relative errors.
+//
+
+struct BC6HBlock
+{
+    int          endpoints[2][3];  // 10-bit endpoints
+    unsigned int indices[NUM_TEXELS];
+    float        weights[NUM_TEXELS];
+    float        error;
+};
+
+uint16_t getHalfBits( float value )
+{
+    const __half half = __float2half( value > 0.0f ? std::min( value, 65504.0f ) : 0.0f );
+    uint16_t     bits;
+    memcpy( &bits, &half, sizeof( bits ) );
+    return bits;
+}
+
+int unquantizeBC6H( int endpoint )
+{
+    return endpoint == 0 ? 0 : endpoint == 1023 ? 0xFFFF : ( endpoint << 6 ) + 32;
+}
+
+// The decoded value of an unquantized endpoint is ( value * 31 ) >> 6, which is q * 31 + 15 for
+// a quantized endpoint q in [1,1022].
+int quantizeBC6H( float halfBits )
+{
+    return clampInt( static_cast<int>( std::lround( ( halfBits - 15.0f ) / 31.0f ) ), 0, 1023 );
+}
+
+BC6HBlock encodeBC6HEndpoints( const Texels& halfTexels, const float e0[4], const float e1[4] )
+{
+    BC6HBlock block{};
+    for( unsigned int c = 0; c < 3; ++c )
+    {
+        block.endpoints[0][c] = quantizeBC6H( std::max( 0.0f, std::min( e0[c], float( MAX_HALF_BITS ) ) ) );
+        block.endpoints[1][c] = quantizeBC6H( std::max( 0.0f, std::min( e1[c], float( MAX_HALF_BITS ) ) ) );
+    }
+
+    float palette[16][3];
+    for( unsigned int i = 0; i < 16; ++i )
+    {
+        for( unsigned int c = 0; c < 3; ++c )
+        {
+            const int a   = unquantizeBC6H( block.endpoints[0][c] );
+            const int b   = unquantizeBC6H( block.endpoints[1][c] );
+            palette[i][c] = static_cast<float>( ( ( ( ( 64 - BC_WEIGHTS4[i] ) * a + BC_WEIGHTS4[i] * b + 32 ) >> 6 ) * 31 ) >> 6 );
+        }
+    }
+
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        unsigned int best      = 0;
+        float        bestError = 0.0f;
+        for( unsigned int i = 0; i < 16; ++i )
+        {
+            float error = 0.0f;
+            for( unsigned int c = 0; c < 3; ++c )
+                error += ( halfTexels[t][c] - palette[i][c] ) * ( halfTexels[t][c] - palette[i][c] );
+            if( i == 0 || error < bestError )
+            {
+                best      = i;
+                bestError = error;
+            }
+        }
+        block.indices[t] = best;
+        block.weights[t] = BC_WEIGHTS4[best] / 64.0f;
+        block.error += bestError;
+    }
+    return block;
+}
+
+void encodeBC6H( const Texels& texels, unsigned char* dest )
+{
+    Texels halfTexels;
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+        for( unsigned int c = 0; c < 4; ++c )
+            halfTexels[t][c] = c < 3 ? static_cast<float>( getHalfBits( texels[t][c] ) ) : 0.0f;
+
+    float e0[4], e1[4];
+    getPrincipalEndpoints( halfTexels, 3, e0, e1 );
+    BC6HBlock block = encodeBC6HEndpoints( halfTexels, e0, e1 );
+    if( refitEndpoints( halfTexels, block.weights, 3, e0, e1 ) )
+    {
+        const BC6HBlock refit = encodeBC6HEndpoints( halfTexels, e0, e1 );
+        if( refit.error < block.error )
+            block = refit;
+    }
+
+    // The most significant bit of the first index is implicitly zero (see encodeBC7).
+    if( block.indices[0] >= 8 )
+    {
+        std::swap( block.endpoints[0], block.endpoints[1] );
+        for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+            block.indices[t] = 15 - block.indices[t];
+    }
+
+    BitWriter writer( dest, 16 );
+    writer.write( 0x03, 5 );  // mode 11
+    for( unsigned int e = 0; e < 2; ++e )
+        for( unsigned int c = 0; c < 3; ++c )
+            writer.write( block.endpoints[e][c], 10 );
+    writer.write( block.indices[0], 3 );
+    for( unsigned int t = 1; t < NUM_TEXELS; ++t )
+        writer.write( block.indices[t], 4 );
+}
+
+//
+// Writing DDS files
+//
+
+bool isEncodableFormat( const TextureInfo& info )
+{
+    const bool knownFormat = info.format == CU_AD_FORMAT_UNSIGNED_INT8 || info.format == CU_AD_FORMAT_UNSIGNED_INT16
+                             || info.format == CU_AD_FORMAT_HALF || info.format == CU_AD_FORMAT_FLOAT;
+    return knownFormat && info.numChannels >= 1 && info.numChannels <= 4;
+}
+
+float getChannel( const char* pixel, CUarray_format format, unsigned int channel )
+{
+    switch( format )
+    {
+        case CU_AD_FORMAT_UNSIGNED_INT8:
+            return reinterpret_cast<const uint8_t*>( pixel )[channel] / 255.0f;
+        case CU_AD_FORMAT_UNSIGNED_INT16:
+            return reinterpret_cast<const uint16_t*>( pixel )[channel] / 65535.0f;
+        case CU_AD_FORMAT_HALF:
+            return __half2float( reinterpret_cast<const __half*>( pixel )[channel] );
+        default:
+            return reinterpret_cast<const float*>( pixel )[channel];
+    }
+}
+
+// Get the width or height of a mip level in blocks, including partial blocks.
+unsigned int getSizeInBlocks( unsigned int size, unsigned int blockSize )
+{
+    return ( size + blockSize - 1 ) / blockSize;
+}
+
+// Encode a band of block rows of a mip level, writing the blocks in row-major order.  Partial blocks
+// at the right and bottom edges replicate the edge texels.
+void encodeBlockRows( const char*         level,
+                      unsigned int        width,
+                      unsigned int        height,
+                      unsigned int        rowBegin,
+                      unsigned int        rowEnd,
+                      const TextureInfo&  info,
+                      BCFormat            format,
+                      unsigned char*      dest )
+{
+    const unsigned int pixelSize     = getBitsPerPixel( info ) / BITS_PER_BYTE;
+    const unsigned int widthInBlocks = getSizeInBlocks( width, BC_BLOCK_WIDTH );
+    const unsigned int blockSize     = getBCBlockSizeInBytes( format );
+
+    float4 texels[NUM_TEXELS];
+    for( unsigned int blockY = rowBegin; blockY < rowEnd; ++blockY )
+    {
+        for( unsigned int blockX = 0; blockX < widthInBlocks; ++blockX )
+        {
+            for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+            {
+                const unsigned int x     = std::min( blockX * BC_BLOCK_WIDTH + t % BC_BLOCK_WIDTH, width - 1 );
+                const unsigned int y     = std::min( blockY * BC_BLOCK_HEIGHT + t / BC_BLOCK_WIDTH, height - 1 );
+                const char*        pixel = level + ( static_cast<size_t>( y ) * width + x ) * pixelSize;
+
+                // Single channel images are luminance; missing channels are zero, and alpha is one.
+                float c[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+                for( unsigned int channel = 0; channel < info.numChannels; ++channel )
+                    c[channel] = getChannel( pixel, info.format, channel );
+                if( info.numChannels == 1 )
+                    c[1] = c[2] = c[0];
+                texels[t] = make_float4( c[0], c[1], c[2], c[3] );
+            }
+            encodeBCBlock( format, texels, dest + ( static_cast<size_t>( blockY ) * widthInBlocks + blockX ) * blockSize );
+        }
+    }
+}
+
+// Encode a mip level, splitting the block rows into bands that are encoded in parallel.
+void encodeMipLevel( const char* level, unsigned int width, unsigned int height, const TextureInfo& info, const BCEncoderOptions& options, std::vector<unsigned char>& dest )
+{
+    const unsigned int widthInBlocks  = getSizeInBlocks( width, BC_BLOCK_WIDTH );
+    const unsigned int heightInBlocks = getSizeInBlocks( height, BC_BLOCK_HEIGHT );
+    dest.resize( static_cast<size_t>( widthInBlocks ) * heightInBlocks * getBCBlockSizeInBytes( options.format ) );
+
+    const unsigned int maxThreads = options.maxThreads != 0 ? options.maxThreads : std::max( 1U, std::thread::hardware_concurrency() );
+    const unsigned int numBands   = std::max( 1U, std::min( maxThreads, heightInBlocks / MIN_BLOCK_ROWS_PER_BAND ) );
+    const unsigned int bandHeight = ( heightInBlocks + numBands - 1 ) / numBands;
+
+    std::vector<std::thread> threads;
+    for( unsigned int band = 1; band < numBands; ++band )
+    {
+        const unsigned int rowBegin = band * bandHeight;
+        const unsigned int rowEnd   = std::min( heightInBlocks, rowBegin + bandHeight );
+        if( rowBegin < rowEnd )
+            threads.emplace_back( encodeBlockRows, level, width, height, rowBegin, rowEnd, std::cref( info ), options.format, dest.data() );
+    }
+    encodeBlockRows( level, width, height, 0, std::min( heightInBlocks, bandHeight ), info, options.format, dest.data() );
+    for( std::thread& thread : threads )
+        thread.join();
+}
+
+void writeDDSHeader( std::ofstream& file, unsigned int width, unsigned int height, unsigned int numMipLevels, const BCEncoderOptions& options )
+{
+    const char* fourCC     = "DX10";
+    uint32_t    dxgiFormat = 0;
+    switch( options.format )
+    {
+        case BCFormat::BC1:
+            fourCC = "DXT1";
+            break;
+        case BCFormat::BC4:
+            fourCC = "ATI1";
+            break;
+        case BCFormat::BC5:
+            fourCC = "ATI2";
+            break;
+        case BCFormat::BC6H:
+            dxgiFormat = DXGI_FORMAT_BC6H_UF16;
+            break;
+        case BCFormat::BC7:
+            dxgiFormat = DXGI_FORMAT_BC7_UNORM;
+            break;
+    }
+
+    const unsigned int blockSize = getBCBlockSizeInBytes( options.format );
+
+    DDSFileHeader header{};
+    header.magicNumber = DDS_MAGIC_NUMBER;
+    header.sizeCheck   = 124;
+    header.flags       = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+    if( options.tiled )
+        header.flags |= MISC_TILED_PIXEL_LAYOUT;
+    header.height                = height;
+    header.width                 = width;
+    header.pitchOrLinearSize     = getSizeInBlocks( width, BC_BLOCK_WIDTH ) * getSizeInBlocks( height, BC_BLOCK_HEIGHT ) * blockSize;
+    header.mipMapCount           = numMipLevels;
+    header.pixelFormat.sizeCheck = 32;
+    header.pixelFormat.flags     = DDPF_FOURCC;
+    memcpy( header.pixelFormat.fourCCcode, fourCC, 4 );
+    header.caps1 = DDSCAPS_TEXTURE | ( numMipLevels > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0 );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( DDSFileHeader ) );
+
+    if( dxgiFormat != 0 )
+    {
+        DDSHeaderExtension extension{};
+        extension.dxgiFormat        = dxgiFormat;
+        extension.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+        extension.miscFlag          = options.tiled ? D3D11_RESOURCE_MISC_TILED : 0;
+        extension.arraySize         = 1;
+        file.write( reinterpret_cast<const char*>( &extension ), sizeof( DDSHeaderExtension ) );
+    }
+}
+
+// Write the tiles of an encoded mip level in the layout read by DDSImageReader: row-major tiles of
+// TILE_SIZE_IN_BYTES, with partial tiles padded with zeros.
+void writeTiles( std::ofstream& file, const std::vector<unsigned char>& blocks, unsigned int width, unsigned int height, unsigned int tileWidth, unsigned int tileHeight, unsigned int blockSize )
+{
+    const unsigned int widthInBlocks      = getSizeInBlocks( width, BC_BLOCK_WIDTH );
+    const unsigned int heightInBlocks     = getSizeInBlocks( height, BC_BLOCK_HEIGHT );
+    const unsigned int tileWidthInBlocks  = tileWidth / BC_BLOCK_WIDTH;
+    const unsigned int tileHeightInBlocks = tileHeight / BC_BLOCK_HEIGHT;
+
+    std::vector<char> tile( TILE_SIZE_IN_BYTES );
+    for( unsigned int tileY = 0; tileY * tileHeightInBlocks < heightInBlocks; ++tileY )
+    {
+        for( unsigned int tileX = 0; tileX * tileWidthInBlocks < widthInBlocks; ++tileX )
+        {
+            std::fill( tile.begin(), tile.end(), 0 );
+            const unsigned int rows = std::min( tileHeightInBlocks, heightInBlocks - tileY * tileHeightInBlocks );
+            const unsigned int cols = std::min( tileWidthInBlocks, widthInBlocks - tileX * tileWidthInBlocks );
+            for( unsigned int row = 0; row < rows; ++row )
+            {
+                const size_t sourceBlock = static_cast<size_t>( tileY * tileHeightInBlocks + row ) * widthInBlocks + tileX * tileWidthInBlocks;
+                memcpy( &tile[row * tileWidthInBlocks * blockSize], &blocks[sourceBlock * blockSize], cols * blockSize );
+            }
+            file.write( tile.data(), tile.size() );
+        }
+    }
+}
+
+}  // anonymous namespace
+
+unsigned int getBCBlockSizeInBytes( BCFormat format )
+{
+    return ( format == BCFormat::BC1 || format == BCFormat::BC4 ) ? 8u : 16u;
+}
+
+void encodeBCBlock( BCFormat format, const float4 texels[16], unsigned char* dest )
+{
+    Texels block;
+    for( unsigned int t = 0; t < NUM_TEXELS; ++t )
+    {
+        block[t][0] = texels[t].x;
+        block[t][1] = texels[t].y;
+        block[t][2] = texels[t].z;
+        block[t][3] = texels[t].w;
+    }
+
+    switch( format )
+    {
+        case BCFormat::BC1:
+            encodeBC1( block, dest );
+            break;
+        case BCFormat::BC4:
+            encodeBC4Channel( block, 0, dest );
+            break;
+        case BCFormat::BC5:
+            encodeBC4Channel( block, 0, dest );
+            encodeBC4Channel( block, 1, dest + 8 );
+            break;
+        case BCFormat::BC6H:
+            encodeBC6H( block, dest );
+            break;
+        case BCFormat::BC7:
+            encodeBC7( block, dest );
+            break;
+    }
+}
+
+bool writeBCFile( std::shared_ptr<ImageSource> image, const std::string& fileName, const BCEncoderOptions& options )
+{
+    TextureInfo info{};
+    image->open( &info );
+    if( !info.isValid || !isEncodableFormat( info ) )
+        return false;
+
+    // Generate mip levels for images that have only one.
+    if( info.numMipLevels == 1 && ( info.width > 1 || info.height > 1 ) )
+    {
+        MipFilterOptions filterOptions = getMipFilterOptions( info );
+        filterOptions.maxThreads       = options.maxThreads;
+        image                    = std::make_shared<MipMapImageSource>( image, filterOptions );
+        image->open( &info );
+    }
+
+    // All the mip levels from the first one are written, as in a standard DDS file: levels that are not
+    // a multiple of the block size end in partial blocks, and levels smaller than a block take one block.
+    const unsigned int firstLevel = std::min( options.firstMipLevel, info.numMipLevels - 1 );
+    const unsigned int width      = std::max( 1u, info.width >> firstLevel );
+    const unsigned int height     = std::max( 1u, info.height >> firstLevel );
+    const unsigned int numLevels  = info.numMipLevels - firstLevel;
+
+    std::ofstream file( fileName, std::ios::binary );
+    if( !file.is_open() )
+        return false;
+    writeDDSHeader( file, width, height, numLevels, options );
+
+    // Tiles are the same size as DDSImageReader::getTileWidth/getTileHeight.  Levels from the first
+    // one smaller than a tile are written flat, as a single padded mip tail.
+    const unsigned int blockSize  = getBCBlockSizeInBytes( options.format );
+    const unsigned int tileWidth  = ( blockSize == 8 ) ? 512u : 256u;
+    const unsigned int tileHeight = 256u;
+    unsigned int       tailLevel  = 0;
+    while( options.tiled && tailLevel < numLevels && ( width >> tailLevel ) >= tileWidth && ( height >> tailLevel ) >= tileHeight )
+        ++tailLevel;
+
+    std::vector<char>          pixels;
+    std::vector<unsigned char> blocks;
+    size_t                     tailSize = 0;
+    for( unsigned int level = 0; level < numLevels; ++level )
+    {
+        const unsigned int levelWidth  = std::max( 1u, width >> level );
+        const unsigned int levelHeight = std::max( 1u, height >> level );
+        pixels.resize( static_cast<size_t>( levelWidth ) * levelHeight * ( getBitsPerPixel( info ) / BITS_PER_BYTE ) );
+        if( !image->readMipLevel( pixels.data(), firstLevel + level, levelWidth, levelHeight, CUstream{0} ) )
+            return false;
+        encodeMipLevel( pixels.data(), levelWidth, levelHeight, info, options, blocks );
+
+        if( options.tiled && level < tailLevel )
+            writeTiles( file, blocks, levelWidth, levelHeight, tileWidth, tileHeight, blockSize );
+        else
+        {
+            file.write( reinterpret_cast<const char*>( blocks.data() ), blocks.size() );
+            tailSize += blocks.size();
+        }
+    }
+
+    // Pad the mip tail of a tiled file to the size DDSImageReader reads.  (It only reads the tail if the
+    // tail's first level is a multiple of the block size.)
+    if( options.tiled && tailLevel < numLevels )
+    {
+        const size_t tailWidthInBlocks  = ( width >> tailLevel ) / BC_BLOCK_WIDTH;
+        const size_t tailHeightInBlocks = ( height >> tailLevel ) / BC_BLOCK_HEIGHT;
+        size_t       paddedSize         = ( tailWidthInBlocks * tailHeightInBlocks * blockSize * 4 ) / 3;
+        paddedSize                      = ( paddedSize + TILE_SIZE_IN_BYTES - 1 ) / TILE_SIZE_IN_BYTES * TILE_SIZE_IN_BYTES;
+        const std::vector<char> padding( paddedSize - std::min( paddedSize, tailSize ) );
+        file.write( padding.data(), padding.size() );
+    }
+
+    file.close();
+    return !file.fail();
+}
+
+}  // namespace imageSource
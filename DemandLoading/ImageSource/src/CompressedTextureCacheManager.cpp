@@ -1,10 +1,12 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include <algorithm>
 #include <filesystem>
+#include <random>
 
+#include <OptiXToolkit/ImageSource/BCnEncoder.h>
 #include <OptiXToolkit/ImageSource/CompressedTextureCacheManager.h>
 
 #include <half.h>
@@ -92,19 +94,39 @@ bool CompressedTextureCacheManager::cacheTextureSetAsNtc( const std::vector<std:
     return true;
 }
 
+std::string CompressedTextureCacheManager::findCacheFileAsDDS( const std::string& inputFilePath ) const
+{
+    return m_manifest.findCacheFile( inputFilePath, getOptionsKey() );
+}
+
+std::string CompressedTextureCacheManager::getOptionsKey() const
+{
+    // Describe the options that affect the contents of DDS cache files.
+    std::string key = m_options.builtInEncoder ? "builtin" : "nvcompress " + m_options.flags;
+    for( int i = 0; i <= DDS_HDR_INDEX; ++i )
+        key += std::string( i == 0 ? " formats=" : "," ) + m_options.exrToDdsFormats[i];
+    key += " droppedMipLevels=" + std::to_string( m_options.droppedMipLevels );
+    key += " minImageSize=" + std::to_string( m_options.minImageSize );
+    key += " hdrCheckSize=" + std::to_string( m_options.hdrCheckSize );
+    key += m_options.saveTiled ? " tiled" : " untiled";
+
+    // The manifest separates fields with tabs and entries with newlines.
+    std::replace_if( key.begin(), key.end(), []( char c ) { return c == '\t' || c == '\n' || c == '\r'; }, ' ' );
+    return key;
+}
+
 bool CompressedTextureCacheManager::cacheFileAsDDS( const std::string& inputFilePath, int deviceId )
 {
     if( inputFilePath.length() == 0 )
         return false;
-    std::string suffix = inputFilePath.substr( inputFilePath.rfind('.') + 1 );
-    std::transform( suffix.begin(), suffix.end(), suffix.begin(), ::tolower );
-    std::string cacheFilePath = getCacheFilePath( inputFilePath, ".dds" );
+    const std::string optionsKey = getOptionsKey();
 
-    // Return if the cache file already exists, or the input file does not exist.
+    // Return if the manifest has an up-to-date cache file, or the input file does not exist.
     {
-        if( fs::exists( cacheFilePath ) )
+        const std::string cacheFilePath = m_manifest.findCacheFile( inputFilePath, optionsKey );
+        if( !cacheFilePath.empty() )
         {
-            printCommand( "\"" + cacheFilePath + "\" exists, not converting." );
+            printCommand( "\"" + cacheFilePath + "\" is up to date, not converting." );
             return true;
         }
         if( !fs::exists( inputFilePath ) )
@@ -114,19 +136,69 @@ bool CompressedTextureCacheManager::cacheFileAsDDS( const std::string& inputFile
         }
     }
 
+    // The cache file is named by the contents of the input file and the conversion options, so
+    // inputs with identical contents are converted only once.  The status of the input file is
+    // captured before hashing it, so that the entry is rejected if the file changes meanwhile.
+    unsigned long long inputSize;
+    long long          inputTime;
+    unsigned long long contentHash;
+    if( !CompressedTextureCacheManifest::getSourceStatus( inputFilePath, inputSize, inputTime )
+        || !CompressedTextureCacheManifest::hashFile( inputFilePath, contentHash ) )
+        return false;
+    const std::string cacheFileName = CompressedTextureCacheManifest::getCacheFileName( contentHash, optionsKey, ".dds" );
+    const std::string cacheFilePath = m_manifest.getCachePath( cacheFileName );
+    if( fs::exists( cacheFilePath ) )
+    {
+        printCommand( "\"" + cacheFilePath + "\" exists, not converting." );
+    }
+    else
+    {
+        // Convert to a temporary file that is renamed when complete, so that other builders and
+        // readers never see a partial cache file.
+        std::error_code ec{};
+        fs::create_directories( m_options.cacheFolder, ec );
+        std::random_device random;
+        const std::string tempFilePath = m_manifest.getCachePath( fs::path( cacheFileName ).stem().string() + "."
+                                                                  + std::to_string( random() ) + ".tmp.dds" );
+        if( !convertFileToDDS( inputFilePath, tempFilePath, deviceId ) )
+        {
+            deleteFile( tempFilePath );
+            return false;
+        }
+        fs::rename( tempFilePath, cacheFilePath, ec );
+        if( ec )
+        {
+            // Another builder may have renamed an identical file into place first.
+            deleteFile( tempFilePath );
+            if( !fs::exists( cacheFilePath ) )
+                return false;
+        }
+    }
+    return m_manifest.addEntry( inputFilePath, inputSize, inputTime, contentHash, optionsKey, cacheFileName );
+}
+
+bool CompressedTextureCacheManager::convertFileToDDS( const std::string& inputFilePath, const std::string& cacheFilePath, int deviceId )
+{
+    std::string suffix = inputFilePath.substr( inputFilePath.rfind('.') + 1 );
+    std::transform( suffix.begin(), suffix.end(), suffix.begin(), ::tolower );
+
     // If already a DDS image, copy or convert directly to tiled.
     if( suffix == "dds" )
     {
         if( !m_options.saveTiled )
         {
-            printCommand( "move " + inputFilePath + ' ' + cacheFilePath );
+            printCommand( "copy " + inputFilePath + ' ' + cacheFilePath );
             std::error_code ec{};
-            fs::rename( inputFilePath, cacheFilePath, ec );
+            fs::copy_file( inputFilePath, cacheFilePath, fs::copy_options::overwrite_existing, ec );
             return !ec;
         }
         return convertDDSToTiledDDS( inputFilePath, cacheFilePath );
     }
 
+    // Encode other images in process if the built-in encoder is enabled.
+    if( m_options.builtInEncoder )
+        return encodeFileAsDDS( inputFilePath, suffix, cacheFilePath );
+
     // If not EXR, convert directly to dds using the default format.
     if( suffix != "exr" )
     {
@@ -208,6 +280,77 @@ bool CompressedTextureCacheManager::cacheFileAsDDS( const std::string& inputFile
     }
 }
 
+static bool getBCFormat( const std::string& ddsFormat, BCFormat& format )
+{
+    const std::string names[] = {"bc1", "bc4", "bc5", "bc6", "bc7"};
+    const BCFormat formats[] = {BCFormat::BC1, BCFormat::BC4, BCFormat::BC5, BCFormat::BC6H, BCFormat::BC7};
+    for( int i = 0; i < 5; ++i )
+    {
+        if( ddsFormat == names[i] )
+        {
+            format = formats[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CompressedTextureCacheManager::encodeFileAsDDS( const std::string& inputFilePath, const std::string& suffix, const std::string& cacheFilePath )
+{
+    std::string command = "Encoding \"" + inputFilePath + "\" to DDS file \"" + cacheFilePath + "\"";
+    printCommand( command );
+
+    try
+    {
+        // Determine dds (bc) format to use, as for nvcompress.  EXR images are read directly,
+        // without intermediate HDR or TGA files.
+        std::shared_ptr<ImageSource> image;
+        TextureInfo texInfo{};
+        std::string ddsFormat = m_options.exrToDdsFormats[DDS_DEFAULT_INDEX];
+        if( suffix == "exr" )
+        {
+            std::shared_ptr<CoreEXRReader> exrReader = std::make_shared<CoreEXRReader>( inputFilePath, false );
+            exrReader->open( &texInfo );
+            if( !exrReader->isOpen() )
+                return false;
+            bool ishdr = isHighDynamicRange( *exrReader, texInfo );
+            ddsFormat = m_options.exrToDdsFormats[ishdr ? DDS_HDR_INDEX : texInfo.numChannels];
+            image = exrReader;
+        }
+        else
+        {
+            image = createImageSource( inputFilePath );
+            image->open( &texInfo );
+        }
+
+        BCEncoderOptions encoderOptions;
+        if( !getBCFormat( ddsFormat, encoderOptions.format ) )
+            return false;
+        encoderOptions.tiled = m_options.saveTiled;
+        encoderOptions.maxThreads = m_options.encoderThreads;
+
+        // Drop mip levels, keeping images at least minImageSize.  Images with a single mip level
+        // are mipmapped by the encoder, so levels can be dropped from them too.
+        unsigned int levelSize = std::max( texInfo.width, texInfo.height );
+        while( encoderOptions.firstMipLevel < m_options.droppedMipLevels && ( levelSize >> 1 ) >= m_options.minImageSize )
+        {
+            ++encoderOptions.firstMipLevel;
+            levelSize >>= 1;
+        }
+
+        if( writeBCFile( image, cacheFilePath, encoderOptions ) )
+            return true;
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "Error encoding " << inputFilePath << ": " << e.what() << std::endl;
+    }
+
+    // Don't leave a partial file in the cache.
+    deleteFile( cacheFilePath );
+    return false;
+}
+
 void CompressedTextureCacheManager::printCommand( const std::string& command )
 {
     if( m_verbose && command.length() < 100 )
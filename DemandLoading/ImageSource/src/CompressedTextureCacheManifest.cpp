@@ -0,0 +1,445 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/CompressedTextureCacheManifest.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace imageSource {
+
+namespace {
+
+const char* const MANIFEST_FILE_NAME = "manifest.txt";
+const char* const LOCK_FILE_NAME     = "manifest.lock";
+const char* const MANIFEST_HEADER    = "# OptiX Toolkit compressed texture cache manifest, version 1";
+
+// Mix 64-bit words into a hash, processing four independent lanes so the multiplies overlap.
+class ContentHasher
+{
+  public:
+    explicit ContentHasher( uint64_t seed )
+        : m_lanes{ seed, seed ^ 0x9E3779B97F4A7C15ULL, seed ^ 0xC2B2AE3D27D4EB4FULL, seed ^ 0x165667B19E3779F9ULL }
+    {
+    }
+
+    // Hash a block of bytes.  All blocks but the last must be a multiple of 32 bytes long.
+    void update( const char* data, size_t size )
+    {
+        size_t i = 0;
+        for( ; i + 32 <= size; i += 32 )
+        {
+            for( int lane = 0; lane < 4; ++lane )
+                m_lanes[lane] = round( m_lanes[lane], readWord( data + i + lane * 8 ) );
+        }
+        for( ; i + 8 <= size; i += 8 )
+            m_lanes[0] = round( m_lanes[0], readWord( data + i ) );
+        if( i < size )
+        {
+            uint64_t tail = 0;
+            memcpy( &tail, data + i, size - i );
+            m_lanes[1] = round( m_lanes[1], tail );
+        }
+        m_size += size;
+    }
+
+    uint64_t digest() const
+    {
+        uint64_t hash = m_size;
+        for( uint64_t lane : m_lanes )
+            hash = round( hash, lane );
+        return avalanche( hash );
+    }
+
+  private:
+    uint64_t m_lanes[4];
+    uint64_t m_size = 0;
+
+    static uint64_t readWord( const char* data )
+    {
+        uint64_t word;
+        memcpy( &word, data, sizeof( word ) );
+        return word;
+    }
+
+    static uint64_t round( uint64_t hash, uint64_t word )
+    {
+        hash += word * 0xC2B2AE3D27D4EB4FULL;
+        hash = ( hash << 31 ) | ( hash >> 33 );
+        return hash * 0x9E3779B97F4A7C15ULL;
+    }
+
+    static uint64_t avalanche( uint64_t hash )
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        return hash ^ ( hash >> 33 );
+    }
+};
+
+std::string toHex( unsigned long long value )
+{
+    char buff[17];
+    snprintf( buff, sizeof( buff ), "%016llx", value );
+    return buff;
+}
+
+std::string getEntryKey( const std::string& sourcePath, const std::string& optionsKey )
+{
+    return sourcePath + '\n' + optionsKey;
+}
+
+#ifdef _WIN32
+
+std::string getAbsolutePath( const std::string& path )
+{
+    char* absolutePath = _fullpath( nullptr, path.c_str(), 0 );
+    if( absolutePath == nullptr )
+        return path;
+    std::string result( absolutePath );
+    free( absolutePath );
+    return result;
+}
+
+bool getFileStatus( const std::string& path, unsigned long long& size, long long& time )
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if( !GetFileAttributesExA( path.c_str(), GetFileExInfoStandard, &data ) || ( data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) )
+        return false;
+    size = ( static_cast<unsigned long long>( data.nFileSizeHigh ) << 32 ) | data.nFileSizeLow;
+    time = static_cast<long long>( ( static_cast<unsigned long long>( data.ftLastWriteTime.dwHighDateTime ) << 32 )
+                                   | data.ftLastWriteTime.dwLowDateTime );
+    return true;
+}
+
+bool replaceFile( const std::string& from, const std::string& to )
+{
+    return MoveFileExA( from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) != 0;
+}
+
+// Holds an exclusive lock on a file, blocking until it is available.
+class FileLock
+{
+  public:
+    explicit FileLock( const std::string& path )
+    {
+        m_handle = CreateFileA( path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+        OVERLAPPED overlapped{};
+        m_locked = m_handle != INVALID_HANDLE_VALUE && LockFileEx( m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped );
+    }
+    ~FileLock()
+    {
+        if( m_locked )
+        {
+            OVERLAPPED overlapped{};
+            UnlockFileEx( m_handle, 0, 1, 0, &overlapped );
+        }
+        if( m_handle != INVALID_HANDLE_VALUE )
+            CloseHandle( m_handle );
+    }
+    bool isLocked() const { return m_locked; }
+
+  private:
+    HANDLE m_handle;
+    bool   m_locked;
+};
+
+#else
+
+std::string getAbsolutePath( const std::string& path )
+{
+    char absolutePath[PATH_MAX];
+    if( realpath( path.c_str(), absolutePath ) == nullptr )
+        return path;
+    return absolutePath;
+}
+
+bool getFileStatus( const std::string& path, unsigned long long& size, long long& time )
+{
+    struct stat status;
+    if( stat( path.c_str(), &status ) != 0 || !S_ISREG( status.st_mode ) )
+        return false;
+    size = static_cast<unsigned long long>( status.st_size );
+#ifdef __APPLE__
+    time = static_cast<long long>( status.st_mtimespec.tv_sec ) * 1000000000LL + status.st_mtimespec.tv_nsec;
+#else
+    time = static_cast<long long>( status.st_mtim.tv_sec ) * 1000000000LL + status.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
+bool replaceFile( const std::string& from, const std::string& to )
+{
+    return std::rename( from.c_str(), to.c_str() ) == 0;
+}
+
+// Holds an exclusive lock on a file, blocking until it is available.  flock locks belong to the
+// open file, so they also exclude other threads of this process that open the file.
+class FileLock
+{
+  public:
+    explicit FileLock( const std::string& path )
+    {
+        m_fd = ::open( path.c_str(), O_RDWR | O_CREAT, 0666 );
+        if( m_fd < 0 )
+            return;
+        int result;
+        do
+        {
+            result = flock( m_fd, LOCK_EX );
+        } while( result != 0 && errno == EINTR );
+        m_locked = result == 0;
+    }
+    ~FileLock()
+    {
+        if( m_locked )
+            flock( m_fd, LOCK_UN );
+        if( m_fd >= 0 )
+            ::close( m_fd );
+    }
+    bool isLocked() const { return m_locked; }
+
+  private:
+    int  m_fd     = -1;
+    bool m_locked = false;
+};
+
+#endif
+
+bool fileExists( const std::string& path )
+{
+    unsigned long long size;
+    long long          time;
+    return getFileStatus( path, size, time );
+}
+
+}  // anonymous namespace
+
+CompressedTextureCacheManifest::CompressedTextureCacheManifest( const std::string& cacheFolder )
+    : m_cacheFolder( cacheFolder )
+{
+    read();
+}
+
+void CompressedTextureCacheManifest::reload()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    read();
+}
+
+std::string CompressedTextureCacheManifest::findCacheFile( const std::string& sourcePath, const std::string& optionsKey ) const
+{
+    const std::string absolutePath = getAbsolutePath( sourcePath );
+    CacheManifestEntry entry;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        std::string key = getEntryKey( absolutePath, optionsKey );
+        if( optionsKey.empty() )
+        {
+            const auto latest = m_latestEntries.find( absolutePath );
+            if( latest == m_latestEntries.end() )
+                return std::string();
+            key = latest->second;
+        }
+        const auto it = m_entries.find( key );
+        if( it == m_entries.end() )
+            return std::string();
+        entry = it->second;
+    }
+
+    // The entry is stale if the source has changed, or the cache file has been removed.
+    unsigned long long size;
+    long long          time;
+    if( !getFileStatus( absolutePath, size, time ) || size != entry.sourceSize || time != entry.sourceTime )
+        return std::string();
+    const std::string cachePath = getCachePath( entry.cacheFile );
+    return fileExists( cachePath ) ? cachePath : std::string();
+}
+
+bool CompressedTextureCacheManifest::addEntry( const std::string& sourcePath,
+                                               unsigned long long sourceSize,
+                                               long long          sourceTime,
+                                               unsigned long long contentHash,
+                                               const std::string& optionsKey,
+                                               const std::string& cacheFile )
+{
+    // Reject the entry if the source changed while it was hashed or converted.
+    CacheManifestEntry entry{ getAbsolutePath( sourcePath ), 0, 0, contentHash, optionsKey, cacheFile };
+    if( !getFileStatus( entry.sourcePath, entry.sourceSize, entry.sourceTime ) || entry.sourceSize != sourceSize
+        || entry.sourceTime != sourceTime )
+        return false;
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    FileLock                     fileLock( getCachePath( LOCK_FILE_NAME ) );
+    if( !fileLock.isLocked() )
+        return false;
+
+    // Merge the entries written by other processes, then add the new one.
+    read();
+    const std::string key      = getEntryKey( entry.sourcePath, optionsKey );
+    const auto        previous = m_entries.find( key );
+    std::string       supersededFile;
+    if( previous != m_entries.end() && previous->second.cacheFile != cacheFile )
+        supersededFile = previous->second.cacheFile;
+    insert( entry );
+    if( !write() )
+        return false;
+
+    // Delete the cache file made from the previous contents of the source, unless another
+    // source shares it.
+    if( !supersededFile.empty() )
+    {
+        for( const auto& it : m_entries )
+        {
+            if( it.second.cacheFile == supersededFile )
+                return true;
+        }
+        std::remove( getCachePath( supersededFile ).c_str() );
+    }
+    return true;
+}
+
+size_t CompressedTextureCacheManifest::getNumEntries() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_entries.size();
+}
+
+std::string CompressedTextureCacheManifest::getCachePath( const std::string& cacheFile ) const
+{
+    if( m_cacheFolder.empty() )
+        return cacheFile;
+    const char last = m_cacheFolder.back();
+    return ( last == '/' || last == '\\' ) ? m_cacheFolder + cacheFile : m_cacheFolder + '/' + cacheFile;
+}
+
+std::string CompressedTextureCacheManifest::getCacheFileName( unsigned long long contentHash, const std::string& optionsKey, const std::string& extension )
+{
+    ContentHasher hasher( contentHash );
+    hasher.update( optionsKey.data(), optionsKey.size() );
+    return toHex( hasher.digest() ) + extension;
+}
+
+bool CompressedTextureCacheManifest::getSourceStatus( const std::string& path, unsigned long long& size, long long& time )
+{
+    return getFileStatus( path, size, time );
+}
+
+bool CompressedTextureCacheManifest::hashFile( const std::string& path, unsigned long long& hash )
+{
+    std::ifstream file( path, std::ios::binary );
+    if( !file )
+        return false;
+
+    const size_t      blockSize = 1 << 20;
+    std::vector<char> block( blockSize );
+    ContentHasher     hasher( 0 );
+    while( file )
+    {
+        file.read( block.data(), blockSize );
+        hasher.update( block.data(), static_cast<size_t>( file.gcount() ) );
+    }
+    if( file.bad() )
+        return false;
+    hash = hasher.digest();
+    return true;
+}
+
+// Each line of the manifest is an entry with the tab separated fields content hash, source size,
+// source time, options key, cache file, and source path.  Later entries for a source are more
+// recent.  Malformed lines are skipped.
+void CompressedTextureCacheManifest::read()
+{
+    m_entries.clear();
+    m_latestEntries.clear();
+
+    std::ifstream file( getCachePath( MANIFEST_FILE_NAME ) );
+    std::string   line;
+    while( std::getline( file, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream fields( line );
+        std::string        hash;
+        CacheManifestEntry entry;
+        if( !std::getline( fields, hash, '\t' ) || !( fields >> entry.sourceSize ) || fields.get() != '\t'
+            || !( fields >> entry.sourceTime ) || fields.get() != '\t' || !std::getline( fields, entry.optionsKey, '\t' )
+            || !std::getline( fields, entry.cacheFile, '\t' ) || !std::getline( fields, entry.sourcePath ) )
+            continue;
+        char* end         = nullptr;
+        entry.contentHash = std::strtoull( hash.c_str(), &end, 16 );
+        if( hash.empty() || *end != '\0' || entry.cacheFile.empty() || entry.sourcePath.empty() )
+            continue;
+        insert( entry );
+    }
+}
+
+bool CompressedTextureCacheManifest::write() const
+{
+    std::random_device random;
+    const std::string  manifestPath = getCachePath( MANIFEST_FILE_NAME );
+    const std::string  tempPath     = manifestPath + '.' + toHex( ( static_cast<unsigned long long>( random() ) << 32 ) | random() ) + ".tmp";
+    {
+        std::ofstream file( tempPath );
+        file << MANIFEST_HEADER << '\n';
+
+        // Write the most recent entry for each source last, so it is still the most recent when read.
+        for( int latest = 0; latest < 2; ++latest )
+        {
+            for( const auto& it : m_entries )
+            {
+                const CacheManifestEntry& entry    = it.second;
+                const auto                latestIt = m_latestEntries.find( entry.sourcePath );
+                if( ( latestIt != m_latestEntries.end() && latestIt->second == it.first ) != ( latest == 1 ) )
+                    continue;
+                file << toHex( entry.contentHash ) << '\t' << entry.sourceSize << '\t' << entry.sourceTime << '\t'
+                     << entry.optionsKey << '\t' << entry.cacheFile << '\t' << entry.sourcePath << '\n';
+            }
+        }
+        file.close();
+        if( !file )
+        {
+            std::remove( tempPath.c_str() );
+            return false;
+        }
+    }
+    if( !replaceFile( tempPath, manifestPath ) )
+    {
+        std::remove( tempPath.c_str() );
+        return false;
+    }
+    return true;
+}
+
+void CompressedTextureCacheManifest::insert( const CacheManifestEntry& entry )
+{
+    const std::string key = getEntryKey( entry.sourcePath, entry.optionsKey );
+    m_entries[key]                    = entry;
+    m_latestEntries[entry.sourcePath] = key;
+}
+
+}  // namespace imageSource
@@ -1,8 +1,10 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include <OptiXToolkit/ImageSource/DDSImageReader.h>
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
 
 #include <OptiXToolkit/Error/ErrorCheck.h>
 #include <OptiXToolkit/Error/cuErrorCheck.h>
@@ -10,6 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <fstream>
 
 #include <vector_functions.h> // from CUDA toolkit
 
@@ -17,17 +20,81 @@
 
 namespace imageSource {
 
-DDSImageReader::DDSImageReader( const std::string& fileName, bool readBaseColor )
+DDSImageReader::DDSImageReader( const std::string&               fileName,
+                                bool                             readBaseColor,
+                                DDSFileAccess                    fileAccess,
+                                std::shared_ptr<AsyncReadEngine> readEngine )
     : m_fileName( fileName )
+    , m_fileAccess( fileAccess )
+    , m_file( new PositionalFile )
+    , m_readEngine( std::move( readEngine ) )
     , m_readBaseColor( readBaseColor )
 {
 }
 
+DDSImageReader::~DDSImageReader()
+{
+    close();
+}
+
 void DDSImageReader::open( TextureInfo* info )
 {
     std::unique_lock<std::mutex> lock( m_mutex );
-    // Check the stream directly: isOpen() would re-lock the (non-recursive) m_mutex we hold.
-    if( m_file.is_open() )
+    openFile( info );
+}
+
+void DDSImageReader::close()
+{
+    // Reads run without m_mutex, so block new reads and wait for in-flight ones to finish
+    // before closing the file (and unmapping it) out from under them.
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_closing = true;
+    m_readsDoneCv.wait( lock, [this] { return m_activeReads == 0; } );
+    m_file->close();
+    {
+        std::unique_lock<std::mutex> lk( m_mipCacheMutex );
+        std::vector<std::vector<char>>().swap( m_mipCache );
+    }
+    m_closing = false;  // allow a subsequent open()
+}
+
+bool DDSImageReader::isOpen() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_file->isOpen();
+}
+
+size_t DDSImageReader::getHostMemoryUsage() const
+{
+    std::unique_lock<std::mutex> lk( m_mipCacheMutex );
+    size_t                       numBytes = 0;
+    for( const std::vector<char>& mipLevel : m_mipCache )
+        numBytes += mipLevel.capacity();
+    return numBytes;
+}
+
+bool DDSImageReader::beginRead()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( m_closing )
+        return false;
+    openFile( nullptr );
+    if( !m_file->isOpen() )
+        return false;
+    ++m_activeReads;
+    return true;
+}
+
+void DDSImageReader::endRead()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( --m_activeReads == 0 )
+        m_readsDoneCv.notify_all();
+}
+
+void DDSImageReader::openFile( TextureInfo* info )
+{
+    if( m_file->isOpen() )
     {
         if( info != nullptr )
             *info = m_info;
@@ -35,14 +102,12 @@ void DDSImageReader::open( TextureInfo* info )
     }
 
     m_info.isValid = false;
-    m_file.open( m_fileName, std::ios::binary );
-    if( !m_file.is_open() ) 
+    if( !m_file->open( m_fileName, m_fileAccess == DDSFileAccess::MEMORY_MAP ) )
         return;
-    m_file.unsetf( std::ios::skipws );
 
     // Read standard dds file header
     m_ddsFileHeader = DDSFileHeader{};
-    m_file.read( reinterpret_cast<char*>( &m_ddsFileHeader ), sizeof( DDSFileHeader ) );
+    m_file->read( reinterpret_cast<char*>( &m_ddsFileHeader ), sizeof( DDSFileHeader ), 0 );
     m_fileHeaderOffset = static_cast<int>( sizeof( DDSFileHeader ) );
     if( m_ddsFileHeader.magicNumber != DDS_MAGIC_NUMBER )
         return;
@@ -52,8 +117,8 @@ void DDSImageReader::open( TextureInfo* info )
     char* fourCC = m_ddsFileHeader.pixelFormat.fourCCcode;
     if( fourCC[0] == 'D' && fourCC[1] == 'X' && fourCC[2] == '1' && fourCC[3] == '0' )
     {
+        m_file->read( reinterpret_cast<char*>( &m_ddsHeaderExtension ), sizeof( DDSHeaderExtension ), m_fileHeaderOffset );
         m_fileHeaderOffset += static_cast<int>( sizeof( DDSHeaderExtension ) );
-        m_file.read( reinterpret_cast<char*>( &m_ddsHeaderExtension ), sizeof( DDSHeaderExtension ) );
     }
     int dxgiFormat = m_ddsHeaderExtension.dxgiFormat;
     m_fileIsTiled = ( m_ddsFileHeader.flags & MISC_TILED_PIXEL_LAYOUT ) != 0;
@@ -103,8 +168,8 @@ void DDSImageReader::open( TextureInfo* info )
         }
     }
 
-    // Resize mip level cache if not a tiled file
-    if( !m_fileIsTiled )
+    // Resize mip level cache if not a tiled file.  (Mapped files are read from the mapping.)
+    if( !m_fileIsTiled && m_file->data() == nullptr )
     {
         std::unique_lock<std::mutex> lk( m_mipCacheMutex );
         m_mipCache.resize( m_info.numMipLevels );
@@ -116,7 +181,9 @@ void DDSImageReader::open( TextureInfo* info )
 
 bool DDSImageReader::readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream /*stream*/  )
 {
-    open( nullptr );
+    ReadScope readScope( *this );
+    if( !readScope.engaged() )
+        return false;
     OTK_ASSERT_MSG( mipLevel < m_info.numMipLevels, "Attempt to read tile from non-existent mip-level." );
 
     if( m_fileIsTiled )
@@ -125,9 +192,57 @@ bool DDSImageReader::readTile( char* dest, unsigned int mipLevel, const Tile& ti
         return readTileFlat( dest, mipLevel, tile );
 }
 
+bool DDSImageReader::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    ReadScope readScope( *this );
+    if( !readScope.engaged() )
+        return false;
+    OTK_ASSERT_MSG( mipLevel < m_info.numMipLevels, "Attempt to read tile from non-existent mip-level." );
+
+    // Flat files are read a mip level at a time, so there is nothing to gain from batching.
+    if( !m_fileIsTiled || tileStride != TILE_SIZE_IN_BYTES )
+        return ImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+
+    // Find runs of tiles that are stored consecutively in the file, and read each run at once.
+    // With a read engine, the runs are submitted together and read concurrently.
+    std::unique_ptr<AsyncReadBatch> batch;
+    if( m_readEngine && m_file->data() == nullptr )
+        batch.reset( new AsyncReadBatch( *m_readEngine ) );
+    Stopwatch    stopwatch;
+    unsigned int begin = 0;
+    while( begin < numTiles )
+    {
+        unsigned int end = begin + 1;
+        while( end < numTiles
+               && getTileOffsetInBytesTiled( mipLevel, tiles[end] )
+                      == getTileOffsetInBytesTiled( mipLevel, tiles[end - 1] ) + static_cast<int>( TILE_SIZE_IN_BYTES ) )
+            ++end;
+        if( batch )
+            batch->read( *m_file, dest + begin * tileStride, static_cast<size_t>( end - begin ) * TILE_SIZE_IN_BYTES,
+                         getTileOffsetInBytesTiled( mipLevel, tiles[begin] ) );
+        else if( !readTileRunTiled( dest + begin * tileStride, mipLevel, tiles[begin], end - begin ) )
+            return false;
+        begin = end;
+    }
+    if( !batch )
+        return true;
+
+    if( !batch->wait() )
+        return false;  // truncated/failed read: don't report success or update stats
+    {
+        std::unique_lock<std::mutex> statsLock( m_statsMutex );
+        m_numTilesRead += numTiles;
+        m_numBytesRead += static_cast<unsigned long long>( numTiles ) * TILE_SIZE_IN_BYTES;
+        m_totalReadTime += stopwatch.elapsed();
+    }
+    return true;
+}
+
 bool DDSImageReader::readMipLevel( char* dest, unsigned int mipLevel, unsigned int /*width*/, unsigned int /*height*/, CUstream /*stream*/ )
 {
-    open( nullptr );
+    ReadScope readScope( *this );
+    if( !readScope.engaged() )
+        return false;
     OTK_ASSERT_MSG( mipLevel < m_info.numMipLevels, "Attempt to read non-existent mip-level." );
 
     if( m_fileIsTiled )
@@ -146,7 +261,9 @@ bool DDSImageReader::readBaseColor( float4& /*dest*/ )
 bool DDSImageReader::readMipTail( char* dest, unsigned int mipTailFirstLevel, unsigned int numMipLevels, 
                                   const uint2* mipLevelDims, CUstream stream )
 {
-    open( nullptr );
+    ReadScope readScope( *this );
+    if( !readScope.engaged() )
+        return false;
     if( m_fileIsTiled && mipTailFirstLevel == (unsigned int)getMipTailStartLevel() )
         return readMipTailTiled( dest, mipTailFirstLevel );
     else
@@ -269,21 +386,32 @@ int DDSImageReader::getMipTailSize()
 
 bool DDSImageReader::readTileFlat( char* dest, unsigned int mipLevel, const Tile& tile )
 {
-    // Read the mip level and extract the tile
+    // Extract the tile straight from the mapping if the file is memory mapped.
+    const char* mipSrc = nullptr;
+    if( m_file->data() != nullptr )
+    {
+        const uint64_t mipOffset = getMipLevelOffsetInBytesFlat( mipLevel );
+        if( mipOffset + getMipLevelSizeInBytesFlat( mipLevel ) > m_file->size() )
+            return false;
+        mipSrc = m_file->data() + mipOffset;
+    }
+
+    // Otherwise read the mip level and extract the tile
+    if( mipSrc == nullptr )
     {
         std::unique_lock<std::mutex> lock( m_mipCacheMutex );
         if( m_mipCache[mipLevel].size() == 0 )
         {
-            m_mipCache[mipLevel].resize( getMipLevelSizeInBytes( mipLevel ) );
+            m_mipCache[mipLevel].resize( getMipLevelSizeInBytesFlat( mipLevel ) );
             if( !readMipLevelFlat( m_mipCache[mipLevel].data(), mipLevel ) )
             {
                 m_mipCache[mipLevel].clear();  // don't cache a failed/partial read
                 return false;
             }
         }
+        mipSrc = m_mipCache[mipLevel].data();
     }
 
-    const char* mipSrc = m_mipCache[mipLevel].data();
     int mipWidthInBlocks = ( m_info.width / BC_BLOCK_WIDTH ) >> mipLevel; 
     int mipHeightInBlocks = ( m_info.height / BC_BLOCK_HEIGHT ) >> mipLevel;
     unsigned int tileWidthInBlocks = tile.width / BC_BLOCK_WIDTH;
@@ -310,6 +438,8 @@ bool DDSImageReader::readTileFlat( char* dest, unsigned int mipLevel, const Tile
     {
         std::unique_lock<std::mutex> statsLock( m_statsMutex );
         m_numTilesRead += 1;
+        if( m_file->data() != nullptr )
+            m_numBytesRead += static_cast<unsigned long long>( blockTile.width ) * blockTile.height * m_blockSizeInBytes;
     }
     
     return true;
@@ -318,12 +448,9 @@ bool DDSImageReader::readTileFlat( char* dest, unsigned int mipLevel, const Tile
 bool DDSImageReader::readMipLevelFlat( char* dest, unsigned int mipLevel )
 {
     OTK_ASSERT_MSG( mipLevel < m_info.numMipLevels, "Attempt to read from non-existent mip-level." );
-    std::unique_lock<std::mutex> lock( m_mutex );
     Stopwatch stopwatch;
 
-    m_file.seekg( getMipLevelOffsetInBytesFlat( mipLevel ) );
-    m_file.read( reinterpret_cast<char*>( dest ), getMipLevelSizeInBytesFlat( mipLevel ) );
-    if( !m_file )
+    if( !m_file->read( dest, getMipLevelSizeInBytesFlat( mipLevel ), getMipLevelOffsetInBytesFlat( mipLevel ) ) )
         return false;  // truncated/failed read: don't report success or update stats
 
     // Stats tracking
@@ -355,18 +482,21 @@ int DDSImageReader::getMipLevelSizeInBytesFlat( int mipLevel )
 
 bool DDSImageReader::readTileTiled( char* dest, unsigned int mipLevel, const Tile& tile )
 {
-    std::unique_lock<std::mutex> lock( m_mutex );
+    return readTileRunTiled( dest, mipLevel, tile, 1 );
+}
+
+bool DDSImageReader::readTileRunTiled( char* dest, unsigned int mipLevel, const Tile& firstTile, unsigned int numTiles )
+{
     Stopwatch stopwatch;
-    m_file.seekg( getTileOffsetInBytesTiled( mipLevel, tile ) );
-    m_file.read( dest, TILE_SIZE_IN_BYTES );
-    if( !m_file )
+    const size_t numBytes = static_cast<size_t>( numTiles ) * TILE_SIZE_IN_BYTES;
+    if( !m_file->read( dest, numBytes, getTileOffsetInBytesTiled( mipLevel, firstTile ) ) )
         return false;  // truncated/failed read: don't report success or update stats
 
     // Stats tracking
     {
         std::unique_lock<std::mutex> statsLock( m_statsMutex );
-        m_numTilesRead++;
-        m_numBytesRead += TILE_SIZE_IN_BYTES;
+        m_numTilesRead += numTiles;
+        m_numBytesRead += numBytes;
         m_totalReadTime += stopwatch.elapsed();
     }
 
@@ -442,12 +572,9 @@ bool DDSImageReader::readMipLevelTiled( char* dest, unsigned int mipLevel )
 
 bool DDSImageReader::readMipTailTiled( char* dest, unsigned int mipTailFirstLevel )
 {
-    std::unique_lock<std::mutex> lock( m_mutex );
     Stopwatch stopwatch;
     OTK_ASSERT_MSG( mipTailFirstLevel == static_cast<unsigned int>(getMipTailStartLevel()), "Improper mip tail first level for tiled file." );
-    m_file.seekg( getMipLevelOffsetInBytesTiled( mipTailFirstLevel ) );
-    m_file.read( dest, getMipTailSize() );
-    if( !m_file )
+    if( !m_file->read( dest, getMipTailSize(), getMipLevelOffsetInBytesTiled( mipTailFirstLevel ) ) )
         return false;  // truncated/failed read: don't report success or update stats
 
     // Stats tracking
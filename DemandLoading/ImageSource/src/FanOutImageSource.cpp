@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
+
+#include <OptiXToolkit/ImageSource/LruCache.h>
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace imageSource {
+
+namespace {
+
+enum ReadKind
+{
+    READ_TILE,
+    READ_MIP_LEVEL,
+    READ_MIP_TAIL
+};
+
+// A read is identified by its image, kind, mip level, and tile coordinates (zero for mip levels
+// and mip tails).
+using ReadKey    = std::tuple<const FanOutImageSource*, int, unsigned int, unsigned int, unsigned int>;
+using ReadBuffer = std::shared_ptr<const std::vector<char>>;
+
+// A consumer is identified by the stream it reads with.  The null stream is distinct for each
+// context, so reads on the null stream are also identified by the current context.
+using Consumer = std::pair<CUstream, CUcontext>;
+
+Consumer getConsumer( CUstream stream )
+{
+    CUcontext context{};
+    if( stream == CUstream{} && cuCtxGetCurrent( &context ) != CUDA_SUCCESS )
+        context = CUcontext{};
+    return Consumer( stream, context );
+}
+
+// SharedReadCache holds the data of completed reads for all FanOutImageSources until every
+// consumer has copied it, evicting the least recently used reads when the memory budget is
+// exceeded.  It also tracks the reads in flight, so that concurrent requests for the same data
+// wait for one read rather than repeating it.
+class SharedReadCache
+{
+  public:
+    // Copy a read for the given consumer.  If the read is in flight, wait for it to complete, or
+    // if inFlight is given, set it and return null.  Otherwise returns null if the read is not
+    // resident, in which case the caller must perform it and then call complete().  A consumer
+    // that copies a read again (e.g. to refill an evicted tile) does not take another's share.
+    ReadBuffer acquire( const ReadKey& key, const Consumer& consumer, bool* inFlight = nullptr )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while( true )
+        {
+            if( SharedRead* read = m_reads.find( key ) )
+            {
+                ++m_numSharedReads;
+                ReadBuffer buffer = read->buffer;
+                if( std::find( read->consumers.begin(), read->consumers.end(), consumer ) == read->consumers.end() )
+                    read->consumers.push_back( consumer );
+                if( read->consumers.size() >= read->numConsumers )
+                    m_reads.erase( key );
+                return buffer;
+            }
+            if( m_inFlight.insert( key ).second )
+                return ReadBuffer();
+            if( inFlight )
+            {
+                *inFlight = true;
+                return ReadBuffer();
+            }
+
+            // Another consumer is performing the read.  If it fails or is evicted before we wake,
+            // the loop makes this consumer perform the read itself.
+            m_readCompleted.wait( lock );
+        }
+    }
+
+    // Finish a read started by acquire(), sharing it with the other numConsumers - 1 consumers.
+    // A null buffer means the read failed and is not shared.  Reads larger than the memory budget
+    // are not retained.
+    void complete( const ReadKey& key, const Consumer& consumer, ReadBuffer buffer, unsigned int numConsumers )
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_inFlight.erase( key );
+            ++m_numReads;
+            if( buffer && numConsumers > 1 && buffer->size() <= m_reads.getMemoryBudget() )
+            {
+                const size_t size = buffer->size();
+                m_reads.insert( key, SharedRead{ std::move( buffer ), { consumer }, numConsumers }, size );
+            }
+        }
+        m_readCompleted.notify_all();
+    }
+
+    // Release the reads of the given image.
+    void release( const FanOutImageSource* owner )
+    {
+        const unsigned int           maxValue = std::numeric_limits<unsigned int>::max();
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_reads.eraseRange( ReadKey( owner, 0, 0, 0, 0 ), ReadKey( owner, std::numeric_limits<int>::max(), maxValue, maxValue, maxValue ) );
+    }
+
+    void setMemoryBudget( size_t numBytes )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_reads.setMemoryBudget( numBytes );
+    }
+
+    FanOutImageCacheStatistics getStatistics()
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        return FanOutImageCacheStatistics{ m_numReads, m_numSharedReads, m_reads.getNumEvictions(),
+                                           m_reads.getNumResidentBytes(), m_reads.getMemoryBudget() };
+    }
+
+  private:
+    struct SharedRead
+    {
+        ReadBuffer            buffer;
+        std::vector<Consumer> consumers;     // consumers that have copied the read
+        unsigned int          numConsumers;  // consumers that share the read
+    };
+
+    std::mutex                    m_mutex;
+    std::condition_variable       m_readCompleted;
+    LruCache<ReadKey, SharedRead> m_reads{ FanOutImageSource::DEFAULT_MEMORY_BUDGET };
+    std::set<ReadKey>             m_inFlight;
+    unsigned long long            m_numReads       = 0;
+    unsigned long long            m_numSharedReads = 0;
+};
+
+SharedReadCache& getSharedReadCache()
+{
+    static SharedReadCache cache;
+    return cache;
+}
+
+// Copy a shared read into dest, or perform the read into dest and share a copy of it with the
+// other consumers.
+bool readShared( const ReadKey& key, unsigned int numConsumers, CUstream stream, char* dest, size_t size, const std::function<bool( char* )>& read )
+{
+    SharedReadCache& cache    = getSharedReadCache();
+    const Consumer   consumer = getConsumer( stream );
+    if( ReadBuffer buffer = cache.acquire( key, consumer ) )
+    {
+        std::memcpy( dest, buffer->data(), std::min( size, buffer->size() ) );
+        return true;
+    }
+
+    bool satisfied = false;
+    try
+    {
+        satisfied = read( dest );
+    }
+    catch( ... )
+    {
+        cache.complete( key, consumer, ReadBuffer(), 0 );
+        throw;
+    }
+    ReadBuffer buffer;
+    if( satisfied )
+        buffer = std::make_shared<const std::vector<char>>( dest, dest + size );
+    cache.complete( key, consumer, std::move( buffer ), numConsumers );
+    return satisfied;
+}
+
+}  // namespace
+
+const size_t FanOutImageSource::DEFAULT_MEMORY_BUDGET;
+
+FanOutImageSource::FanOutImageSource( std::shared_ptr<ImageSource> imageSource, unsigned int numConsumers )
+    : WrappedImageSource( std::move( imageSource ) )
+    , m_numConsumers( numConsumers )
+{
+}
+
+FanOutImageSource::~FanOutImageSource()
+{
+    getSharedReadCache().release( this );
+}
+
+void FanOutImageSource::setMemoryBudget( size_t numBytes )
+{
+    getSharedReadCache().setMemoryBudget( numBytes );
+}
+
+size_t FanOutImageSource::getMemoryBudget()
+{
+    return getSharedReadCache().getStatistics().memoryBudget;
+}
+
+FanOutImageCacheStatistics FanOutImageSource::getCacheStatistics()
+{
+    return getSharedReadCache().getStatistics();
+}
+
+void FanOutImageSource::close()
+{
+    WrappedImageSource::close();
+    getSharedReadCache().release( this );
+}
+
+bool FanOutImageSource::isShared() const
+{
+    return m_numConsumers > 1 && getFillType() == CU_MEMORYTYPE_HOST;
+}
+
+bool FanOutImageSource::readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream )
+{
+    if( !isShared() )
+        return WrappedImageSource::readTile( dest, mipLevel, tile, stream );
+
+    const size_t size = getImageSizeInBytes( getInfo(), tile.width, tile.height );
+    return readShared( ReadKey( this, READ_TILE, mipLevel, tile.x, tile.y ), m_numConsumers, stream, dest, size,
+                       [&]( char* buffer ) { return WrappedImageSource::readTile( buffer, mipLevel, tile, stream ); } );
+}
+
+bool FanOutImageSource::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    if( !isShared() )
+        return WrappedImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+
+    // Copy the shared tiles, and collect the tiles to read.  Tiles that another consumer is reading
+    // are deferred rather than waited for, since that consumer might be waiting for our reads.
+    SharedReadCache&          cache    = getSharedReadCache();
+    const Consumer            consumer = getConsumer( stream );
+    std::vector<unsigned int> misses;
+    std::vector<unsigned int> deferred;
+    for( unsigned int i = 0; i < numTiles; ++i )
+    {
+        bool inFlight = false;
+        if( ReadBuffer buffer = cache.acquire( ReadKey( this, READ_TILE, mipLevel, tiles[i].x, tiles[i].y ), consumer, &inFlight ) )
+            std::memcpy( dest + i * tileStride, buffer->data(), std::min( tileStride, buffer->size() ) );
+        else if( inFlight )
+            deferred.push_back( i );
+        else
+            misses.push_back( i );
+    }
+
+    // Read the missing tiles with a single call, so that the wrapped image can batch them.
+    if( !misses.empty() )
+    {
+        std::vector<Tile> missingTiles;
+        for( unsigned int i : misses )
+            missingTiles.push_back( tiles[i] );
+        const bool        inPlace = misses.size() == numTiles;
+        std::vector<char> readBuffer( inPlace ? 0 : misses.size() * tileStride );
+        char*             readDest  = inPlace ? dest : readBuffer.data();
+        bool              satisfied = false;
+        try
+        {
+            satisfied = WrappedImageSource::readTiles( readDest, tileStride, mipLevel, missingTiles.data(),
+                                                       static_cast<unsigned int>( misses.size() ), stream );
+        }
+        catch( ... )
+        {
+            for( unsigned int i : misses )
+                cache.complete( ReadKey( this, READ_TILE, mipLevel, tiles[i].x, tiles[i].y ), consumer, ReadBuffer(), 0 );
+            throw;
+        }
+        for( size_t j = 0; j < misses.size(); ++j )
+        {
+            const Tile&  tile   = tiles[misses[j]];
+            const size_t size   = getImageSizeInBytes( getInfo(), tile.width, tile.height );
+            const char*  source = readDest + j * tileStride;
+            ReadBuffer   buffer;
+            if( satisfied )
+            {
+                buffer = std::make_shared<const std::vector<char>>( source, source + size );
+                if( !inPlace )
+                    std::memcpy( dest + misses[j] * tileStride, source, size );
+            }
+            cache.complete( ReadKey( this, READ_TILE, mipLevel, tile.x, tile.y ), consumer, std::move( buffer ), m_numConsumers );
+        }
+        if( !satisfied )
+            return false;
+    }
+
+    for( unsigned int i : deferred )
+    {
+        if( !readTile( dest + i * tileStride, mipLevel, tiles[i], stream ) )
+            return false;
+    }
+    return true;
+}
+
+bool FanOutImageSource::readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream )
+{
+    if( !isShared() )
+        return WrappedImageSource::readMipLevel( dest, mipLevel, expectedWidth, expectedHeight, stream );
+
+    const size_t size = getImageSizeInBytes( getInfo(), expectedWidth, expectedHeight );
+    return readShared( ReadKey( this, READ_MIP_LEVEL, mipLevel, 0, 0 ), m_numConsumers, stream, dest, size, [&]( char* buffer ) {
+        return WrappedImageSource::readMipLevel( buffer, mipLevel, expectedWidth, expectedHeight, stream );
+    } );
+}
+
+bool FanOutImageSource::readMipTail( char*        dest,
+                                     unsigned int mipTailFirstLevel,
+                                     unsigned int numMipLevels,
+                                     const uint2* mipLevelDims,
+                                     CUstream     stream )
+{
+    if( !isShared() )
+        return WrappedImageSource::readMipTail( dest, mipTailFirstLevel, numMipLevels, mipLevelDims, stream );
+
+    // The mip tail levels are packed consecutively, as in ImageSourceBase::readMipTail.
+    size_t size = 0;
+    for( unsigned int mipLevel = mipTailFirstLevel; mipLevel < numMipLevels; ++mipLevel )
+        size += getImageSizeInBytes( getInfo(), mipLevelDims[mipLevel].x, mipLevelDims[mipLevel].y );
+    return readShared( ReadKey( this, READ_MIP_TAIL, mipTailFirstLevel, 0, 0 ), m_numConsumers, stream, dest, size, [&]( char* buffer ) {
+        return WrappedImageSource::readMipTail( buffer, mipTailFirstLevel, numMipLevels, mipLevelDims, stream );
+    } );
+}
+
+}  // namespace imageSource
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -38,6 +38,16 @@ bool fileExists( const std::string& path )
 
 namespace imageSource {
 
+bool ImageSource::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    for( unsigned int i = 0; i < numTiles; ++i )
+    {
+        if( !readTile( dest + i * tileStride, mipLevel, tiles[i], stream ) )
+            return false;
+    }
+    return true;
+}
+
 unsigned long long ImageSource::getHash( CUstream stream )
 {
     TextureInfo info;
@@ -78,7 +88,6 @@ bool ImageSourceBase::readMipTail( char*        dest,
                                    const uint2* mipLevelDims,
                                    CUstream     stream )
 {
-    int bitsPerPixel = getBitsPerPixel( getInfo() );
     size_t offset = 0;
     for( unsigned int mipLevel = mipTailFirstLevel; mipLevel < numMipLevels; ++mipLevel )
     {
@@ -86,13 +95,13 @@ bool ImageSourceBase::readMipTail( char*        dest,
         readMipLevel( dest + offset, mipLevel, levelDims.x, levelDims.y, stream );
 
         // Increment offset.
-        offset += ( levelDims.x * levelDims.y * bitsPerPixel ) / BITS_PER_BYTE;
+        offset += getImageSizeInBytes( getInfo(), levelDims.x, levelDims.y );
     }
 
     return true;
 }
 
-std::shared_ptr<ImageSource> createImageSource( const std::string& filename, const std::string& directory )
+std::shared_ptr<ImageSource> createImageSource( const std::string& filename, const std::string& directory, const ImageSourceOptions& options )
 {
     // Special cases
     if( filename == "mandelbrot" )
@@ -122,7 +131,7 @@ std::shared_ptr<ImageSource> createImageSource( const std::string& filename, con
 
     if( extension == ".dds" )
     {
-        return std::make_shared<DDSImageReader>( path, false );
+        return std::make_shared<DDSImageReader>( path, false, options.ddsFileAccess, options.readEngine );
     }
 
 #if OTK_USE_OPENEXR    
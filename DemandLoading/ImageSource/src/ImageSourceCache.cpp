@@ -1,34 +1,449 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include <OptiXToolkit/ImageSource/ImageSourceCache.h>
 
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
+#include <OptiXToolkit/ImageSource/WrappedImageSource.h>
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
 namespace imageSource {
 
+namespace {
+
+class CachedImageSource;
+
+}  // namespace
+
+// OpenImageSourceList tracks the open ImageSources created by an ImageSourceCache, most recently
+// used first.  When there are too many, the least recently used ImageSources that are not being
+// read are removed from the list and closed.
+class OpenImageSourceList
+{
+  public:
+    explicit OpenImageSourceList( unsigned int maxOpen )
+        : m_maxOpen( maxOpen )
+    {
+    }
+
+    // Register a read of the given image, marking it as most recently used.  Returns false if the
+    // image is not in the list, in which case the caller must open it and call insert().
+    bool beginRead( CachedImageSource* image );
+
+    // Unregister a read of the given image.
+    void endRead( CachedImageSource* image );
+
+    // Insert an image that has been opened, closing others if there are too many.
+    void insert( const std::shared_ptr<CachedImageSource>& image );
+
+    // Remove the given image, which is being closed or destroyed.
+    void remove( CachedImageSource* image );
+
+    // Returns true if the image has not been reinserted or read since it was chosen to be closed.
+    bool isUnused( CachedImageSource* image );
+
+    void setMaxOpen( unsigned int maxOpen );
+
+    unsigned int getMaxOpen() const
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        return m_maxOpen;
+    }
+
+    void countReopen() { ++m_numReopened; }
+
+    // Fill in the open image counts of the given statistics.
+    void getStatistics( CacheStatistics& stats ) const
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        stats.numOpenImageSources = static_cast<unsigned int>( m_lru.size() );
+        stats.numClosed           = m_numClosed;
+        stats.numReopened         = m_numReopened;
+    }
+
+    // An entry is expired while its image is being destroyed.
+    using Iterator = std::list<std::weak_ptr<CachedImageSource>>::iterator;
+
+  private:
+    mutable std::mutex                          m_mutex;
+    std::list<std::weak_ptr<CachedImageSource>> m_lru;  // most recently used first
+    unsigned int                                m_maxOpen;
+    unsigned long long                          m_numClosed = 0;
+    std::atomic<unsigned long long>             m_numReopened{};
+
+    // Remove least recently used images that are not being read until the list is within the limit.
+    std::vector<std::shared_ptr<CachedImageSource>> takeExcess();
+
+    // Close the given images unless they were read again after being removed from the list.
+    void close( std::vector<std::shared_ptr<CachedImageSource>>& images );
+};
+
+namespace {
+
+// CachedImageSource wraps an ImageSource created by ImageSourceCache::get().  The wrapped image is
+// opened before each read and is listed in the OpenImageSourceList, which may close it when it is
+// not being read.  The image therefore remains logically open until close() is called.
+class CachedImageSource : public WrappedImageSource, public std::enable_shared_from_this<CachedImageSource>
+{
+  public:
+    CachedImageSource( std::shared_ptr<ImageSource> imageSource, std::shared_ptr<OpenImageSourceList> openImageSources )
+        : WrappedImageSource( imageSource )
+        , m_imageSource( std::move( imageSource ) )
+        , m_openImageSources( std::move( openImageSources ) )
+    {
+    }
+
+    ~CachedImageSource() override { m_openImageSources->remove( this ); }
+
+    void open( TextureInfo* info ) override
+    {
+        ReadScope readScope( *this );
+        m_isOpen = true;
+        if( info != nullptr )
+            *info = getInfo();
+    }
+
+    void close() override
+    {
+        std::unique_lock<std::mutex> lock( m_openMutex );
+        m_openImageSources->remove( this );
+        WrappedImageSource::close();
+        m_isWrappedOpen = false;
+        m_isOpen        = false;
+        m_hasInfo       = false;
+    }
+
+    bool isOpen() const override { return m_isOpen; }
+
+    // The info is copied when the image is first opened, since the wrapped image might be closed
+    // (and its info invalidated) while the caller holds a reference.
+    const TextureInfo& getInfo() const override { return m_hasInfo ? m_info : WrappedImageSource::getInfo(); }
+
+    bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream stream ) override
+    {
+        ReadScope readScope( *this );
+        return WrappedImageSource::readTile( dest, mipLevel, tile, stream );
+    }
+
+    bool readTiles( char*        dest,
+                    size_t       tileStride,
+                    unsigned int mipLevel,
+                    const Tile*  tiles,
+                    unsigned int numTiles,
+                    CUstream     stream ) override
+    {
+        ReadScope readScope( *this );
+        return m_imageSource->readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+    }
+
+    bool readMipLevel( char*        dest,
+                       unsigned int mipLevel,
+                       unsigned int expectedWidth,
+                       unsigned int expectedHeight,
+                       CUstream     stream ) override
+    {
+        ReadScope readScope( *this );
+        return WrappedImageSource::readMipLevel( dest, mipLevel, expectedWidth, expectedHeight, stream );
+    }
+
+    bool readMipTail( char*        dest,
+                      unsigned int mipTailFirstLevel,
+                      unsigned int numMipLevels,
+                      const uint2* mipLevelDims,
+                      CUstream     stream ) override
+    {
+        ReadScope readScope( *this );
+        return WrappedImageSource::readMipTail( dest, mipTailFirstLevel, numMipLevels, mipLevelDims, stream );
+    }
+
+    bool readBaseColor( float4& dest ) override
+    {
+        ReadScope readScope( *this );
+        return WrappedImageSource::readBaseColor( dest );
+    }
+
+    CUdeviceptr getSamplerExtraData( OptixDeviceContext optixContext ) override
+    {
+        ReadScope readScope( *this );
+        return m_imageSource->getSamplerExtraData( optixContext );
+    }
+
+    // Close the wrapped image if it has not been read since it was removed from the open list.
+    // Returns true if the image was closed.
+    bool closeIfUnused()
+    {
+        std::unique_lock<std::mutex> lock( m_openMutex );
+        if( !m_isWrappedOpen || !m_openImageSources->isUnused( this ) )
+            return false;
+        WrappedImageSource::close();
+        m_isWrappedOpen = false;
+        return true;
+    }
+
+  private:
+    friend class imageSource::OpenImageSourceList;
+
+    std::shared_ptr<ImageSource>         m_imageSource;
+    std::shared_ptr<OpenImageSourceList> m_openImageSources;
+
+    // m_openMutex guards opening and closing the wrapped image.  Some images report that they are
+    // always open, so the wrapped image's state is tracked here.
+    std::mutex        m_openMutex;
+    bool              m_isWrappedOpen = false;
+    bool              m_wasOpened     = false;
+    std::atomic<bool> m_isOpen{};
+    std::atomic<bool> m_hasInfo{};
+    TextureInfo       m_info{};
+
+    // Guarded by the OpenImageSourceList mutex.
+    OpenImageSourceList::Iterator m_listPos;
+    bool                          m_isListed       = false;
+    unsigned int                  m_numActiveReads = 0;
+
+    // Open the wrapped image if necessary, and keep it open until endRead().
+    void beginRead()
+    {
+        if( m_openImageSources->beginRead( this ) )
+            return;
+
+        try
+        {
+            std::unique_lock<std::mutex> lock( m_openMutex );
+            if( !m_isWrappedOpen )
+            {
+                WrappedImageSource::open( nullptr );
+                if( m_wasOpened )
+                    m_openImageSources->countReopen();
+                m_wasOpened     = true;
+                m_isWrappedOpen = true;
+            }
+            if( !m_hasInfo )
+            {
+                m_info    = WrappedImageSource::getInfo();
+                m_hasInfo = true;
+            }
+        }
+        catch( ... )
+        {
+            m_openImageSources->endRead( this );
+            throw;
+        }
+        m_openImageSources->insert( shared_from_this() );
+    }
+
+    void endRead() { m_openImageSources->endRead( this ); }
+
+    class ReadScope
+    {
+      public:
+        explicit ReadScope( CachedImageSource& image )
+            : m_image( image )
+        {
+            m_image.beginRead();
+        }
+        ~ReadScope() { m_image.endRead(); }
+        ReadScope( const ReadScope& )            = delete;
+        ReadScope& operator=( const ReadScope& ) = delete;
+
+      private:
+        CachedImageSource& m_image;
+    };
+};
+
+}  // namespace
+
+bool OpenImageSourceList::beginRead( CachedImageSource* image )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    ++image->m_numActiveReads;
+    if( !image->m_isListed )
+        return false;
+    m_lru.splice( m_lru.begin(), m_lru, image->m_listPos );
+    return true;
+}
+
+void OpenImageSourceList::endRead( CachedImageSource* image )
+{
+    // Close images that were skipped while they were being read.
+    std::vector<std::shared_ptr<CachedImageSource>> excess;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        --image->m_numActiveReads;
+        excess = takeExcess();
+    }
+    close( excess );
+}
+
+void OpenImageSourceList::insert( const std::shared_ptr<CachedImageSource>& image )
+{
+    std::vector<std::shared_ptr<CachedImageSource>> excess;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        if( !image->m_isListed )
+        {
+            m_lru.push_front( image );
+            image->m_listPos  = m_lru.begin();
+            image->m_isListed = true;
+        }
+        excess = takeExcess();
+    }
+    close( excess );
+}
+
+void OpenImageSourceList::remove( CachedImageSource* image )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if( image->m_isListed )
+    {
+        m_lru.erase( image->m_listPos );
+        image->m_isListed = false;
+    }
+}
+
+bool OpenImageSourceList::isUnused( CachedImageSource* image )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return !image->m_isListed && image->m_numActiveReads == 0;
+}
+
+void OpenImageSourceList::setMaxOpen( unsigned int maxOpen )
+{
+    std::vector<std::shared_ptr<CachedImageSource>> excess;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_maxOpen = maxOpen;
+        excess    = takeExcess();
+    }
+    close( excess );
+}
+
+std::vector<std::shared_ptr<CachedImageSource>> OpenImageSourceList::takeExcess()
+{
+    std::vector<std::shared_ptr<CachedImageSource>> excess;
+    if( m_maxOpen == 0 || m_lru.size() <= m_maxOpen )
+        return excess;
+
+    // Images that are being read (or destroyed) are skipped.
+    auto it = m_lru.end();
+    while( m_lru.size() > m_maxOpen && it != m_lru.begin() )
+    {
+        --it;
+        std::shared_ptr<CachedImageSource> image = it->lock();
+        if( !image || image->m_numActiveReads > 0 )
+            continue;
+        image->m_isListed = false;
+        it                = m_lru.erase( it );
+        excess.push_back( std::move( image ) );
+    }
+    return excess;
+}
+
+void OpenImageSourceList::close( std::vector<std::shared_ptr<CachedImageSource>>& images )
+{
+    for( const std::shared_ptr<CachedImageSource>& image : images )
+    {
+        if( image->closeIfUnused() )
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            ++m_numClosed;
+        }
+    }
+    // The images are released without holding the mutex, since the last reference might destroy one.
+    images.clear();
+}
+
+ImageSourceCache::ImageSourceCache( unsigned int maxOpenImageSources )
+    : m_openImageSources( std::make_shared<OpenImageSourceList>( maxOpenImageSources ) )
+{
+}
+
+ImageSourceCache::Shard& ImageSourceCache::getShard( const std::string& path )
+{
+    return m_shards[std::hash<std::string>()( path ) % NUM_SHARDS];
+}
+
+const ImageSourceCache::Shard& ImageSourceCache::getShard( const std::string& path ) const
+{
+    return m_shards[std::hash<std::string>()( path ) % NUM_SHARDS];
+}
+
+std::shared_ptr<ImageSource> ImageSourceCache::find( const std::string& path ) const
+{
+    const Shard&                 shard = getShard( path );
+    std::unique_lock<std::mutex> lock( shard.mutex );
+    auto                         it = shard.cache.find( path );
+    return it == shard.cache.end() ? std::shared_ptr<ImageSource>() : it->second;
+}
+
 std::shared_ptr<ImageSource> ImageSourceCache::get( const std::string& path )
 {
-    // Use a cached ImageSource if possible.
-    std::shared_ptr<ImageSource> imageSource{ find( path ) };
-    if( imageSource )
-        return imageSource;
+    // Use a cached ImageSource if possible.  The shard is locked while a new ImageSource is
+    // created, so concurrent requests for the same path create a single instance.
+    Shard&                       shard = getShard( path );
+    std::unique_lock<std::mutex> lock( shard.mutex );
+    auto                         it = shard.cache.find( path );
+    if( it != shard.cache.end() )
+        return it->second;
 
     // Create a new ImageSource and cache it.
-    imageSource = createImageSource( path );
-    m_cache[path] = imageSource;
+    std::shared_ptr<ImageSource> imageSource =
+        std::make_shared<CachedImageSource>( createImageSource( path, "", getImageSourceOptions() ), m_openImageSources );
+    shard.cache[path] = imageSource;
     return imageSource;
 }
 
+void ImageSourceCache::set( const std::string& path, const std::shared_ptr<ImageSource>& image )
+{
+    Shard&                       shard = getShard( path );
+    std::unique_lock<std::mutex> lock( shard.mutex );
+    shard.cache[path] = image;
+}
+
+void ImageSourceCache::setImageSourceOptions( const ImageSourceOptions& options )
+{
+    std::unique_lock<std::mutex> lock( m_optionsMutex );
+    m_imageSourceOptions = options;
+}
+
+ImageSourceOptions ImageSourceCache::getImageSourceOptions() const
+{
+    std::unique_lock<std::mutex> lock( m_optionsMutex );
+    return m_imageSourceOptions;
+}
+
+void ImageSourceCache::setMaxOpenImageSources( unsigned int maxOpenImageSources )
+{
+    m_openImageSources->setMaxOpen( maxOpenImageSources );
+}
+
+unsigned int ImageSourceCache::getMaxOpenImageSources() const
+{
+    return m_openImageSources->getMaxOpen();
+}
+
 CacheStatistics ImageSourceCache::getStatistics() const
 {
     CacheStatistics result{};
-    for (const auto &keyValue :  m_cache)
+    for( const Shard& shard : m_shards )
     {
-        ++result.numImageSources;
-        result.totalBytesRead += keyValue.second->getNumBytesRead();
-        result.totalTilesRead += keyValue.second->getNumTilesRead();
-        result.totalReadTime += keyValue.second->getTotalReadTime();
+        std::unique_lock<std::mutex> lock( shard.mutex );
+        for( const auto& keyValue : shard.cache )
+        {
+            ++result.numImageSources;
+            result.totalBytesRead += keyValue.second->getNumBytesRead();
+            result.totalTilesRead += keyValue.second->getNumTilesRead();
+            result.totalReadTime += keyValue.second->getTotalReadTime();
+            result.hostMemoryUsage += keyValue.second->getHostMemoryUsage();
+        }
     }
+    m_openImageSources->getStatistics( result );
     return result;
 }
 
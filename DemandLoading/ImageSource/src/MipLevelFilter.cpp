@@ -0,0 +1,395 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "MipLevelFilter.h"
+
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
+
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace imageSource {
+
+namespace {
+
+// Bands are not split below this many destination rows, so small levels are filtered on one thread.
+const unsigned int MIN_ROWS_PER_BAND = 32;
+
+// Shape parameter of the Kaiser window.
+const float KAISER_ALPHA = 4.0f;
+
+const float PI = 3.14159265358979323846f;
+
+// Filter weights for a 2:1 reduction.  Destination pixel x is a weighted sum of source pixels
+// 2x + firstTap + t, for t in [0, weights.size()).
+struct FilterKernel
+{
+    int                firstTap;
+    std::vector<float> weights;
+};
+
+float sinc( float x )
+{
+    if( std::fabs( x ) < 1.0e-6f )
+        return 1.0f;
+    x *= PI;
+    return std::sin( x ) / x;
+}
+
+// Zeroth-order modified Bessel function of the first kind.
+float besselI0( float x )
+{
+    float sum  = 1.0f;
+    float term = 1.0f;
+    for( int k = 1; k < 32; ++k )
+    {
+        const float t = x / ( 2.0f * k );
+        term *= t * t;
+        sum += term;
+        if( term < sum * 1.0e-8f )
+            break;
+    }
+    return sum;
+}
+
+FilterKernel makeFilterKernel( MipFilterType filter )
+{
+    // Filter radius in destination pixels.
+    const float radius = filter == MipFilterType::BOX ? 0.5f : filter == MipFilterType::TENT ? 1.0f : 2.0f;
+
+    FilterKernel kernel{ 0, {} };
+    for( int k = -8; k <= 8; ++k )
+    {
+        // Distance from the source pixel center to the destination pixel center, in destination pixels.
+        const float d = ( k - 0.5f ) / 2.0f;
+        if( std::fabs( d ) >= radius )
+            continue;
+
+        float weight = 1.0f;
+        if( filter == MipFilterType::TENT )
+            weight = 1.0f - std::fabs( d );
+        else if( filter == MipFilterType::KAISER )
+        {
+            const float t = d / radius;
+            weight        = sinc( d ) * besselI0( KAISER_ALPHA * std::sqrt( 1.0f - t * t ) ) / besselI0( KAISER_ALPHA );
+        }
+
+        if( kernel.weights.empty() )
+            kernel.firstTap = k;
+        kernel.weights.push_back( weight );
+    }
+
+    float sum = 0.0f;
+    for( float weight : kernel.weights )
+        sum += weight;
+    for( float& weight : kernel.weights )
+        weight /= sum;
+    return kernel;
+}
+
+// Lookup table that converts 8-bit sRGB values to linear.
+const float* getSrgbToLinearTable()
+{
+    static const std::vector<float> table = [] {
+        std::vector<float> values( 256 );
+        for( int i = 0; i < 256; ++i )
+        {
+            const float c = i / 255.0f;
+            values[i]     = c <= 0.04045f ? c / 12.92f : std::pow( ( c + 0.055f ) / 1.055f, 2.4f );
+        }
+        return values;
+    }();
+    return table.data();
+}
+
+inline float srgbToLinear( float c )
+{
+    return c <= 0.04045f ? c / 12.92f : std::pow( ( c + 0.055f ) / 1.055f, 2.4f );
+}
+
+inline float linearToSrgb( float c )
+{
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow( c, 1.0f / 2.4f ) - 0.055f;
+}
+
+inline float clamp01( float c )
+{
+    return std::min( std::max( c, 0.0f ), 1.0f );
+}
+
+// Describes how pixel values are converted to and from float.
+struct PixelLayout
+{
+    CUarray_format format;
+    unsigned int   numChannels;  // number of stored channels
+    unsigned int   pixelSizeInBytes;
+    bool           sRGB;
+
+    // sRGB conversion applies to the color channels only, not to alpha (or the padding channel of
+    // three-channel images).
+    bool isColorChannel( unsigned int channel ) const { return sRGB && ( numChannels < 4 || channel < 3 ); }
+};
+
+// Convert a row of pixels to float (linear) values.
+void decodeRow( const char* source, float* dest, unsigned int width, const PixelLayout& layout )
+{
+    const unsigned int numValues = width * layout.numChannels;
+    switch( layout.format )
+    {
+        case CU_AD_FORMAT_UNSIGNED_INT8:
+        {
+            const unsigned char* values = reinterpret_cast<const unsigned char*>( source );
+            if( !layout.sRGB )
+            {
+                for( unsigned int i = 0; i < numValues; ++i )
+                    dest[i] = values[i] * ( 1.0f / 255.0f );
+                break;
+            }
+            const float* table = getSrgbToLinearTable();
+            for( unsigned int i = 0; i < numValues; ++i )
+                dest[i] = layout.isColorChannel( i % layout.numChannels ) ? table[values[i]] : values[i] * ( 1.0f / 255.0f );
+            break;
+        }
+        case CU_AD_FORMAT_UNSIGNED_INT16:
+        {
+            for( unsigned int i = 0; i < numValues; ++i )
+            {
+                uint16_t value;
+                memcpy( &value, source + i * sizeof( uint16_t ), sizeof( uint16_t ) );
+                dest[i] = value * ( 1.0f / 65535.0f );
+                if( layout.isColorChannel( i % layout.numChannels ) )
+                    dest[i] = srgbToLinear( dest[i] );
+            }
+            break;
+        }
+        case CU_AD_FORMAT_HALF:
+        {
+            for( unsigned int i = 0; i < numValues; ++i )
+            {
+                half value;
+                memcpy( &value, source + i * sizeof( half ), sizeof( half ) );
+                dest[i] = __half2float( value );
+            }
+            break;
+        }
+        case CU_AD_FORMAT_FLOAT:
+            memcpy( dest, source, numValues * sizeof( float ) );
+            break;
+        default:
+            break;
+    }
+}
+
+// Convert a row of float (linear) values to pixels, rounding to nearest.
+void encodeRow( const float* source, char* dest, unsigned int width, const PixelLayout& layout )
+{
+    const unsigned int numValues = width * layout.numChannels;
+    switch( layout.format )
+    {
+        case CU_AD_FORMAT_UNSIGNED_INT8:
+        {
+            unsigned char* values = reinterpret_cast<unsigned char*>( dest );
+            for( unsigned int i = 0; i < numValues; ++i )
+            {
+                float c = clamp01( source[i] );
+                if( layout.isColorChannel( i % layout.numChannels ) )
+                    c = linearToSrgb( c );
+                values[i] = static_cast<unsigned char>( c * 255.0f + 0.5f );
+            }
+            break;
+        }
+        case CU_AD_FORMAT_UNSIGNED_INT16:
+        {
+            for( unsigned int i = 0; i < numValues; ++i )
+            {
+                float c = clamp01( source[i] );
+                if( layout.isColorChannel( i % layout.numChannels ) )
+                    c = linearToSrgb( c );
+                const uint16_t value = static_cast<uint16_t>( c * 65535.0f + 0.5f );
+                memcpy( dest + i * sizeof( uint16_t ), &value, sizeof( uint16_t ) );
+            }
+            break;
+        }
+        case CU_AD_FORMAT_HALF:
+        {
+            for( unsigned int i = 0; i < numValues; ++i )
+            {
+                const half value = __float2half( source[i] );
+                memcpy( dest + i * sizeof( half ), &value, sizeof( half ) );
+            }
+            break;
+        }
+        case CU_AD_FORMAT_FLOAT:
+            memcpy( dest, source, numValues * sizeof( float ) );
+            break;
+        default:
+            break;
+    }
+}
+
+inline unsigned int clampIndex( int index, unsigned int size )
+{
+    return static_cast<unsigned int>( std::min( std::max( index, 0 ), static_cast<int>( size ) - 1 ) );
+}
+
+// Filter destination rows [rowBegin, rowEnd).  Each destination row is filtered vertically into a
+// full-width row of floats, which is then filtered horizontally.  Decoded source rows are kept in a
+// ring buffer with one slot per filter tap, since consecutive destination rows share source rows.
+// The inner loops run over contiguous float arrays so the compiler can vectorize them.
+void filterBand( const char*         source,
+                 unsigned int        sourceWidth,
+                 unsigned int        sourceHeight,
+                 char*               dest,
+                 unsigned int        destWidth,
+                 unsigned int        rowBegin,
+                 unsigned int        rowEnd,
+                 const FilterKernel& kernel,
+                 const PixelLayout&  layout )
+{
+    const unsigned int numTaps         = static_cast<unsigned int>( kernel.weights.size() );
+    const unsigned int numChannels     = layout.numChannels;
+    const size_t       sourceRowValues = static_cast<size_t>( sourceWidth ) * numChannels;
+    const size_t       sourceRowBytes  = static_cast<size_t>( sourceWidth ) * layout.pixelSizeInBytes;
+    const size_t       destRowBytes    = static_cast<size_t>( destWidth ) * layout.pixelSizeInBytes;
+    const float*       weights         = kernel.weights.data();
+
+    std::vector<float> ring( numTaps * sourceRowValues );
+    std::vector<int>   ringRows( numTaps, -1 );
+    std::vector<float> vertical( sourceRowValues );
+    std::vector<float> horizontal( static_cast<size_t>( destWidth ) * numChannels );
+
+    // Destination pixels whose taps all lie within the source row need no clamping.
+    const int    firstTap      = kernel.firstTap;
+    const int    lastTap       = firstTap + static_cast<int>( numTaps ) - 1;
+    const int    interiorSpan  = static_cast<int>( sourceWidth ) - 1 - lastTap;
+    unsigned int interiorBegin = static_cast<unsigned int>( std::max( 0, ( -firstTap + 1 ) / 2 ) );
+    unsigned int interiorEnd   = interiorSpan < 0 ? 0 : std::min( destWidth, static_cast<unsigned int>( interiorSpan / 2 + 1 ) );
+    interiorBegin              = std::min( interiorBegin, interiorEnd );
+
+    for( unsigned int y = rowBegin; y < rowEnd; ++y )
+    {
+        // Vertical pass.
+        std::fill( vertical.begin(), vertical.end(), 0.0f );
+        for( unsigned int t = 0; t < numTaps; ++t )
+        {
+            const unsigned int sourceRow = clampIndex( static_cast<int>( 2 * y ) + firstTap + static_cast<int>( t ), sourceHeight );
+            const unsigned int slot      = sourceRow % numTaps;
+            float*             row       = &ring[slot * sourceRowValues];
+            if( ringRows[slot] != static_cast<int>( sourceRow ) )
+            {
+                decodeRow( source + sourceRow * sourceRowBytes, row, sourceWidth, layout );
+                ringRows[slot] = static_cast<int>( sourceRow );
+            }
+            const float weight = weights[t];
+            float*      sum    = vertical.data();
+            for( size_t i = 0; i < sourceRowValues; ++i )
+                sum[i] += weight * row[i];
+        }
+
+        // Horizontal pass.  Edge pixels clamp their taps to the row.
+        std::fill( horizontal.begin(), horizontal.end(), 0.0f );
+        for( unsigned int x = 0; x < destWidth; ++x )
+        {
+            if( x == interiorBegin && interiorBegin < interiorEnd )
+                x = interiorEnd;
+            if( x >= destWidth )
+                break;
+            for( unsigned int t = 0; t < numTaps; ++t )
+            {
+                const unsigned int sourceX = clampIndex( static_cast<int>( 2 * x ) + firstTap + static_cast<int>( t ), sourceWidth );
+                for( unsigned int c = 0; c < numChannels; ++c )
+                    horizontal[x * numChannels + c] += weights[t] * vertical[sourceX * numChannels + c];
+            }
+        }
+        for( unsigned int t = 0; t < numTaps && interiorBegin < interiorEnd; ++t )
+        {
+            const float  weight = weights[t];
+            const float* src    = &vertical[( 2 * interiorBegin + firstTap + t ) * numChannels];
+            float*       dst    = &horizontal[interiorBegin * numChannels];
+            const size_t stride = 2 * numChannels;
+            for( unsigned int x = 0; x < interiorEnd - interiorBegin; ++x )
+                for( unsigned int c = 0; c < numChannels; ++c )
+                    dst[x * numChannels + c] += weight * src[x * stride + c];
+        }
+
+        encodeRow( horizontal.data(), dest + y * destRowBytes, destWidth, layout );
+    }
+}
+
+// Point sample every other pixel (for formats that can't be filtered, e.g. integer formats).
+void pointSampleBand( const char* source, unsigned int sourceWidth, unsigned int sourceHeight, char* dest, unsigned int destWidth,
+                      unsigned int rowBegin, unsigned int rowEnd, unsigned int pixelSizeInBytes )
+{
+    const size_t sourceRowBytes = static_cast<size_t>( sourceWidth ) * pixelSizeInBytes;
+    for( unsigned int y = rowBegin; y < rowEnd; ++y )
+    {
+        const char* sourceRow = source + std::min( 2 * y, sourceHeight - 1 ) * sourceRowBytes;
+        char*       destRow   = dest + static_cast<size_t>( y ) * destWidth * pixelSizeInBytes;
+        for( unsigned int x = 0; x < destWidth; ++x )
+        {
+            const unsigned int sourceX = std::min( 2 * x, sourceWidth - 1 );
+            std::copy_n( sourceRow + sourceX * pixelSizeInBytes, pixelSizeInBytes, destRow + x * pixelSizeInBytes );
+        }
+    }
+}
+
+}  // namespace
+
+bool isFilterableFormat( CUarray_format format, unsigned int numChannels )
+{
+    if( numChannels < 1 || numChannels > 4 )
+        return false;
+    return format == CU_AD_FORMAT_UNSIGNED_INT8 || format == CU_AD_FORMAT_UNSIGNED_INT16 || format == CU_AD_FORMAT_HALF
+           || format == CU_AD_FORMAT_FLOAT;
+}
+
+void downsampleMipLevel( const char*             source,
+                         unsigned int            sourceWidth,
+                         unsigned int            sourceHeight,
+                         char*                   dest,
+                         CUarray_format          format,
+                         unsigned int            numChannels,
+                         const MipFilterOptions& options )
+{
+    const unsigned int destWidth  = std::max( 1U, sourceWidth / 2 );
+    const unsigned int destHeight = std::max( 1U, sourceHeight / 2 );
+    // Three-channel images are stored with four channels (see getBitsPerPixel).
+    const unsigned int storedChannels = numChannels == 3 ? 4 : numChannels;
+    const PixelLayout  layout{ format, storedChannels, ( getBitsPerChannel( format ) * storedChannels ) / BITS_PER_BYTE,
+                              options.sRGB && ( format == CU_AD_FORMAT_UNSIGNED_INT8 || format == CU_AD_FORMAT_UNSIGNED_INT16 ) };
+    const bool         filtered = isFilterableFormat( format, numChannels );
+    const FilterKernel kernel   = filtered ? makeFilterKernel( options.filter ) : FilterKernel{ 0, {} };
+
+    const auto processBand = [&]( unsigned int rowBegin, unsigned int rowEnd ) {
+        if( filtered )
+            filterBand( source, sourceWidth, sourceHeight, dest, destWidth, rowBegin, rowEnd, kernel, layout );
+        else
+            pointSampleBand( source, sourceWidth, sourceHeight, dest, destWidth, rowBegin, rowEnd, layout.pixelSizeInBytes );
+    };
+
+    // Split the destination rows into bands, processing the first band on the calling thread.
+    const unsigned int maxThreads = options.maxThreads != 0 ? options.maxThreads : std::max( 1U, std::thread::hardware_concurrency() );
+    const unsigned int numBands   = std::max( 1U, std::min( maxThreads, destHeight / MIN_ROWS_PER_BAND ) );
+    const unsigned int bandHeight = ( destHeight + numBands - 1 ) / numBands;
+
+    std::vector<std::thread> threads;
+    for( unsigned int band = 1; band < numBands; ++band )
+    {
+        const unsigned int rowBegin = band * bandHeight;
+        const unsigned int rowEnd   = std::min( destHeight, rowBegin + bandHeight );
+        if( rowBegin < rowEnd )
+            threads.emplace_back( processBand, rowBegin, rowEnd );
+    }
+    processBand( 0, std::min( destHeight, bandHeight ) );
+    for( std::thread& thread : threads )
+        thread.join();
+}
+
+}  // namespace imageSource
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/ImageSource/MipMapImageSource.h>
+
+#include <cuda.h>
+
+namespace imageSource {
+
+/// Check whether mip levels of the given format can be filtered (rather than point sampled).
+bool isFilterableFormat( CUarray_format format, unsigned int numChannels );
+
+/// Downsample a mip level by a factor of two in each dimension, writing the next coarser level to
+/// dest.  The destination dimensions are max(1, sourceDim / 2).  Filterable formats are converted
+/// to float, filtered separably with the specified filter, and converted back; other formats are
+/// point sampled.  Bands of destination rows are filtered in parallel.
+void downsampleMipLevel( const char*             source,
+                         unsigned int            sourceWidth,
+                         unsigned int            sourceHeight,
+                         char*                   dest,
+                         CUarray_format          format,
+                         unsigned int            numChannels,
+                         const MipFilterOptions& options );
+
+}  // namespace imageSource
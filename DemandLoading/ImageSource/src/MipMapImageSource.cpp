@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -6,12 +6,24 @@
 
 #include <OptiXToolkit/Error/ErrorCheck.h>
 
+#include "MipLevelFilter.h"
+
 #include <algorithm>
 
 namespace imageSource {
 
-MipMapImageSource::MipMapImageSource( std::shared_ptr<ImageSource> baseImage )
+namespace {
+
+unsigned int getMipLevelDim( unsigned int dim, unsigned int mipLevel )
+{
+    return std::max( 1U, dim >> mipLevel );
+}
+
+}  // namespace
+
+MipMapImageSource::MipMapImageSource( std::shared_ptr<ImageSource> baseImage, const MipFilterOptions& options )
     : WrappedImageSource( baseImage )
+    , m_options( options )
 {
     if( baseImage->isOpen() )
     {
@@ -76,60 +88,47 @@ const TextureInfo& MipMapImageSource::getInfo() const
     return m_mipMapInfo;
 }
 
-inline void filterPixel( const char* source, char* dest, unsigned int pixelStride, CUarray_format /*format*/ )
-{
-    std::copy_n( source, pixelStride, dest );
-}
-
 const char* MipMapImageSource::getMipLevelBuffer( unsigned int mipLevel, CUstream stream )
 {
     if( m_buffer.empty() )
     {
-        m_buffer.resize( getTextureSizeInBytes( m_mipMapInfo ) );
-        m_mipLevels.resize( m_mipMapInfo.numMipLevels );
+        size_t bufferSize = 0;
+        for( unsigned int level = 0; level < m_mipMapInfo.numMipLevels; ++level )
+            bufferSize += static_cast<size_t>( m_pixelStrideInBytes ) * getMipLevelDim( m_mipMapInfo.width, level )
+                          * getMipLevelDim( m_mipMapInfo.height, level );
+        m_buffer.resize( bufferSize );
+        m_mipLevels.assign( m_mipMapInfo.numMipLevels, nullptr );
     }
+    if( m_mipLevels[mipLevel] != nullptr )
+        return m_mipLevels[mipLevel];
+
+    // Find the finest resident level at or above the requested level, then filter each coarser
+    // level from the one before it.
+    unsigned int level = mipLevel;
+    while( level > 0 && m_mipLevels[level] == nullptr )
+        --level;
 
-    if( m_mipLevels[mipLevel] == nullptr )
+    char* ptr = m_buffer.data();
+    for( unsigned int i = 0; i < level; ++i )
+        ptr += static_cast<size_t>( m_pixelStrideInBytes ) * getMipLevelDim( m_mipMapInfo.width, i ) * getMipLevelDim( m_mipMapInfo.height, i );
+
+    if( m_mipLevels[0] == nullptr )
     {
-        unsigned int mipLevelWidth{ m_mipMapInfo.width };
-        unsigned int mipLevelHeight{ m_mipMapInfo.height };
-        {
-            size_t       levelSize{ m_pixelStrideInBytes * m_mipMapInfo.width * m_mipMapInfo.height };
-            char*        ptr{ m_buffer.data() };
-            for( unsigned int i = 0; i < mipLevel; ++i )
-            {
-                ptr += levelSize;
-                levelSize /= 4;
-                mipLevelWidth /= 2;
-                mipLevelHeight /= 2;
-            }
-            m_mipLevels[mipLevel] = ptr;
-        }
-        if( mipLevel == 0 )
-        {
-            if( !WrappedImageSource::readMipLevel( m_mipLevels[mipLevel], mipLevel, mipLevelWidth, mipLevelHeight, stream ) )
-            {
-                return nullptr;
-            }
-        }
-        else
+        if( !WrappedImageSource::readMipLevel( ptr, 0, m_mipMapInfo.width, m_mipMapInfo.height, stream ) )
         {
-            // point sample from source to dest
-            const char* source = getMipLevelBuffer( mipLevel - 1, stream );
-            char*       dest   = m_mipLevels[mipLevel];
-            for( unsigned int y = 0; y < mipLevelHeight; ++y )
-            {
-                for( unsigned int x = 0; x < mipLevelWidth; ++x )
-                {
-                    filterPixel( source, dest, m_pixelStrideInBytes, m_mipMapInfo.format );
-                    // skip every other source pixel
-                    source += m_pixelStrideInBytes * 2ULL;
-                    dest += m_pixelStrideInBytes;
-                }
-                // skip every other source scanline
-                source += static_cast<size_t>( m_pixelStrideInBytes * mipLevelWidth );
-            }
+            return nullptr;
         }
+        m_mipLevels[0] = ptr;
+    }
+
+    for( ; level < mipLevel; ++level )
+    {
+        const unsigned int width  = getMipLevelDim( m_mipMapInfo.width, level );
+        const unsigned int height = getMipLevelDim( m_mipMapInfo.height, level );
+        char*              next   = ptr + static_cast<size_t>( m_pixelStrideInBytes ) * width * height;
+        downsampleMipLevel( ptr, width, height, next, m_mipMapInfo.format, m_mipMapInfo.numChannels, m_options );
+        m_mipLevels[level + 1] = next;
+        ptr                    = next;
     }
 
     return m_mipLevels[mipLevel];
@@ -154,16 +153,7 @@ bool MipMapImageSource::readTile( char* dest, unsigned mipLevel, const Tile& til
 
         ++m_numTilesRead;
     }
-    unsigned int mipLevelWidth{ m_mipMapInfo.width };
-    unsigned int level{ mipLevel };
-    if( level > 0 )
-    {
-        do
-        {
-            mipLevelWidth /= 2;
-            level--;
-        } while( level > 0 );
-    }
+    const unsigned int  mipLevelWidth{ getMipLevelDim( m_mipMapInfo.width, mipLevel ) };
     const size_t        mipLevelRowStrideInBytes{ mipLevelWidth * m_pixelStrideInBytes };
     const size_t        tileRowStrideInBytes{ tile.width * m_pixelStrideInBytes };
     const PixelPosition start = pixelPosition( tile );
@@ -178,6 +168,20 @@ bool MipMapImageSource::readTile( char* dest, unsigned mipLevel, const Tile& til
     return true;
 }
 
+bool MipMapImageSource::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    {
+        std::unique_lock<std::mutex> lock( m_dataMutex );
+        if( m_mipMappedBase )
+        {
+            return WrappedImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+        }
+    }
+
+    // Tiles of generated mip levels are copied one at a time.
+    return ImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+}
+
 bool MipMapImageSource::readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream )
 {
     {
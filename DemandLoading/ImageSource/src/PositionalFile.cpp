@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
+
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace imageSource {
+
+#ifdef _WIN32
+
+bool PositionalFile::open( const std::string& fileName, bool memoryMap )
+{
+    close();
+    HANDLE handle = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr );
+    if( handle == INVALID_HANDLE_VALUE )
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if( !GetFileSizeEx( handle, &fileSize ) )
+    {
+        CloseHandle( handle );
+        return false;
+    }
+    m_handle = handle;
+    m_size   = static_cast<uint64_t>( fileSize.QuadPart );
+
+    if( memoryMap && m_size > 0 )
+    {
+        HANDLE mapping = CreateFileMappingA( handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if( mapping != nullptr )
+        {
+            void* view = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+            if( view != nullptr )
+            {
+                m_mapping = mapping;
+                m_data    = static_cast<const char*>( view );
+            }
+            else
+            {
+                CloseHandle( mapping );
+            }
+        }
+    }
+    return true;
+}
+
+void PositionalFile::close()
+{
+    if( m_data != nullptr )
+        UnmapViewOfFile( m_data );
+    if( m_mapping != nullptr )
+        CloseHandle( m_mapping );
+    if( m_handle != nullptr )
+        CloseHandle( m_handle );
+    m_handle  = nullptr;
+    m_mapping = nullptr;
+    m_data    = nullptr;
+    m_size    = 0;
+}
+
+bool PositionalFile::isOpen() const
+{
+    return m_handle != nullptr;
+}
+
+bool PositionalFile::read( char* dest, size_t size, uint64_t offset ) const
+{
+    if( m_handle == nullptr || offset > m_size || size > m_size - offset )
+        return false;
+    if( m_data != nullptr )
+    {
+        memcpy( dest, m_data + offset, size );
+        return true;
+    }
+
+    // ReadFile with an OVERLAPPED offset on a synchronous handle reads at the given position
+    // without relying on (or racing over) the shared file pointer.
+    while( size > 0 )
+    {
+        const DWORD chunk = static_cast<DWORD>( size < 0x40000000u ? size : 0x40000000u );
+        OVERLAPPED overlapped{};
+        overlapped.Offset     = static_cast<DWORD>( offset );
+        overlapped.OffsetHigh = static_cast<DWORD>( offset >> 32 );
+        DWORD numRead         = 0;
+        if( !ReadFile( m_handle, dest, chunk, &numRead, &overlapped ) || numRead == 0 )
+            return false;
+        dest += numRead;
+        size -= numRead;
+        offset += numRead;
+    }
+    return true;
+}
+
+#else
+
+bool PositionalFile::open( const std::string& fileName, bool memoryMap )
+{
+    close();
+    int fd = ::open( fileName.c_str(), O_RDONLY | O_CLOEXEC );
+    if( fd < 0 )
+        return false;
+
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) != 0 )
+    {
+        ::close( fd );
+        return false;
+    }
+    m_fd   = fd;
+    m_size = static_cast<uint64_t>( fileStat.st_size );
+
+    if( memoryMap && m_size > 0 )
+    {
+        void* addr = mmap( nullptr, static_cast<size_t>( m_size ), PROT_READ, MAP_SHARED, fd, 0 );
+        if( addr != MAP_FAILED )
+        {
+            // Tile reads are scattered, so disable kernel read-ahead.
+            madvise( addr, static_cast<size_t>( m_size ), MADV_RANDOM );
+            m_data = static_cast<const char*>( addr );
+        }
+    }
+    else
+    {
+        posix_fadvise( fd, 0, 0, POSIX_FADV_RANDOM );
+    }
+    return true;
+}
+
+void PositionalFile::close()
+{
+    if( m_data != nullptr )
+        munmap( const_cast<char*>( m_data ), static_cast<size_t>( m_size ) );
+    if( m_fd >= 0 )
+        ::close( m_fd );
+    m_fd   = -1;
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool PositionalFile::isOpen() const
+{
+    return m_fd >= 0;
+}
+
+bool PositionalFile::read( char* dest, size_t size, uint64_t offset ) const
+{
+    if( m_fd < 0 || offset > m_size || size > m_size - offset )
+        return false;
+    if( m_data != nullptr )
+    {
+        memcpy( dest, m_data + offset, size );
+        return true;
+    }
+
+    // pread may return fewer bytes than requested (e.g. when interrupted), so loop until done.
+    while( size > 0 )
+    {
+        const ssize_t numRead = pread( m_fd, dest, size, static_cast<off_t>( offset ) );
+        if( numRead < 0 && errno == EINTR )
+            continue;
+        if( numRead <= 0 )
+            return false;
+        dest += numRead;
+        size -= static_cast<size_t>( numRead );
+        offset += static_cast<uint64_t>( numRead );
+    }
+    return true;
+}
+
+#endif
+
+}  // namespace imageSource
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -50,6 +50,19 @@ bool RateLimitedImageSource::readTile( char* dest, unsigned int mipLevel, const
     return result;
 }
 
+/// Delegates to the wrapped ImageSource and decrements the time remaining, unless the
+/// time limit has been exceeded, in which case nothing is done and false is returned.
+bool RateLimitedImageSource::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    if( m_duration->load() <= Microseconds( 0 ) )
+        return false;
+
+    Timer timer;
+    bool  result = WrappedImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+    *m_duration -= timer.elapsed();
+    return result;
+}
+
 /// Delegates to the wrapped ImageSource and decrements the time remaining, unless the
 /// time limit has been exceeded, in which case nothing is done and false is returned.
 bool RateLimitedImageSource::readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream )
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -77,4 +77,17 @@ size_t getTextureSizeInBytes( const TextureInfo& info )
     return texSizeInBytes;
 }
 
+size_t getImageSizeInBytes( const TextureInfo& info, unsigned int width, unsigned int height )
+{
+    if( !isBcFormat( info.format ) )
+        return static_cast<size_t>( width ) * height * getBitsPerPixel( info ) / BITS_PER_BYTE;
+
+    const unsigned int blockWidth       = 4;
+    const unsigned int blockHeight      = 4;
+    const size_t       blockSizeInBytes = blockWidth * blockHeight * getBitsPerPixel( info ) / BITS_PER_BYTE;
+    const size_t       widthInBlocks    = ( width + blockWidth - 1 ) / blockWidth;
+    const size_t       heightInBlocks   = ( height + blockHeight - 1 ) / blockHeight;
+    return widthInBlocks * heightInBlocks * blockSizeInBytes;
+}
+
 }  // namespace imageSource
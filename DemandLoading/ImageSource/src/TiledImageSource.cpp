@@ -1,19 +1,97 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include <OptiXToolkit/ImageSource/TiledImageSource.h>
 
 #include <OptiXToolkit/Error/ErrorCheck.h>
+#include <OptiXToolkit/ImageSource/LruCache.h>
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace imageSource {
 
+namespace {
+
+using MipLevelBuffer = std::shared_ptr<const std::vector<char>>;
+
+// MipLevelCache holds decoded mip levels for all TiledImageSources, evicting the least recently
+// used levels when the memory budget is exceeded.  The most recently used level is never evicted,
+// so a level larger than the budget can still be read.  Readers hold a reference to the buffer
+// while copying tiles, so a level can be evicted while it is being read.
+class MipLevelCache
+{
+  public:
+    // Find a resident mip level, marking it as most recently used.  Returns null on a miss.
+    MipLevelBuffer find( const TiledImageSource* owner, unsigned int mipLevel )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        const MipLevelBuffer*        buffer = m_levels.find( Key( owner, mipLevel ) );
+        if( buffer == nullptr )
+            return MipLevelBuffer();
+        ++m_numHits;
+        return *buffer;
+    }
+
+    // Insert a newly decoded mip level, evicting other levels to stay within the budget.
+    void insert( const TiledImageSource* owner, unsigned int mipLevel, MipLevelBuffer buffer )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        ++m_numMisses;
+        const size_t size = buffer->size();
+        m_levels.insert( Key( owner, mipLevel ), std::move( buffer ), size );
+    }
+
+    // Release the mip levels of the given image.
+    void release( const TiledImageSource* owner )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_levels.eraseRange( Key( owner, 0 ), Key( owner, std::numeric_limits<unsigned int>::max() ) );
+    }
+
+    void setMemoryBudget( size_t numBytes )
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_levels.setMemoryBudget( numBytes );
+    }
+
+    TiledImageCacheStatistics getStatistics()
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        return TiledImageCacheStatistics{ m_numHits,
+                                          m_numMisses,
+                                          m_levels.getNumEvictions(),
+                                          m_levels.getNumEvictedBytes(),
+                                          m_levels.getNumResidentBytes(),
+                                          m_levels.getMemoryBudget() };
+    }
+
+  private:
+    using Key = std::pair<const TiledImageSource*, unsigned int>;
+
+    std::mutex                    m_mutex;
+    LruCache<Key, MipLevelBuffer> m_levels{ TiledImageSource::DEFAULT_MEMORY_BUDGET };
+    unsigned long long            m_numHits   = 0;
+    unsigned long long            m_numMisses = 0;
+};
+
+MipLevelCache& getMipLevelCache()
+{
+    static MipLevelCache cache;
+    return cache;
+}
+
+}  // namespace
+
+const size_t TiledImageSource::DEFAULT_MEMORY_BUDGET;
+
 TiledImageSource::TiledImageSource( std::shared_ptr<ImageSource> baseImage )
     : WrappedImageSource( baseImage )
 {
@@ -23,6 +101,26 @@ TiledImageSource::TiledImageSource( std::shared_ptr<ImageSource> baseImage )
     }
 }
 
+TiledImageSource::~TiledImageSource()
+{
+    getMipLevelCache().release( this );
+}
+
+void TiledImageSource::setMemoryBudget( size_t numBytes )
+{
+    getMipLevelCache().setMemoryBudget( numBytes );
+}
+
+size_t TiledImageSource::getMemoryBudget()
+{
+    return getMipLevelCache().getStatistics().memoryBudget;
+}
+
+TiledImageCacheStatistics TiledImageSource::getCacheStatistics()
+{
+    return getMipLevelCache().getStatistics();
+}
+
 void TiledImageSource::getBaseInfo()
 {
     m_tiledInfo = WrappedImageSource::getInfo();
@@ -50,6 +148,7 @@ void TiledImageSource::close()
     std::unique_lock<std::mutex> lock( m_dataMutex );
     WrappedImageSource::close();
     m_tiledInfo = TextureInfo{};
+    getMipLevelCache().release( this );
 }
 
 const TextureInfo& TiledImageSource::getInfo() const
@@ -72,46 +171,30 @@ bool TiledImageSource::readTile( char* dest, unsigned int mipLevel, const Tile&
         }
     }
 
-    const char* mipLevelBuffer;
-    uint2       mipDimensions;
-    size_t      pixelSizeInBytes;
+    MipLevelBuffer mipLevelBuffer;
+    uint2          mipDimensions;
+    size_t         pixelSizeInBytes;
     {
         std::unique_lock<std::mutex> lock( m_dataMutex );
+        mipDimensions.x  = std::max( m_tiledInfo.width >> mipLevel, 1U );
+        mipDimensions.y  = std::max( m_tiledInfo.height >> mipLevel, 1U );
+        pixelSizeInBytes = getBitsPerPixel( m_tiledInfo ) / BITS_PER_BYTE;  // m_tiledInfo read under lock
 
-        if( m_buffer.empty() )
-        {
-            m_buffer.resize( getTextureSizeInBytes( m_tiledInfo ) );
-            m_mipLevels.resize( m_tiledInfo.numMipLevels );
-            m_mipDimensions.resize( m_tiledInfo.numMipLevels );
-        }
-
-        if( m_mipLevels[mipLevel] == nullptr )
+        // Decode the mip level on a miss.  Decoding happens under m_dataMutex so that concurrent
+        // misses on the same level decode it once; the shared cache is only locked briefly.
+        mipLevelBuffer = getMipLevelCache().find( this, mipLevel );
+        if( !mipLevelBuffer )
         {
-            size_t levelSize = ( m_tiledInfo.width * m_tiledInfo.height * getBitsPerPixel( m_tiledInfo ) ) / BITS_PER_BYTE;
-            char*        ptr            = m_buffer.data();
-            unsigned int mipLevelWidth  = m_tiledInfo.width;
-            unsigned int mipLevelHeight = m_tiledInfo.height;
-            for( unsigned int i = 0; i < mipLevel; ++i )
-            {
-                ptr += levelSize;
-                levelSize /= 4;
-                mipLevelWidth /= 2;
-                mipLevelHeight /= 2;
-            }
-            m_mipLevels[mipLevel] = ptr;
-            m_mipDimensions[mipLevel].x = mipLevelWidth;
-            m_mipDimensions[mipLevel].y = mipLevelHeight;
-            if( !WrappedImageSource::readMipLevel( m_mipLevels[mipLevel], mipLevel, mipLevelWidth, mipLevelHeight, stream ) )
+            std::shared_ptr<std::vector<char>> buffer( new std::vector<char>( static_cast<size_t>( mipDimensions.x ) * mipDimensions.y * pixelSizeInBytes ) );
+            if( !WrappedImageSource::readMipLevel( buffer->data(), mipLevel, mipDimensions.x, mipDimensions.y, stream ) )
             {
                 OTK_ASSERT(false);
                 return false;
-            }    
+            }
+            getMipLevelCache().insert( this, mipLevel, buffer );
+            mipLevelBuffer = buffer;
         }
-
         ++m_numTilesRead;
-        mipLevelBuffer   = m_mipLevels[mipLevel];
-        mipDimensions    = m_mipDimensions[mipLevel];
-        pixelSizeInBytes = getBitsPerPixel( m_tiledInfo ) / BITS_PER_BYTE;  // m_tiledInfo read under lock
     }
 
     OTK_ASSERT_MSG( mipLevelBuffer != nullptr, ( "Bad pointer for level " + std::to_string( mipLevel ) ).c_str() );
@@ -122,7 +205,7 @@ bool TiledImageSource::readTile( char* dest, unsigned int mipLevel, const Tile&
     const size_t        sourceRowStrideInBytes   = mipDimensions.x * pixelSizeInBytes;
     const size_t        destTileRowStrideInBytes = tile.width * pixelSizeInBytes;
     const PixelPosition start                    = pixelPosition( tile );
-    const char*         source = mipLevelBuffer + start.y * sourceRowStrideInBytes + start.x * pixelSizeInBytes;
+    const char*         source = mipLevelBuffer->data() + start.y * sourceRowStrideInBytes + start.x * pixelSizeInBytes;
 
     // Pixels outside the mip level must be black: zero the destination tile first when this is a
     // partial edge tile, since the copy below only writes the valid sourceWidth x sourceHeight region.
@@ -139,6 +222,20 @@ bool TiledImageSource::readTile( char* dest, unsigned int mipLevel, const Tile&
     return true;
 }
 
+bool TiledImageSource::readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    {
+        std::unique_lock<std::mutex> lock( m_dataMutex );
+        if( m_baseIsTiled )
+        {
+            return WrappedImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+        }
+    }
+
+    // Tiles of decoded mip levels are copied one at a time.
+    return ImageSource::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+}
+
 bool TiledImageSource::readMipTail( char*        dest,
                                     unsigned int mipTailFirstLevel,
                                     unsigned int numMipLevels,
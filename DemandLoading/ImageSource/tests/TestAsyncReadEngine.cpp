@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace imageSource;
+
+namespace {
+
+const size_t FILE_SIZE = 1 << 20;
+
+class TestAsyncReadEngine : public testing::TestWithParam<AsyncReadEngineType>
+{
+  protected:
+    void SetUp() override
+    {
+        m_contents.resize( FILE_SIZE );
+        for( size_t i = 0; i < m_contents.size(); ++i )
+            m_contents[i] = static_cast<char>( ( i * 31 ) ^ ( i >> 8 ) );
+        std::ofstream file( m_fileName, std::ios::binary );
+        file.write( m_contents.data(), m_contents.size() );
+        file.close();
+        ASSERT_TRUE( m_file.open( m_fileName, false ) );
+    }
+
+    void TearDown() override
+    {
+        m_file.close();
+        std::remove( m_fileName.c_str() );
+    }
+
+    std::shared_ptr<AsyncReadEngine> createEngine( unsigned int queueDepth ) { return createAsyncReadEngine( queueDepth, GetParam() ); }
+
+    const std::string m_fileName{"TestAsyncReadEngine.bin"};
+    std::vector<char> m_contents;
+    PositionalFile    m_file;
+};
+
+}  // namespace
+
+TEST_P( TestAsyncReadEngine, ReadsMatchFile )
+{
+    std::shared_ptr<AsyncReadEngine> engine = createEngine( 8 );
+    const size_t                     readSize = 65536;
+    std::vector<char>                dest( FILE_SIZE );
+
+    AsyncReadBatch batch( *engine );
+    for( size_t offset = 0; offset < FILE_SIZE; offset += readSize )
+        batch.read( m_file, &dest[offset], readSize, offset );
+    EXPECT_TRUE( batch.wait() );
+    EXPECT_EQ( m_contents, dest );
+}
+
+TEST_P( TestAsyncReadEngine, ReadsBeyondQueueDepthAreQueued )
+{
+    std::shared_ptr<AsyncReadEngine> engine = createEngine( 2 );
+    const unsigned int               numReads = 200;
+    const size_t                     readSize = 1000;
+    std::vector<char>                dest( numReads * readSize );
+    std::atomic<unsigned int>        numCallbacks{0};
+
+    for( unsigned int i = 0; i < numReads; ++i )
+    {
+        const uint64_t offset = ( i * 7919 * readSize ) % ( FILE_SIZE - readSize );
+        engine->submit( m_file, &dest[i * readSize], readSize, offset, [&, i, offset]( bool success ) {
+            EXPECT_TRUE( success );
+            EXPECT_TRUE( std::equal( &dest[i * readSize], &dest[( i + 1 ) * readSize], &m_contents[offset] ) );
+            ++numCallbacks;
+        } );
+    }
+
+    // Destroying the engine waits for the reads in flight.
+    engine.reset();
+    EXPECT_EQ( numReads, numCallbacks );
+}
+
+TEST_P( TestAsyncReadEngine, ReadPastEndFails )
+{
+    std::shared_ptr<AsyncReadEngine> engine = createEngine( 4 );
+    std::vector<char>                dest( 2 );
+
+    AsyncReadBatch batch( *engine );
+    batch.read( m_file, dest.data(), 2, FILE_SIZE - 1 );
+    EXPECT_FALSE( batch.wait() );
+
+    // A failure is reported once.
+    batch.read( m_file, dest.data(), 2, FILE_SIZE - 2 );
+    EXPECT_TRUE( batch.wait() );
+    EXPECT_EQ( m_contents[FILE_SIZE - 1], dest[1] );
+}
+
+TEST_P( TestAsyncReadEngine, MemoryMappedFileIsCopied )
+{
+    std::shared_ptr<AsyncReadEngine> engine = createEngine( 4 );
+    PositionalFile                   mappedFile;
+    ASSERT_TRUE( mappedFile.open( m_fileName, true ) );
+    std::vector<char> dest( 100 );
+
+    bool completed = false;
+    engine->submit( mappedFile, dest.data(), dest.size(), 1234, [&]( bool success ) { completed = success; } );
+
+    EXPECT_TRUE( completed );
+    EXPECT_TRUE( std::equal( dest.begin(), dest.end(), &m_contents[1234] ) );
+}
+
+TEST_P( TestAsyncReadEngine, ClosedFileFails )
+{
+    std::shared_ptr<AsyncReadEngine> engine = createEngine( 4 );
+    PositionalFile                   closedFile;
+    std::vector<char>                dest( 100 );
+
+    AsyncReadBatch batch( *engine );
+    batch.read( closedFile, dest.data(), dest.size(), 0 );
+    EXPECT_FALSE( batch.wait() );
+}
+
+INSTANTIATE_TEST_SUITE_P( Engines,
+                          TestAsyncReadEngine,
+                          testing::Values( AsyncReadEngineType::THREAD_POOL, AsyncReadEngineType::DEFAULT ) );
@@ -0,0 +1,464 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/BCnEncoder.h>
+#include <OptiXToolkit/ImageSource/CheckerBoardImage.h>
+#include <OptiXToolkit/ImageSource/DDSImageReader.h>
+
+#include <gtest/gtest.h>
+
+#include <cuda_fp16.h>
+#include <vector_functions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace imageSource;
+
+namespace {
+
+const int WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+class BitReader
+{
+  public:
+    BitReader( const unsigned char* block )
+        : m_block( block )
+    {
+    }
+
+    unsigned int read( unsigned int numBits )
+    {
+        unsigned int value = 0;
+        for( unsigned int i = 0; i < numBits; ++i, ++m_bit )
+            value |= ( ( m_block[m_bit / 8] >> ( m_bit % 8 ) ) & 1u ) << i;
+        return value;
+    }
+
+  private:
+    const unsigned char* m_block;
+    unsigned int         m_bit = 0;
+};
+
+void decodeBC1( const unsigned char* block, float4 texels[16] )
+{
+    BitReader    reader( block );
+    unsigned int colors[2] = {reader.read( 16 ), reader.read( 16 )};
+    float        palette[4][3];
+    for( int i = 0; i < 2; ++i )
+    {
+        const unsigned int r = colors[i] >> 11, g = ( colors[i] >> 5 ) & 0x3F, b = colors[i] & 0x1F;
+        palette[i][0]        = ( ( r << 3 ) | ( r >> 2 ) ) / 255.0f;
+        palette[i][1]        = ( ( g << 2 ) | ( g >> 4 ) ) / 255.0f;
+        palette[i][2]        = ( ( b << 3 ) | ( b >> 2 ) ) / 255.0f;
+    }
+    for( int c = 0; c < 3; ++c )
+    {
+        if( colors[0] > colors[1] )
+        {
+            palette[2][c] = ( 2.0f * palette[0][c] + palette[1][c] ) / 3.0f;
+            palette[3][c] = ( palette[0][c] + 2.0f * palette[1][c] ) / 3.0f;
+        }
+        else
+        {
+            palette[2][c] = ( palette[0][c] + palette[1][c] ) / 2.0f;
+            palette[3][c] = 0.0f;
+        }
+    }
+    for( int t = 0; t < 16; ++t )
+    {
+        const unsigned int index = reader.read( 2 );
+        texels[t]                = make_float4( palette[index][0], palette[index][1], palette[index][2], 1.0f );
+    }
+}
+
+void decodeBC4( const unsigned char* block, float values[16] )
+{
+    BitReader reader( block );
+    const int red0 = reader.read( 8 );
+    const int red1 = reader.read( 8 );
+    float     palette[8]{red0 / 255.0f, red1 / 255.0f};
+    for( int i = 2; i < 8; ++i )
+        palette[i] = red0 > red1 ? ( ( 8 - i ) * red0 + ( i - 1 ) * red1 ) / ( 7.0f * 255.0f ) :
+                     i < 6       ? ( ( 6 - i ) * red0 + ( i - 1 ) * red1 ) / ( 5.0f * 255.0f ) :
+                                   ( i == 6 ? 0.0f : 1.0f );
+    for( int t = 0; t < 16; ++t )
+        values[t] = palette[reader.read( 3 )];
+}
+
+// Decode a mode 6 BC7 block.  Returns false for other modes.
+bool decodeBC7( const unsigned char* block, float4 texels[16] )
+{
+    BitReader reader( block );
+    if( reader.read( 7 ) != 0x40 )
+        return false;
+    int endpoints[2][4];
+    for( int c = 0; c < 4; ++c )
+    {
+        endpoints[0][c] = reader.read( 7 ) << 1;
+        endpoints[1][c] = reader.read( 7 ) << 1;
+    }
+    const int p0 = reader.read( 1 ), p1 = reader.read( 1 );
+    for( int c = 0; c < 4; ++c )
+    {
+        endpoints[0][c] |= p0;
+        endpoints[1][c] |= p1;
+    }
+    for( int t = 0; t < 16; ++t )
+    {
+        const int w = WEIGHTS4[reader.read( t == 0 ? 3 : 4 )];
+        float     c[4];
+        for( int i = 0; i < 4; ++i )
+            c[i] = ( ( ( 64 - w ) * endpoints[0][i] + w * endpoints[1][i] + 32 ) >> 6 ) / 255.0f;
+        texels[t] = make_float4( c[0], c[1], c[2], c[3] );
+    }
+    return true;
+}
+
+float halfBitsToFloat( int bits )
+{
+    const uint16_t value = static_cast<uint16_t>( bits );
+    __half         half;
+    memcpy( &half, &value, sizeof( value ) );
+    return __half2float( half );
+}
+
+// Decode a mode 11 unsigned BC6H block.  Returns false for other modes.
+bool decodeBC6H( const unsigned char* block, float4 texels[16] )
+{
+    BitReader reader( block );
+    if( reader.read( 5 ) != 0x03 )
+        return false;
+    int endpoints[2][3];
+    for( int e = 0; e < 2; ++e )
+    {
+        for( int c = 0; c < 3; ++c )
+        {
+            const int q     = reader.read( 10 );
+            endpoints[e][c] = q == 0 ? 0 : q == 1023 ? 0xFFFF : ( q << 6 ) + 32;
+        }
+    }
+    for( int t = 0; t < 16; ++t )
+    {
+        const int w = WEIGHTS4[reader.read( t == 0 ? 3 : 4 )];
+        float     c[3];
+        for( int i = 0; i < 3; ++i )
+            c[i] = halfBitsToFloat( ( ( ( ( 64 - w ) * endpoints[0][i] + w * endpoints[1][i] + 32 ) >> 6 ) * 31 ) >> 6 );
+        texels[t] = make_float4( c[0], c[1], c[2], 1.0f );
+    }
+    return true;
+}
+
+// Texels on a line in color space, taking numSteps evenly spaced positions along it.
+void makeGradient( float4 texels[16], int numSteps )
+{
+    for( int t = 0; t < 16; ++t )
+    {
+        const float s = ( t % numSteps ) / ( numSteps - 1.0f );
+        texels[t]     = make_float4( 0.1f + 0.8f * s, 0.2f + 0.3f * s, 0.9f - 0.5f * s, 0.25f + 0.5f * s );
+    }
+}
+
+float maxError( const float4* expected, const float4* actual, int numTexels, int numChannels )
+{
+    float error = 0.0f;
+    for( int t = 0; t < numTexels; ++t )
+    {
+        const float e[4] = {expected[t].x, expected[t].y, expected[t].z, expected[t].w};
+        const float a[4] = {actual[t].x, actual[t].y, actual[t].z, actual[t].w};
+        for( int c = 0; c < numChannels; ++c )
+            error = std::max( error, std::fabs( e[c] - a[c] ) );
+    }
+    return error;
+}
+
+}  // anonymous namespace
+
+TEST( TestBCnEncoder, BlockSizes )
+{
+    EXPECT_EQ( 8u, getBCBlockSizeInBytes( BCFormat::BC1 ) );
+    EXPECT_EQ( 8u, getBCBlockSizeInBytes( BCFormat::BC4 ) );
+    EXPECT_EQ( 16u, getBCBlockSizeInBytes( BCFormat::BC5 ) );
+    EXPECT_EQ( 16u, getBCBlockSizeInBytes( BCFormat::BC6H ) );
+    EXPECT_EQ( 16u, getBCBlockSizeInBytes( BCFormat::BC7 ) );
+}
+
+TEST( TestBCnEncoder, BC1 )
+{
+    float4 texels[16], decoded[16];
+    makeGradient( texels, 4 );
+    unsigned char block[8];
+    encodeBCBlock( BCFormat::BC1, texels, block );
+    decodeBC1( block, decoded );
+    EXPECT_LT( maxError( texels, decoded, 16, 3 ), 0.03f );
+
+    // A solid color is within the 565 quantization error.
+    std::fill( texels, texels + 16, make_float4( 0.3f, 0.6f, 0.9f, 1.0f ) );
+    encodeBCBlock( BCFormat::BC1, texels, block );
+    decodeBC1( block, decoded );
+    EXPECT_LT( maxError( texels, decoded, 16, 3 ), 0.5f / 31.0f );
+}
+
+TEST( TestBCnEncoder, BC4AndBC5 )
+{
+    float4 texels[16];
+    makeGradient( texels, 16 );
+
+    unsigned char block[16];
+    float         red[16], green[16];
+    encodeBCBlock( BCFormat::BC4, texels, block );
+    decodeBC4( block, red );
+    for( int t = 0; t < 16; ++t )
+        EXPECT_NEAR( texels[t].x, red[t], 0.8f / 14.0f + 1.0f / 255.0f );
+
+    encodeBCBlock( BCFormat::BC5, texels, block );
+    decodeBC4( block, red );
+    decodeBC4( block + 8, green );
+    for( int t = 0; t < 16; ++t )
+    {
+        EXPECT_NEAR( texels[t].x, red[t], 0.8f / 14.0f + 1.0f / 255.0f );
+        EXPECT_NEAR( texels[t].y, green[t], 0.3f / 14.0f + 1.0f / 255.0f );
+    }
+}
+
+TEST( TestBCnEncoder, BC7 )
+{
+    float4 texels[16], decoded[16];
+    makeGradient( texels, 16 );
+    unsigned char block[16];
+    encodeBCBlock( BCFormat::BC7, texels, block );
+    ASSERT_TRUE( decodeBC7( block, decoded ) );
+    EXPECT_LT( maxError( texels, decoded, 16, 4 ), 0.03f );
+
+    // Two colors are encoded almost exactly, whichever texel comes first.
+    for( int t = 0; t < 16; ++t )
+        texels[t] = ( t % 3 == 0 ) ? make_float4( 1.0f, 0.5f, 0.0f, 0.0f ) : make_float4( 0.0f, 0.0f, 1.0f, 1.0f );
+    for( int first = 0; first < 2; ++first )
+    {
+        std::swap( texels[0], texels[1] );
+        encodeBCBlock( BCFormat::BC7, texels, block );
+        ASSERT_TRUE( decodeBC7( block, decoded ) );
+        EXPECT_LE( maxError( texels, decoded, 16, 4 ), 1.0f / 255.0f );
+    }
+}
+
+TEST( TestBCnEncoder, BC6H )
+{
+    // A color whose intensity varies from 1 to 64, which is nearly a line in half float bit space.
+    float4 texels[16], decoded[16];
+    for( int t = 0; t < 16; ++t )
+    {
+        const float intensity = std::exp2( 6.0f * t / 15.0f );
+        texels[t]             = make_float4( intensity, 0.5f * intensity, 0.25f * intensity, 1.0f );
+    }
+    unsigned char block[16];
+    encodeBCBlock( BCFormat::BC6H, texels, block );
+    ASSERT_TRUE( decodeBC6H( block, decoded ) );
+    for( int t = 0; t < 16; ++t )
+    {
+        EXPECT_NEAR( texels[t].x, decoded[t].x, 0.08f * texels[t].x );
+        EXPECT_NEAR( texels[t].y, decoded[t].y, 0.08f * texels[t].y );
+        EXPECT_NEAR( texels[t].z, decoded[t].z, 0.08f * texels[t].z );
+    }
+
+    // Negative values are clamped to zero.
+    std::fill( texels, texels + 16, make_float4( -1.0f, 0.0f, 2.0f, 1.0f ) );
+    encodeBCBlock( BCFormat::BC6H, texels, block );
+    ASSERT_TRUE( decodeBC6H( block, decoded ) );
+    EXPECT_EQ( 0.0f, decoded[0].x );
+    EXPECT_EQ( 0.0f, decoded[0].y );
+    EXPECT_NEAR( 2.0f, decoded[0].z, 0.01f );
+}
+
+class TestBCnEncoderFile : public testing::Test
+{
+  public:
+    void TearDown() override { std::remove( m_fileName.c_str() ); }
+
+  protected:
+    const std::string m_fileName = "TestBCnEncoder.dds";
+
+    std::vector<char> readFile() const
+    {
+        std::ifstream file( m_fileName, std::ios::binary );
+        return std::vector<char>( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+    }
+
+    DDSFileHeader readFileHeader() const
+    {
+        DDSFileHeader           header{};
+        const std::vector<char> file = readFile();
+        if( file.size() >= sizeof( DDSFileHeader ) )
+            memcpy( &header, file.data(), sizeof( DDSFileHeader ) );
+        return header;
+    }
+
+    // Get the size of a flat DDS file without a header extension, with partial blocks in each level.
+    static size_t getFlatFileSize( unsigned int width, unsigned int height, unsigned int numMipLevels, unsigned int blockSize )
+    {
+        size_t size = sizeof( DDSFileHeader );
+        for( unsigned int mipLevel = 0; mipLevel < numMipLevels; ++mipLevel )
+        {
+            const size_t levelWidth  = std::max( 1u, width >> mipLevel );
+            const size_t levelHeight = std::max( 1u, height >> mipLevel );
+            size += ( ( levelWidth + 3 ) / 4 ) * ( ( levelHeight + 3 ) / 4 ) * blockSize;
+        }
+        return size;
+    }
+
+    // Compare the decoded mip levels of the file with the checkerboard they were encoded from.
+    void checkMipLevels( DDSImageReader& reader, CheckerBoardImage& image, unsigned int firstMipLevel, BCFormat format )
+    {
+        TextureInfo info{};
+        reader.open( &info );
+        const unsigned int blockSize = getBCBlockSizeInBytes( format );
+        for( unsigned int mipLevel = 0; mipLevel < info.numMipLevels; ++mipLevel )
+        {
+            const unsigned int width = info.width >> mipLevel, height = info.height >> mipLevel;
+            std::vector<unsigned char> blocks( ( width / 4 ) * ( height / 4 ) * blockSize );
+            ASSERT_TRUE( reader.readMipLevel( reinterpret_cast<char*>( blocks.data() ), mipLevel, width, height, CUstream{0} ) );
+            std::vector<float4> expected( width * height );
+            ASSERT_TRUE( image.readMipLevel( reinterpret_cast<char*>( expected.data() ), firstMipLevel + mipLevel, width, height, CUstream{0} ) );
+
+            float error = 0.0f;
+            for( unsigned int block = 0; block < blocks.size() / blockSize; ++block )
+            {
+                float4 texels[16], decoded[16];
+                for( int t = 0; t < 16; ++t )
+                    texels[t] = expected[( ( block / ( width / 4 ) ) * 4 + t / 4 ) * width + ( block % ( width / 4 ) ) * 4 + t % 4];
+                if( format == BCFormat::BC1 )
+                    decodeBC1( &blocks[block * blockSize], decoded );
+                else
+                    ASSERT_TRUE( decodeBC7( &blocks[block * blockSize], decoded ) );
+                error = std::max( error, maxError( texels, decoded, 16, format == BCFormat::BC1 ? 3 : 4 ) );
+            }
+            EXPECT_LT( error, 0.02f ) << "mip level " << mipLevel;
+        }
+    }
+};
+
+TEST_F( TestBCnEncoderFile, WriteTiledBC7 )
+{
+    // Levels 0 and 1 are tiled, and levels 2-7 (256x128 to 8x4) form the mip tail.
+    auto image = std::make_shared<CheckerBoardImage>( 1024, 512, 16 );
+    ASSERT_TRUE( writeBCFile( image, m_fileName ) );
+
+    DDSImageReader reader( m_fileName, false );
+    TextureInfo    info{};
+    reader.open( &info );
+    ASSERT_TRUE( info.isValid );
+    EXPECT_TRUE( reader.isFileTiled() );
+    EXPECT_EQ( 1024u, info.width );
+    EXPECT_EQ( 512u, info.height );
+    EXPECT_EQ( 8u, info.numMipLevels );
+    EXPECT_EQ( CU_AD_FORMAT_BC7_UNORM, info.format );
+    checkMipLevels( reader, *image, 0, BCFormat::BC7 );
+}
+
+TEST_F( TestBCnEncoderFile, WriteFlatBC1WithDroppedLevels )
+{
+    auto             image = std::make_shared<CheckerBoardImage>( 1024, 1024, 16 );
+    BCEncoderOptions options;
+    options.format        = BCFormat::BC1;
+    options.firstMipLevel = 2;
+    options.tiled         = false;
+    options.maxThreads    = 3;
+    ASSERT_TRUE( writeBCFile( image, m_fileName, options ) );
+
+    DDSImageReader reader( m_fileName, false );
+    TextureInfo    info{};
+    reader.open( &info );
+    ASSERT_TRUE( info.isValid );
+    EXPECT_FALSE( reader.isFileTiled() );
+    EXPECT_EQ( 256u, info.width );
+    EXPECT_EQ( 7u, info.numMipLevels );
+    EXPECT_EQ( CU_AD_FORMAT_BC1_UNORM, info.format );
+    checkMipLevels( reader, *image, 2, BCFormat::BC1 );
+}
+
+TEST_F( TestBCnEncoderFile, GeneratesMipLevels )
+{
+    auto image = std::make_shared<CheckerBoardImage>( 64, 64, 4, /*useMipmaps=*/false );
+    ASSERT_TRUE( writeBCFile( image, m_fileName ) );
+
+    DDSImageReader reader( m_fileName, false );
+    TextureInfo    info{};
+    reader.open( &info );
+    EXPECT_EQ( 5u, info.numMipLevels );
+}
+
+TEST_F( TestBCnEncoderFile, WritesFullMipChain )
+{
+    // The file holds every level down to 1x1, though DDSImageReader only reads the levels whose
+    // dimensions are multiples of four.
+    auto image = std::make_shared<CheckerBoardImage>( 1024, 512, 16 );
+    ASSERT_TRUE( writeBCFile( image, m_fileName ) );
+    EXPECT_EQ( 11u, readFileHeader().mipMapCount );
+
+    BCEncoderOptions options;
+    options.format        = BCFormat::BC1;
+    options.firstMipLevel = 2;
+    options.tiled         = false;
+    ASSERT_TRUE( writeBCFile( image, m_fileName, options ) );
+    const DDSFileHeader header = readFileHeader();
+    EXPECT_EQ( 9u, header.mipMapCount );
+    EXPECT_EQ( getFlatFileSize( 256, 128, 9, 8 ), readFile().size() );
+}
+
+TEST_F( TestBCnEncoderFile, WritesUnalignedSize )
+{
+    // Levels 125x125 and smaller end in partial blocks.
+    auto             image = std::make_shared<CheckerBoardImage>( 1000, 1000, 8 );
+    BCEncoderOptions options;
+    options.format = BCFormat::BC1;
+    options.tiled  = false;
+    ASSERT_TRUE( writeBCFile( image, m_fileName, options ) );
+
+    const DDSFileHeader header = readFileHeader();
+    EXPECT_EQ( 1000u, header.width );
+    EXPECT_EQ( 10u, header.mipMapCount );
+    EXPECT_EQ( 250u * 250u * 8u, header.pitchOrLinearSize );
+    EXPECT_EQ( getFlatFileSize( 1000, 1000, 10, 8 ), readFile().size() );
+
+    DDSImageReader reader( m_fileName, false );
+    TextureInfo    info{};
+    reader.open( &info );
+    ASSERT_TRUE( info.isValid );
+    EXPECT_EQ( 2u, info.numMipLevels );
+    checkMipLevels( reader, *image, 0, BCFormat::BC1 );
+}
+
+TEST_F( TestBCnEncoderFile, PartialBlocksReplicateEdgeTexels )
+{
+    auto             image = std::make_shared<CheckerBoardImage>( 6, 6, 2 );
+    BCEncoderOptions options;
+    options.format = BCFormat::BC1;
+    options.tiled  = false;
+    ASSERT_TRUE( writeBCFile( image, m_fileName, options ) );
+    EXPECT_EQ( 3u, readFileHeader().mipMapCount );
+
+    // Level 0 is 2x2 blocks, whose texels beyond the edge repeat the last row or column.
+    const std::vector<char> file = readFile();
+    ASSERT_EQ( getFlatFileSize( 6, 6, 3, 8 ), file.size() );
+    std::vector<float4> expected( 6 * 6 );
+    ASSERT_TRUE( image->readMipLevel( reinterpret_cast<char*>( expected.data() ), 0, 6, 6, CUstream{0} ) );
+    for( unsigned int block = 0; block < 4; ++block )
+    {
+        float4 texels[16], decoded[16];
+        for( unsigned int t = 0; t < 16; ++t )
+        {
+            const unsigned int x = std::min( ( block % 2 ) * 4 + t % 4, 5u );
+            const unsigned int y = std::min( ( block / 2 ) * 4 + t / 4, 5u );
+            texels[t]            = expected[y * 6 + x];
+        }
+        decodeBC1( reinterpret_cast<const unsigned char*>( &file[sizeof( DDSFileHeader ) + block * 8] ), decoded );
+        EXPECT_LT( maxError( texels, decoded, 16, 3 ), 0.02f ) << "block " << block;
+    }
+}
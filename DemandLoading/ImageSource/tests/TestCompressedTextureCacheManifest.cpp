@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/CompressedTextureCacheManifest.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace imageSource;
+
+namespace {
+
+bool fileExists( const std::string& path )
+{
+    return static_cast<bool>( std::ifstream( path ) );
+}
+
+}  // namespace
+
+class TestCompressedTextureCacheManifest : public testing::Test
+{
+  public:
+    void TearDown() override
+    {
+        for( const std::string& fileName : m_fileNames )
+            std::remove( fileName.c_str() );
+        std::remove( "manifest.txt" );
+        std::remove( "manifest.lock" );
+    }
+
+  protected:
+    // The cache folder is the working directory, which holds the source files too.
+    const std::string        m_cacheFolder = ".";
+    std::vector<std::string> m_fileNames;
+
+    std::string writeFile( const std::string& fileName, const std::string& contents )
+    {
+        std::ofstream file( fileName, std::ios::binary );
+        file << contents;
+        m_fileNames.push_back( fileName );
+        return fileName;
+    }
+
+    // Add a cache file for a source, as CompressedTextureCacheManager does after converting it.
+    std::string addSource( CompressedTextureCacheManifest& manifest, const std::string& source, const std::string& optionsKey )
+    {
+        unsigned long long size = 0, hash = 0;
+        long long          time = 0;
+        EXPECT_TRUE( CompressedTextureCacheManifest::getSourceStatus( source, size, time ) );
+        EXPECT_TRUE( CompressedTextureCacheManifest::hashFile( source, hash ) );
+        const std::string cacheFile = CompressedTextureCacheManifest::getCacheFileName( hash, optionsKey, ".dds" );
+        writeFile( manifest.getCachePath( cacheFile ), "DDS " + source );
+        EXPECT_TRUE( manifest.addEntry( source, size, time, hash, optionsKey, cacheFile ) );
+        return cacheFile;
+    }
+};
+
+TEST_F( TestCompressedTextureCacheManifest, HashFile )
+{
+    writeFile( "TestManifestA.png", std::string( 1000, 'a' ) );
+    writeFile( "TestManifestB.png", std::string( 1000, 'a' ) );
+    writeFile( "TestManifestC.png", std::string( 999, 'a' ) + 'b' );
+
+    unsigned long long hashA = 0, hashB = 0, hashC = 0;
+    EXPECT_TRUE( CompressedTextureCacheManifest::hashFile( "TestManifestA.png", hashA ) );
+    EXPECT_TRUE( CompressedTextureCacheManifest::hashFile( "TestManifestB.png", hashB ) );
+    EXPECT_TRUE( CompressedTextureCacheManifest::hashFile( "TestManifestC.png", hashC ) );
+    EXPECT_EQ( hashA, hashB );
+    EXPECT_NE( hashA, hashC );
+    EXPECT_FALSE( CompressedTextureCacheManifest::hashFile( "TestManifestMissing.png", hashA ) );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, CacheFileName )
+{
+    const std::string name = CompressedTextureCacheManifest::getCacheFileName( 1234, "bc7 tiled", ".dds" );
+    EXPECT_EQ( 20u, name.size() );
+    EXPECT_EQ( ".dds", name.substr( 16 ) );
+    EXPECT_EQ( name, CompressedTextureCacheManifest::getCacheFileName( 1234, "bc7 tiled", ".dds" ) );
+    EXPECT_NE( name, CompressedTextureCacheManifest::getCacheFileName( 1234, "bc7 untiled", ".dds" ) );
+    EXPECT_NE( name, CompressedTextureCacheManifest::getCacheFileName( 1235, "bc7 tiled", ".dds" ) );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, FindAddedEntry )
+{
+    writeFile( "TestManifestA.png", "source a" );
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    EXPECT_TRUE( manifest.findCacheFile( "TestManifestA.png", "bc7" ).empty() );
+
+    const std::string cacheFile = addSource( manifest, "TestManifestA.png", "bc7" );
+    EXPECT_EQ( manifest.getCachePath( cacheFile ), manifest.findCacheFile( "TestManifestA.png", "bc7" ) );
+    EXPECT_EQ( manifest.getCachePath( cacheFile ), manifest.findCacheFile( "./TestManifestA.png", "bc7" ) );
+    EXPECT_TRUE( manifest.findCacheFile( "TestManifestA.png", "bc1" ).empty() );
+    EXPECT_EQ( 1u, manifest.getNumEntries() );
+
+    // Another manifest for the folder reads the entry.
+    CompressedTextureCacheManifest other( m_cacheFolder );
+    EXPECT_EQ( manifest.getCachePath( cacheFile ), other.findCacheFile( "TestManifestA.png", "bc7" ) );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, LatestOptions )
+{
+    writeFile( "TestManifestA.png", "source a" );
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    addSource( manifest, "TestManifestA.png", "bc1" );
+    const std::string cacheFile = addSource( manifest, "TestManifestA.png", "bc7" );
+    EXPECT_EQ( manifest.getCachePath( cacheFile ), manifest.findCacheFile( "TestManifestA.png" ) );
+
+    CompressedTextureCacheManifest other( m_cacheFolder );
+    EXPECT_EQ( 2u, other.getNumEntries() );
+    EXPECT_EQ( manifest.getCachePath( cacheFile ), other.findCacheFile( "TestManifestA.png" ) );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, StaleEntries )
+{
+    writeFile( "TestManifestA.png", "source a" );
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    const std::string              cacheFile = addSource( manifest, "TestManifestA.png", "bc7" );
+
+    // Changing the source makes the entry stale.
+    writeFile( "TestManifestA.png", "changed source a" );
+    EXPECT_TRUE( manifest.findCacheFile( "TestManifestA.png", "bc7" ).empty() );
+
+    // Caching the new contents deletes the superseded cache file.
+    const std::string newCacheFile = addSource( manifest, "TestManifestA.png", "bc7" );
+    EXPECT_NE( cacheFile, newCacheFile );
+    EXPECT_EQ( manifest.getCachePath( newCacheFile ), manifest.findCacheFile( "TestManifestA.png", "bc7" ) );
+    EXPECT_FALSE( fileExists( manifest.getCachePath( cacheFile ) ) );
+
+    // A missing cache file makes the entry stale.
+    std::remove( manifest.getCachePath( newCacheFile ).c_str() );
+    EXPECT_TRUE( manifest.findCacheFile( "TestManifestA.png", "bc7" ).empty() );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, SourceChangedWhileHashingIsRejected )
+{
+    writeFile( "TestManifestA.png", "source a" );
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    unsigned long long             size = 0, hash = 0;
+    long long                      time = 0;
+    EXPECT_TRUE( CompressedTextureCacheManifest::getSourceStatus( "TestManifestA.png", size, time ) );
+    EXPECT_TRUE( CompressedTextureCacheManifest::hashFile( "TestManifestA.png", hash ) );
+
+    // The source changes before the entry is added, so the hash may not match its contents.
+    writeFile( "TestManifestA.png", "changed source a" );
+    const std::string cacheFile = CompressedTextureCacheManifest::getCacheFileName( hash, "bc7", ".dds" );
+    writeFile( manifest.getCachePath( cacheFile ), "DDS" );
+    EXPECT_FALSE( manifest.addEntry( "TestManifestA.png", size, time, hash, "bc7", cacheFile ) );
+    EXPECT_EQ( 0u, manifest.getNumEntries() );
+    EXPECT_TRUE( manifest.findCacheFile( "TestManifestA.png", "bc7" ).empty() );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, IdenticalSourcesShareCacheFile )
+{
+    writeFile( "TestManifestA.png", "same contents" );
+    writeFile( "TestManifestB.png", "same contents" );
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    const std::string              cacheFileA = addSource( manifest, "TestManifestA.png", "bc7" );
+    const std::string              cacheFileB = addSource( manifest, "TestManifestB.png", "bc7" );
+    EXPECT_EQ( cacheFileA, cacheFileB );
+
+    // The shared cache file is kept when one of the sources changes.
+    writeFile( "TestManifestA.png", "different contents" );
+    addSource( manifest, "TestManifestA.png", "bc7" );
+    EXPECT_EQ( manifest.getCachePath( cacheFileB ), manifest.findCacheFile( "TestManifestB.png", "bc7" ) );
+}
+
+TEST_F( TestCompressedTextureCacheManifest, ConcurrentBuilders )
+{
+    // Builders with their own manifests merge their entries into the shared manifest.
+    const int numThreads = 4;
+    const int numSources = 8;
+    for( int i = 0; i < numThreads * numSources; ++i )
+        writeFile( "TestManifest" + std::to_string( i ) + ".png", "source " + std::to_string( i ) );
+
+    std::vector<std::string> cacheFiles( numThreads * numSources );
+    std::vector<std::thread> threads;
+    for( int t = 0; t < numThreads; ++t )
+    {
+        threads.emplace_back( [this, t, &cacheFiles] {
+            CompressedTextureCacheManifest manifest( m_cacheFolder );
+            for( int i = t * numSources; i < ( t + 1 ) * numSources; ++i )
+            {
+                const std::string source = "TestManifest" + std::to_string( i ) + ".png";
+                unsigned long long size = 0, hash = 0;
+                long long          time = 0;
+                CompressedTextureCacheManifest::getSourceStatus( source, size, time );
+                CompressedTextureCacheManifest::hashFile( source, hash );
+                cacheFiles[i] = CompressedTextureCacheManifest::getCacheFileName( hash, "bc7", ".dds" );
+                manifest.addEntry( source, size, time, hash, "bc7", cacheFiles[i] );
+            }
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+
+    CompressedTextureCacheManifest manifest( m_cacheFolder );
+    EXPECT_EQ( static_cast<size_t>( numThreads * numSources ), manifest.getNumEntries() );
+    for( int i = 0; i < numThreads * numSources; ++i )
+    {
+        writeFile( manifest.getCachePath( cacheFiles[i] ), "DDS" );
+        EXPECT_EQ( manifest.getCachePath( cacheFiles[i] ), manifest.findCacheFile( "TestManifest" + std::to_string( i ) + ".png", "bc7" ) );
+    }
+}
@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace imageSource;
+
+namespace {
+
+const unsigned int TILE_WIDTH  = 8;
+const unsigned int TILE_HEIGHT = 8;
+const size_t       TILE_SIZE   = TILE_WIDTH * TILE_HEIGHT * 4;
+
+// An RGBA image (RGBA8 by default) whose tiles are filled with a value derived from their coordinates,
+// which counts its reads and can be made to read slowly, fail, or throw.
+class FakeImageSource : public ImageSourceBase
+{
+  public:
+    explicit FakeImageSource( CUarray_format format = CU_AD_FORMAT_UNSIGNED_INT8 )
+    {
+        m_info.width        = 64;
+        m_info.height       = 64;
+        m_info.format       = format;
+        m_info.numChannels  = 4;
+        m_info.numMipLevels = 7;
+        m_info.isValid      = true;
+        m_info.isTiled      = true;
+    }
+
+    void open( TextureInfo* info ) override
+    {
+        m_isOpen = true;
+        if( info != nullptr )
+            *info = m_info;
+    }
+    void               close() override { m_isOpen = false; }
+    bool               isOpen() const override { return m_isOpen; }
+    const TextureInfo& getInfo() const override { return m_info; }
+    CUmemorytype       getFillType() const override { return m_fillType; }
+
+    bool readTile( char* dest, unsigned int mipLevel, const Tile& tile, CUstream /*stream*/ ) override
+    {
+        if( !read() )
+            return false;
+        std::fill( dest, dest + getImageSizeInBytes( m_info, tile.width, tile.height ), static_cast<char>( mipLevel * 64 + tile.y * 8 + tile.x ) );
+        return true;
+    }
+
+    bool readMipLevel( char* dest, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream /*stream*/ ) override
+    {
+        if( !read() )
+            return false;
+        std::fill( dest, dest + getImageSizeInBytes( m_info, expectedWidth, expectedHeight ), static_cast<char>( mipLevel ) );
+        return true;
+    }
+
+    bool readBaseColor( float4& /*dest*/ ) override { return false; }
+
+    std::atomic<int>          m_numReads{};
+    std::atomic<int>          m_numFailures{};  // number of reads that return false
+    std::atomic<bool>         m_throw{};
+    std::chrono::milliseconds m_readDelay{};
+    CUmemorytype              m_fillType{ CU_MEMORYTYPE_HOST };
+
+  private:
+    TextureInfo m_info{};
+    bool        m_isOpen{};
+
+    bool read()
+    {
+        ++m_numReads;
+        std::this_thread::sleep_for( m_readDelay );
+        if( m_throw )
+            throw std::runtime_error( "read failed" );
+        return m_numFailures-- <= 0;
+    }
+};
+
+CUstream getStream( unsigned int consumer )
+{
+    return reinterpret_cast<CUstream>( static_cast<uintptr_t>( consumer + 1 ) );
+}
+
+class TestFanOutImageSource : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_fanOut = std::make_shared<FanOutImageSource>( m_image, 2 );
+        m_fanOut->open( nullptr );
+    }
+
+    void TearDown() override { FanOutImageSource::setMemoryBudget( FanOutImageSource::DEFAULT_MEMORY_BUDGET ); }
+
+    // Read a tile for the given consumer, which is identified by the (fake) stream it reads with.
+    bool readTile( std::vector<char>& dest, unsigned int x, unsigned int y, unsigned int consumer )
+    {
+        dest.assign( TILE_SIZE, 0 );
+        return m_fanOut->readTile( dest.data(), 1, Tile{ x, y, TILE_WIDTH, TILE_HEIGHT }, getStream( consumer ) );
+    }
+
+    std::shared_ptr<FakeImageSource>   m_image{ std::make_shared<FakeImageSource>() };
+    std::shared_ptr<FanOutImageSource> m_fanOut;
+};
+
+}  // namespace
+
+TEST_F( TestFanOutImageSource, SingleConsumerIsNotWrapped )
+{
+    EXPECT_EQ( m_image, createFanOutImageSource( m_image, 1 ) );
+    EXPECT_NE( m_image, createFanOutImageSource( m_image, 2 ) );
+}
+
+TEST_F( TestFanOutImageSource, TileIsReadOncePerConsumers )
+{
+    std::vector<char> first, second, third;
+
+    EXPECT_TRUE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 1, 2, 1 ) );
+    EXPECT_EQ( 1, m_image->m_numReads );
+    EXPECT_EQ( std::vector<char>( TILE_SIZE, 64 + 2 * 8 + 1 ), second );
+    EXPECT_EQ( first, second );
+
+    // Both consumers have copied the tile, so it is no longer resident.
+    EXPECT_TRUE( readTile( third, 1, 2, 0 ) );
+    EXPECT_EQ( 2, m_image->m_numReads );
+    EXPECT_EQ( first, third );
+}
+
+TEST_F( TestFanOutImageSource, RepeatedCopyDoesNotTakeAnotherConsumersShare )
+{
+    std::vector<char> first, second, third;
+
+    // A consumer that refills the same tile copies it again without reading it.
+    EXPECT_TRUE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 1, 2, 0 ) );
+    EXPECT_EQ( 1, m_image->m_numReads );
+    EXPECT_EQ( first, second );
+
+    // The other consumer's share is still resident.
+    EXPECT_TRUE( readTile( third, 1, 2, 1 ) );
+    EXPECT_EQ( 1, m_image->m_numReads );
+    EXPECT_EQ( first, third );
+    EXPECT_EQ( 0U, FanOutImageSource::getCacheStatistics().numResidentBytes );
+}
+
+TEST_F( TestFanOutImageSource, DifferentTilesAreReadSeparately )
+{
+    std::vector<char> first, second;
+
+    EXPECT_TRUE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 2, 1, 0 ) );
+
+    EXPECT_EQ( 2, m_image->m_numReads );
+    EXPECT_NE( first, second );
+}
+
+TEST_F( TestFanOutImageSource, ConcurrentReadsAreCoalesced )
+{
+    const unsigned int numConsumers = 4;
+    m_fanOut                        = std::make_shared<FanOutImageSource>( m_image, numConsumers );
+    m_image->m_readDelay            = std::chrono::milliseconds( 50 );
+    const FanOutImageCacheStatistics before{ FanOutImageSource::getCacheStatistics() };
+
+    std::vector<std::vector<char>> tiles( numConsumers );
+    std::vector<std::thread>       threads;
+    for( unsigned int i = 0; i < numConsumers; ++i )
+        threads.emplace_back( [this, &tiles, i] { readTile( tiles[i], 3, 4, i ); } );
+    for( std::thread& thread : threads )
+        thread.join();
+
+    const FanOutImageCacheStatistics after{ FanOutImageSource::getCacheStatistics() };
+    EXPECT_EQ( 1, m_image->m_numReads );
+    EXPECT_EQ( 1U, after.numReads - before.numReads );
+    EXPECT_EQ( numConsumers - 1, after.numSharedReads - before.numSharedReads );
+    for( const std::vector<char>& tile : tiles )
+        EXPECT_EQ( std::vector<char>( TILE_SIZE, 64 + 4 * 8 + 3 ), tile );
+}
+
+TEST_F( TestFanOutImageSource, FailedReadIsNotShared )
+{
+    std::vector<char> first, second;
+    m_image->m_numFailures = 1;
+
+    EXPECT_FALSE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 1, 2, 1 ) );
+
+    EXPECT_EQ( 2, m_image->m_numReads );
+}
+
+TEST_F( TestFanOutImageSource, ExceptionIsNotShared )
+{
+    std::vector<char> first, second;
+    m_image->m_throw = true;
+
+    EXPECT_THROW( readTile( first, 1, 2, 0 ), std::runtime_error );
+    m_image->m_throw = false;
+    EXPECT_TRUE( readTile( second, 1, 2, 1 ) );
+
+    EXPECT_EQ( 2, m_image->m_numReads );
+}
+
+TEST_F( TestFanOutImageSource, DeviceFillIsNotShared )
+{
+    std::vector<char> first, second;
+    m_image->m_fillType = CU_MEMORYTYPE_DEVICE;
+
+    EXPECT_TRUE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 1, 2, 1 ) );
+
+    EXPECT_EQ( 2, m_image->m_numReads );
+}
+
+TEST_F( TestFanOutImageSource, EvictedReadIsReadAgain )
+{
+    std::vector<char> first, second;
+    FanOutImageSource::setMemoryBudget( TILE_SIZE );
+
+    EXPECT_TRUE( readTile( first, 1, 2, 0 ) );
+    EXPECT_TRUE( readTile( second, 2, 2, 0 ) );
+    EXPECT_EQ( TILE_SIZE, FanOutImageSource::getCacheStatistics().numResidentBytes );
+    EXPECT_TRUE( readTile( first, 1, 2, 1 ) );
+    EXPECT_TRUE( readTile( second, 2, 2, 1 ) );
+
+    EXPECT_EQ( 4, m_image->m_numReads );
+}
+
+TEST_F( TestFanOutImageSource, CloseReleasesReads )
+{
+    std::vector<char> tile;
+
+    EXPECT_TRUE( readTile( tile, 1, 2, 0 ) );
+    EXPECT_EQ( TILE_SIZE, FanOutImageSource::getCacheStatistics().numResidentBytes );
+    m_fanOut->close();
+
+    EXPECT_EQ( 0U, FanOutImageSource::getCacheStatistics().numResidentBytes );
+}
+
+TEST_F( TestFanOutImageSource, MipTailIsReadOncePerConsumers )
+{
+    const std::vector<uint2> dims{ { 64, 64 }, { 32, 32 }, { 16, 16 }, { 8, 8 }, { 4, 4 }, { 2, 2 }, { 1, 1 } };
+    const size_t             mipTailSize = ( 8 * 8 + 4 * 4 + 2 * 2 + 1 ) * 4;
+    std::vector<char>        first( mipTailSize ), second( mipTailSize );
+
+    EXPECT_TRUE( m_fanOut->readMipTail( first.data(), 3, 7, dims.data(), getStream( 0 ) ) );
+    EXPECT_TRUE( m_fanOut->readMipTail( second.data(), 3, 7, dims.data(), getStream( 1 ) ) );
+
+    // ImageSourceBase reads the four levels of the mip tail once.
+    EXPECT_EQ( 4, m_image->m_numReads );
+    EXPECT_EQ( first, second );
+    EXPECT_EQ( 6, second.back() );
+}
+
+TEST_F( TestFanOutImageSource, BlockCompressedMipTailIsShared )
+{
+    // BC1 levels are sized in 8 byte blocks, so the 2x2 and 1x1 levels take a whole block each.
+    auto image  = std::make_shared<FakeImageSource>( CU_AD_FORMAT_BC1_UNORM );
+    auto fanOut = std::make_shared<FanOutImageSource>( image, 2 );
+    fanOut->open( nullptr );
+
+    const std::vector<uint2> dims{ { 64, 64 }, { 32, 32 }, { 16, 16 }, { 8, 8 }, { 4, 4 }, { 2, 2 }, { 1, 1 } };
+    const size_t             mipTailSize = ( 4 + 1 + 1 + 1 ) * 8;
+    std::vector<char>        first( mipTailSize ), second( mipTailSize );
+
+    EXPECT_TRUE( fanOut->readMipTail( first.data(), 3, 7, dims.data(), getStream( 0 ) ) );
+    EXPECT_TRUE( fanOut->readMipTail( second.data(), 3, 7, dims.data(), getStream( 1 ) ) );
+    EXPECT_EQ( 4, image->m_numReads );
+    EXPECT_EQ( first, second );
+    EXPECT_EQ( 5, second[mipTailSize - 9] );
+    EXPECT_EQ( 6, second.back() );
+
+    // Mip levels are sized the same way.
+    std::vector<char> level( 8, 0 );
+    EXPECT_TRUE( fanOut->readMipLevel( level.data(), 5, 2, 2, getStream( 0 ) ) );
+    EXPECT_TRUE( fanOut->readMipLevel( level.data(), 5, 2, 2, getStream( 1 ) ) );
+    EXPECT_EQ( 5, image->m_numReads );
+    EXPECT_EQ( std::vector<char>( 8, 5 ), level );
+}
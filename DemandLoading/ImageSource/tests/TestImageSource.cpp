@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -14,7 +14,12 @@
 #if OTK_USE_OIIO
 #include <OptiXToolkit/ImageSource/OIIOReader.h>
 #endif
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
 #include <OptiXToolkit/ImageSource/DDSImageReader.h>
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
+#include <OptiXToolkit/ImageSource/RateLimitedImageSource.h>
+#include <OptiXToolkit/ImageSource/TiledImageSource.h>
+#include <OptiXToolkit/ImageSource/WrappedImageSource.h>
 #include <OptiXToolkit/ShaderUtil/vec_printers.h>
 
 #include <gtest/gtest.h>
@@ -27,6 +32,8 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <fstream>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
@@ -405,6 +412,271 @@ TEST( TestDDSImageReader, OpenDoesNotDeadlock )
     EXPECT_FALSE( reader.isOpen() );
 }
 
+// Write a single-level BC1 DDS file with arbitrary block data.
+static void writeBC1File( const std::string& fileName, unsigned int width, unsigned int height )
+{
+    DDSFileHeader header{};
+    header.magicNumber            = DDS_MAGIC_NUMBER;
+    header.sizeCheck              = 124;
+    header.width                  = width;
+    header.height                 = height;
+    header.mipMapCount            = 1;
+    header.pixelFormat.sizeCheck  = 32;
+    const char fourCC[4]          = { 'D', 'X', 'T', '1' };
+    std::copy( fourCC, fourCC + 4, header.pixelFormat.fourCCcode );
+
+    std::vector<char> data( ( width / BC_BLOCK_WIDTH ) * ( height / BC_BLOCK_HEIGHT ) * 8 );
+    for( size_t i = 0; i < data.size(); ++i )
+        data[i] = static_cast<char>( ( i * 2654435761u ) >> 13 );
+
+    std::ofstream file( fileName, std::ios::binary );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    file.write( data.data(), data.size() );
+}
+
+TEST( TestDDSImageReader, ReadTilesMatchesReadTile )
+{
+    const std::string flatFile  = testing::TempDir() + "readTilesFlat.dds";
+    const std::string tiledFile = testing::TempDir() + "readTilesTiled.dds";
+    writeBC1File( flatFile, 2048, 512 );
+    DDSImageReader flatReader( flatFile, /*readBaseColor=*/false );
+    TextureInfo    info{};
+    flatReader.open( &info );
+    ASSERT_TRUE( info.isValid );
+    ASSERT_TRUE( flatReader.saveAsTiledFile( tiledFile.c_str() ) );
+
+    DDSImageReader tiledReader( tiledFile, /*readBaseColor=*/false );
+    tiledReader.open( &info );
+    ASSERT_TRUE( tiledReader.isFileTiled() );
+
+    // Tiles 1-3 of the first row and tile 0 of the second row are adjacent in the tiled file.
+    const unsigned int tileWidth  = tiledReader.getTileWidth();
+    const unsigned int tileHeight = tiledReader.getTileHeight();
+    const Tile         tiles[]    = { { 1, 0, tileWidth, tileHeight }, { 2, 0, tileWidth, tileHeight },
+                                      { 3, 0, tileWidth, tileHeight }, { 0, 1, tileWidth, tileHeight },
+                                      { 2, 1, tileWidth, tileHeight } };
+    const unsigned int numTiles   = sizeof( tiles ) / sizeof( tiles[0] );
+
+    for( DDSImageReader* reader : { &flatReader, &tiledReader } )
+    {
+        std::vector<char> batch( numTiles * TILE_SIZE_IN_BYTES );
+        ASSERT_TRUE( reader->readTiles( batch.data(), TILE_SIZE_IN_BYTES, 0, tiles, numTiles, CUstream{} ) );
+
+        std::vector<char> single( TILE_SIZE_IN_BYTES );
+        for( unsigned int i = 0; i < numTiles; ++i )
+        {
+            ASSERT_TRUE( reader->readTile( single.data(), 0, tiles[i], CUstream{} ) );
+            EXPECT_TRUE( std::equal( single.begin(), single.end(), batch.begin() + i * TILE_SIZE_IN_BYTES ) );
+        }
+    }
+    EXPECT_EQ( 2 * numTiles, tiledReader.getNumTilesRead() );
+}
+
+TEST( TestDDSImageReader, CreateImageSourceWithFileAccess )
+{
+    const std::string fileName = testing::TempDir() + "createMapped.dds";
+    writeBC1File( fileName, 1024, 256 );
+
+    std::vector<std::vector<char>> tiles;
+    for( DDSFileAccess fileAccess : { DDSFileAccess::POSITIONAL_READ, DDSFileAccess::MEMORY_MAP } )
+    {
+        ImageSourceOptions options;
+        options.ddsFileAccess = fileAccess;
+        std::shared_ptr<DDSImageReader> reader =
+            std::dynamic_pointer_cast<DDSImageReader>( createImageSource( fileName, "", options ) );
+        ASSERT_TRUE( reader );
+        EXPECT_EQ( fileAccess, reader->getFileAccess() );
+
+        TextureInfo info{};
+        reader->open( &info );
+        ASSERT_TRUE( info.isValid );
+        tiles.emplace_back( TILE_SIZE_IN_BYTES );
+        ASSERT_TRUE( reader->readTile( tiles.back().data(), 0, { 1, 0, reader->getTileWidth(), reader->getTileHeight() }, CUstream{} ) );
+    }
+    EXPECT_EQ( tiles[0], tiles[1] );
+}
+
+TEST( TestDDSImageReader, CreateImageSourceWithReadEngine )
+{
+    const std::string flatFile  = testing::TempDir() + "createEngineFlat.dds";
+    const std::string tiledFile = testing::TempDir() + "createEngineTiled.dds";
+    writeBC1File( flatFile, 2048, 512 );
+    {
+        DDSImageReader reader( flatFile, /*readBaseColor=*/false );
+        ASSERT_TRUE( reader.saveAsTiledFile( tiledFile.c_str() ) );
+    }
+
+    ImageSourceOptions options;
+    options.readEngine = createAsyncReadEngine( 8, AsyncReadEngineType::THREAD_POOL );
+    std::shared_ptr<DDSImageReader> reader = std::dynamic_pointer_cast<DDSImageReader>( createImageSource( tiledFile, "", options ) );
+    ASSERT_TRUE( reader );
+    EXPECT_EQ( options.readEngine, reader->getReadEngine() );
+
+    TextureInfo info{};
+    reader->open( &info );
+    ASSERT_TRUE( reader->isFileTiled() );
+    const unsigned int tileWidth  = reader->getTileWidth();
+    const unsigned int tileHeight = reader->getTileHeight();
+    const Tile         tiles[]    = { { 0, 0, tileWidth, tileHeight }, { 1, 0, tileWidth, tileHeight },
+                                      { 3, 0, tileWidth, tileHeight }, { 2, 1, tileWidth, tileHeight } };
+    const unsigned int numTiles   = sizeof( tiles ) / sizeof( tiles[0] );
+    std::vector<char>  batch( numTiles * TILE_SIZE_IN_BYTES );
+    ASSERT_TRUE( reader->readTiles( batch.data(), TILE_SIZE_IN_BYTES, 0, tiles, numTiles, CUstream{} ) );
+
+    std::vector<char> single( TILE_SIZE_IN_BYTES );
+    for( unsigned int i = 0; i < numTiles; ++i )
+    {
+        ASSERT_TRUE( reader->readTile( single.data(), 0, tiles[i], CUstream{} ) );
+        EXPECT_TRUE( std::equal( single.begin(), single.end(), batch.begin() + i * TILE_SIZE_IN_BYTES ) );
+    }
+}
+
+// Counts the batches of tiles read by a DDSImageReader.
+class BatchCountingDDSImageReader : public DDSImageReader
+{
+  public:
+    using DDSImageReader::DDSImageReader;
+
+    bool readTiles( char* dest, size_t tileStride, unsigned int mipLevel, const Tile* tiles, unsigned int numTiles, CUstream stream ) override
+    {
+        ++m_numBatches;
+        return DDSImageReader::readTiles( dest, tileStride, mipLevel, tiles, numTiles, stream );
+    }
+
+    unsigned int getNumBatches() const { return m_numBatches; }
+
+  private:
+    std::atomic<unsigned int> m_numBatches{};
+};
+
+TEST( TestDDSImageReader, WrappersForwardReadTiles )
+{
+    const std::string flatFile  = testing::TempDir() + "wrappedFlat.dds";
+    const std::string tiledFile = testing::TempDir() + "wrappedTiled.dds";
+    writeBC1File( flatFile, 2048, 512 );
+    {
+        DDSImageReader reader( flatFile, /*readBaseColor=*/false );
+        ASSERT_TRUE( reader.saveAsTiledFile( tiledFile.c_str() ) );
+    }
+
+    enum Wrapper
+    {
+        WRAPPED,
+        RATE_LIMITED,
+        TILED,
+        FAN_OUT,
+        NUM_WRAPPERS
+    };
+    for( int wrapper = WRAPPED; wrapper < NUM_WRAPPERS; ++wrapper )
+    {
+        auto reader = std::make_shared<BatchCountingDDSImageReader>( tiledFile, /*readBaseColor=*/false );
+        std::shared_ptr<ImageSource> image;
+        switch( wrapper )
+        {
+            case WRAPPED:
+                image = std::make_shared<WrappedImageSource>( reader );
+                break;
+            case RATE_LIMITED:
+                image = std::make_shared<RateLimitedImageSource>(
+                    reader, std::make_shared<std::atomic<RateLimitedImageSource::Microseconds>>( 60 * 1000 * 1000 ) );
+                break;
+            case TILED:
+                image = std::make_shared<TiledImageSource>( reader );
+                break;
+            case FAN_OUT:
+                image = std::make_shared<FanOutImageSource>( reader, 2 );
+                break;
+        }
+        TextureInfo info{};
+        image->open( &info );
+        ASSERT_TRUE( info.isValid );
+
+        const unsigned int tileWidth  = reader->getTileWidth();
+        const unsigned int tileHeight = reader->getTileHeight();
+        const Tile         tiles[]    = { { 0, 0, tileWidth, tileHeight }, { 1, 0, tileWidth, tileHeight },
+                                          { 2, 0, tileWidth, tileHeight }, { 3, 0, tileWidth, tileHeight } };
+        const unsigned int numTiles   = sizeof( tiles ) / sizeof( tiles[0] );
+        std::vector<char>  batch( numTiles * TILE_SIZE_IN_BYTES );
+        ASSERT_TRUE( image->readTiles( batch.data(), TILE_SIZE_IN_BYTES, 0, tiles, numTiles, CUstream{} ) );
+        EXPECT_EQ( 1U, reader->getNumBatches() ) << "wrapper " << wrapper;
+
+        std::vector<char> single( TILE_SIZE_IN_BYTES );
+        for( unsigned int i = 0; i < numTiles; ++i )
+        {
+            ASSERT_TRUE( reader->readTile( single.data(), 0, tiles[i], CUstream{} ) );
+            EXPECT_TRUE( std::equal( single.begin(), single.end(), batch.begin() + i * TILE_SIZE_IN_BYTES ) );
+        }
+
+        // The other consumer of a FanOutImageSource copies the shared tiles without reading them.
+        if( wrapper == FAN_OUT )
+        {
+            std::vector<char> shared( batch.size() );
+            ASSERT_TRUE( image->readTiles( shared.data(), TILE_SIZE_IN_BYTES, 0, tiles, numTiles, CUstream{} ) );
+            EXPECT_EQ( 1U, reader->getNumBatches() );
+            EXPECT_EQ( batch, shared );
+        }
+    }
+}
+
+// Reads use positional file access, so concurrent readers of one open file must return the same
+// tiles as serial reads, for both flat and tiled files in both access modes.
+TEST( TestDDSImageReader, ConcurrentReadsMatchSerialReads )
+{
+    const std::string flatFile  = testing::TempDir() + "concurrentFlat.dds";
+    const std::string tiledFile = testing::TempDir() + "concurrentTiled.dds";
+    writeBC1File( flatFile, 2048, 512 );
+    {
+        DDSImageReader reader( flatFile, /*readBaseColor=*/false );
+        ASSERT_TRUE( reader.saveAsTiledFile( tiledFile.c_str() ) );
+    }
+
+    for( DDSFileAccess fileAccess : { DDSFileAccess::POSITIONAL_READ, DDSFileAccess::MEMORY_MAP } )
+    {
+        for( const std::string& fileName : { flatFile, tiledFile } )
+        {
+            DDSImageReader reader( fileName, /*readBaseColor=*/false, fileAccess );
+            TextureInfo    info{};
+            reader.open( &info );
+            ASSERT_TRUE( info.isValid );
+
+            const unsigned int tileWidth  = reader.getTileWidth();
+            const unsigned int tileHeight = reader.getTileHeight();
+            const unsigned int numTilesX  = info.width / tileWidth;
+            const unsigned int numTiles   = numTilesX * ( info.height / tileHeight );
+
+            std::vector<char> expected( numTiles * TILE_SIZE_IN_BYTES );
+            for( unsigned int i = 0; i < numTiles; ++i )
+            {
+                const Tile tile{ i % numTilesX, i / numTilesX, tileWidth, tileHeight };
+                ASSERT_TRUE( reader.readTile( &expected[i * TILE_SIZE_IN_BYTES], 0, tile, CUstream{} ) );
+            }
+
+            const unsigned int        numThreads    = 8;
+            const unsigned int        numIterations = 16;
+            std::vector<char>         actual( numThreads * TILE_SIZE_IN_BYTES );
+            std::atomic<unsigned int> numMismatches{ 0 };
+            std::vector<std::thread>  threads;
+            for( unsigned int t = 0; t < numThreads; ++t )
+            {
+                threads.emplace_back( [&, t] {
+                    char* dest = &actual[t * TILE_SIZE_IN_BYTES];
+                    for( unsigned int iter = 0; iter < numIterations; ++iter )
+                    {
+                        const unsigned int i = ( t + iter ) % numTiles;
+                        const Tile         tile{ i % numTilesX, i / numTilesX, tileWidth, tileHeight };
+                        if( !reader.readTile( dest, 0, tile, CUstream{} )
+                            || !std::equal( dest, dest + TILE_SIZE_IN_BYTES, &expected[i * TILE_SIZE_IN_BYTES] ) )
+                            ++numMismatches;
+                    }
+                } );
+            }
+            for( std::thread& thread : threads )
+                thread.join();
+            EXPECT_EQ( 0U, numMismatches.load() );
+        }
+    }
+}
+
 #ifdef OPTIX_SAMPLE_USE_CORE_EXR
 
 // CoreEXRReader decodes tiles lock-free, so verify that concurrent reads of one open reader are
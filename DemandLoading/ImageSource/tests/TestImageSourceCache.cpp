@@ -1,15 +1,24 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include "Config.h"
 #include "ImageSourceTestConfig.h"
 
+#include <OptiXToolkit/ImageSource/DDSImageReader.h>
 #include <OptiXToolkit/ImageSource/ImageSourceCache.h>
+#include <OptiXToolkit/ImageSource/TextureInfo.h>
 #include <OptiXToolkit/ImageSource/TiledImageSource.h>
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace imageSource;
 
 class TestImageSourceCache : public testing::Test
@@ -58,3 +67,157 @@ TEST_F( TestImageSourceCache, setAdaptedReturnsAdapted )
     EXPECT_EQ( adapted, image );
 }
 #endif
+
+TEST_F( TestImageSourceCache, concurrentGetReturnsSameInstance )
+{
+    const unsigned int                        numThreads = 8;
+    std::vector<std::shared_ptr<ImageSource>> images( numThreads );
+    std::vector<std::thread>                  threads;
+    for( unsigned int i = 0; i < numThreads; ++i )
+        threads.emplace_back( [this, &images, i] { images[i] = m_cache.get( "checkerboard" ); } );
+    for( std::thread& thread : threads )
+        thread.join();
+
+    for( const std::shared_ptr<ImageSource>& image : images )
+        EXPECT_EQ( images[0], image );
+    EXPECT_EQ( 1U, m_cache.getStatistics().numImageSources );
+}
+
+namespace {
+
+const unsigned int DDS_WIDTH           = 64;
+const size_t       DDS_MIP_LEVEL_BYTES = DDS_WIDTH / BC_BLOCK_WIDTH * DDS_WIDTH / BC_BLOCK_HEIGHT * 8;
+const unsigned int NUM_DDS_FILES       = 3;
+
+// Write a flat BC1 file with a single mip level, whose blocks depend on the seed.
+void writeFlatDDS( const std::string& fileName, int seed )
+{
+    DDSFileHeader header{};
+    header.magicNumber           = DDS_MAGIC_NUMBER;
+    header.sizeCheck             = 124;
+    header.width                 = DDS_WIDTH;
+    header.height                = DDS_WIDTH;
+    header.mipMapCount           = 1;
+    header.pixelFormat.sizeCheck = 32;
+    memcpy( header.pixelFormat.fourCCcode, "DXT1", 4 );
+
+    std::vector<char> blocks( DDS_MIP_LEVEL_BYTES );
+    for( size_t i = 0; i < blocks.size(); ++i )
+        blocks[i] = static_cast<char>( i * 13 + seed );
+    std::ofstream file( fileName, std::ios::binary );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    file.write( blocks.data(), blocks.size() );
+}
+
+class TestImageSourceCacheOpenLimit : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        for( unsigned int i = 0; i < NUM_DDS_FILES; ++i )
+        {
+            m_paths.push_back( "TestImageSourceCache" + std::to_string( i ) + ".dds" );
+            writeFlatDDS( m_paths.back(), i );
+        }
+    }
+
+    void TearDown() override
+    {
+        for( const std::string& path : m_paths )
+            std::remove( path.c_str() );
+    }
+
+    // Read the first tile of the given image.
+    std::vector<char> readTile( ImageSource& image )
+    {
+        std::vector<char> tile( TILE_SIZE_IN_BYTES );
+        EXPECT_TRUE( image.readTile( tile.data(), 0, Tile{ 0, 0, image.getTileWidth(), image.getTileHeight() }, CUstream{} ) );
+        return tile;
+    }
+
+    ImageSourceCache         m_cache{ 2 };
+    std::vector<std::string> m_paths;
+};
+
+}  // namespace
+
+TEST_F( TestImageSourceCacheOpenLimit, leastRecentlyUsedImageIsClosed )
+{
+    std::vector<std::shared_ptr<ImageSource>> images;
+    std::vector<std::vector<char>>            tiles;
+    for( const std::string& path : m_paths )
+    {
+        images.push_back( m_cache.get( path ) );
+        TextureInfo info{};
+        images.back()->open( &info );
+        EXPECT_TRUE( info.isValid );
+        tiles.push_back( readTile( *images.back() ) );
+    }
+    CacheStatistics stats = m_cache.getStatistics();
+    EXPECT_EQ( NUM_DDS_FILES, stats.numImageSources );
+    EXPECT_EQ( 2U, stats.numOpenImageSources );
+    EXPECT_EQ( 1U, stats.numClosed );
+    EXPECT_EQ( 0U, stats.numReopened );
+
+    // The closed image remains logically open, and is reopened by the next read.
+    EXPECT_TRUE( images[0]->isOpen() );
+    EXPECT_TRUE( images[0]->getInfo().isValid );
+    EXPECT_EQ( tiles[0], readTile( *images[0] ) );
+    stats = m_cache.getStatistics();
+    EXPECT_EQ( 2U, stats.numOpenImageSources );
+    EXPECT_EQ( 2U, stats.numClosed );
+    EXPECT_EQ( 1U, stats.numReopened );
+    EXPECT_NE( tiles[0], tiles[1] );
+}
+
+TEST_F( TestImageSourceCacheOpenLimit, closedImageReleasesMemory )
+{
+    std::shared_ptr<ImageSource> image0 = m_cache.get( m_paths[0] );
+    std::shared_ptr<ImageSource> image1 = m_cache.get( m_paths[1] );
+    readTile( *image0 );
+    readTile( *image1 );
+    EXPECT_EQ( 2 * DDS_MIP_LEVEL_BYTES, m_cache.getStatistics().hostMemoryUsage );
+
+    m_cache.setMaxOpenImageSources( 1 );
+
+    const CacheStatistics stats = m_cache.getStatistics();
+    EXPECT_EQ( 1U, m_cache.getMaxOpenImageSources() );
+    EXPECT_EQ( 1U, stats.numOpenImageSources );
+    EXPECT_EQ( DDS_MIP_LEVEL_BYTES, stats.hostMemoryUsage );
+}
+
+TEST_F( TestImageSourceCacheOpenLimit, concurrentReads )
+{
+    std::vector<std::shared_ptr<ImageSource>> images;
+    for( const std::string& path : m_paths )
+        images.push_back( m_cache.get( path ) );
+
+    // The tile size of a DDS image depends on its format, so it is known only once an image is open.
+    images[0]->open( nullptr );
+    const Tile                     tile{ 0, 0, images[0]->getTileWidth(), images[0]->getTileHeight() };
+    std::vector<std::vector<char>> expected;
+    for( const std::shared_ptr<ImageSource>& image : images )
+    {
+        expected.emplace_back( TILE_SIZE_IN_BYTES );
+        EXPECT_TRUE( image->readTile( expected.back().data(), 0, tile, CUstream{} ) );
+    }
+
+    const unsigned int       numThreads = 4;
+    std::vector<std::thread> threads;
+    for( unsigned int t = 0; t < numThreads; ++t )
+    {
+        threads.emplace_back( [&, t] {
+            std::vector<char> dest( TILE_SIZE_IN_BYTES );
+            for( unsigned int i = 0; i < 100; ++i )
+            {
+                const unsigned int index = ( i + t ) % NUM_DDS_FILES;
+                EXPECT_TRUE( images[index]->readTile( dest.data(), 0, tile, CUstream{} ) );
+                EXPECT_EQ( expected[index], dest );
+            }
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+
+    EXPECT_LE( m_cache.getStatistics().numOpenImageSources, 2U );
+}
@@ -9,9 +9,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cuda_fp16.h>
 #include <vector_functions.h>
 
 #include <algorithm>
+#include <functional>
 
 using namespace testing;
 using namespace imageSource;
@@ -279,6 +281,137 @@ TEST_F( TestMipMapImageSource, tracksTileReadCount )
 
 namespace {
 
+// Fill a base mip level with the given pixel values.
+template <typename T>
+std::function<void( char*, unsigned int, unsigned int, unsigned int, CUstream )> fillWith( const std::vector<T>& values )
+{
+    return [values]( char* dest, unsigned int, unsigned int, unsigned int, CUstream ) {
+        std::copy_n( reinterpret_cast<const char*>( values.data() ), values.size() * sizeof( T ), dest );
+    };
+}
+
+}  // namespace
+
+TEST_F( TestMipMapImageSource, boxFilterAveragesTwoByTwoBlocks )
+{
+    m_baseInfo.width       = 4;
+    m_baseInfo.height      = 4;
+    m_baseInfo.numChannels = 1;
+    // clang-format off
+    const std::vector<unsigned char> level0{
+        0,   10,  100, 200,
+        20,  30,  50,  50,
+        255, 255, 1,   2,
+        255, 255, 3,   4 };
+    // clang-format on
+    ExpectationSet open{ expectOpen() };
+    EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, 4, 4, m_stream ) ).After( open ).WillOnce( DoAll( fillWith( level0 ), Return( true ) ) );
+    MipFilterOptions options;
+    options.filter = MipFilterType::BOX;
+    m_mipMapImage  = std::make_shared<MipMapImageSource>( m_baseImage, options );
+    m_mipMapImage->open( nullptr );
+
+    std::vector<unsigned char> level1( 4 );
+    ASSERT_TRUE( m_mipMapImage->readMipLevel( reinterpret_cast<char*>( level1.data() ), 1, 2, 2, m_stream ) );
+    std::vector<unsigned char> level2( 1 );
+    ASSERT_TRUE( m_mipMapImage->readMipLevel( reinterpret_cast<char*>( level2.data() ), 2, 1, 1, m_stream ) );
+
+    EXPECT_EQ( ( std::vector<unsigned char>{ 15, 100, 255, 3 } ), level1 );
+    EXPECT_EQ( 93, level2[0] );
+}
+
+TEST_F( TestMipMapImageSource, filtersPreserveConstantImages )
+{
+    m_baseInfo.width       = 64;
+    m_baseInfo.height      = 32;
+    m_baseInfo.format      = CU_AD_FORMAT_FLOAT;
+    m_baseInfo.numChannels = 2;
+    const std::vector<float> level0( 64 * 32 * 2, 0.75f );
+    for( MipFilterType filter : { MipFilterType::BOX, MipFilterType::TENT, MipFilterType::KAISER } )
+    {
+        m_baseImage = std::make_shared<otk::testing::MockImageSource>();
+        ExpectationSet open{ expectOpen() };
+        EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, 64, 32, m_stream ) ).After( open ).WillOnce( DoAll( fillWith( level0 ), Return( true ) ) );
+        MipFilterOptions options;
+        options.filter = filter;
+        m_mipMapImage  = std::make_shared<MipMapImageSource>( m_baseImage, options );
+        m_mipMapImage->open( nullptr );
+
+        std::vector<float> level2( 16 * 8 * 2 );
+        ASSERT_TRUE( m_mipMapImage->readMipLevel( reinterpret_cast<char*>( level2.data() ), 2, 16, 8, m_stream ) );
+
+        for( float value : level2 )
+            EXPECT_NEAR( 0.75f, value, 1.0e-5f );
+    }
+}
+
+TEST_F( TestMipMapImageSource, srgbColorChannelsAreFilteredInLinearSpace )
+{
+    m_baseInfo.width       = 2;
+    m_baseInfo.height      = 2;
+    m_baseInfo.numChannels = 4;
+    // Black and white pixels; alpha alternates between 0 and 255.
+    const std::vector<unsigned char> level0{ 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255 };
+    ExpectationSet open{ expectOpen() };
+    EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, 2, 2, m_stream ) ).After( open ).WillOnce( DoAll( fillWith( level0 ), Return( true ) ) );
+    MipFilterOptions options;
+    options.filter = MipFilterType::BOX;
+    options.sRGB   = true;
+    m_mipMapImage  = std::make_shared<MipMapImageSource>( m_baseImage, options );
+    m_mipMapImage->open( nullptr );
+
+    std::vector<unsigned char> level1( 4 );
+    ASSERT_TRUE( m_mipMapImage->readMipLevel( reinterpret_cast<char*>( level1.data() ), 1, 1, 1, m_stream ) );
+
+    // Linear 0.5 is 188 in sRGB, whereas alpha is averaged linearly.
+    EXPECT_EQ( ( std::vector<unsigned char>{ 188, 188, 188, 128 } ), level1 );
+}
+
+TEST_F( TestMipMapImageSource, parallelBandsMatchSerialFiltering )
+{
+    m_baseInfo.width       = 512;
+    m_baseInfo.height      = 512;
+    m_baseInfo.format      = CU_AD_FORMAT_HALF;
+    m_baseInfo.numChannels = 3;
+    std::vector<half> level0( 512 * 512 * 4 );  // three channels are stored as four
+    for( size_t i = 0; i < level0.size(); ++i )
+        level0[i] = __float2half( static_cast<float>( ( i * 7919 ) % 1021 ) / 1021.0f );
+
+    std::vector<std::vector<char>> results;
+    for( unsigned int maxThreads : { 1U, 8U } )
+    {
+        m_baseImage = std::make_shared<otk::testing::MockImageSource>();
+        ExpectationSet open{ expectOpen() };
+        EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, 512, 512, m_stream ) ).After( open ).WillOnce( DoAll( fillWith( level0 ), Return( true ) ) );
+        MipFilterOptions options;
+        options.maxThreads = maxThreads;
+        m_mipMapImage      = std::make_shared<MipMapImageSource>( m_baseImage, options );
+        m_mipMapImage->open( nullptr );
+
+        results.emplace_back( 256 * 256 * 4 * sizeof( half ) );
+        ASSERT_TRUE( m_mipMapImage->readMipLevel( results.back().data(), 1, 256, 256, m_stream ) );
+    }
+
+    EXPECT_EQ( results[0], results[1] );
+}
+
+TEST( TestMipFilterOptions, onlyEightBitImagesAreAssumedToBeSrgb )
+{
+    TextureInfo info{};
+    info.format = CU_AD_FORMAT_UNSIGNED_INT8;
+    EXPECT_TRUE( getMipFilterOptions( info ).sRGB );
+    for( CUarray_format format : { CU_AD_FORMAT_UNSIGNED_INT16, CU_AD_FORMAT_HALF, CU_AD_FORMAT_FLOAT } )
+    {
+        info.format = format;
+        EXPECT_FALSE( getMipFilterOptions( info ).sRGB );
+    }
+
+    // Mip levels are filtered on the calling thread by default.
+    EXPECT_EQ( 1U, getMipFilterOptions( info ).maxThreads );
+}
+
+namespace {
+
 class TestMipMapImageSourcePassThrough : public TestMipMapImageSource
 {
   public:
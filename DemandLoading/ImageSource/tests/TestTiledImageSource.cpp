@@ -370,6 +370,55 @@ TEST_F( TestTiledImageSource, tracksTileReadCount )
     EXPECT_EQ( 2ULL, m_tiledImage->getNumTilesRead() );
 }
 
+TEST_F( TestTiledImageSource, residentMipLevelIsNotDecodedAgain )
+{
+    ExpectationSet open{ expectOpen() };
+    create();
+    EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, m_baseInfo.width, m_baseInfo.height, _ ) ).WillOnce( Return( true ) );
+    m_tiledImage->open( nullptr );
+    const imageSource::Tile tile{ 0, 0, 64, 64 };
+    std::vector<char>       dest( tile.width * tile.height * 4 );
+    const TiledImageCacheStatistics before = TiledImageSource::getCacheStatistics();
+
+    m_tiledImage->readTile( dest.data(), 0, tile, m_stream );
+    m_tiledImage->readTile( dest.data(), 0, tile, m_stream );
+
+    const TiledImageCacheStatistics after = TiledImageSource::getCacheStatistics();
+    EXPECT_EQ( 1ULL, after.numMisses - before.numMisses );
+    EXPECT_EQ( 1ULL, after.numHits - before.numHits );
+}
+
+TEST_F( TestTiledImageSource, leastRecentlyUsedMipLevelIsEvictedOverBudget )
+{
+    m_baseInfo.numMipLevels = 2;
+    ExpectationSet open{ expectOpen() };
+    create();
+    const unsigned int width  = m_baseInfo.width;
+    const unsigned int height = m_baseInfo.height;
+    EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 0, width, height, _ ) ).Times( 2 ).WillRepeatedly( Return( true ) );
+    EXPECT_CALL( *m_baseImage, readMipLevel( NotNull(), 1, width / 2, height / 2, _ ) ).WillOnce( Return( true ) );
+    m_tiledImage->open( nullptr );
+    const imageSource::Tile tile{ 0, 0, 64, 64 };
+    std::vector<char>       dest( tile.width * tile.height * 4 );
+    const size_t            oldBudget = TiledImageSource::getMemoryBudget();
+    const size_t            levelSize = static_cast<size_t>( width ) * height * getPixelSizeInBytes();
+    TiledImageSource::setMemoryBudget( levelSize );
+    const TiledImageCacheStatistics before = TiledImageSource::getCacheStatistics();
+
+    m_tiledImage->readTile( dest.data(), 0, tile, m_stream );
+    m_tiledImage->readTile( dest.data(), 1, tile, m_stream );  // evicts level 0
+    m_tiledImage->readTile( dest.data(), 1, tile, m_stream );
+    m_tiledImage->readTile( dest.data(), 0, tile, m_stream );  // evicts level 1
+
+    const TiledImageCacheStatistics after = TiledImageSource::getCacheStatistics();
+    TiledImageSource::setMemoryBudget( oldBudget );
+    EXPECT_EQ( 3ULL, after.numMisses - before.numMisses );
+    EXPECT_EQ( 1ULL, after.numHits - before.numHits );
+    EXPECT_EQ( 2ULL, after.numEvictions - before.numEvictions );
+    EXPECT_EQ( levelSize + levelSize / 4, after.numEvictedBytes - before.numEvictedBytes );
+    EXPECT_EQ( levelSize, after.numResidentBytes );
+}
+
 namespace {
 
 class TestTiledImageSourcePassThrough : public TestTiledImageSource
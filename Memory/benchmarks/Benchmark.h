@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/Memory/HeapSuballocator.h>
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+#include <OptiXToolkit/Memory/TlsfSuballocator.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+// A small host-only benchmark harness for the Memory library.  Benchmarks replay synthetic
+// allocation traces against suballocators and memory pools, timing each operation.
+namespace memoryBenchmarks {
+
+typedef std::chrono::steady_clock Clock;
+
+/// Options shared by all of the benchmarks.
+struct BenchmarkOptions
+{
+    unsigned int numOperations = 1000000;  // operations per trace (divided between the threads in pool benchmarks)
+    unsigned int maxThreads    = 64;       // maximum number of threads for pool benchmarks
+};
+
+/// Records the duration of individual operations, and reports the mean and percentiles.
+class LatencyRecorder
+{
+  public:
+    void reserve( size_t n ) { m_samples.reserve( n ); }
+    void record( Clock::duration d ) { m_samples.push_back( static_cast<float>( std::chrono::duration<double, std::nano>( d ).count() ) ); }
+    void append( const LatencyRecorder& other ) { m_samples.insert( m_samples.end(), other.m_samples.begin(), other.m_samples.end() ); }
+    size_t count() const { return m_samples.size(); }
+
+    /// Total recorded time in seconds.
+    double totalSeconds() const
+    {
+        double total = 0.0;
+        for( float s : m_samples )
+            total += s;
+        return total * 1e-9;
+    }
+
+    /// Mean latency in nanoseconds.
+    double mean() const { return m_samples.empty() ? 0.0 : totalSeconds() * 1e9 / m_samples.size(); }
+
+    /// Latency percentile (0-100) in nanoseconds.
+    double percentile( double p )
+    {
+        if( m_samples.empty() )
+            return 0.0;
+        const size_t idx = std::min( m_samples.size() - 1, static_cast<size_t>( p / 100.0 * m_samples.size() ) );
+        std::nth_element( m_samples.begin(), m_samples.begin() + idx, m_samples.end() );
+        return m_samples[idx];
+    }
+
+  private:
+    std::vector<float> m_samples;
+};
+
+/// External fragmentation of a suballocator: one minus the ratio of the largest free block to
+/// the free space.  Returns a negative value for suballocators where it is not meaningful.
+inline double fragmentation( otk::HeapSuballocator& suballocator )
+{
+    uint64_t largest = 0;
+    for( const auto& block : suballocator.getBeginMap() )
+        largest = std::max( largest, block.second );
+    const double freeSpace = static_cast<double>( suballocator.freeSpace() );
+    return freeSpace > 0.0 ? 1.0 - largest / freeSpace : 0.0;
+}
+
+inline double fragmentation( otk::TlsfSuballocator& suballocator )
+{
+    const double freeSpace = static_cast<double>( suballocator.freeSpace() );
+    return freeSpace > 0.0 ? 1.0 - suballocator.largestFreeBlock() / freeSpace : 0.0;
+}
+
+template <typename Suballocator>
+double fragmentation( Suballocator& )
+{
+    return -1.0;
+}
+
+/// One operation in an allocation trace.
+struct TraceOp
+{
+    enum Kind
+    {
+        ALLOC,        // allocate size bytes with the given alignment
+        FREE_RANDOM,  // free a live block chosen by choice % numLiveBlocks
+        FREE_OLDEST   // free the oldest live block
+    };
+    Kind     kind;
+    uint64_t size;
+    uint64_t alignment;
+    uint32_t choice;
+};
+
+/// A synthetic allocation trace, modeling one of the memory pools used by demand loading.
+struct Trace
+{
+    std::string          name;
+    std::vector<TraceOp> ops;
+    uint64_t             capacity;   // memory available to the trace
+    uint64_t             arenaSize;  // size of the arenas (pool allocation granularity)
+};
+
+/// Texture tile churn: fill the tile pool, then evict random tiles and load new ones.  Most
+/// requests are single 64 KB tiles, with occasional multi-tile blocks for mip tails.
+Trace makeTileChurnTrace( unsigned int seed, unsigned int numOps, uint64_t capacity );
+
+/// Transfer buffers: staging buffers for tiles and mip tails, freed in order once the copy
+/// has finished, with a bounded number in flight.
+Trace makeRingTransferTrace( unsigned int seed, unsigned int numOps, uint64_t capacity );
+
+/// Sampler blocks: many small fixed-size blocks, allocated in bursts when textures are created
+/// and freed rarely when textures are destroyed.
+Trace makeSamplerTrace( unsigned int seed, unsigned int numOps, uint64_t capacity );
+
+/// Size of the blocks in the sampler trace.
+const uint64_t SAMPLER_BLOCK_SIZE = 256;
+
+/// Result of replaying a trace.
+struct ReplayResult
+{
+    LatencyRecorder     allocLatency;
+    LatencyRecorder     freeLatency;
+    uint64_t            numFailures = 0;
+    std::vector<double> fragmentation;  // sampled at regular intervals through the trace
+};
+
+/// Replay a trace, calling allocFn( size, alignment ) -> MemoryBlockDesc and freeFn( block ) for
+/// each operation, and sampleFn() -> fragmentation numSamples times during the trace.  A failed
+/// allocation is counted, and the trace continues.
+template <typename AllocFn, typename FreeFn, typename SampleFn>
+void replayTrace( const Trace& trace, AllocFn allocFn, FreeFn freeFn, SampleFn sampleFn, unsigned int numSamples, ReplayResult& result )
+{
+    std::deque<otk::MemoryBlockDesc> live;
+    result.allocLatency.reserve( trace.ops.size() );
+    result.freeLatency.reserve( trace.ops.size() );
+    const size_t sampleInterval = std::max( static_cast<size_t>( 1 ), trace.ops.size() / std::max( numSamples, 1u ) );
+
+    for( size_t i = 0; i < trace.ops.size(); ++i )
+    {
+        const TraceOp& op = trace.ops[i];
+        if( op.kind == TraceOp::ALLOC )
+        {
+            const Clock::time_point start = Clock::now();
+            otk::MemoryBlockDesc    block = allocFn( op.size, op.alignment );
+            result.allocLatency.record( Clock::now() - start );
+            if( block.isGood() )
+                live.push_back( block );
+            else
+                ++result.numFailures;
+        }
+        else if( !live.empty() )
+        {
+            otk::MemoryBlockDesc block;
+            if( op.kind == TraceOp::FREE_OLDEST )
+            {
+                block = live.front();
+                live.pop_front();
+            }
+            else
+            {
+                const size_t idx = op.choice % live.size();
+                block            = live[idx];
+                live[idx]        = live.back();
+                live.pop_back();
+            }
+            const Clock::time_point start = Clock::now();
+            freeFn( block );
+            result.freeLatency.record( Clock::now() - start );
+        }
+
+        if( ( i + 1 ) % sampleInterval == 0 && result.fragmentation.size() < numSamples )
+            result.fragmentation.push_back( sampleFn() );
+    }
+
+    for( const otk::MemoryBlockDesc& block : live )
+        freeFn( block );
+}
+
+/// Randomized alloc/free stress test comparing HeapSuballocator and TlsfSuballocator.
+void runSuballocatorStress( const BenchmarkOptions& options );
+
+/// Replay the tile, transfer buffer, and sampler traces against each applicable suballocator.
+void runTraceBenchmarks( const BenchmarkOptions& options );
+
+/// Measure MemoryPool contention, replaying traces on 1 to maxThreads threads sharing a pool.
+void runMemoryPoolBenchmarks( const BenchmarkOptions& options );
+
+}  // namespace memoryBenchmarks
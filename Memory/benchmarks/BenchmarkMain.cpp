@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only benchmarks for the Memory suballocators and MemoryPool.
+//
+// Usage: MemoryBenchmarks [--ops N] [--threads N] [stress] [traces] [pool]
+//
+// With no benchmark names, all of the benchmarks are run.
+//   stress    Randomized alloc/free stress test of HeapSuballocator vs. TlsfSuballocator.
+//   traces    Tile churn, ring transfer buffer, and sampler block traces for each suballocator.
+//   pool      Multi-threaded MemoryPool and ShardedMemoryPool contention with the HostAllocator.
+
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace memoryBenchmarks;
+
+namespace {
+
+void printUsage( const char* program )
+{
+    printf( "Usage: %s [--ops N] [--threads N] [stress] [traces] [pool]\n", program );
+}
+
+}  // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    BenchmarkOptions options;
+    bool             runStress = false;
+    bool             runTraces = false;
+    bool             runPool   = false;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        const char* arg = argv[i];
+        if( strcmp( arg, "--ops" ) == 0 && i + 1 < argc )
+            options.numOperations = static_cast<unsigned int>( atoi( argv[++i] ) );
+        else if( strcmp( arg, "--threads" ) == 0 && i + 1 < argc )
+            options.maxThreads = static_cast<unsigned int>( atoi( argv[++i] ) );
+        else if( strcmp( arg, "stress" ) == 0 )
+            runStress = true;
+        else if( strcmp( arg, "traces" ) == 0 )
+            runTraces = true;
+        else if( strcmp( arg, "pool" ) == 0 )
+            runPool = true;
+        else
+        {
+            printUsage( argv[0] );
+            return 1;
+        }
+    }
+    if( !runStress && !runTraces && !runPool )
+        runStress = runTraces = runPool = true;
+
+    if( runStress )
+        runSuballocatorStress( options );
+    if( runTraces )
+        runTraceBenchmarks( options );
+    if( runPool )
+        runMemoryPoolBenchmarks( options );
+    return 0;
+}
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// MemoryPool contention benchmark.  A number of threads share a MemoryPool (or ShardedMemoryPool)
+// backed by the HostAllocator, and each thread replays its own allocation trace against it.
+// Reports the aggregate operation rate, and alloc/free latency percentiles, for 1 to maxThreads
+// threads.  Pools that use the HostAllocator do not require a CUDA context, so this benchmark runs
+// without a GPU.
+
+#include "Benchmark.h"
+
+#include <OptiXToolkit/Memory/Allocators.h>
+#include <OptiXToolkit/Memory/FixedSuballocator.h>
+#include <OptiXToolkit/Memory/MemoryPool.h>
+#include <OptiXToolkit/Memory/RingSuballocator.h>
+#include <OptiXToolkit/Memory/ShardedMemoryPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace otk;
+
+namespace memoryBenchmarks {
+
+namespace {
+
+typedef Trace ( *TraceMaker )( unsigned int seed, unsigned int numOps, uint64_t capacity );
+
+// Wraps a MemoryPool so that it can be constructed like a ShardedMemoryPool.
+template <typename Suballocator>
+class SinglePool : public MemoryPool<HostAllocator, Suballocator>
+{
+  public:
+    SinglePool( const Suballocator& prototype, uint64_t granularity, uint64_t maxSize )
+        : MemoryPool<HostAllocator, Suballocator>( new HostAllocator(), new Suballocator( prototype ), granularity, maxSize, /*headroom=*/0 )
+    {
+    }
+};
+
+template <typename Suballocator>
+class ShardedPool : public ShardedMemoryPool<HostAllocator, Suballocator>
+{
+  public:
+    ShardedPool( const Suballocator& prototype, uint64_t granularity, uint64_t maxSize )
+        : ShardedMemoryPool<HostAllocator, Suballocator>( 0, prototype, granularity, maxSize, /*headroom=*/0 )
+    {
+    }
+};
+
+template <typename Pool, typename Suballocator>
+void runPoolTrace( const char*             name,
+                   const Suballocator&     prototype,
+                   TraceMaker              makeTrace,
+                   uint64_t                capacity,
+                   const BenchmarkOptions& options )
+{
+    printf( "\n%s\n", name );
+    printf( "%8s | %12s %10s %10s %10s %10s %9s\n", "threads", "ops/sec", "alloc p50", "alloc p99", "free p50",
+            "free p99", "failures" );
+
+    for( unsigned int numThreads = 1; numThreads <= options.maxThreads; numThreads *= 2 )
+    {
+        // The capacity and operations are divided between the threads, so the total work is the
+        // same for each thread count.
+        std::vector<Trace> traces;
+        for( unsigned int t = 0; t < numThreads; ++t )
+            traces.push_back( makeTrace( t + 1, options.numOperations / numThreads, capacity / numThreads ) );
+
+        Pool pool( prototype, traces[0].arenaSize, capacity / 4 * 5 );
+
+        std::vector<ReplayResult> results( numThreads );
+        std::vector<std::thread>  threads;
+        std::atomic<unsigned int> numReady( 0 );
+        std::atomic<bool>         go( false );
+        for( unsigned int t = 0; t < numThreads; ++t )
+        {
+            threads.emplace_back( [&, t]() {
+                ++numReady;
+                while( !go.load() )
+                    std::this_thread::yield();
+                replayTrace(
+                    traces[t], [&pool]( uint64_t size, uint64_t alignment ) { return pool.alloc( size, alignment ); },
+                    [&pool]( const MemoryBlockDesc& block ) { pool.free( block ); }, []() { return -1.0; }, 0, results[t] );
+            } );
+        }
+        while( numReady.load() < numThreads )
+            std::this_thread::yield();
+
+        const Clock::time_point start = Clock::now();
+        go.store( true );
+        for( std::thread& thread : threads )
+            thread.join();
+        const double seconds = std::chrono::duration<double>( Clock::now() - start ).count();
+
+        ReplayResult total;
+        size_t       numOps = 0;
+        for( const ReplayResult& result : results )
+        {
+            total.allocLatency.append( result.allocLatency );
+            total.freeLatency.append( result.freeLatency );
+            total.numFailures += result.numFailures;
+        }
+        for( const Trace& trace : traces )
+            numOps += trace.ops.size();
+
+        printf( "%8u | %12.0f %10.1f %10.1f %10.1f %10.1f %9llu\n", numThreads, numOps / seconds,
+                total.allocLatency.percentile( 50.0 ), total.allocLatency.percentile( 99.0 ),
+                total.freeLatency.percentile( 50.0 ), total.freeLatency.percentile( 99.0 ),
+                static_cast<unsigned long long>( total.numFailures ) );
+    }
+}
+
+}  // anonymous namespace
+
+void runMemoryPoolBenchmarks( const BenchmarkOptions& options )
+{
+    printf( "\n=== MemoryPool and ShardedMemoryPool<HostAllocator, ...> contention (latencies in ns) ===\n" );
+    runPoolTrace<SinglePool<HeapSuballocator>>( "tile churn, MemoryPool, HeapSuballocator", HeapSuballocator(),
+                                                makeTileChurnTrace, 512ull << 20, options );
+    runPoolTrace<SinglePool<TlsfSuballocator>>( "tile churn, MemoryPool, TlsfSuballocator", TlsfSuballocator(),
+                                                makeTileChurnTrace, 512ull << 20, options );
+    runPoolTrace<ShardedPool<TlsfSuballocator>>( "tile churn, ShardedMemoryPool, TlsfSuballocator", TlsfSuballocator(),
+                                                 makeTileChurnTrace, 512ull << 20, options );
+    runPoolTrace<SinglePool<RingSuballocator>>( "ring transfer buffers, MemoryPool, RingSuballocator",
+                                                RingSuballocator( 8 * 1024 * 1024 ), makeRingTransferTrace, 64ull << 20, options );
+    runPoolTrace<ShardedPool<RingSuballocator>>( "ring transfer buffers, ShardedMemoryPool, RingSuballocator",
+                                                 RingSuballocator( 8 * 1024 * 1024 ), makeRingTransferTrace, 64ull << 20, options );
+    runPoolTrace<SinglePool<FixedSuballocator>>( "sampler blocks, MemoryPool, FixedSuballocator",
+                                                 FixedSuballocator( SAMPLER_BLOCK_SIZE, 64 ), makeSamplerTrace, 16ull << 20, options );
+    runPoolTrace<ShardedPool<FixedSuballocator>>( "sampler blocks, ShardedMemoryPool, FixedSuballocator",
+                                                  FixedSuballocator( SAMPLER_BLOCK_SIZE, 64 ), makeSamplerTrace, 16ull << 20, options );
+}
+
+}  // namespace memoryBenchmarks
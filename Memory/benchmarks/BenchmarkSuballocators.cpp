@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Randomized stress benchmark comparing the HeapSuballocator with the TlsfSuballocator.  The
+// suballocators track a number of disjoint arenas (as a MemoryPool would), are filled to a target
+// occupancy, and then churn through random frees and allocations of mixed sizes and alignments.
+// The benchmark reports the average alloc and free times, the number of failed allocations, and
+// the fragmentation of the free space (one minus the ratio of the largest free block to the total
+// free space) at the end.
+
+#include "Benchmark.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace otk;
+
+namespace memoryBenchmarks {
+
+namespace {
+
+const uint64_t ARENA_SIZE = 2 * 1024 * 1024;
+const double   OCCUPANCY  = 0.75;
+
+struct Request
+{
+    uint64_t size;
+    uint64_t alignment;
+};
+
+struct Result
+{
+    double   allocNanoseconds;  // average time per alloc
+    double   freeNanoseconds;   // average time per free
+    uint64_t numFailures;
+    double   fragmentation;
+};
+
+// Make a random request. A quarter of the requests are texture tiles, and the rest have
+// log-uniform sizes from 64 bytes to 256 KB with power of two alignments up to 256 bytes.
+Request makeRequest( std::mt19937& rng )
+{
+    if( rng() % 4 == 0 )
+        return Request{TILE_SIZE_IN_BYTES, TILE_SIZE_IN_BYTES};
+
+    std::uniform_real_distribution<double> logSize( std::log2( 64.0 ), std::log2( 256.0 * 1024.0 ) );
+    const uint64_t                         size = static_cast<uint64_t>( std::exp2( logSize( rng ) ) );
+    return Request{size, 1ull << ( rng() % 9 )};
+}
+
+template <typename Suballocator>
+Result runBenchmark( unsigned int numOperations, unsigned int numArenas )
+{
+    Suballocator suballocator;
+    for( unsigned int i = 0; i < numArenas; ++i )
+        suballocator.track( i * 2 * ARENA_SIZE, ARENA_SIZE );
+
+    std::mt19937                 rng( 1 );
+    std::vector<MemoryBlockDesc> blocks;
+    const uint64_t               targetSize    = static_cast<uint64_t>( OCCUPANCY * suballocator.trackedSize() );
+    uint64_t                     allocatedSize = 0;
+
+    // Fill to the target occupancy
+    while( allocatedSize < targetSize )
+    {
+        const Request   request = makeRequest( rng );
+        MemoryBlockDesc block   = suballocator.alloc( request.size, request.alignment );
+        if( block.isBad() )
+            break;
+        allocatedSize += block.size;
+        blocks.push_back( block );
+    }
+
+    // Churn: free random blocks while above the target occupancy, otherwise allocate.
+    Clock::duration allocTime   = Clock::duration::zero();
+    Clock::duration freeTime    = Clock::duration::zero();
+    uint64_t        numAllocs   = 0;
+    uint64_t        numFrees    = 0;
+    uint64_t        numFailures = 0;
+    for( unsigned int op = 0; op < numOperations; ++op )
+    {
+        if( allocatedSize >= targetSize && !blocks.empty() )
+        {
+            const size_t    idx   = rng() % blocks.size();
+            MemoryBlockDesc block = blocks[idx];
+            blocks[idx]           = blocks.back();
+            blocks.pop_back();
+
+            const Clock::time_point start = Clock::now();
+            suballocator.free( block );
+            freeTime += Clock::now() - start;
+            allocatedSize -= block.size;
+            ++numFrees;
+        }
+        else
+        {
+            const Request request = makeRequest( rng );
+
+            const Clock::time_point start = Clock::now();
+            MemoryBlockDesc         block = suballocator.alloc( request.size, request.alignment );
+            allocTime += Clock::now() - start;
+            ++numAllocs;
+
+            if( block.isBad() )
+            {
+                // Free a block so that the churn continues
+                ++numFailures;
+                allocatedSize = targetSize;
+                continue;
+            }
+            allocatedSize += block.size;
+            blocks.push_back( block );
+        }
+    }
+
+    Result result;
+    result.allocNanoseconds = numAllocs ? std::chrono::duration<double, std::nano>( allocTime ).count() / numAllocs : 0.0;
+    result.freeNanoseconds  = numFrees ? std::chrono::duration<double, std::nano>( freeTime ).count() / numFrees : 0.0;
+    result.numFailures      = numFailures;
+    result.fragmentation    = fragmentation( suballocator );
+    return result;
+}
+
+void printResult( const char* name, const Result& result )
+{
+    printf( "%-18s | %12.1f %12.1f %10llu %14.3f\n", name, result.allocNanoseconds, result.freeNanoseconds,
+            static_cast<unsigned long long>( result.numFailures ), result.fragmentation );
+}
+
+}  // anonymous namespace
+
+void runSuballocatorStress( const BenchmarkOptions& options )
+{
+    printf( "\n=== Suballocator stress: %u operations, %.0f%% occupancy (latencies in ns) ===\n", options.numOperations,
+            OCCUPANCY * 100.0 );
+    for( unsigned int numArenas = 8; numArenas <= 512; numArenas *= 4 )
+    {
+        printf( "\n%u arenas of %llu MB\n", numArenas, static_cast<unsigned long long>( ARENA_SIZE >> 20 ) );
+        printf( "%-18s | %12s %12s %10s %14s\n", "suballocator", "alloc (ns)", "free (ns)", "failures", "fragmentation" );
+        printResult( "HeapSuballocator", runBenchmark<HeapSuballocator>( options.numOperations, numArenas ) );
+        printResult( "TlsfSuballocator", runBenchmark<TlsfSuballocator>( options.numOperations, numArenas ) );
+    }
+}
+
+}  // namespace memoryBenchmarks
@@ -0,0 +1,210 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Trace generators, and replay of the traces against each applicable suballocator.  Reports the
+// allocation rate, free latency percentiles, failed allocations, and fragmentation over time.
+
+#include "Benchmark.h"
+
+#include <OptiXToolkit/Memory/BinnedSuballocator.h>
+#include <OptiXToolkit/Memory/FixedSuballocator.h>
+#include <OptiXToolkit/Memory/RingSuballocator.h>
+
+#include <cstdio>
+#include <deque>
+#include <random>
+
+using namespace otk;
+
+namespace memoryBenchmarks {
+
+namespace {
+
+const unsigned int NUM_FRAGMENTATION_SAMPLES = 5;
+const uint64_t     ARENA_BASE                = 1ull << 40;  // arbitrary base address for arenas
+
+// Track the trace capacity as disjoint arenas, as a MemoryPool would.
+template <typename Suballocator>
+void trackArenas( Suballocator& suballocator, const Trace& trace )
+{
+    for( uint64_t i = 0; i < trace.capacity / trace.arenaSize; ++i )
+        suballocator.track( ARENA_BASE + i * 2 * trace.arenaSize, trace.arenaSize );
+}
+
+void printHeader( const Trace& trace )
+{
+    printf( "\n%s: %zu ops, %llu MB in %llu KB arenas\n", trace.name.c_str(), trace.ops.size(),
+            static_cast<unsigned long long>( trace.capacity >> 20 ), static_cast<unsigned long long>( trace.arenaSize >> 10 ) );
+    printf( "%-20s | %12s %10s %10s %10s %9s | %s\n", "suballocator", "allocs/sec", "free mean", "free p50",
+            "free p99", "failures", "fragmentation over time" );
+}
+
+template <typename Suballocator>
+void runTrace( const char* name, Suballocator& suballocator, const Trace& trace )
+{
+    trackArenas( suballocator, trace );
+
+    ReplayResult result;
+    replayTrace(
+        trace, [&suballocator]( uint64_t size, uint64_t alignment ) { return suballocator.alloc( size, alignment ); },
+        [&suballocator]( const MemoryBlockDesc& block ) { suballocator.free( block ); },
+        [&suballocator]() { return fragmentation( suballocator ); }, NUM_FRAGMENTATION_SAMPLES, result );
+
+    const double allocSeconds = result.allocLatency.totalSeconds();
+    printf( "%-20s | %12.0f %10.1f %10.1f %10.1f %9llu |", name, allocSeconds > 0.0 ? result.allocLatency.count() / allocSeconds : 0.0,
+            result.freeLatency.mean(), result.freeLatency.percentile( 50.0 ), result.freeLatency.percentile( 99.0 ),
+            static_cast<unsigned long long>( result.numFailures ) );
+    for( double f : result.fragmentation )
+    {
+        if( f < 0.0 )
+            printf( "      -" );
+        else
+            printf( " %6.3f", f );
+    }
+    printf( "\n" );
+}
+
+}  // anonymous namespace
+
+Trace makeTileChurnTrace( unsigned int seed, unsigned int numOps, uint64_t capacity )
+{
+    Trace trace;
+    trace.name      = "tile churn";
+    trace.capacity  = capacity;
+    trace.arenaSize = 2 * 1024 * 1024;
+    trace.ops.reserve( numOps );
+
+    std::mt19937          rng( seed );
+    std::vector<uint64_t> live;
+    uint64_t              allocated = 0;
+    const uint64_t        target    = capacity / 10 * 9;
+    for( unsigned int i = 0; i < numOps; ++i )
+    {
+        if( allocated < target || live.empty() )
+        {
+            const uint64_t numTiles = ( rng() % 10 == 0 ) ? 2 + rng() % 7 : 1;
+            const uint64_t size     = numTiles * TILE_SIZE_IN_BYTES;
+            trace.ops.push_back( TraceOp{TraceOp::ALLOC, size, TILE_SIZE_IN_BYTES, 0} );
+            live.push_back( size );
+            allocated += size;
+        }
+        else
+        {
+            const uint32_t choice = static_cast<uint32_t>( rng() );
+            const size_t   idx    = choice % live.size();
+            trace.ops.push_back( TraceOp{TraceOp::FREE_RANDOM, 0, 0, choice} );
+            allocated -= live[idx];
+            live[idx] = live.back();
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+Trace makeRingTransferTrace( unsigned int seed, unsigned int numOps, uint64_t capacity )
+{
+    Trace trace;
+    trace.name      = "ring transfer buffers";
+    trace.capacity  = capacity;
+    trace.arenaSize = 8 * 1024 * 1024;
+    trace.ops.reserve( numOps );
+
+    const unsigned int maxInFlight = 128;
+    const uint64_t     maxBytes    = capacity / 4 * 3;
+
+    std::mt19937         rng( seed );
+    std::deque<uint64_t> inFlight;
+    uint64_t             inFlightBytes = 0;
+    for( unsigned int i = 0; i < numOps; ++i )
+    {
+        // Mostly single tiles, with some mip tails and small whole mip levels.
+        const uint64_t size = ( rng() % 8 == 0 ) ? ( 2 + rng() % 15 ) * TILE_SIZE_IN_BYTES : TILE_SIZE_IN_BYTES;
+        if( !inFlight.empty() && ( inFlight.size() >= maxInFlight || inFlightBytes + size > maxBytes ) )
+        {
+            trace.ops.push_back( TraceOp{TraceOp::FREE_OLDEST, 0, 0, 0} );
+            inFlightBytes -= inFlight.front();
+            inFlight.pop_front();
+        }
+        else
+        {
+            trace.ops.push_back( TraceOp{TraceOp::ALLOC, size, 256, 0} );
+            inFlight.push_back( size );
+            inFlightBytes += size;
+        }
+    }
+    return trace;
+}
+
+Trace makeSamplerTrace( unsigned int seed, unsigned int numOps, uint64_t capacity )
+{
+    Trace trace;
+    trace.name      = "sampler blocks";
+    trace.capacity  = capacity;
+    trace.arenaSize = 1024 * 1024;
+    trace.ops.reserve( numOps );
+
+    std::mt19937   rng( seed );
+    uint64_t       numLive = 0;
+    const uint64_t target  = capacity / SAMPLER_BLOCK_SIZE / 5 * 4;
+    while( trace.ops.size() < numOps )
+    {
+        // Textures are created in bursts (e.g. when a scene is loaded), and destroyed in bursts.
+        const bool         create    = numLive == 0 || ( numLive < target && rng() % 4 != 0 );
+        const unsigned int burstSize = 1 + rng() % 32;
+        for( unsigned int i = 0; i < burstSize && trace.ops.size() < numOps; ++i )
+        {
+            if( create )
+            {
+                trace.ops.push_back( TraceOp{TraceOp::ALLOC, SAMPLER_BLOCK_SIZE, 64, 0} );
+                ++numLive;
+            }
+            else if( numLive > 0 )
+            {
+                trace.ops.push_back( TraceOp{TraceOp::FREE_RANDOM, 0, 0, static_cast<uint32_t>( rng() )} );
+                --numLive;
+            }
+        }
+    }
+    return trace;
+}
+
+void runTraceBenchmarks( const BenchmarkOptions& options )
+{
+    printf( "\n=== Suballocator traces (latencies in ns) ===\n" );
+
+    const Trace tiles = makeTileChurnTrace( 1, options.numOperations, 512ull << 20 );
+    printHeader( tiles );
+    {
+        HeapSuballocator heap;
+        runTrace( "HeapSuballocator", heap, tiles );
+        TlsfSuballocator tlsf;
+        runTrace( "TlsfSuballocator", tlsf, tiles );
+    }
+
+    const Trace transfers = makeRingTransferTrace( 2, options.numOperations, 64ull << 20 );
+    printHeader( transfers );
+    {
+        RingSuballocator ring( transfers.arenaSize );
+        runTrace( "RingSuballocator", ring, transfers );
+        HeapSuballocator heap;
+        runTrace( "HeapSuballocator", heap, transfers );
+        TlsfSuballocator tlsf;
+        runTrace( "TlsfSuballocator", tlsf, transfers );
+    }
+
+    const Trace samplers = makeSamplerTrace( 3, options.numOperations, 16ull << 20 );
+    printHeader( samplers );
+    {
+        FixedSuballocator fixed( SAMPLER_BLOCK_SIZE, 64 );
+        runTrace( "FixedSuballocator", fixed, samplers );
+        BinnedSuballocator binned( std::vector<uint64_t>{SAMPLER_BLOCK_SIZE}, std::vector<uint64_t>{256} );
+        runTrace( "BinnedSuballocator", binned, samplers );
+        HeapSuballocator heap;
+        runTrace( "HeapSuballocator", heap, samplers );
+        TlsfSuballocator tlsf;
+        runTrace( "TlsfSuballocator", tlsf, samplers );
+    }
+}
+
+}  // namespace memoryBenchmarks
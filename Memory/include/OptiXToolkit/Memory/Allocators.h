@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 namespace otk {
 
@@ -26,6 +27,18 @@ class HostAllocator
     bool allocationIsHandle() const { return false; }
 };
 
+/// Whether an allocator requires a current CUDA context.  HostAllocator does not, so memory pools
+/// that use it can run without a GPU.
+template <class Allocator>
+struct AllocatorRequiresContext : std::true_type
+{
+};
+
+template <>
+struct AllocatorRequiresContext<HostAllocator> : std::false_type
+{
+};
+
 /// Pinned host allocator using cuMallocHost
 class PinnedAllocator
 {
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -12,6 +12,7 @@
 #include <cuda.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -23,6 +24,7 @@
 #define NullAllocator HostAllocator
 #define NullSuballocator HeapSuballocator
 const uint64_t DEFAULT_HEADROOM = 128ULL << 20;
+const unsigned int HEADROOM_CHECK_INTERVAL_MS = 10;
 
 namespace otk {
 
@@ -43,8 +45,12 @@ class MemoryPool
         , m_maxSize( maxSize ? maxSize : std::numeric_limits<uint64_t>::max() )
         , m_headroom( headroom )
     {
-        OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
-        OTK_ASSERT( m_context != nullptr );
+        // Pools of host memory from malloc don't need a CUDA context (e.g. in host-only benchmarks).
+        if( AllocatorRequiresContext<Allocator>::value )
+        {
+            OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
+            OTK_ASSERT( m_context != nullptr );
+        }
     }
 
     /// Constructor for when the suballocator has a default constructor
@@ -52,8 +58,6 @@ class MemoryPool
                 uint64_t maxSize = 0, uint64_t headroom = DEFAULT_HEADROOM )
         : MemoryPool( allocator, new SubAllocator(), allocationGranularity, maxSize, headroom )
     {
-        OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
-        OTK_ASSERT( m_context != nullptr );
     }
 
     /// Constructor for when the allocator has a default constructor
@@ -61,8 +65,6 @@ class MemoryPool
                 uint64_t maxSize = 0, uint64_t headroom = DEFAULT_HEADROOM )
         : MemoryPool( new Allocator(), suballocator, allocationGranularity, maxSize, headroom )
     {
-        OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
-        OTK_ASSERT( m_context != nullptr );
     }
 
     /// Constructor for when both the allocator and suballocator have default constructors
@@ -70,16 +72,12 @@ class MemoryPool
                 uint64_t maxSize = 0, uint64_t headroom = DEFAULT_HEADROOM )
         : MemoryPool( new Allocator(), new SubAllocator(), allocationGranularity, maxSize, headroom )
     {
-        OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
-        OTK_ASSERT( m_context != nullptr );
     }
 
     /// Move constructor
     MemoryPool( MemoryPool&& p )
         : MemoryPool( p.m_allocator, p.m_suballocator, p.m_allocationGranularity, p.m_maxSize, p.m_headroom )
     {
-        OTK_ERROR_CHECK( cuCtxGetCurrent( &m_context ) );
-        OTK_ASSERT( m_context != nullptr );
         p.m_allocator    = nullptr;
         p.m_suballocator = nullptr;
     }
@@ -87,7 +85,8 @@ class MemoryPool
     /// Destructor
     ~MemoryPool()
     {
-        OTK_ERROR_CHECK_NOTHROW( cuCtxPushCurrent( m_context ) );
+        if( m_context )
+            OTK_ERROR_CHECK_NOTHROW( cuCtxPushCurrent( m_context ) );
 
         std::unique_lock<std::mutex> lock( m_mutex );
 
@@ -110,8 +109,11 @@ class MemoryPool
         {
         }
 
-        CUcontext ignored;
-        OTK_ERROR_CHECK_NOTHROW( cuCtxPopCurrent( &ignored ) );
+        if( m_context )
+        {
+            CUcontext ignored;
+            OTK_ERROR_CHECK_NOTHROW( cuCtxPopCurrent( &ignored ) );
+        }
     }
 
     /// Tell the memory pool to track an address range, bypassing the allocator, which may be null
@@ -120,7 +122,7 @@ class MemoryPool
     /// Allocate a memory block with (at least) the given size and alignment. Returns BAD_ADDR on failure.
     MemoryBlockDesc alloc( uint64_t size = 0, uint64_t alignment = 1, CUstream stream = 0 )
     {
-        OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+        checkStreamContext( stream );
 
         std::unique_lock<std::mutex> lock( m_mutex );
         freeStagedBlocks( false );
@@ -136,13 +138,8 @@ class MemoryPool
         if( ( block.isBad() ) && ( trackedSize() < m_maxSize ) && m_allocator )
         {
             // Make sure there is enough headroom (allocatable space) still on the card
-            if( m_headroom > 0 )
-            {
-                size_t freeMem, totalMem;
-                OTK_ERROR_CHECK( cuMemGetInfo( &freeMem, &totalMem ) );
-                if( freeMem < m_headroom )
-                    return block;
-            }
+            if( m_headroom > 0 && AllocatorRequiresContext<Allocator>::value && !hasHeadroom() )
+                return block;
 
             // Allocate enough memory for the current request at m_allocationGranularity increments.
             size_t allocSize = m_allocationGranularity * ( ( size + m_allocationGranularity - 1 ) / m_allocationGranularity );
@@ -150,6 +147,7 @@ class MemoryPool
             if( !ptr )
                 return block;
             m_allocations.push_back( PtrSize{ptr, allocSize} );
+            m_cachedFreeMem -= std::min( m_cachedFreeMem, static_cast<uint64_t>( allocSize ) );
 
             if( m_allocator->allocationIsHandle() )
             {
@@ -218,7 +216,7 @@ class MemoryPool
     /// Free block immediately on the specified stream.
     void free( const MemoryBlockDesc& block, CUstream stream = 0 )
     {
-        OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+        checkStreamContext( stream );
 
         std::unique_lock<std::mutex> lock( m_mutex );
         if( m_suballocator )
@@ -255,7 +253,7 @@ class MemoryPool
     /// Free block asynchronously, after operations currently in the stream have finished
     void freeAsync( const MemoryBlockDesc& block, CUstream stream )
     {
-        OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+        checkStreamContext( stream );
 
         CUcontext context;
         OTK_ERROR_CHECK( cuCtxGetCurrent( &context ) );
@@ -319,6 +317,21 @@ class MemoryPool
     /// Also indicates that largest block that the pool can allocate.
     uint64_t allocationGranularity() const { return m_allocationGranularity; }
 
+    /// Return the address ranges of the allocations backing the pool, as memory blocks.  For allocators
+    /// that return handles, these are ranges in the artificial address space given to the suballocator.
+    std::vector<MemoryBlockDesc> getAllocationRanges() const
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        std::vector<MemoryBlockDesc> ranges;
+        for( uint64_t idx = 0; idx < m_allocations.size(); ++idx )
+        {
+            const uint64_t ptr = ( m_allocator && m_allocator->allocationIsHandle() ) ? getArenaStartAddress( idx ) :
+                                                                                      reinterpret_cast<uint64_t>( m_allocations[idx].ptr );
+            ranges.push_back( MemoryBlockDesc{ptr, m_allocations[idx].size, 0} );
+        }
+        return ranges;
+    }
+
     /// Set the max size (maximum size that the pool will allocate)
     void setMaxSize( uint64_t maxSize, bool releaseAllocations, CUstream stream = 0 ) 
     {
@@ -332,7 +345,7 @@ class MemoryPool
     /// Reduce the size of the pool by about rsize, releasing the memory to the OS
     void releaseMemory( uint64_t rsize, CUstream stream = 0 )
     {
-        OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+        checkStreamContext( stream );
         std::unique_lock<std::mutex> lock( m_mutex );
         freeStagedBlocks( true );
 
@@ -360,6 +373,7 @@ class MemoryPool
             numAllocationsToRelease--;
             idx--;
         }
+        m_headroomCheckTime = std::chrono::steady_clock::time_point();
     }
 
   private:
@@ -379,17 +393,46 @@ class MemoryPool
         uint64_t size;
     };
 
-    CUcontext            m_context;
+    CUcontext            m_context = nullptr;  // null if the allocator does not require a context
     Allocator*           m_allocator;
     SubAllocator*        m_suballocator;
     std::vector<PtrSize> m_allocations;
     uint64_t             m_allocationGranularity;
     uint64_t             m_maxSize;
-    uint64_t             m_headroom; // Leave at least this much memory unallocated
+    uint64_t             m_headroom; // Device memory to leave unallocated (not checked for HostAllocator)
     mutable std::mutex   m_mutex;
 
     std::deque<StagedBlock> m_stagedBlocks;
 
+    // Free device memory reported by the last headroom check, less the memory allocated since then.
+    uint64_t                              m_cachedFreeMem = 0;
+    std::chrono::steady_clock::time_point m_headroomCheckTime;
+
+    // Check that the current context matches the stream's, if the allocator requires a context.
+    void checkStreamContext( CUstream stream ) const
+    {
+        if( AllocatorRequiresContext<Allocator>::value )
+        {
+            OTK_ASSERT_CONTEXT_MATCHES_STREAM( stream );
+        }
+    }
+
+    // Check whether there is enough headroom on the device to allocate more memory.  cuMemGetInfo is
+    // slow, so the free memory is only queried every HEADROOM_CHECK_INTERVAL_MS milliseconds.
+    bool hasHeadroom()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if( m_headroomCheckTime == std::chrono::steady_clock::time_point()
+            || now - m_headroomCheckTime >= std::chrono::milliseconds( HEADROOM_CHECK_INTERVAL_MS ) )
+        {
+            size_t freeMem, totalMem;
+            OTK_ERROR_CHECK( cuMemGetInfo( &freeMem, &totalMem ) );
+            m_cachedFreeMem     = freeMem;
+            m_headroomCheckTime = now;
+        }
+        return m_cachedFreeMem >= m_headroom;
+    }
+
     // Free blocks with events that have finished
     inline void freeStagedBlocks( bool waitOnEvents )
     {
@@ -422,10 +465,10 @@ class MemoryPool
     }
 
     // Get the spacing between arenas for handle-based allocations
-    uint64_t getArenaSpacing() { return 2 * m_allocationGranularity; }
+    uint64_t getArenaSpacing() const { return 2 * m_allocationGranularity; }
 
     // Get the start of an arena in an artificial linear memory space for a handle
-    uint64_t getArenaStartAddress( uint64_t arenaId ) { return arenaId * getArenaSpacing(); }
+    uint64_t getArenaStartAddress( uint64_t arenaId ) const { return arenaId * getArenaSpacing(); }
 
     // Get the arena id for a given memory block when allocations are handles (such as textures)
     uint64_t getArenaId( const MemoryBlockDesc& block ) { return block.ptr / getArenaSpacing(); }
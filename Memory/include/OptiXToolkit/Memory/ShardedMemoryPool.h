@@ -0,0 +1,348 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/Error/ErrorCheck.h>
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+#include <OptiXToolkit/Memory/MemoryPool.h>
+
+#include <cuda.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace otk {
+
+// ShardedMemoryPool is a thread-safe memory pool for heavily multi-threaded use. It splits the
+// pool into a number of shards, each of which is a MemoryPool with its own allocator, suballocator,
+// and mutex, so threads allocating concurrently do not serialize on a single lock.
+//
+// Each thread allocates from a home shard, chosen by hashing its thread id, and falls back to the
+// other shards if its home shard is full. A block is always freed to the shard that owns it (which
+// may not be the freeing thread's home shard). Ownership is found from a sorted table of the
+// shards' allocations, which is read without locking, and rebuilt only when a shard allocates or
+// releases memory.
+//
+// The maximum size of the pool is divided evenly between the shards. The number of shards is
+// limited so that each shard can hold at least one allocation of allocationGranularity bytes.
+//
+// ShardedMemoryPool has the same alloc/free interface as MemoryPool, but requires both an allocator
+// and a suballocator, and does not support allocators that return handles (TextureTileAllocator),
+// since their blocks are not distinct addresses.
+//
+// Like MemoryPool, a ShardedMemoryPool that uses the HostAllocator does not require a CUDA context,
+// and can be used from threads that have never made one current.
+//
+template <class Allocator, class SubAllocator>
+class ShardedMemoryPool
+{
+  public:
+    /// Constructor. Each shard gets a new Allocator and a copy of the given suballocator. If numShards
+    /// is zero, one shard per hardware thread is used.
+    ShardedMemoryPool( unsigned int        numShards             = 0,
+                       const SubAllocator& suballocator          = SubAllocator(),
+                       uint64_t            allocationGranularity = DEFAULT_ALLOC_SIZE,
+                       uint64_t            maxSize               = 0,
+                       uint64_t            headroom              = DEFAULT_HEADROOM )
+        : m_allocationGranularity( allocationGranularity )
+        , m_maxSize( maxSize ? maxSize : std::numeric_limits<uint64_t>::max() )
+    {
+        if( numShards == 0 )
+            numShards = std::max( 1u, std::thread::hardware_concurrency() );
+        if( maxSize != 0 )
+            numShards = static_cast<unsigned int>( std::max<uint64_t>( 1, std::min<uint64_t>( numShards, maxSize / allocationGranularity ) ) );
+
+        const uint64_t shardMaxSize = maxSize ? maxSize / numShards : 0;
+        for( unsigned int i = 0; i < numShards; ++i )
+        {
+            m_shards.emplace_back( new Shard( new Allocator(), new SubAllocator( suballocator ), allocationGranularity,
+                                              shardMaxSize, headroom ) );
+        }
+        m_readers.reset( new ReaderCount[numShards] );
+        m_ownerTable.store( new OwnerTable );
+    }
+
+    /// Destructor
+    ~ShardedMemoryPool() { delete m_ownerTable.load(); }
+
+    /// Allocate a memory block with (at least) the given size and alignment. Returns BAD_ADDR on failure.
+    MemoryBlockDesc alloc( uint64_t size = 0, uint64_t alignment = 1, CUstream stream = 0 )
+    {
+        const unsigned int home = homeShard();
+        for( unsigned int i = 0; i < numShards(); ++i )
+        {
+            const unsigned int shard = ( home + i ) % numShards();
+            MemoryBlockDesc    block = m_shards[shard]->alloc( size, alignment, stream );
+            if( block.isGood() )
+            {
+                addressAllocated( block.ptr, shard );
+                return block;
+            }
+        }
+        return MemoryBlockDesc{BAD_ADDR, 0, 0};
+    }
+
+    /// Allocate a single item. Works with FixedSuballocator.
+    uint64_t allocItem( CUstream stream = 0 )
+    {
+        const unsigned int home = homeShard();
+        for( unsigned int i = 0; i < numShards(); ++i )
+        {
+            const unsigned int shard = ( home + i ) % numShards();
+            const uint64_t     ptr   = m_shards[shard]->allocItem( stream );
+            if( ptr != BAD_ADDR )
+            {
+                addressAllocated( ptr, shard );
+                return ptr;
+            }
+        }
+        return BAD_ADDR;
+    }
+
+    /// Allocate an object of a given type, returning a pointer to it
+    template <typename TYPE>
+    TYPE* allocObject( CUstream stream = 0 )
+    {
+        return reinterpret_cast<TYPE*>( alloc( sizeof( TYPE ), alignof( TYPE ), stream ).ptr );
+    }
+
+    /// Allocate an array of objects, returning a pointer to the array.
+    template <typename TYPE>
+    TYPE* allocObjects( size_t numItems, CUstream stream = 0 )
+    {
+        return reinterpret_cast<TYPE*>( alloc( sizeof( TYPE ) * numItems, alignof( TYPE ), stream ).ptr );
+    }
+
+    /// Free block immediately, returning it to the shard that owns it.
+    void free( const MemoryBlockDesc& block, CUstream stream = 0 ) { m_shards[findOwner( block.ptr )]->free( block, stream ); }
+
+    /// Free a single item (used with FixedSuballocator).
+    void freeItem( uint64_t ptr ) { m_shards[findOwner( ptr )]->freeItem( ptr ); }
+
+    /// Free an object.
+    template <typename TYPE>
+    void freeObject( TYPE* ptr )
+    {
+        free( MemoryBlockDesc{reinterpret_cast<uint64_t>( ptr ), sizeof( TYPE ), 0} );
+    }
+
+    /// Free an array of objects.
+    template <typename TYPE>
+    void freeObjects( TYPE* ptr, uint64_t numObjects )
+    {
+        free( MemoryBlockDesc{reinterpret_cast<uint64_t>( ptr ), numObjects * sizeof( TYPE ), 0} );
+    }
+
+    /// Free block asynchronously, after operations currently in the stream have finished
+    void freeAsync( const MemoryBlockDesc& block, CUstream stream )
+    {
+        m_shards[findOwner( block.ptr )]->freeAsync( block, stream );
+    }
+
+    /// Async free of a single address slot
+    void freeItemAsync( uint64_t ptr, CUstream stream = 0 ) { m_shards[findOwner( ptr )]->freeItemAsync( ptr, stream ); }
+
+    /// Async free an object
+    template <typename TYPE>
+    void freeObjectAsync( TYPE* ptr, CUstream stream = 0 )
+    {
+        freeAsync( MemoryBlockDesc{reinterpret_cast<uint64_t>( ptr ), sizeof( TYPE ), 0}, stream );
+    }
+
+    /// Async free an array of objects
+    template <typename TYPE>
+    void freeObjectsAsync( TYPE* ptr, uint64_t numObjects, CUstream stream = 0 )
+    {
+        freeAsync( MemoryBlockDesc{reinterpret_cast<uint64_t>( ptr ), numObjects * sizeof( TYPE ), 0}, stream );
+    }
+
+    /// Return the free space currently tracked in the pool
+    uint64_t currentFreeSpace() const
+    {
+        uint64_t total = 0;
+        for( const std::unique_ptr<Shard>& shard : m_shards )
+            total += shard->currentFreeSpace();
+        return total;
+    }
+
+    /// Return the amount of space that can be allocated in the pool without freeing anything
+    uint64_t allocatableSpace() const { return currentFreeSpace() + maxSize() - std::min( maxSize(), trackedSize() ); }
+
+    /// Return the amount of memory currently tracked (free or given out) by the pool
+    uint64_t trackedSize() const
+    {
+        uint64_t total = 0;
+        for( const std::unique_ptr<Shard>& shard : m_shards )
+            total += shard->trackedSize();
+        return total;
+    }
+
+    /// Return the maximum memory that the pool will allocate
+    uint64_t maxSize() const { return m_maxSize; }
+
+    /// Return the number of allocations that the pool is tracking
+    uint64_t numAllocations() const
+    {
+        uint64_t total = 0;
+        for( const std::unique_ptr<Shard>& shard : m_shards )
+            total += shard->numAllocations();
+        return total;
+    }
+
+    /// Return the size of chunks that the allocator will allocate.
+    uint64_t allocationGranularity() const { return m_allocationGranularity; }
+
+    /// Return the number of shards
+    unsigned int numShards() const { return static_cast<unsigned int>( m_shards.size() ); }
+
+    /// Set the max size (maximum size that the pool will allocate), dividing it between the shards.
+    void setMaxSize( uint64_t maxSize, bool releaseAllocations, CUstream stream = 0 )
+    {
+        for( const std::unique_ptr<Shard>& shard : m_shards )
+            shard->setMaxSize( maxSize / numShards(), releaseAllocations, stream );
+        m_maxSize = maxSize;
+        if( releaseAllocations )
+            rebuildOwnerTable();
+    }
+
+    /// Reduce the size of the pool by about rsize, releasing the memory to the OS
+    void releaseMemory( uint64_t rsize, CUstream stream = 0 )
+    {
+        for( const std::unique_ptr<Shard>& shard : m_shards )
+        {
+            const uint64_t before = shard->trackedSize();
+            shard->releaseMemory( std::min( rsize, before ), stream );
+            const uint64_t released = before - std::min( before, shard->trackedSize() );
+            rsize -= std::min( rsize, released );
+            if( rsize < m_allocationGranularity )
+                break;
+        }
+        rebuildOwnerTable();
+    }
+
+    /// Not copyable.
+    ShardedMemoryPool( const ShardedMemoryPool& ) = delete;
+
+    /// Not assignable.
+    ShardedMemoryPool& operator=( const ShardedMemoryPool& ) = delete;
+
+  private:
+    typedef MemoryPool<Allocator, SubAllocator> Shard;
+
+    // Allocation address ranges, sorted by begin address, and the shard that owns each one.
+    struct OwnerTable
+    {
+        std::vector<uint64_t>     begins;
+        std::vector<uint64_t>     ends;
+        std::vector<unsigned int> shards;
+    };
+
+    // Count of threads reading the owner table, one per home shard to avoid contention.
+    // Padded to avoid false sharing between shards.
+    struct ReaderCount
+    {
+        std::atomic<unsigned int> count{0};
+        char                      padding[128 - sizeof( std::atomic<unsigned int> )];
+    };
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::unique_ptr<ReaderCount[]>      m_readers;
+    std::atomic<OwnerTable*>            m_ownerTable;
+    std::mutex                          m_ownerMutex;  // Serializes owner table rebuilds
+    uint64_t                            m_allocationGranularity;
+    uint64_t                            m_maxSize;
+
+    // Choose a shard for the current thread. The thread id hash is mixed, since thread ids are often
+    // aligned addresses, and would otherwise map to a few shards.
+    unsigned int homeShard() const
+    {
+        const uint64_t hash = static_cast<uint64_t>( std::hash<std::thread::id>()( std::this_thread::get_id() ) );
+        return static_cast<unsigned int>( ( ( hash * 0x9E3779B97F4A7C15ull ) >> 32 ) % m_shards.size() );
+    }
+
+    // Look up the shard that owns an address in the given table. Returns numShards() if none does.
+    unsigned int lookupOwner( const OwnerTable& table, uint64_t ptr ) const
+    {
+        auto it = std::upper_bound( table.begins.begin(), table.begins.end(), ptr );
+        if( it == table.begins.begin() )
+            return numShards();
+        const size_t idx = static_cast<size_t>( it - table.begins.begin() ) - 1;
+        return ptr < table.ends[idx] ? table.shards[idx] : numShards();
+    }
+
+    // Look up the shard that owns an address without locking. The reader count keeps the table
+    // alive until the lookup has finished.
+    unsigned int findOwnerUnchecked( uint64_t ptr ) const
+    {
+        ReaderCount& reader = m_readers[homeShard()];
+        reader.count.fetch_add( 1 );
+        const unsigned int owner = lookupOwner( *m_ownerTable.load(), ptr );
+        reader.count.fetch_sub( 1 );
+        return owner;
+    }
+
+    unsigned int findOwner( uint64_t ptr ) const
+    {
+        const unsigned int owner = findOwnerUnchecked( ptr );
+        OTK_ASSERT_MSG( owner < numShards(), "Block was not allocated from this ShardedMemoryPool." );
+        return owner;
+    }
+
+    // Make sure that the owner table includes an allocated address, rebuilding it if the shard
+    // allocated more memory.
+    void addressAllocated( uint64_t ptr, unsigned int shard )
+    {
+        if( findOwnerUnchecked( ptr ) != shard )
+            rebuildOwnerTable();
+    }
+
+    void rebuildOwnerTable()
+    {
+        std::unique_lock<std::mutex> lock( m_ownerMutex );
+
+        struct Range
+        {
+            uint64_t     begin;
+            uint64_t     end;
+            unsigned int shard;
+            bool         operator<( const Range& other ) const { return begin < other.begin; }
+        };
+        std::vector<Range> ranges;
+        for( unsigned int shard = 0; shard < numShards(); ++shard )
+        {
+            for( const MemoryBlockDesc& block : m_shards[shard]->getAllocationRanges() )
+                ranges.push_back( Range{block.ptr, block.ptr + block.size, shard} );
+        }
+        std::sort( ranges.begin(), ranges.end() );
+
+        OwnerTable* table = new OwnerTable;
+        for( size_t i = 0; i < ranges.size(); ++i )
+        {
+            OTK_ASSERT_MSG( i == 0 || ranges[i].begin >= ranges[i - 1].end,
+                            "ShardedMemoryPool requires an allocator that returns distinct addresses." );
+            table->begins.push_back( ranges[i].begin );
+            table->ends.push_back( ranges[i].end );
+            table->shards.push_back( ranges[i].shard );
+        }
+
+        // Publish the new table, then wait for readers of the old table before deleting it.
+        OwnerTable* oldTable = m_ownerTable.exchange( table );
+        for( unsigned int i = 0; i < numShards(); ++i )
+        {
+            while( m_readers[i].count.load() != 0 )
+                std::this_thread::yield();
+        }
+        delete oldTable;
+    }
+};
+
+}  // namespace otk
@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/Memory/MemoryBlockDesc.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace otk {
+
+// TlsfSuballocator is a two-level segregated fit (TLSF) suballocator that tracks
+// free blocks from an address space. It has the same interface as HeapSuballocator,
+// and can be used in its place in a MemoryPool.
+//
+// Free blocks are binned by size. The first level splits sizes by powers of two, and
+// the second level splits each power of two range into SL_COUNT linear size classes.
+// A bitmap per level records which bins are non-empty, so alloc() finds a bin that
+// is guaranteed to fit the request with a couple of bit scans, rather than searching
+// the free list. Blocks are merged with their free neighbors when freed, using hash
+// maps keyed on block begin and end addresses. Alloc and free work in O(1) time,
+// independent of the number of free blocks.
+//
+// Because the memory being tracked may not be host accessible (e.g. device memory or
+// texture tiles), all of the block metadata is kept on the host, not in the blocks.
+//
+// Allocation rounds the request up to the next size class (good fit), so the internal
+// fragmentation of the search is bounded by 1/SL_COUNT of the block size. If no such
+// block exists, the bin containing the exact request size is searched before failing.
+//
+class TlsfSuballocator
+{
+  public:
+    TlsfSuballocator() { clearBins(); }
+    ~TlsfSuballocator() = default;
+
+    /// Tell the suballocator to track a memory segment.
+    /// This can be called multiple times to track multiple segments.
+    void track( uint64_t ptr, uint64_t size )
+    {
+        m_trackedSize += size;
+        free( MemoryBlockDesc{ptr, size, 0} );
+    }
+
+    /// Allocate a block from tracked memory. Returns the address to the allocated block.
+    /// On failure, BAD_ADDR is returned in the memory block.
+    MemoryBlockDesc alloc( uint64_t size, uint64_t alignment = 1 );
+
+    /// Free a block. The size must be correct to ensure correctness.
+    void free( const MemoryBlockDesc& memBlock );
+
+    /// Untrack memory that is currently tracked by the suballocator.
+    void untrack( uint64_t ptr, uint64_t size );
+
+    /// Return the current free space
+    uint64_t freeSpace() const { return m_freeSpace; }
+
+    /// Return the total memory tracked by suballocator
+    uint64_t trackedSize() const { return m_trackedSize; }
+
+    /// Return the number of free blocks
+    uint64_t numFreeBlocks() const { return static_cast<uint64_t>( m_blocks.size() ); }
+
+    /// Return the size of the largest free block
+    uint64_t largestFreeBlock() const;
+
+    /// Return true if the internal structure is valid (all blocks have non-zero size, none
+    /// overlap or abut, and every block is in the bin matching its size)
+    bool validate() const;
+
+    /// Return the free blocks as (begin, size) pairs, sorted by address, for testing purposes
+    std::vector<std::pair<uint64_t, uint64_t>> getFreeBlocks() const;
+
+    static const unsigned int SL_LOG2  = 4;               // log2 of the number of second level bins
+    static const unsigned int SL_COUNT = 1u << SL_LOG2;   // Number of second level bins per first level bin
+    static const unsigned int FL_COUNT = 64 - SL_LOG2 + 1;  // Number of first level bins
+
+  private:
+    struct FreeBlock
+    {
+        uint64_t size;
+        uint64_t prev;  // Begin address of the previous block in the same bin, or BAD_ADDR
+        uint64_t next;  // Begin address of the next block in the same bin, or BAD_ADDR
+    };
+
+    uint64_t m_trackedSize = 0;  // Total memory tracked by the suballocator
+    uint64_t m_freeSpace   = 0;  // Current free memory available
+
+    uint64_t m_flBitmap;                      // Bit fl is set if any bin in first level fl is non-empty
+    uint32_t m_slBitmap[FL_COUNT];            // Bit sl is set if bin (fl, sl) is non-empty
+    uint64_t m_bins[FL_COUNT][SL_COUNT];      // Head of the free list for each bin, or BAD_ADDR
+
+    std::unordered_map<uint64_t, FreeBlock> m_blocks;  // Free blocks indexed by beginning address
+    std::unordered_map<uint64_t, uint64_t>  m_ends;    // Beginning address of free blocks indexed by end address
+
+    static unsigned int findLastSet( uint64_t val );
+    static unsigned int findFirstSet( uint64_t val );
+    static void         mapSize( uint64_t size, unsigned int& fl, unsigned int& sl );
+
+    void clearBins();
+    void insertBlock( uint64_t begin, uint64_t size );
+    void removeBlock( uint64_t begin );
+    bool findBin( unsigned int& fl, unsigned int& sl ) const;
+    bool fitsBlock( uint64_t begin, uint64_t blockSize, uint64_t size, uint64_t alignment ) const
+    {
+        const uint64_t usedBegin = alignVal( begin, alignment );
+        return usedBegin >= begin && usedBegin - begin <= blockSize && size <= blockSize - ( usedBegin - begin );
+    }
+    MemoryBlockDesc allocFromBlock( uint64_t begin, uint64_t size, uint64_t alignment );
+};
+
+// Index of the most significant set bit. val must be non-zero.
+inline unsigned int TlsfSuballocator::findLastSet( uint64_t val )
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanReverse64( &idx, val );
+    return static_cast<unsigned int>( idx );
+#else
+    return 63u - static_cast<unsigned int>( __builtin_clzll( val ) );
+#endif
+}
+
+// Index of the least significant set bit. val must be non-zero.
+inline unsigned int TlsfSuballocator::findFirstSet( uint64_t val )
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward64( &idx, val );
+    return static_cast<unsigned int>( idx );
+#else
+    return static_cast<unsigned int>( __builtin_ctzll( val ) );
+#endif
+}
+
+// Map a size to its bin. Sizes below SL_COUNT go in first level 0, one size per bin.
+inline void TlsfSuballocator::mapSize( uint64_t size, unsigned int& fl, unsigned int& sl )
+{
+    if( size < SL_COUNT )
+    {
+        fl = 0;
+        sl = static_cast<unsigned int>( size );
+        return;
+    }
+    const unsigned int msb = findLastSet( size );
+    fl                     = msb - SL_LOG2 + 1;
+    sl                     = static_cast<unsigned int>( size >> ( msb - SL_LOG2 ) ) & ( SL_COUNT - 1 );
+}
+
+inline void TlsfSuballocator::clearBins()
+{
+    m_flBitmap = 0;
+    std::fill( &m_slBitmap[0], &m_slBitmap[0] + FL_COUNT, 0u );
+    std::fill( &m_bins[0][0], &m_bins[0][0] + FL_COUNT * SL_COUNT, BAD_ADDR );
+}
+
+inline void TlsfSuballocator::insertBlock( uint64_t begin, uint64_t size )
+{
+    unsigned int fl, sl;
+    mapSize( size, fl, sl );
+
+    const uint64_t head = m_bins[fl][sl];
+    m_blocks[begin]     = FreeBlock{size, BAD_ADDR, head};
+    m_ends[begin + size] = begin;
+    if( head != BAD_ADDR )
+        m_blocks[head].prev = begin;
+    m_bins[fl][sl] = begin;
+    m_flBitmap |= 1ull << fl;
+    m_slBitmap[fl] |= 1u << sl;
+}
+
+inline void TlsfSuballocator::removeBlock( uint64_t begin )
+{
+    auto            it    = m_blocks.find( begin );
+    const FreeBlock block = it->second;
+
+    unsigned int fl, sl;
+    mapSize( block.size, fl, sl );
+
+    if( block.prev != BAD_ADDR )
+        m_blocks[block.prev].next = block.next;
+    else
+        m_bins[fl][sl] = block.next;
+    if( block.next != BAD_ADDR )
+        m_blocks[block.next].prev = block.prev;
+
+    if( m_bins[fl][sl] == BAD_ADDR )
+    {
+        m_slBitmap[fl] &= ~( 1u << sl );
+        if( m_slBitmap[fl] == 0 )
+            m_flBitmap &= ~( 1ull << fl );
+    }
+
+    m_ends.erase( begin + block.size );
+    m_blocks.erase( it );
+}
+
+// Find the first non-empty bin at or above (fl, sl), updating fl and sl. Returns false if none.
+inline bool TlsfSuballocator::findBin( unsigned int& fl, unsigned int& sl ) const
+{
+    uint32_t slMap = m_slBitmap[fl] & ( ~0u << sl );
+    if( slMap == 0 )
+    {
+        const uint64_t flMap = ( fl + 1 < 64 ) ? m_flBitmap & ( ~0ull << ( fl + 1 ) ) : 0;
+        if( flMap == 0 )
+            return false;
+        fl    = findFirstSet( flMap );
+        slMap = m_slBitmap[fl];
+    }
+    sl = findFirstSet( slMap );
+    return true;
+}
+
+inline MemoryBlockDesc TlsfSuballocator::allocFromBlock( uint64_t begin, uint64_t size, uint64_t alignment )
+{
+    const uint64_t blockSize = m_blocks[begin].size;
+    const uint64_t usedBegin = alignVal( begin, alignment );
+    const uint64_t usedEnd   = usedBegin + size;
+    removeBlock( begin );
+
+    // Return the alignment padding and the tail of the block to the free lists. The neighbors
+    // of the block are allocated (otherwise they would have been merged), so no merge is needed.
+    if( usedBegin != begin )
+        insertBlock( begin, usedBegin - begin );
+    if( usedEnd != begin + blockSize )
+        insertBlock( usedEnd, begin + blockSize - usedEnd );
+
+    m_freeSpace -= size;
+    return MemoryBlockDesc{usedBegin, size, 0};
+}
+
+inline MemoryBlockDesc TlsfSuballocator::alloc( uint64_t size, uint64_t alignment )
+{
+    alignment = std::max( alignment, static_cast<uint64_t>( 1 ) );
+
+    // Can't allocate 0 size, or more than the free space
+    if( size == 0 || size > m_freeSpace )
+        return MemoryBlockDesc{BAD_ADDR, 0, 0};
+
+    // Try the head of the bin holding the exact size first. This reuses freed blocks of the
+    // same size (e.g. texture tiles) instead of splitting larger blocks.
+    unsigned int fl, sl;
+    mapSize( size, fl, sl );
+    const uint64_t head = m_bins[fl][sl];
+    if( head != BAD_ADDR && fitsBlock( head, m_blocks[head].size, size, alignment ) )
+        return allocFromBlock( head, size, alignment );
+
+    // Round the request (plus worst case alignment padding) up to the next size class, so
+    // that any block in the bin found by the bitmap search is guaranteed to fit.
+    uint64_t searchSize = size + ( alignment - 1 );
+    if( searchSize >= SL_COUNT )
+        searchSize += ( 1ull << ( findLastSet( searchSize ) - SL_LOG2 ) ) - 1;
+    if( searchSize < size || searchSize > m_freeSpace )
+        searchSize = 0;
+
+    unsigned int searchFl, searchSl;
+    if( searchSize != 0 )
+    {
+        mapSize( searchSize, searchFl, searchSl );
+        if( findBin( searchFl, searchSl ) )
+            return allocFromBlock( m_bins[searchFl][searchSl], size, alignment );
+    }
+
+    // Last resort: search the bin that holds the exact size, which may contain blocks
+    // that are big enough, but smaller than the next size class.
+    for( uint64_t begin = head; begin != BAD_ADDR; begin = m_blocks[begin].next )
+    {
+        if( fitsBlock( begin, m_blocks[begin].size, size, alignment ) )
+            return allocFromBlock( begin, size, alignment );
+    }
+
+    return MemoryBlockDesc{BAD_ADDR, 0, 0};
+}
+
+inline void TlsfSuballocator::free( const MemoryBlockDesc& memBlock )
+{
+    uint64_t begin = memBlock.ptr;
+    uint64_t end   = memBlock.ptr + memBlock.size;
+    if( memBlock.size == 0 )
+        return;
+    m_freeSpace += memBlock.size;
+
+    // Merge with the previous block
+    auto prevIt = m_ends.find( begin );
+    if( prevIt != m_ends.end() )
+    {
+        begin = prevIt->second;
+        removeBlock( begin );
+    }
+
+    // Merge with the next block
+    auto nextIt = m_blocks.find( end );
+    if( nextIt != m_blocks.end() )
+    {
+        const uint64_t nextSize = nextIt->second.size;
+        removeBlock( end );
+        end += nextSize;
+    }
+
+    insertBlock( begin, end - begin );
+}
+
+inline void TlsfSuballocator::untrack( uint64_t ptr, uint64_t size )
+{
+    // Remove free blocks that are in the untracked region. Untracking is rare, so a linear
+    // pass over the free blocks is acceptable.
+    std::vector<uint64_t> eraseBlocks;
+    for( const auto& block : m_blocks )
+    {
+        if( block.first >= ptr && block.first < ptr + size )
+            eraseBlocks.push_back( block.first );
+    }
+    for( uint64_t begin : eraseBlocks )
+    {
+        m_freeSpace -= m_blocks[begin].size;
+        removeBlock( begin );
+    }
+
+    // Reduce the tracked size
+    m_trackedSize = ( size <= m_trackedSize ) ? m_trackedSize - size : 0ULL;
+}
+
+inline uint64_t TlsfSuballocator::largestFreeBlock() const
+{
+    if( m_flBitmap == 0 )
+        return 0;
+    const unsigned int fl = findLastSet( m_flBitmap );
+    const unsigned int sl = findLastSet( m_slBitmap[fl] );
+
+    uint64_t largest = 0;
+    for( uint64_t begin = m_bins[fl][sl]; begin != BAD_ADDR; begin = m_blocks.at( begin ).next )
+        largest = std::max( largest, m_blocks.at( begin ).size );
+    return largest;
+}
+
+inline bool TlsfSuballocator::validate() const
+{
+    if( m_blocks.size() != m_ends.size() )
+        return false;
+
+    // Every block must be in the bin that matches its size, and the bitmaps must match the bins
+    size_t numBinned = 0;
+    for( unsigned int fl = 0; fl < FL_COUNT; ++fl )
+    {
+        for( unsigned int sl = 0; sl < SL_COUNT; ++sl )
+        {
+            const bool binUsed = m_bins[fl][sl] != BAD_ADDR;
+            if( binUsed != ( ( m_slBitmap[fl] & ( 1u << sl ) ) != 0 ) )
+                return false;
+
+            uint64_t prev = BAD_ADDR;
+            for( uint64_t begin = m_bins[fl][sl]; begin != BAD_ADDR; begin = m_blocks.at( begin ).next )
+            {
+                const FreeBlock& block = m_blocks.at( begin );
+                unsigned int     blockFl, blockSl;
+                mapSize( block.size, blockFl, blockSl );
+                if( block.size == 0 || block.prev != prev || blockFl != fl || blockSl != sl )
+                    return false;
+                prev = begin;
+                ++numBinned;
+            }
+        }
+        if( ( m_slBitmap[fl] != 0 ) != ( ( m_flBitmap & ( 1ull << fl ) ) != 0 ) )
+            return false;
+    }
+    if( numBinned != m_blocks.size() )
+        return false;
+
+    // Blocks must not overlap, and adjacent blocks should have been merged
+    std::vector<std::pair<uint64_t, uint64_t>> blocks = getFreeBlocks();
+    for( size_t i = 1; i < blocks.size(); ++i )
+    {
+        if( blocks[i - 1].first + blocks[i - 1].second >= blocks[i].first )
+            return false;
+    }
+    return true;
+}
+
+inline std::vector<std::pair<uint64_t, uint64_t>> TlsfSuballocator::getFreeBlocks() const
+{
+    std::vector<std::pair<uint64_t, uint64_t>> blocks;
+    blocks.reserve( m_blocks.size() );
+    for( const auto& block : m_blocks )
+        blocks.push_back( std::make_pair( block.first, block.second.size ) );
+    std::sort( blocks.begin(), blocks.end() );
+    return blocks;
+}
+
+}  // namespace otk
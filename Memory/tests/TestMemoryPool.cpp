@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -303,3 +303,17 @@ TEST_F( TestMemoryPool, TestReleaseMemory )
     pool.releaseMemory( trackedSize );
     EXPECT_EQ( pool.trackedSize(), 0ULL );
 }
+
+TEST_F( TestMemoryPool, TestHostPoolWithoutContext )
+{
+    // Pools that use the HostAllocator can be used without a current CUDA context.
+    CUcontext context;
+    OTK_ERROR_CHECK( cuCtxPopCurrent( &context ) );
+    {
+        MemoryPool<HostAllocator, HeapSuballocator> pool;
+        MemoryBlockDesc                             block = pool.alloc( 1024, 16 );
+        EXPECT_TRUE( block.isGood() );
+        pool.free( block );
+    }
+    OTK_ERROR_CHECK( cuCtxPushCurrent( context ) );
+}
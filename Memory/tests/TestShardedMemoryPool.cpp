@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/Error/cuErrorCheck.h>
+#include <OptiXToolkit/Error/cudaErrorCheck.h>
+#include <OptiXToolkit/Memory/Allocators.h>
+#include <OptiXToolkit/Memory/FixedSuballocator.h>
+#include <OptiXToolkit/Memory/HeapSuballocator.h>
+#include <OptiXToolkit/Memory/RingSuballocator.h>
+#include <OptiXToolkit/Memory/ShardedMemoryPool.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace otk;
+
+class TestShardedMemoryPool : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        OTK_ERROR_CHECK( cudaSetDevice( 0 ) );
+        OTK_ERROR_CHECK( cudaFree( nullptr ) );
+    }
+};
+
+TEST_F( TestShardedMemoryPool, NumShardsLimitedByMaxSize )
+{
+    ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 16, HeapSuballocator(), 1 << 20, 4 << 20 );
+    EXPECT_EQ( 4U, pool.numShards() );
+    EXPECT_EQ( static_cast<uint64_t>( 4 << 20 ), pool.maxSize() );
+}
+
+TEST_F( TestShardedMemoryPool, AllocFree )
+{
+    ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 4, HeapSuballocator(), 1 << 20, 0, 0 );
+
+    std::vector<MemoryBlockDesc> blocks;
+    for( unsigned int i = 1; i <= 1000; ++i )
+    {
+        MemoryBlockDesc block = pool.alloc( i, 8 );
+        ASSERT_TRUE( block.isGood() );
+        EXPECT_EQ( 0ULL, block.ptr % 8 );
+        blocks.push_back( block );
+    }
+    EXPECT_EQ( static_cast<uint64_t>( 1 ), pool.numAllocations() );
+
+    for( const MemoryBlockDesc& block : blocks )
+        pool.free( block );
+    EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+}
+
+TEST_F( TestShardedMemoryPool, FallsBackToOtherShards )
+{
+    // Each shard can hold a single 1 MB allocation, so the second allocation must come from the other shard.
+    ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 2, HeapSuballocator(), 1 << 20, 2 << 20, 0 );
+
+    MemoryBlockDesc block1 = pool.alloc( 1 << 20 );
+    MemoryBlockDesc block2 = pool.alloc( 1 << 20 );
+    MemoryBlockDesc block3 = pool.alloc( 1 << 20 );
+    EXPECT_TRUE( block1.isGood() );
+    EXPECT_TRUE( block2.isGood() );
+    EXPECT_TRUE( block3.isBad() );
+    EXPECT_EQ( static_cast<uint64_t>( 2 ), pool.numAllocations() );
+
+    pool.free( block1 );
+    pool.free( block2 );
+    EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+}
+
+TEST_F( TestShardedMemoryPool, FreeReturnsBlocksToOwningShard )
+{
+    ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 8, HeapSuballocator(), 1 << 20, 0, 0 );
+
+    // Allocate on a number of threads, and free everything on this thread.
+    const unsigned int                        numThreads = 8;
+    std::vector<std::vector<MemoryBlockDesc>> blocks( numThreads );
+    std::vector<std::thread>                  threads;
+    for( unsigned int t = 0; t < numThreads; ++t )
+    {
+        threads.emplace_back( [&pool, &blocks, t]() {
+            for( unsigned int i = 0; i < 1000; ++i )
+                blocks[t].push_back( pool.alloc( 64 + i, 16 ) );
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+
+    for( const std::vector<MemoryBlockDesc>& threadBlocks : blocks )
+    {
+        for( const MemoryBlockDesc& block : threadBlocks )
+        {
+            ASSERT_TRUE( block.ptr != BAD_ADDR );
+            pool.free( block );
+        }
+    }
+    EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+}
+
+TEST_F( TestShardedMemoryPool, ConcurrentAllocFree )
+{
+    ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 4, HeapSuballocator(), 1 << 20, 0, 0 );
+
+    // Each thread fills its blocks with its id, and checks them before freeing, to detect overlap.
+    const unsigned int       numThreads = 8;
+    std::vector<std::thread> threads;
+    std::vector<int>         numErrors( numThreads, 0 );
+    for( unsigned int t = 0; t < numThreads; ++t )
+    {
+        threads.emplace_back( [&pool, &numErrors, t]() {
+            std::mt19937                 rng( t );
+            std::vector<MemoryBlockDesc> live;
+            for( unsigned int i = 0; i < 5000; ++i )
+            {
+                if( live.empty() || rng() % 2 == 0 )
+                {
+                    MemoryBlockDesc block = pool.alloc( 1 + rng() % 1024, 1 );
+                    if( block.isBad() )
+                        continue;
+                    memset( reinterpret_cast<void*>( block.ptr ), static_cast<int>( t ), block.size );
+                    live.push_back( block );
+                }
+                else
+                {
+                    const size_t    idx   = rng() % live.size();
+                    MemoryBlockDesc block = live[idx];
+                    live[idx]             = live.back();
+                    live.pop_back();
+                    const unsigned char* data = reinterpret_cast<const unsigned char*>( block.ptr );
+                    for( uint64_t j = 0; j < block.size; ++j )
+                        numErrors[t] += data[j] != t;
+                    pool.free( block );
+                }
+            }
+            for( const MemoryBlockDesc& block : live )
+                pool.free( block );
+        } );
+    }
+    for( std::thread& thread : threads )
+        thread.join();
+
+    for( int errors : numErrors )
+        EXPECT_EQ( 0, errors );
+    EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+}
+
+TEST_F( TestShardedMemoryPool, FixedSuballocatorItems )
+{
+    ShardedMemoryPool<HostAllocator, FixedSuballocator> pool( 2, FixedSuballocator( 64, 64 ), 64 * 1024, 0, 0 );
+
+    std::vector<uint64_t> items;
+    for( unsigned int i = 0; i < 2000; ++i )
+    {
+        uint64_t item = pool.allocItem();
+        ASSERT_NE( BAD_ADDR, item );
+        EXPECT_EQ( 0ULL, item % 64 );
+        items.push_back( item );
+    }
+    for( uint64_t item : items )
+        pool.freeItem( item );
+    EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+}
+
+TEST_F( TestShardedMemoryPool, ReleaseMemory )
+{
+    ShardedMemoryPool<HostAllocator, RingSuballocator> pool( 2, RingSuballocator( 1 << 20 ), 1 << 20, 0, 0 );
+
+    std::vector<MemoryBlockDesc> blocks;
+    for( unsigned int i = 0; i < 8; ++i )
+        blocks.push_back( pool.alloc( 1 << 19, 1 ) );
+    for( const MemoryBlockDesc& block : blocks )
+        pool.free( block );
+    EXPECT_EQ( static_cast<uint64_t>( 4 << 20 ), pool.trackedSize() );
+
+    pool.releaseMemory( pool.trackedSize() );
+    EXPECT_EQ( static_cast<uint64_t>( 0 ), pool.trackedSize() );
+
+    // The pool can allocate again after releasing its memory.
+    MemoryBlockDesc block = pool.alloc( 1024, 1 );
+    EXPECT_TRUE( block.isGood() );
+    pool.free( block );
+}
+
+TEST_F( TestShardedMemoryPool, HostPoolWithoutContext )
+{
+    // Host shards can be created and used from threads without a current CUDA context.
+    CUcontext context;
+    OTK_ERROR_CHECK( cuCtxPopCurrent( &context ) );
+    {
+        ShardedMemoryPool<HostAllocator, HeapSuballocator> pool( 4, HeapSuballocator(), 1 << 20, 0, 0 );
+        std::vector<std::thread> threads;
+        for( unsigned int t = 0; t < 4; ++t )
+        {
+            threads.emplace_back( [&pool]() {
+                for( unsigned int i = 0; i < 1000; ++i )
+                {
+                    MemoryBlockDesc block = pool.alloc( 256, 16 );
+                    EXPECT_TRUE( block.isGood() );
+                    pool.free( block );
+                }
+            } );
+        }
+        for( std::thread& thread : threads )
+            thread.join();
+        EXPECT_EQ( pool.trackedSize(), pool.currentFreeSpace() );
+    }
+    OTK_ERROR_CHECK( cuCtxPushCurrent( context ) );
+}
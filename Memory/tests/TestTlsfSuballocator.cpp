@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/Memory/TlsfSuballocator.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace otk;
+
+class TestTlsfSuballocator : public testing::Test
+{
+  protected:
+    TlsfSuballocator tlsfSuballocator;
+};
+
+TEST_F( TestTlsfSuballocator, track )
+{
+    tlsfSuballocator.track( 0, 1024 );
+    tlsfSuballocator.track( 2048, 65536 );
+
+    std::vector<std::pair<uint64_t, uint64_t>> blocks = tlsfSuballocator.getFreeBlocks();
+    ASSERT_EQ( static_cast<size_t>( 2 ), blocks.size() );
+    EXPECT_EQ( static_cast<uint64_t>( 1024 + 65536 ), tlsfSuballocator.trackedSize() );
+    EXPECT_EQ( static_cast<uint64_t>( 1024 + 65536 ), tlsfSuballocator.freeSpace() );
+    EXPECT_EQ( 0ULL, blocks[0].first );
+    EXPECT_EQ( 1024ULL, blocks[0].second );
+    EXPECT_EQ( 2048ULL, blocks[1].first );
+    EXPECT_EQ( 65536ULL, blocks[1].second );
+    EXPECT_EQ( 65536ULL, tlsfSuballocator.largestFreeBlock() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, trackAdjacentMerges )
+{
+    tlsfSuballocator.track( 0, 1024 );
+    tlsfSuballocator.track( 1024, 1024 );
+
+    EXPECT_EQ( 1ULL, tlsfSuballocator.numFreeBlocks() );
+    EXPECT_EQ( 2048ULL, tlsfSuballocator.largestFreeBlock() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, allocMany )
+{
+    const uint64_t numAllocations = 1 << 20;
+    tlsfSuballocator.track( 0, numAllocations );
+
+    for( uint64_t i = 0; i < numAllocations; ++i )
+    {
+        MemoryBlockDesc memBlock = tlsfSuballocator.alloc( 1, 1 );
+        EXPECT_TRUE( memBlock.isGood() );
+    }
+    EXPECT_TRUE( tlsfSuballocator.freeSpace() == 0 );
+    EXPECT_TRUE( tlsfSuballocator.alloc( 1, 1 ).isBad() );
+}
+
+TEST_F( TestTlsfSuballocator, allocFree )
+{
+    const uint64_t               numAllocations = 1 << 18;
+    std::vector<MemoryBlockDesc> allocs;
+    tlsfSuballocator.track( 0, numAllocations );
+
+    for( uint64_t i = 0; i < numAllocations; ++i )
+    {
+        MemoryBlockDesc memBlock = tlsfSuballocator.alloc( 1, 1 );
+        allocs.push_back( memBlock );
+        EXPECT_TRUE( memBlock.isGood() );
+    }
+    EXPECT_TRUE( tlsfSuballocator.freeSpace() == 0 );
+
+    std::mt19937 urng( 7 );
+    std::shuffle( allocs.begin(), allocs.end(), urng );
+    for( MemoryBlockDesc& memBlock : allocs )
+        tlsfSuballocator.free( memBlock );
+
+    // All of the blocks should have been merged back into one
+    EXPECT_TRUE( tlsfSuballocator.freeSpace() == tlsfSuballocator.trackedSize() );
+    EXPECT_EQ( 1ULL, tlsfSuballocator.numFreeBlocks() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, alignment )
+{
+    tlsfSuballocator.track( 3, 1 << 20 );
+
+    for( uint64_t alignment = 1; alignment <= 65536; alignment *= 2 )
+    {
+        MemoryBlockDesc memBlock = tlsfSuballocator.alloc( 100, alignment );
+        ASSERT_TRUE( memBlock.isGood() );
+        EXPECT_EQ( 0ULL, memBlock.ptr % alignment );
+        EXPECT_EQ( 100ULL, static_cast<uint64_t>( memBlock.size ) );
+    }
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, exactFitReusesFreedBlock )
+{
+    // Allocate aligned tiles, free one in the middle, and make sure that it is reused
+    // rather than splitting the large block at the end.
+    tlsfSuballocator.track( 0, 16 * TILE_SIZE_IN_BYTES );
+    std::vector<MemoryBlockDesc> tiles;
+    for( int i = 0; i < 8; ++i )
+        tiles.push_back( tlsfSuballocator.alloc( TILE_SIZE_IN_BYTES, TILE_SIZE_IN_BYTES ) );
+
+    tlsfSuballocator.free( tiles[3] );
+    MemoryBlockDesc memBlock = tlsfSuballocator.alloc( TILE_SIZE_IN_BYTES, TILE_SIZE_IN_BYTES );
+    EXPECT_EQ( tiles[3].ptr, memBlock.ptr );
+}
+
+TEST_F( TestTlsfSuballocator, allocFailsWhenFragmented )
+{
+    tlsfSuballocator.track( 0, 4096 );
+    std::vector<MemoryBlockDesc> allocs;
+    for( int i = 0; i < 4; ++i )
+        allocs.push_back( tlsfSuballocator.alloc( 1024 ) );
+    tlsfSuballocator.free( allocs[0] );
+    tlsfSuballocator.free( allocs[2] );
+
+    EXPECT_EQ( 2048ULL, tlsfSuballocator.freeSpace() );
+    EXPECT_TRUE( tlsfSuballocator.alloc( 2048 ).isBad() );
+    EXPECT_TRUE( tlsfSuballocator.alloc( 1024 ).isGood() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, randomAllocFree )
+{
+    const uint64_t heapSize = 1 << 24;
+    tlsfSuballocator.track( 0, heapSize );
+
+    std::mt19937                            rng( 1234 );
+    std::uniform_int_distribution<uint64_t> sizeDist( 1, 1 << 14 );
+    std::uniform_int_distribution<int>      alignDist( 0, 8 );
+    std::vector<MemoryBlockDesc>            allocs;
+    uint64_t                                allocatedSize = 0;
+
+    for( int i = 0; i < 100000; ++i )
+    {
+        if( allocs.empty() || rng() % 3 != 0 )
+        {
+            MemoryBlockDesc memBlock = tlsfSuballocator.alloc( sizeDist( rng ), 1ULL << alignDist( rng ) );
+            if( memBlock.isGood() )
+            {
+                allocatedSize += memBlock.size;
+                allocs.push_back( memBlock );
+            }
+        }
+        else
+        {
+            const size_t idx = rng() % allocs.size();
+            allocatedSize -= allocs[idx].size;
+            tlsfSuballocator.free( allocs[idx] );
+            allocs[idx] = allocs.back();
+            allocs.pop_back();
+        }
+        ASSERT_EQ( heapSize - allocatedSize, tlsfSuballocator.freeSpace() );
+    }
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+
+    // No allocations may overlap each other or the free blocks
+    std::vector<std::pair<uint64_t, uint64_t>> blocks = tlsfSuballocator.getFreeBlocks();
+    for( const MemoryBlockDesc& memBlock : allocs )
+        blocks.push_back( std::make_pair( memBlock.ptr, static_cast<uint64_t>( memBlock.size ) ) );
+    std::sort( blocks.begin(), blocks.end() );
+    for( size_t i = 1; i < blocks.size(); ++i )
+        EXPECT_LE( blocks[i - 1].first + blocks[i - 1].second, blocks[i].first );
+
+    for( MemoryBlockDesc& memBlock : allocs )
+        tlsfSuballocator.free( memBlock );
+    EXPECT_EQ( 1ULL, tlsfSuballocator.numFreeBlocks() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
+
+TEST_F( TestTlsfSuballocator, untrack )
+{
+    tlsfSuballocator.track( 0, 1024 );
+    tlsfSuballocator.track( 2048, 1024 );
+
+    tlsfSuballocator.untrack( 0, 1024 );
+    EXPECT_EQ( tlsfSuballocator.trackedSize(), 1024ULL );
+    EXPECT_EQ( tlsfSuballocator.freeSpace(), 1024ULL );
+    EXPECT_EQ( 1ULL, tlsfSuballocator.numFreeBlocks() );
+    EXPECT_TRUE( tlsfSuballocator.validate() );
+}
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -19,8 +19,9 @@ const uint32_t NTC_TEXTURE_SET_CHUNK_SIZE = 512;
 class NeuralTextureSource : public imageSource::ImageSourceBase
 {
   public:
-    /// Create a neural texture source with the specified dimensions
-    explicit NeuralTextureSource( const std::string& filename );
+    /// Create a neural texture source for the given .ntc file.  By default the latents are read
+    /// from the file on demand, so opening a texture reads only its header and network weights.
+    explicit NeuralTextureSource( const std::string& filename, NtcFileAccess fileAccess = NtcFileAccess::STREAMING );
 
     /// The destructor is virtual.
     ~NeuralTextureSource() override = default;
@@ -50,6 +51,9 @@ class NeuralTextureSource : public imageSource::ImageSourceBase
     /// Read the base color of the image (1x1 mip level) as a float4. Returns true on success.
     bool readBaseColor( float4& /*dest*/ ) override { return false; }
 
+    /// Returns the host memory held by the image reader.
+    size_t getHostMemoryUsage() const override { return m_imageReader.getHostMemoryUsage(); }
+
     /// Get the extra data for the sampler
     CUdeviceptr getSamplerExtraData( OptixDeviceContext optixContext ) override { return makeOptixInferenceData( optixContext ); }
 
@@ -62,6 +66,7 @@ class NeuralTextureSource : public imageSource::ImageSourceBase
   private:
 
     std::string m_filename;
+    NtcFileAccess m_fileAccess;
     NtcImageReader m_imageReader;
     imageSource::TextureInfo m_latentsInfo;
     bool m_isOpen;
@@ -1,11 +1,13 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2019 - 2025  NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2019 - 2026  NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: BSD-3-Clause
  */
  
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include <cuda_runtime.h>
@@ -13,15 +15,28 @@
 #include <optix_stubs.h>
 #include <rapidjson/document.h>
 
+#include <OptiXToolkit/ImageSource/PositionalFile.h>
+
 #include "InferenceDataOptix.h"
 
 const uint32_t NTC_NETWORK_MAX_SIZE = 32768;
 
+/// How NtcImageReader accesses the latent data of an .ntc file.
+enum class NtcFileAccess
+{
+    /// Read the whole data chunk into host memory when the file is loaded.
+    READ_ALL,
+
+    /// Memory map the file (falling back to positional reads) and read latents on demand.  Only
+    /// the JSON header and the network weights are read when the file is loaded.
+    STREAMING
+};
+
 class NtcImageReader
 {
   public:
     /// Load an .ntc file
-    bool loadFile( const char* fileName );
+    bool loadFile( const char* fileName, NtcFileAccess fileAccess = NtcFileAccess::READ_ALL );
 
     /// Make the latent texture for the current cuda context
     CUtexObject makeLatentTexture();
@@ -32,9 +47,12 @@ class NtcImageReader
     /// Get the texture inference data for this texture
     const InferenceDataOptix& getInferenceData() { return m_inferenceData; }
 
-    /// Read a rectangle from a mip level of the latent texture into dest on the host.
+    /// Read a rectangle from a mip level of the latent texture into dest on the host.  Thread safe.
     bool readLatentRectUshort( uint16_t* dest, int mipLevel, int xstart, int ystart, int width, int height );
 
+    /// Get the number of bytes of host memory held by the reader (not including mapped file pages).
+    size_t getHostMemoryUsage() const;
+
   private:
 
     struct NtcFileHeader
@@ -63,7 +81,10 @@ class NtcImageReader
     };
 
     InferenceDataOptix m_inferenceData{};
-    std::vector<char> m_hDataChunk;
+    imageSource::PositionalFile m_file;  // open only when streaming
+    uint64_t m_dataOffset = 0;
+    uint64_t m_dataSize = 0;
+    std::vector<char> m_hDataChunk;  // empty when streaming
     std::vector<int> m_hLatentMipOffsets;
     std::vector<int> m_hLatentMipSizes;
     std::vector<NtcNetworkLayer> m_hNetwork;
@@ -73,6 +94,7 @@ class NtcImageReader
     bool parseLatentsDescription( rapidjson::Document& doc );
     bool parseNetworkDescription( rapidjson::Document& doc );
     uint32_t getColorSpace( rapidjson::Document& doc, int channelNum );
+    bool readData( char* dest, uint64_t offset, size_t size ) const;
     
     bool convertNetworkToOptixInferencingOptimal( OptixDeviceContext optixContext, CUdeviceptr d_srcNetworkData,
                                                   CUdeviceptr d_dstMatrix, int d_dstSize );
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,8 +10,9 @@
 
 namespace neuralTextures {
 
-NeuralTextureSource::NeuralTextureSource( const std::string& filename )
+NeuralTextureSource::NeuralTextureSource( const std::string& filename, NtcFileAccess fileAccess )
     : m_filename( filename )
+    , m_fileAccess( fileAccess )
     , m_isOpen( false )
 {
 }
@@ -22,7 +23,7 @@ void NeuralTextureSource::open( imageSource::TextureInfo* info )
     if( !m_isOpen )
     {
         std::string errString = "Could not open NTC image file " + m_filename;
-        bool success = m_imageReader.loadFile( m_filename.c_str() );
+        bool success = m_imageReader.loadFile( m_filename.c_str(), m_fileAccess );
         OTK_ERROR_CHECK_MSG( !success, errString.c_str() );
         InferenceDataOptix infData = m_imageReader.getInferenceData();
 
@@ -1,10 +1,11 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2019 - 2025  NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2019 - 2026  NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <math.h>
-#include <fstream>
+#include <algorithm>
+#include <cstring>
 
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
@@ -14,25 +15,34 @@
 #define OPTIX_CHK( call ) if( call != OPTIX_SUCCESS ) return false
 #define CUDA_CHK( call ) if( call != CUDA_SUCCESS ) return false
 
-bool NtcImageReader::loadFile( const char* fileName )
+bool NtcImageReader::loadFile( const char* fileName, NtcFileAccess fileAccess )
 {
     const uint32_t NTEX_MAGIC_NUMBER = 0x5845544E; // "NTEX"
     const uint32_t NTEX_SUPPORTED_VERSION = 0x100;
 
-    std::ifstream file( fileName, std::ios::binary );
-    if( !file.is_open() )
+    const bool streaming = ( fileAccess == NtcFileAccess::STREAMING );
+    m_file.close();
+    m_hDataChunk.clear();
+    if( !m_file.open( fileName, streaming ) )
         return false;
 
     // Read file header
     NtcFileHeader header{};
-    file.read( reinterpret_cast<char*>( &header ), sizeof( NtcFileHeader ) );
+    if( !m_file.read( reinterpret_cast<char*>( &header ), sizeof( NtcFileHeader ), 0 ) )
+        return false;
     if( header.magicNumber != NTEX_MAGIC_NUMBER || header.version != NTEX_SUPPORTED_VERSION )
         return false;
+    if( header.dataOffset > m_file.size() )
+        return false;
+
+    // Some files declare a data chunk that extends past the end of the file, so clamp it to the file.
+    m_dataOffset = header.dataOffset;
+    m_dataSize = std::min<uint64_t>( header.dataSize, m_file.size() - header.dataOffset );
 
     // Read json text
     std::vector<char> jsonText( header.jsonSize + 1, '\0' );
-    file.seekg( header.jsonOffset );
-    file.read( jsonText.data(), header.jsonSize );
+    if( !m_file.read( jsonText.data(), header.jsonSize, header.jsonOffset ) )
+        return false;
 
     // Parse json document and fill in texture description
     rapidjson::Document jsonDoc;
@@ -42,21 +52,17 @@ bool NtcImageReader::loadFile( const char* fileName )
     if( !parseTextureSetDescription( jsonDoc ) )
         return false;
 
-    // Figure out how much of the data chunk to read
-    bool loadLatents = true;
-    int dataChunkReadSize = static_cast<int>(header.dataSize);
-    if( !loadLatents )
+    // Read the data chunk unless streaming, in which case the latents are read from the file on
+    // demand and only the network weights are copied.
+    if( !streaming )
     {
-        int latentOffsetViewIdx = jsonDoc["latents"][0]["view"].GetInt();
-        int latentOffset = jsonDoc["views"][latentOffsetViewIdx]["offset"].GetInt();
-        dataChunkReadSize = latentOffset;
+        m_hDataChunk.resize( header.dataSize, '\0' );
+        if( !m_file.read( m_hDataChunk.data(), m_dataSize, m_dataOffset ) )
+            return false;
+        m_file.close();
     }
-    
-    // Read data chunk, parse latents and network weights
-    m_hDataChunk.resize( dataChunkReadSize, '\0' );
 
-    file.seekg( header.dataOffset );
-    file.read( m_hDataChunk.data(), dataChunkReadSize );
+    // Parse latents and network weights
     if( !parseLatentsDescription( jsonDoc ) )
         return false;
     if( !parseNetworkDescription( jsonDoc ) )
@@ -67,6 +73,25 @@ bool NtcImageReader::loadFile( const char* fileName )
 }
 
 
+bool NtcImageReader::readData( char* dest, uint64_t offset, size_t size ) const
+{
+    if( offset > m_dataSize || size > m_dataSize - offset )
+        return false;
+    if( !m_hDataChunk.empty() )
+    {
+        memcpy( dest, &m_hDataChunk[offset], size );
+        return true;
+    }
+    return m_file.read( dest, size, m_dataOffset + offset );
+}
+
+
+size_t NtcImageReader::getHostMemoryUsage() const
+{
+    return m_hDataChunk.capacity() + m_hNetworkData.capacity();
+}
+
+
 bool NtcImageReader::parseTextureSetDescription( rapidjson::Document& doc )
 {
     try
@@ -142,7 +167,7 @@ bool NtcImageReader::parseLatentsDescription( rapidjson::Document& doc )
 {
     try 
     {
-        // The latent data is held in m_hDataChunk. Read the offsets and sizes
+        // The latent data is held in the data chunk. Read the offsets and sizes
         m_hLatentMipOffsets.resize( doc["latents"].Size(), 0 );
         m_hLatentMipSizes.resize( doc["latents"].Size(), 0 );
         m_inferenceData.numLatentMips = static_cast<int>( doc["latents"].Size() );
@@ -153,6 +178,9 @@ bool NtcImageReader::parseLatentsDescription( rapidjson::Document& doc )
             int numLayerViews = doc["latents"][level]["layerViews"].Size();
             m_hLatentMipOffsets[level] = doc["views"][dataViewIdx]["offset"].GetInt();
             m_hLatentMipSizes[level] = doc["views"][dataViewIdx]["storedSize"].GetInt() * numLayerViews;
+            if( m_hLatentMipOffsets[level] < 0 || m_hLatentMipSizes[level] < 0
+                || static_cast<uint64_t>( m_hLatentMipOffsets[level] ) + m_hLatentMipSizes[level] > m_dataSize )
+                return false;
         }
     }
     catch(...)
@@ -206,7 +234,9 @@ bool NtcImageReader::parseNetworkDescription( rapidjson::Document& doc )
                 int srcOffset = doc["views"][viewIdx]["offset"].GetInt();
                 layer.weightSize = doc["views"][viewIdx]["storedSize"].GetInt();
                 layer.weightOffset = offset;
-                memcpy( &m_hNetworkData[offset], &m_hDataChunk[srcOffset], layer.weightSize );
+                if( offset + layer.weightSize > static_cast<int>( m_hNetworkData.size() )
+                    || !readData( &m_hNetworkData[offset], srcOffset, layer.weightSize ) )
+                    return false;
                 offset += layer.weightSize;
             }
 
@@ -230,7 +260,9 @@ bool NtcImageReader::parseNetworkDescription( rapidjson::Document& doc )
                 int srcOffset = doc["views"][viewIdx]["offset"].GetInt();
                 layer.scaleSize = doc["views"][viewIdx]["storedSize"].GetInt();
                 layer.scaleOffset = offset;
-                memcpy( &m_hNetworkData[offset], &m_hDataChunk[srcOffset], layer.scaleSize );
+                if( offset + layer.scaleSize > static_cast<int>( m_hNetworkData.size() )
+                    || !readData( &m_hNetworkData[offset], srcOffset, layer.scaleSize ) )
+                    return false;
                 offset += layer.scaleSize;
             }
             if( networkLayer.HasMember( "biasView" ) )
@@ -239,7 +271,9 @@ bool NtcImageReader::parseNetworkDescription( rapidjson::Document& doc )
                 int srcOffset = doc["views"][viewIdx]["offset"].GetInt();
                 layer.biasSize = doc["views"][viewIdx]["storedSize"].GetInt();
                 layer.biasOffset = offset;
-                memcpy( &m_hNetworkData[offset], &m_hDataChunk[srcOffset], layer.biasSize );
+                if( offset + layer.biasSize > static_cast<int>( m_hNetworkData.size() )
+                    || !readData( &m_hNetworkData[offset], srcOffset, layer.biasSize ) )
+                    return false;
                 offset += layer.biasSize;
             }
         }
@@ -257,6 +291,9 @@ bool NtcImageReader::parseNetworkDescription( rapidjson::Document& doc )
 
 bool NtcImageReader::readLatentRectUshort( uint16_t* dest, int mipLevel, int xstart, int ystart, int width, int height )
 {
+    if( mipLevel < 0 || mipLevel >= static_cast<int>( m_hLatentMipOffsets.size() ) )
+        return false;
+
     int numLatentTextures = m_inferenceData.latentFeatures / 4;
     int destPixelStride = (numLatentTextures != 3) ? numLatentTextures : 4;
 
@@ -264,22 +301,36 @@ bool NtcImageReader::readLatentRectUshort( uint16_t* dest, int mipLevel, int xst
     int mipHeight = m_inferenceData.latentHeight >> mipLevel;
     int latentOffset = m_hLatentMipOffsets[mipLevel];
 
-    uint16_t* src = (uint16_t*) &m_hDataChunk[latentOffset];
     width = std::min( width, mipWidth - xstart );
     height = std::min( height, mipHeight - ystart );
-
-    for( int y = 0; y < height; ++y )
+    if( width <= 0 || height <= 0 )
+        return true;
+
+    // The latents are read from the data chunk, the file mapping, or (when streaming from a file
+    // that could not be mapped) the file itself, one row of the rectangle at a time.
+    const char* data = nullptr;
+    if( !m_hDataChunk.empty() )
+        data = m_hDataChunk.data();
+    else if( m_file.data() != nullptr )
+        data = m_file.data() + m_dataOffset;
+    std::vector<uint16_t> rowBuffer( data ? 0 : width );
+
+    for( int c = 0; c < numLatentTextures; ++c )
     {
-        for( int x = 0; x < width; ++x )
+        for( int y = 0; y < height; ++y )
         {
-            uint16_t* pixelDest = &dest[( y * width + x ) * destPixelStride];
-            for( int c = 0; c < numLatentTextures; ++c )
-            {
-                int srcLayerOffset = mipWidth * mipHeight * c;
-                int srcPixelOffset = ( y + ystart ) * mipWidth + ( x + xstart );
-                uint16_t* pixelSrc = &src[srcLayerOffset + srcPixelOffset];
-                pixelDest[c] = *pixelSrc;
-            }
+            int srcLayerOffset = mipWidth * mipHeight * c;
+            int srcPixelOffset = ( y + ystart ) * mipWidth + xstart;
+            uint64_t srcByteOffset = latentOffset + ( srcLayerOffset + srcPixelOffset ) * sizeof( uint16_t );
+            const uint16_t* rowSrc = rowBuffer.data();
+            if( data != nullptr )
+                rowSrc = reinterpret_cast<const uint16_t*>( data + srcByteOffset );
+            else if( !readData( reinterpret_cast<char*>( rowBuffer.data() ), srcByteOffset,
+                                width * sizeof( uint16_t ) ) )
+                return false;
+
+            for( int x = 0; x < width; ++x )
+                dest[( y * width + x ) * destPixelStride + c] = rowSrc[x];
         }
     }
     return true;
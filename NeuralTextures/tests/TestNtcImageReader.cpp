@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Host-only tests for NtcImageReader; these do not require a GPU.
+
+#include <gtest/gtest.h>
+
+#include "SourceDir.h"  // generated from SourceDir.h.in
+#include <OptiXToolkit/NeuralTextures/NtcImageReader.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string getColorsFileName()
+{
+    return getSourceDir() + "/Textures/colors.ntc";
+}
+
+// The directory of .ntc files to measure, which can be overridden with OTK_NTC_TEXTURE_DIR.
+std::string getTextureDir()
+{
+    const char* dir = std::getenv( "OTK_NTC_TEXTURE_DIR" );
+    return dir != nullptr ? std::string( dir ) : getSourceDir() + "/Textures";
+}
+
+std::vector<std::string> findNtcFiles( const std::string& dir )
+{
+    std::vector<std::string> fileNames;
+    for( const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator( dir ) )
+    {
+        if( entry.is_regular_file() && entry.path().extension() == ".ntc" )
+            fileNames.push_back( entry.path().string() );
+    }
+    return fileNames;
+}
+
+std::vector<uint16_t> readLatentRect( NtcImageReader& reader, int mipLevel, int x, int y, int width, int height )
+{
+    const InferenceDataOptix& infData           = reader.getInferenceData();
+    const int                 numLatentTextures = infData.latentFeatures / 4;
+    const int                 pixelStride       = ( numLatentTextures != 3 ) ? numLatentTextures : 4;
+    std::vector<uint16_t>     rect( static_cast<size_t>( width ) * height * pixelStride, 0 );
+    EXPECT_TRUE( reader.readLatentRectUshort( rect.data(), mipLevel, x, y, width, height ) );
+    return rect;
+}
+
+}  // namespace
+
+TEST( TestNtcImageReader, StreamingMatchesReadAll )
+{
+    NtcImageReader readAll;
+    NtcImageReader streaming;
+    ASSERT_TRUE( readAll.loadFile( getColorsFileName().c_str(), NtcFileAccess::READ_ALL ) );
+    ASSERT_TRUE( streaming.loadFile( getColorsFileName().c_str(), NtcFileAccess::STREAMING ) );
+
+    const InferenceDataOptix& expected = readAll.getInferenceData();
+    const InferenceDataOptix& actual   = streaming.getInferenceData();
+    EXPECT_EQ( expected.latentFeatures, actual.latentFeatures );
+    EXPECT_EQ( expected.latentWidth, actual.latentWidth );
+    EXPECT_EQ( expected.latentHeight, actual.latentHeight );
+    EXPECT_EQ( expected.numLatentMips, actual.numLatentMips );
+    EXPECT_EQ( expected.constants.imageWidth, actual.constants.imageWidth );
+    EXPECT_EQ( expected.constants.imageHeight, actual.constants.imageHeight );
+
+    for( int mipLevel = 0; mipLevel < expected.numLatentMips; ++mipLevel )
+    {
+        const int width  = expected.latentWidth >> mipLevel;
+        const int height = expected.latentHeight >> mipLevel;
+        EXPECT_EQ( readLatentRect( readAll, mipLevel, 0, 0, width, height ),
+                   readLatentRect( streaming, mipLevel, 0, 0, width, height ) );
+    }
+
+    // A rectangle that extends past the edge of the mip level is clipped.
+    EXPECT_EQ( readLatentRect( readAll, 0, 3, 5, 128, 16 ), readLatentRect( streaming, 0, 3, 5, 128, 16 ) );
+}
+
+TEST( TestNtcImageReader, StreamingHoldsLessMemory )
+{
+    NtcImageReader readAll;
+    NtcImageReader streaming;
+    ASSERT_TRUE( readAll.loadFile( getColorsFileName().c_str(), NtcFileAccess::READ_ALL ) );
+    ASSERT_TRUE( streaming.loadFile( getColorsFileName().c_str(), NtcFileAccess::STREAMING ) );
+
+    EXPECT_LT( streaming.getHostMemoryUsage(), readAll.getHostMemoryUsage() );
+}
+
+TEST( TestNtcImageReader, MissingFileFails )
+{
+    NtcImageReader reader;
+    EXPECT_FALSE( reader.loadFile( "missing-file.ntc", NtcFileAccess::STREAMING ) );
+}
+
+// Load every .ntc file in the texture directory with each kind of file access, keeping the readers
+// alive as a renderer would, and report the load time and the host memory held.
+TEST( TestNtcImageReader, LoadDirectory )
+{
+    const std::vector<std::string> fileNames = findNtcFiles( getTextureDir() );
+    ASSERT_FALSE( fileNames.empty() );
+
+    size_t hostMemoryUsage[2] = {};
+    for( NtcFileAccess fileAccess : { NtcFileAccess::READ_ALL, NtcFileAccess::STREAMING } )
+    {
+        const bool                                   streaming = fileAccess == NtcFileAccess::STREAMING;
+        std::vector<std::unique_ptr<NtcImageReader>> readers;
+        const auto                                   start = std::chrono::steady_clock::now();
+        for( const std::string& fileName : fileNames )
+        {
+            readers.push_back( std::make_unique<NtcImageReader>() );
+            EXPECT_TRUE( readers.back()->loadFile( fileName.c_str(), fileAccess ) ) << fileName;
+        }
+        const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+        for( const std::unique_ptr<NtcImageReader>& reader : readers )
+            hostMemoryUsage[streaming] += reader->getHostMemoryUsage();
+        std::cout << ( streaming ? "Streaming" : "Read all" ) << ": loaded " << readers.size() << " files in "
+                  << seconds * 1000.0 << " ms, holding " << hostMemoryUsage[streaming] << " bytes\n";
+    }
+    EXPECT_LT( hostMemoryUsage[1], hostMemoryUsage[0] );
+}
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -7,11 +7,17 @@
 /// \file TextureUtil.h
 #include <OptiXToolkit/ShaderUtil/Preprocessor.h>
 
+#include <vector_types.h>
+
+#if !defined(__CUDACC_RTC__)
+#include <cmath>
+#endif
+
 enum FilterMode { FILTER_POINT=0, FILTER_BILINEAR, FILTER_BICUBIC, FILTER_SMARTBICUBIC };
 
-/// Compute mip level from the texture gradients.
-#ifdef __CUDACC__
-OTK_INLINE OTK_DEVICE float getMipLevel( float2 ddx, float2 ddy, int texWidth, int texHeight, float invAnisotropy )
+/// Compute mip level from the texture gradients.  Also callable on the host, so that host-side
+/// footprint computations (see DemandLoading's getFootprintTiles) match the device.
+OTK_INLINE OTK_HOSTDEVICE float getMipLevel( float2 ddx, float2 ddy, int texWidth, int texHeight, float invAnisotropy )
 {
     ddx = float2{ddx.x * texWidth, ddx.y * texHeight};
     ddy = float2{ddy.x * texWidth, ddy.y * texHeight};
@@ -35,4 +41,3 @@ OTK_INLINE OTK_DEVICE float getMipLevel( float2 ddx, float2 ddy, int texWidth, i
     const float mipLevel     = 0.5f * log2f( filterWidth2 );
     return mipLevel;
 }
-#endif
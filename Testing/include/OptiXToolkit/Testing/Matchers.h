@@ -518,6 +518,20 @@ MATCHER( buildAllowsRandomVertexAccess, "" )
     return true;
 }
 
+// OptixAccelBuildOptions
+MATCHER( buildAllowsCompaction, "" )
+{
+    if( ( arg->buildFlags & OPTIX_BUILD_FLAG_ALLOW_COMPACTION ) == 0 )
+    {
+        *result_listener << "build flag OPTIX_BUILD_FLAG_ALLOW_COMPACTION (" << OPTIX_BUILD_FLAG_ALLOW_COMPACTION
+                         << ") not set in value " << arg->buildFlags;
+        return false;
+    }
+    *result_listener << "build flag OPTIX_BUILD_FLAG_ALLOW_COMPACTION (" << OPTIX_BUILD_FLAG_ALLOW_COMPACTION
+                     << ") set in value " << arg->buildFlags;
+    return true;
+}
+
 inline OptixCustomPrimitiveBuildInputPredicate hasNumCustomPrimitives( unsigned int numPrims )
 {
     return [=]( ::testing::MatchResultListener* listener, const OptixBuildInputCustomPrimitiveArray& prims ) {
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <string>
 #include <filesystem>
+#include <thread>
 
 #ifndef _WIN32
 #include <unistd.h>
@@ -69,7 +70,7 @@ void printUsage( char* program )
         "   --threads | -t <numThreads>                  number of threads to use. (default 8, 1 for NTC)\n"
         "\n"
         "DDS Compression Options:\n"
-        "   --nvcompress | -nc <nvcompress executable>   nvcompress executable path.\n"
+        "   --nvcompress | -nc <nvcompress executable>   nvcompress executable path. (default: built-in encoder)\n"
         "   --minImageSize | -mi <minSize>               minimum size to maintain for files put in cache. (default 512)\n"
         "   --hdrCheckSize | -cs <checkSize>             size of mip level to check to see if a file is hdr. (default 256)\n"
         "   --small | -s                                 use lower quality, higher compression formats. (default off)\n"
@@ -110,7 +111,10 @@ int main( int argc, char* argv[] )
         if( arg == "--help" || arg == "-h" )
             printUsage( argv[0] );
         else if( ( arg == "--nvcompress" || arg == "-nc" ) && !lastArg )
+        {
             options.nvcompress = argv[++idx];
+            options.builtInEncoder = false;
+        }
         else if( ( arg == "--flags" || arg == "-f" ) && !lastArg )
             options.flags = argv[++idx];
         else if( ( arg == "--cachefolder" || arg == "-cf" ) && !lastArg )
@@ -165,11 +169,12 @@ int main( int argc, char* argv[] )
     if( numThreads == 0 )
         numThreads = ntcCliFound ? DEFAULT_NTC_THREADS : DEFAULT_NVCOMPRESS_THREADS;
 
-    if( !nvcompressFound && !ntcCliFound )
+    // Share the cores between the images that the built-in encoder compresses at once.
+    options.encoderThreads = std::max( 1u, std::thread::hardware_concurrency() / numThreads );
+
+    if( ( !options.builtInEncoder && !nvcompressFound ) || ( !options.ntcCli.empty() && !ntcCliFound ) )
     {
-        if( options.nvcompress.empty() && options.ntcCli.empty() )
-            std::cerr << "Error: No nvcompress executable or ntc-cli executable provided.\n";
-        else if( !options.nvcompress.empty() )
+        if( !options.builtInEncoder && !nvcompressFound )
             std::cerr << "Could not find nvcompress executable \"" << options.nvcompress << "\".\n";
         else if( !options.ntcCli.empty() )
             std::cerr << "Could not find ntc-cli executable \"" << options.ntcCli << "\".\n";
@@ -272,7 +277,7 @@ int main( int argc, char* argv[] )
         cacheManager.setVerbose( false );
 
     // Convert the source images to DDS.
-    if( nvcompressFound )
+    if( options.builtInEncoder || nvcompressFound )
     {
         if ( verbose )
         {
@@ -293,12 +298,14 @@ int main( int argc, char* argv[] )
             #pragma omp parallel for schedule(dynamic)
             for( unsigned int i = 0; i < sourceImages.size(); ++i )
             {
-                std::string outputImage = cacheManager.getCacheFilePath( sourceImages[i], ".dds" );
-                bool outFileExists = fs::exists( outputImage );
+                std::string outputImage = cacheManager.findCacheFileAsDDS( sourceImages[i] );
+                bool outFileExists = !outputImage.empty();
                 bool doPrint = verbose && ( !outFileExists || ( pass == 0 ) );
 
-                if( doPrint )
-                    printf( "Converting: \"%s\" ==> \"%s\"\n", sourceImages[i].c_str(), outputImage.c_str() );
+                if( doPrint && outFileExists )
+                    printf( "Cached: \"%s\" ==> \"%s\"\n", sourceImages[i].c_str(), outputImage.c_str() );
+                else if( doPrint )
+                    printf( "Converting: \"%s\"\n", sourceImages[i].c_str() );
 
                 if( outFileExists )
                 {
@@ -310,7 +317,7 @@ int main( int argc, char* argv[] )
                     if( cacheManager.cacheFileAsDDS( sourceImages[i], idx % numCudaDevices ) )
                         conversionCount++;
                     else if( verbose )
-                        printf( "GPU busy converting %s. Will retry.\n", outputImage.c_str() );
+                        printf( "GPU busy converting %s. Will retry.\n", sourceImages[i].c_str() );
                 }
             }
 
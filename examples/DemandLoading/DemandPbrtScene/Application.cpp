@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -51,7 +51,8 @@ Application::Application( int argc, char* argv[] )
     , m_demandLoader( createDemandLoader( getDemandLoaderOptions() ), demandLoading::destroyDemandLoader )
     , m_geometryLoader( std::make_shared<demandGeometry::ProxyInstances>( m_demandLoader.get() ) )
     , m_materialLoader( demandMaterial::createMaterialLoader( m_demandLoader.get() ) )
-    , m_geometryCache( createGeometryCache( createFileSystemInfo() ) )
+    , m_geometryCache( createGeometryCache( createFileSystemInfo(), static_cast<unsigned int>( m_options.geometryThreads ),
+                                           m_options.compactGeometry ) )
     , m_imageSourceFactory( createImageSourceFactory( m_options ) )
     , m_proxyFactory( createProxyFactory( m_options, m_geometryLoader, m_geometryCache ) )
     , m_renderer( createRenderer( m_options, m_geometryLoader->getNumAttributes() ) )
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -9,15 +9,27 @@
 #include "DemandPbrtScene/Stopwatch.h"
 
 #include <OptiXToolkit/Error/ErrorCheck.h>
+#include <OptiXToolkit/Error/cuErrorCheck.h>
 #include <OptiXToolkit/Error/optixErrorCheck.h>
+#include <OptiXToolkit/Memory/Allocators.h>
+#include <OptiXToolkit/Memory/HeapSuballocator.h>
+#include <OptiXToolkit/Memory/MemoryPool.h>
 #include <OptiXToolkit/Memory/SyncVector.h>
 #include <OptiXToolkit/PbrtSceneLoader/MeshReader.h>
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <future>
 #include <iterator>
+#include <mutex>
+#include <string_view>
+#include <thread>
 
 using namespace otk::pbrt;
 
@@ -66,15 +78,102 @@ static std::string objectPrimitiveCacheKey( const ObjectDefinition& object, Geom
 
 namespace {
 
+// Host buffers for a PLY mesh in object space, built from the mesh data by a load thread.
+struct HostTriangleMesh
+{
+    std::vector<float3>          vertices;
+    std::vector<std::uint32_t>   indices;
+    std::vector<TriangleNormals> normals;  // per-primitive normals, empty if none
+    std::vector<TriangleUVs>     uvs;      // per-primitive texture coordinates, empty if none
+    unsigned long long           bytesRead;
+    double                       readTime;
+};
+
+using HostTriangleMeshPtr    = std::shared_ptr<HostTriangleMesh>;
+using HostTriangleMeshFuture = std::shared_future<HostTriangleMeshPtr>;
+
+// A fixed pool of threads that read meshes in the order they were requested.
+class MeshLoadThreads
+{
+  public:
+    MeshLoadThreads( unsigned int numThreads )
+    {
+        for( unsigned int i = 0; i < numThreads; ++i )
+        {
+            m_threads.emplace_back( [this] { worker(); } );
+        }
+    }
+    ~MeshLoadThreads()
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_shutDown = true;
+        }
+        m_ready.notify_all();
+        for( std::thread& thread : m_threads )
+        {
+            thread.join();
+        }
+    }
+
+    HostTriangleMeshFuture push( std::function<HostTriangleMeshPtr()> read )
+    {
+        std::packaged_task<HostTriangleMeshPtr()> task( std::move( read ) );
+        HostTriangleMeshFuture                    result{ task.get_future().share() };
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_tasks.push_back( std::move( task ) );
+        }
+        m_ready.notify_one();
+        return result;
+    }
+
+  private:
+    void worker()
+    {
+        while( true )
+        {
+            std::packaged_task<HostTriangleMeshPtr()> task;
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_ready.wait( lock, [this] { return m_shutDown || !m_tasks.empty(); } );
+                if( m_shutDown )
+                {
+                    return;
+                }
+                task = std::move( m_tasks.front() );
+                m_tasks.pop_front();
+            }
+            // Exceptions are stored in the future and rethrown on the render thread.
+            task();
+        }
+    }
+
+    std::mutex                                            m_mutex;
+    std::condition_variable                               m_ready;
+    std::deque<std::packaged_task<HostTriangleMeshPtr()>> m_tasks;
+    std::vector<std::thread>                              m_threads;
+    bool                                                  m_shutDown{};
+};
+
 class GeometryCacheImpl : public GeometryCache
 {
   public:
-    GeometryCacheImpl( FileSystemInfoPtr fileSystemInfo )
+    GeometryCacheImpl( FileSystemInfoPtr fileSystemInfo, unsigned int numLoadThreads, bool compactAccels )
         : m_fileSystemInfo( std::move( fileSystemInfo ) )
+        , m_compactAccels( compactAccels )
     {
+        if( numLoadThreads > 0 )
+        {
+            m_loadThreads = std::make_unique<MeshLoadThreads>( numLoadThreads );
+        }
     }
     ~GeometryCacheImpl() override = default;
 
+    bool prefetchShape( const ShapeDefinition& shape ) override;
+
+    bool prefetchObject( const ObjectDefinition& object, const ShapeList& shapes, GeometryPrimitive primitive, MaterialFlags flags ) override;
+
     GeometryCacheEntry getShape( OptixDeviceContext context, CUstream stream, const ShapeDefinition& shape ) override;
 
     GeometryCacheEntry getObject( OptixDeviceContext      context,
@@ -87,7 +186,10 @@ class GeometryCacheImpl : public GeometryCache
     GeometryCacheStatistics getStatistics() const override { return m_stats; }
 
   private:
-    GeometryCacheEntry cacheGeometry( const std::string& key, GeometryCacheEntry entry );
+    bool                prefetchPlyMesh( const PlyMeshData& plyMesh );
+    HostTriangleMeshPtr getHostPlyMesh( const PlyMeshData& plyMesh );
+    void                releaseHostPlyMeshes();
+    GeometryCacheEntry  cacheGeometry( const std::string& key, GeometryCacheEntry entry );
     GeometryCacheEntry getPlyMesh( OptixDeviceContext context, CUstream stream, const PlyMeshData& plyMesh );
     GeometryCacheEntry getTriangleMesh( OptixDeviceContext context, CUstream stream, const TriangleMeshData& mesh );
     GeometryCacheEntry getSphere( OptixDeviceContext context, CUstream stream, const SphereData& sphere );
@@ -99,11 +201,16 @@ class GeometryCacheImpl : public GeometryCache
                                  TriangleNormals*       normals,
                                  TriangleUVs*           uvs,
                                  const OptixBuildInput& build );
+    CUdeviceptr        compactGAS( OptixDeviceContext context, CUstream stream, OptixTraversableHandle& traversable, size_t compactedSize );
     void               appendPlyMesh( const pbrt::Transform& transform, const PlyMeshData& plyMesh );
     void               appendTriangleMesh( const pbrt::Transform& transform, const TriangleMeshData& mesh );
     void               appendSphere( const pbrt::Transform& transform, const SphereData& sphereData );
 
+    using AccelPool = otk::MemoryPool<otk::DeviceAllocator, otk::HeapSuballocator>;
+
     FileSystemInfoPtr                         m_fileSystemInfo;
+    bool                                      m_compactAccels;
+    std::unique_ptr<AccelPool>                m_accelPool;  // created on first use, as it needs a current CUDA context
     std::map<std::string, GeometryCacheEntry> m_geomCache;
     otk::SyncVector<float3>                   m_vertices;
     otk::SyncVector<std::uint32_t>            m_indices;
@@ -112,8 +219,175 @@ class GeometryCacheImpl : public GeometryCache
     otk::SyncVector<TriangleUVs>              m_uvs;
     std::vector<uint_t>                       m_primitiveGroupEndIndices;
     GeometryCacheStatistics                   m_stats{};
+
+    // Triangle meshes and the GAS built for each, indexed by the hash of their contents.  The contents
+    // are kept to tell apart meshes with the same hash.
+    struct CachedTriangleMesh
+    {
+        TriangleMeshData   mesh;
+        GeometryCacheEntry geom;
+    };
+    std::map<std::size_t, std::vector<CachedTriangleMesh>> m_triangleMeshes;
+
+    // PLY meshes read or being read on the load threads, indexed by file name.
+    std::map<std::string, HostTriangleMeshFuture> m_hostPlyMeshes;
+    std::vector<std::string>                      m_usedHostPlyMeshes;
+    std::unique_ptr<MeshLoadThreads>              m_loadThreads;  // nullptr when reading synchronously
 };
 
+// Read a PLY mesh and build its host buffers; called on a load thread when reading asynchronously.
+static HostTriangleMeshPtr readPlyMesh( const FileSystemInfo& fileSystemInfo, const PlyMeshData& plyMesh )
+{
+    const MeshLoaderPtr loader{ plyMesh.loader };
+    const MeshInfo      meshInfo{ loader->getMeshInfo() };
+    MeshData            buffers{};
+    HostTriangleMeshPtr mesh{ std::make_shared<HostTriangleMesh>() };
+    {
+        Stopwatch stopwatch;
+        loader->load( buffers );
+        mesh->readTime = stopwatch.elapsed();
+    }
+    mesh->bytesRead = fileSystemInfo.getSize( plyMesh.fileName );
+
+    mesh->vertices.resize( meshInfo.numVertices );
+    for( int i = 0; i < meshInfo.numVertices; ++i )
+    {
+        mesh->vertices[i] = make_float3( buffers.vertexCoords[i * VERTS_PER_TRI + 0], buffers.vertexCoords[i * VERTS_PER_TRI + 1],
+                                         buffers.vertexCoords[i * VERTS_PER_TRI + 2] );
+    }
+    mesh->indices.assign( buffers.indices.begin(), buffers.indices.end() );
+
+    const size_t numTriangles{ buffers.indices.size() / VERTS_PER_TRI };
+    if( meshInfo.numNormals > 0 )
+    {
+        if( meshInfo.numNormals != meshInfo.numVertices )
+        {
+            throw std::runtime_error( "Expected " + std::to_string( meshInfo.numVertices ) + " vertex normals, got "
+                                      + std::to_string( meshInfo.numNormals ) );
+        }
+
+        // When building the GAS, we have the luxury of supplying the vertex array and the
+        // index array, but in the closest hit program, we only have the primitive index,
+        // not the vertex/normal index.  So we size the array of TriangleNormals structures
+        // to the number of primitives and use the index array to select the appropriate normal
+        // for each vertex.
+        //
+        mesh->normals.resize( numTriangles );
+        for( size_t face = 0; face < numTriangles; ++face )
+        {
+            TriangleNormals& normals{ mesh->normals[face] };
+            for( size_t vert = 0; vert < VERTS_PER_TRI; ++vert )
+            {
+                // 3 coords per vertex
+                // 3 vertices per face, 3 indices per face
+                const int idx{ buffers.indices[face * VERTS_PER_TRI + vert] * 3 };
+                normals.N[vert] = make_float3( buffers.normalCoords[idx + 0], buffers.normalCoords[idx + 1],
+                                               buffers.normalCoords[idx + 2] );
+            }
+        }
+    }
+
+    if( meshInfo.numTextureCoordinates > 0 )
+    {
+        if( meshInfo.numTextureCoordinates != meshInfo.numVertices )
+        {
+            throw std::runtime_error( "Expected " + std::to_string( meshInfo.numVertices )
+                                      + " vertex texture coordinates, got " + std::to_string( meshInfo.numTextureCoordinates ) );
+        }
+
+        // When building the GAS, we have the luxury of supplying the vertex array and the
+        // index array, but in the closest hit program, we only have the primitive index,
+        // not the vertex/normal/uv index.  So we size the array of TriangleUVs structures
+        // to the number of primitives and use the index array to select the appropriate normal
+        // for each vertex.
+        mesh->uvs.resize( numTriangles );
+        for( size_t face = 0; face < numTriangles; ++face )
+        {
+            TriangleUVs& uvs{ mesh->uvs[face] };
+            for( size_t vert = 0; vert < VERTS_PER_TRI; ++vert )
+            {
+                // 2 coords per vertex
+                // 3 vertices per face, 3 indices per face
+                const int idx{ buffers.indices[face * VERTS_PER_TRI + vert] * 2 };
+                uvs.UV[vert] = make_float2( buffers.uvCoords[idx + 0], buffers.uvCoords[idx + 1] );
+            }
+        }
+    }
+
+    return mesh;
+}
+
+bool GeometryCacheImpl::prefetchPlyMesh( const PlyMeshData& plyMesh )
+{
+    if( !m_loadThreads )
+    {
+        return true;
+    }
+
+    auto it{ m_hostPlyMeshes.find( plyMesh.fileName ) };
+    if( it == m_hostPlyMeshes.end() )
+    {
+        const FileSystemInfoPtr fileSystemInfo{ m_fileSystemInfo };
+        it = m_hostPlyMeshes
+                 .emplace( plyMesh.fileName,
+                           m_loadThreads->push( [fileSystemInfo, plyMesh] { return readPlyMesh( *fileSystemInfo, plyMesh ); } ) )
+                 .first;
+    }
+    return it->second.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready;
+}
+
+HostTriangleMeshPtr GeometryCacheImpl::getHostPlyMesh( const PlyMeshData& plyMesh )
+{
+    const auto it{ m_hostPlyMeshes.find( plyMesh.fileName ) };
+    if( it == m_hostPlyMeshes.end() )
+    {
+        return readPlyMesh( *m_fileSystemInfo, plyMesh );
+    }
+
+    // Waits for the mesh if it is still being read; the mesh is kept until the GAS is built,
+    // in case another shape of the same object uses it.
+    m_usedHostPlyMeshes.push_back( plyMesh.fileName );
+    return it->second.get();
+}
+
+void GeometryCacheImpl::releaseHostPlyMeshes()
+{
+    for( const std::string& fileName : m_usedHostPlyMeshes )
+    {
+        m_hostPlyMeshes.erase( fileName );
+    }
+    m_usedHostPlyMeshes.clear();
+}
+
+bool GeometryCacheImpl::prefetchShape( const ShapeDefinition& shape )
+{
+    if( shape.type != SHAPE_TYPE_PLY_MESH || m_geomCache.find( plyMeshCacheKey( shape.plyMesh ) ) != m_geomCache.end() )
+    {
+        return true;
+    }
+
+    return prefetchPlyMesh( shape.plyMesh );
+}
+
+bool GeometryCacheImpl::prefetchObject( const ObjectDefinition& object, const ShapeList& shapes, GeometryPrimitive primitive, MaterialFlags flags )
+{
+    if( primitive != GeometryPrimitive::TRIANGLE
+        || m_geomCache.find( objectPrimitiveCacheKey( object, primitive, flags ) ) != m_geomCache.end() )
+    {
+        return true;
+    }
+
+    bool ready{ true };
+    for( const ShapeDefinition& shape : shapes )
+    {
+        if( shape.type == SHAPE_TYPE_PLY_MESH && shapeMaterialFlags( shape ) == flags )
+        {
+            ready = prefetchPlyMesh( shape.plyMesh ) && ready;
+        }
+    }
+    return ready;
+}
+
 GeometryCacheEntry GeometryCacheImpl::getShape( OptixDeviceContext context, CUstream stream, const ShapeDefinition& shape )
 {
     if( shape.type == SHAPE_TYPE_PLY_MESH )
@@ -164,6 +438,7 @@ GeometryCacheEntry GeometryCacheImpl::getObject( OptixDeviceContext      context
                     }
                 }
             }
+            releaseHostPlyMeshes();
             return cacheGeometry( cacheKey, buildTriangleGAS( context, stream ) );
 
         case GeometryPrimitive::SPHERE:
@@ -203,19 +478,62 @@ GeometryCacheEntry GeometryCacheImpl::getPlyMesh( OptixDeviceContext context, CU
     m_uvs.clear();
     m_primitiveGroupEndIndices.clear();
     appendPlyMesh( pbrt::Transform(), plyMesh );
+    releaseHostPlyMeshes();
     return cacheGeometry( cacheKey, buildTriangleGAS( context, stream ) );
 }
 
+template <typename T>
+static std::size_t hashData( const std::vector<T>& values )
+{
+    return std::hash<std::string_view>{}(
+        std::string_view( reinterpret_cast<const char*>( values.data() ), values.size() * sizeof( T ) ) );
+}
+
+template <typename T>
+static bool sameData( const std::vector<T>& lhs, const std::vector<T>& rhs )
+{
+    return lhs.size() == rhs.size() && ( lhs.empty() || std::memcmp( lhs.data(), rhs.data(), lhs.size() * sizeof( T ) ) == 0 );
+}
+
+// Triangle meshes are indexed by a hash of their contents, so identical meshes from different shapes share a GAS.
+static std::size_t hashTriangleMesh( const TriangleMeshData& mesh )
+{
+    std::size_t hash{};
+    for( std::size_t value : { mesh.indices.size(), hashData( mesh.indices ), mesh.points.size(), hashData( mesh.points ),
+                               mesh.normals.size(), hashData( mesh.normals ), mesh.uvs.size(), hashData( mesh.uvs ) } )
+    {
+        hash ^= value + 0x9e3779b97f4a7c15ULL + ( hash << 6 ) + ( hash >> 2 );
+    }
+    return hash;
+}
+
+static bool sameTriangleMesh( const TriangleMeshData& lhs, const TriangleMeshData& rhs )
+{
+    return sameData( lhs.indices, rhs.indices ) && sameData( lhs.points, rhs.points ) && sameData( lhs.normals, rhs.normals )
+           && sameData( lhs.uvs, rhs.uvs );
+}
+
 GeometryCacheEntry GeometryCacheImpl::getTriangleMesh( OptixDeviceContext context, CUstream stream, const TriangleMeshData& triangleMesh )
 {
-    // TODO: implement a cache for trianglemesh shapes?
+    // Distinct meshes can have the same hash, so the GAS is only shared with a mesh whose contents match.
+    std::vector<CachedTriangleMesh>& meshes{ m_triangleMeshes[hashTriangleMesh( triangleMesh )] };
+    for( const CachedTriangleMesh& cached : meshes )
+    {
+        if( sameTriangleMesh( cached.mesh, triangleMesh ) )
+        {
+            ++m_stats.numSharedMeshes;
+            return cached.geom;
+        }
+    }
+
     m_vertices.clear();
     m_indices.clear();
     m_normals.clear();
     m_uvs.clear();
     m_primitiveGroupEndIndices.clear();
     appendTriangleMesh( pbrt::Transform(), triangleMesh );
-    return buildTriangleGAS( context, stream );
+    meshes.push_back( CachedTriangleMesh{ triangleMesh, buildTriangleGAS( context, stream ) } );
+    return meshes.back().geom;
 }
 
 GeometryCacheEntry GeometryCacheImpl::buildGAS( OptixDeviceContext     context,
@@ -227,7 +545,9 @@ GeometryCacheEntry GeometryCacheImpl::buildGAS( OptixDeviceContext     context,
 {
     OptixAccelBuildOptions options{};
     options.buildFlags = OPTIX_BUILD_FLAG_ALLOW_RANDOM_VERTEX_ACCESS;
-    options.operation  = OPTIX_BUILD_OPERATION_BUILD;
+    if( m_compactAccels )
+        options.buildFlags |= OPTIX_BUILD_FLAG_ALLOW_COMPACTION;
+    options.operation = OPTIX_BUILD_OPERATION_BUILD;
     OptixAccelBufferSizes sizes{};
     OTK_ERROR_CHECK( optixAccelComputeMemoryUsage( context, &options, &build, 1, &sizes ) );
 
@@ -235,13 +555,43 @@ GeometryCacheEntry GeometryCacheImpl::buildGAS( OptixDeviceContext     context,
     temp.resize( sizes.tempSizeInBytes );
     otk::DeviceBuffer output;
     output.resize( sizes.outputSizeInBytes );
+    otk::DeviceBuffer     compactedSizeBuffer;
+    OptixAccelEmitDesc    compactedSizeProperty{};
+    OptixAccelEmitDesc*   emittedProperties{};
+    unsigned int          numEmittedProperties{};
+    if( m_compactAccels )
+    {
+        compactedSizeBuffer.resize( sizeof( std::uint64_t ) );
+        compactedSizeProperty.type   = OPTIX_PROPERTY_TYPE_COMPACTED_SIZE;
+        compactedSizeProperty.result = compactedSizeBuffer;
+        emittedProperties            = &compactedSizeProperty;
+        numEmittedProperties         = 1;
+    }
     OptixTraversableHandle traversable{};
     OTK_ERROR_CHECK( optixAccelBuild( context, stream, &options, &build, 1, temp, temp.size(), output, output.size(),
-                                      &traversable, nullptr, 0 ) );
+                                      &traversable, emittedProperties, numEmittedProperties ) );
 #ifndef NDEBUG
     OTK_CUDA_SYNC_CHECK();
 #endif
 
+    CUdeviceptr accelBuffer{};
+    m_stats.totalAccelBytes += output.size();
+    if( m_compactAccels )
+    {
+        std::uint64_t compactedSize{};
+        OTK_ERROR_CHECK( cuMemcpyDtoHAsync( &compactedSize, compactedSizeBuffer, sizeof( compactedSize ), stream ) );
+        OTK_ERROR_CHECK( cuStreamSynchronize( stream ) );
+        if( compactedSize < output.size() )
+            accelBuffer = compactGAS( context, stream, traversable, compactedSize );
+        if( accelBuffer != CUdeviceptr{} )
+            m_stats.totalCompactedAccelBytes += compactedSize;
+    }
+    if( accelBuffer == CUdeviceptr{} )
+    {
+        m_stats.totalCompactedAccelBytes += output.size();
+        accelBuffer = output.detach();
+    }
+
     ++m_stats.numTraversables;
     switch( primitive )
     {
@@ -257,7 +607,25 @@ GeometryCacheEntry GeometryCacheImpl::buildGAS( OptixDeviceContext     context,
             break;
     }
 
-    return { output.detach(), traversable, primitive, normals, uvs, m_primitiveGroupEndIndices };
+    return { accelBuffer, traversable, primitive, normals, uvs, m_primitiveGroupEndIndices };
+}
+
+// Copy a GAS built with compaction allowed into a pooled allocation of its compacted size and
+// update the traversable to refer to the copy.  Returns zero if the pool has no room, in which
+// case the uncompacted GAS should be kept.
+CUdeviceptr GeometryCacheImpl::compactGAS( OptixDeviceContext context, CUstream stream, OptixTraversableHandle& traversable, size_t compactedSize )
+{
+    if( !m_accelPool )
+        m_accelPool = std::make_unique<AccelPool>();
+    const otk::MemoryBlockDesc block{ m_accelPool->alloc( compactedSize, OPTIX_ACCEL_BUFFER_BYTE_ALIGNMENT, stream ) };
+    if( block.isBad() )
+        return CUdeviceptr{};
+
+    OTK_ERROR_CHECK( optixAccelCompact( context, stream, traversable, block.ptr, compactedSize, &traversable ) );
+#ifndef NDEBUG
+    OTK_CUDA_SYNC_CHECK();
+#endif
+    return block.ptr;
 }
 
 template <typename Container>
@@ -268,88 +636,32 @@ void growContainer( Container& coll, size_t increase )
 
 void GeometryCacheImpl::appendPlyMesh( const pbrt::Transform& transform, const PlyMeshData& plyMesh )
 {
-    const MeshLoaderPtr loader{ plyMesh.loader };
-    const MeshInfo      meshInfo{ loader->getMeshInfo() };
-    MeshData            buffers{};
-    {
-        Stopwatch stopwatch;
-        loader->load( buffers );
-        m_stats.totalReadTime += stopwatch.elapsed();
-    }
-    m_stats.totalBytesRead += m_fileSystemInfo->getSize( plyMesh.fileName );
+    const HostTriangleMeshPtr mesh{ getHostPlyMesh( plyMesh ) };
+    m_stats.totalReadTime += mesh->readTime;
+    m_stats.totalBytesRead += mesh->bytesRead;
 
     const uint_t indexOffset{ toUInt( m_vertices.size() ) };
-    growContainer( m_vertices, meshInfo.numVertices );
-    for( int i = 0; i < meshInfo.numVertices; ++i )
+    growContainer( m_vertices, mesh->vertices.size() );
+    if( transform.IsIdentity() )
     {
-        pbrt::Point3f pt{ buffers.vertexCoords[i * VERTS_PER_TRI + 0], buffers.vertexCoords[i * VERTS_PER_TRI + 1],
-                          buffers.vertexCoords[i * VERTS_PER_TRI + 2] };
-        pt = transform( pt );
-        m_vertices.push_back( make_float3( pt.x, pt.y, pt.z ) );
+        std::copy( mesh->vertices.begin(), mesh->vertices.end(), std::back_inserter( m_vertices ) );
     }
-    growContainer( m_indices, meshInfo.numTriangles * VERTS_PER_TRI );
-    std::transform( buffers.indices.begin(), buffers.indices.end(), std::back_inserter( m_indices ),
-                    [=]( int index ) { return static_cast<std::uint32_t>( index + indexOffset ); } );
-    m_primitiveGroupEndIndices.push_back( containerSize( m_indices ) / VERTS_PER_TRI );
-
-    const size_t numTriangles{ buffers.indices.size() / VERTS_PER_TRI };
-    if( meshInfo.numNormals > 0 )
+    else
     {
-        if( meshInfo.numNormals != meshInfo.numVertices )
-        {
-            throw std::runtime_error( "Expected " + std::to_string( meshInfo.numVertices ) + " vertex normals, got "
-                                      + std::to_string( meshInfo.numNormals ) );
-        }
-
-        // When building the GAS, we have the luxury of supplying the vertex array and the
-        // index array, but in the closest hit program, we only have the primitive index,
-        // not the vertex/normal index.  So we size the array of TriangleNormals structures
-        // to the number of primitives and use the index array to select the appropriate normal
-        // for each vertex.
-        //
-        growContainer( m_normals, numTriangles );
-        for( size_t face = 0; face < numTriangles; ++face )
-        {
-            TriangleNormals normals;
-            for( size_t vert = 0; vert < VERTS_PER_TRI; ++vert )
-            {
-                // 3 coords per vertex
-                // 3 vertices per face, 3 indices per face
-                const int idx{ buffers.indices[face * VERTS_PER_TRI + vert] * 3 };
-                normals.N[vert] = make_float3( buffers.normalCoords[idx + 0], buffers.normalCoords[idx + 1],
-                                               buffers.normalCoords[idx + 2] );
-            }
-            m_normals.push_back( normals );
-        }
+        std::transform( mesh->vertices.begin(), mesh->vertices.end(), std::back_inserter( m_vertices ), [&]( const float3& vertex ) {
+            const pbrt::Point3f pt{ transform( pbrt::Point3f( vertex.x, vertex.y, vertex.z ) ) };
+            return make_float3( pt.x, pt.y, pt.z );
+        } );
     }
+    growContainer( m_indices, mesh->indices.size() );
+    std::transform( mesh->indices.begin(), mesh->indices.end(), std::back_inserter( m_indices ),
+                    [=]( std::uint32_t index ) { return index + indexOffset; } );
+    m_primitiveGroupEndIndices.push_back( containerSize( m_indices ) / VERTS_PER_TRI );
 
-    if( meshInfo.numTextureCoordinates > 0 )
-    {
-        if( meshInfo.numTextureCoordinates != meshInfo.numVertices )
-        {
-            throw std::runtime_error( "Expected " + std::to_string( meshInfo.numVertices )
-                                      + " vertex texture coordinates, got " + std::to_string( meshInfo.numTextureCoordinates ) );
-        }
-
-        // When building the GAS, we have the luxury of supplying the vertex array and the
-        // index array, but in the closest hit program, we only have the primitive index,
-        // not the vertex/normal/uv index.  So we size the array of TriangleUVs structures
-        // to the number of primitives and use the index array to select the appropriate normal
-        // for each vertex.
-        growContainer( m_uvs, numTriangles );
-        for( size_t face = 0; face < numTriangles; ++face )
-        {
-            TriangleUVs uvs;
-            for( size_t vert = 0; vert < VERTS_PER_TRI; ++vert )
-            {
-                // 2 coords per vertex
-                // 3 vertices per face, 3 indices per face
-                const int idx{ buffers.indices[face * VERTS_PER_TRI + vert] * 2 };
-                uvs.UV[vert] = make_float2( buffers.uvCoords[idx + 0], buffers.uvCoords[idx + 1] );
-            }
-            m_uvs.push_back( uvs );
-        }
-    }
+    growContainer( m_normals, mesh->normals.size() );
+    std::copy( mesh->normals.begin(), mesh->normals.end(), std::back_inserter( m_normals ) );
+    growContainer( m_uvs, mesh->uvs.size() );
+    std::copy( mesh->uvs.begin(), mesh->uvs.end(), std::back_inserter( m_uvs ) );
 }
 
 void GeometryCacheImpl::appendTriangleMesh( const pbrt::Transform& transform, const TriangleMeshData& triangleMesh )
@@ -492,9 +804,9 @@ FileSystemInfoPtr createFileSystemInfo()
     return std::make_shared<FileSystemInfoImpl>();
 }
 
-GeometryCachePtr createGeometryCache( FileSystemInfoPtr fileSystemInfo )
+GeometryCachePtr createGeometryCache( FileSystemInfoPtr fileSystemInfo, unsigned int numLoadThreads, bool compactAccels )
 {
-    return std::make_shared<GeometryCacheImpl>( std::move( fileSystemInfo ) );
+    return std::make_shared<GeometryCacheImpl>( std::move( fileSystemInfo ), numLoadThreads, compactAccels );
 }
 
 }  // namespace demandPbrtScene
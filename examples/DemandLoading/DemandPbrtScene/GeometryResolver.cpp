@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -23,9 +23,11 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <stdexcept>
+#include <unordered_set>
 #include <vector>
 
 namespace demandPbrtScene {
@@ -59,9 +61,18 @@ class PbrtGeometryResolver : public GeometryResolver
     GeometryResolverStatistics getStatistics() const override { return m_stats; }
 
   private:
-    void                pushInstance( SceneSyncState& sync, OptixTraversableHandle handle );
-    std::vector<uint_t> sortRequestedProxyGeometriesByVolume();
-    bool resolveProxyGeometry( CUstream stream, OptixDeviceContext context, uint_t proxyGeomId, SceneSyncState& sync );
+    struct RequestedProxy
+    {
+        uint_t        id;
+        SceneProxyPtr proxy;
+        bool          decomposable;
+        bool          ready;  // geometry data has been read
+    };
+
+    void                        pushInstance( SceneSyncState& sync, OptixTraversableHandle handle );
+    std::vector<uint_t>         sortRequestedProxyGeometriesByVolume();
+    std::vector<RequestedProxy> prefetchRequestedProxyGeometries();
+    bool resolveProxyGeometry( CUstream stream, OptixDeviceContext context, const RequestedProxy& request, SceneSyncState& sync );
 
     // Dependencies
     const Options&        m_options;
@@ -74,6 +85,7 @@ class PbrtGeometryResolver : public GeometryResolver
     // Scene data
     OptixTraversableHandle          m_proxyInstanceTraversable{};
     std::map<uint_t, SceneProxyPtr> m_sceneProxies;  // indexed by proxy geometry id
+    std::vector<uint_t>             m_deferredProxies;  // proxies whose data was still being read
     bool                            m_resolveOneGeometry{};
     GeometryResolverStatistics      m_stats{};
 };
@@ -124,6 +136,16 @@ float volume( const OptixAabb& bounds )
 std::vector<uint_t> PbrtGeometryResolver::sortRequestedProxyGeometriesByVolume()
 {
     std::vector<uint_t> ids{ m_geometryLoader->requestedProxyIds() };
+
+    // Deferred proxies are resolved once their data is ready, even if they aren't requested again.
+    if( !m_deferredProxies.empty() )
+    {
+        const std::unordered_set<uint_t> requested( ids.begin(), ids.end() );
+        std::copy_if( m_deferredProxies.begin(), m_deferredProxies.end(), std::back_inserter( ids ),
+                      [&]( uint_t id ) { return requested.find( id ) == requested.end(); } );
+        m_deferredProxies.clear();
+    }
+
     if( m_options.sortProxies )
     {
         std::sort( ids.begin(), ids.end(), [this]( const uint_t lhs, const uint_t rhs ) {
@@ -135,29 +157,42 @@ std::vector<uint_t> PbrtGeometryResolver::sortRequestedProxyGeometriesByVolume()
     return ids;
 }
 
-bool PbrtGeometryResolver::resolveProxyGeometry( CUstream stream, OptixDeviceContext context, uint_t proxyGeomId, SceneSyncState& sync )
+std::vector<PbrtGeometryResolver::RequestedProxy> PbrtGeometryResolver::prefetchRequestedProxyGeometries()
 {
-    bool updateNeeded{};
-
-    m_geometryLoader->remove( proxyGeomId );
-    auto it = m_sceneProxies.find( proxyGeomId );
-    if( it == m_sceneProxies.end() )
+    // Start reading the data of all the requested proxies before resolving any of them, so the
+    // geometry cache reads their meshes concurrently.
+    std::vector<RequestedProxy> requests;
+    for( uint_t id : sortRequestedProxyGeometriesByVolume() )
     {
-        throw std::runtime_error( "Proxy geometry " + std::to_string( proxyGeomId ) + " not found" );
+        auto it = m_sceneProxies.find( id );
+        if( it == m_sceneProxies.end() )
+        {
+            throw std::runtime_error( "Proxy geometry " + std::to_string( id ) + " not found" );
+        }
+        const SceneProxyPtr& proxy{ it->second };
+        const bool           decomposable{ proxy->isDecomposable() };
+        requests.push_back( { id, proxy, decomposable, decomposable || proxy->prefetchGeometry() } );
     }
+    return requests;
+}
+
+bool PbrtGeometryResolver::resolveProxyGeometry( CUstream stream, OptixDeviceContext context, const RequestedProxy& request, SceneSyncState& sync )
+{
+    bool updateNeeded{};
 
-    // Remove proxy from scene proxies map.
-    SceneProxyPtr removedProxy = it->second;
+    // Remove proxy from the geometry loader and scene proxies map.
+    const uint_t proxyGeomId{ request.id };
+    m_geometryLoader->remove( proxyGeomId );
     m_sceneProxies.erase( proxyGeomId );
 
     // Add replacement for the proxy to the scene
-    if( removedProxy->isDecomposable() )
+    if( request.decomposable )
     {
         static std::vector<uint_t> subProxies;
         subProxies.clear();
 
         // get sub-proxies and add to scene
-        for( SceneProxyPtr proxy : removedProxy->decompose( m_proxyFactory ) )
+        for( SceneProxyPtr proxy : request.proxy->decompose( m_proxyFactory ) )
         {
             const uint_t id = proxy->getPageId();
             subProxies.push_back( id );
@@ -172,7 +207,7 @@ bool PbrtGeometryResolver::resolveProxyGeometry( CUstream stream, OptixDeviceCon
     else
     {
         // add instance to TLAS instances
-        const GeometryInstance geom{ removedProxy->createGeometry( context, stream ) };
+        const GeometryInstance geom{ request.proxy->createGeometry( context, stream ) };
         updateNeeded = m_materialResolver->resolveMaterialForGeometry( proxyGeomId, geom, sync );
         ++m_stats.numGeometriesRealized;
     }
@@ -193,17 +228,38 @@ bool PbrtGeometryResolver::resolveRequestedProxyGeometries( CUstream
 
     const unsigned int MIN_REALIZED{ 512 };
     unsigned int       realizedCount{};
+    int                buildCount{};
     bool               realized{};
     bool               updateNeeded{};
-    for( uint_t id : sortRequestedProxyGeometriesByVolume() )
+    const std::vector<RequestedProxy> requests{ prefetchRequestedProxyGeometries() };
+    for( auto it = requests.begin(); it != requests.end(); ++it )
     {
+        const RequestedProxy& request{ *it };
         if( frameTime.expired() && realizedCount > MIN_REALIZED )
         {
+            // Their data may already be loading, so resolve the remaining proxies on a later frame.
+            std::transform( it, requests.end(), std::back_inserter( m_deferredProxies ),
+                            []( const RequestedProxy& remaining ) { return remaining.id; } );
             break;
         }
+        if( !request.decomposable && frameTime.isInteractive() )
+        {
+            // Interactive frames don't wait for mesh data to be read, and build a bounded number of
+            // acceleration structures; the rest are resolved on later frames.
+            if( !request.ready || buildCount >= m_options.geometryBuildsPerFrame )
+            {
+                m_deferredProxies.push_back( request.id );
+                if( !request.ready )
+                {
+                    ++m_stats.numGeometriesDeferred;
+                }
+                continue;
+            }
+            ++buildCount;
+        }
         ++realizedCount;
 
-        if( resolveProxyGeometry( stream, context, id, sync ) )
+        if( resolveProxyGeometry( stream, context, request, sync ) )
         {
             updateNeeded = true;
         }
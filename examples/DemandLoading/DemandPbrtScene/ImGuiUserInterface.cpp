@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -134,8 +134,11 @@ void ImGuiUserInterface::renderGeometryCacheStatistics() const
         ImGui::Text( "Spheres: %u", stats.numSpheres );
         ImGui::Text( "Normals: %u", stats.numNormals );
         ImGui::Text( "UVs: %u", stats.numUVs );
+        ImGui::Text( "Shared meshes: %u", stats.numSharedMeshes );
         ImGui::Text( "Total bytes read: %llu", stats.totalBytesRead );
         ImGui::Text( "Total read time: %.3f secs", stats.totalReadTime );
+        ImGui::Text( "Accel bytes: %llu", stats.totalAccelBytes );
+        ImGui::Text( "Compacted accel bytes: %llu", stats.totalCompactedAccelBytes );
         ImGui::TreePop();
         ImGui::Spacing();
     }
@@ -149,6 +152,10 @@ void ImGuiUserInterface::renderImageCacheStatistics( const char* label, const im
         ImGui::Text( "Num tiles read: %llu", stats.totalTilesRead );
         ImGui::Text( "Num bytes read: %llu", stats.totalBytesRead );
         ImGui::Text( "Read time: %.3f secs", stats.totalReadTime );
+        ImGui::Text( "Num open images: %u", stats.numOpenImageSources );
+        ImGui::Text( "Num closed: %llu", stats.numClosed );
+        ImGui::Text( "Num reopened: %llu", stats.numReopened );
+        ImGui::Text( "Host memory bytes: %zu", stats.hostMemoryUsage );
         ImGui::TreePop();
         ImGui::Spacing();
     }
@@ -202,6 +209,7 @@ void ImGuiUserInterface::renderSceneStatistics() const
         const GeometryResolverStatistics& geometry{ m_stats.geometry };
         ImGui::Text( "Proxy geometries resolved: %u", geometry.numProxyGeometriesResolved );
         ImGui::Text( "Geometries realized: %u", geometry.numGeometriesRealized );
+        ImGui::Text( "Geometries deferred: %u", geometry.numGeometriesDeferred );
         const MaterialResolverStats& materials{ m_stats.materials };
         ImGui::Text( "Proxy materials created: %u", materials.numProxyMaterialsCreated );
         ImGui::Text( "Partial materials realized: %u", materials.numPartialMaterialsRealized );
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -7,6 +7,8 @@
 #include "DemandPbrtScene/Options.h"
 #include "DemandPbrtScene/PbrtAlphaMapImageSource.h"
 
+#include <OptiXToolkit/ImageSource/AsyncReadEngine.h>
+#include <OptiXToolkit/ImageSource/CompressedTextureCacheManifest.h>
 #include <OptiXToolkit/ImageSource/ImageSource.h>
 #include <OptiXToolkit/ImageSource/ImageSourceCache.h>
 #include <OptiXToolkit/ImageSource/TiledImageSource.h>
@@ -14,6 +16,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 
 namespace demandPbrtScene {
 
@@ -26,6 +29,18 @@ class ImageSourceFactoryImpl : public ImageSourceFactory
     ImageSourceFactoryImpl( const Options& options )
         : m_options( options )
     {
+        if( !m_options.textureCacheFolder.empty() )
+            m_textureCache = std::make_unique<imageSource::CompressedTextureCacheManifest>( m_options.textureCacheFolder );
+
+        // The texture cache holds tiled DDS files, whose tiles can be copied straight out of a mapping.
+        // The batches of tiles requested by the demand loader are read through the shared read engine,
+        // which keeps the reads of every batch in flight at once.
+        imageSource::ImageSourceOptions imageOptions;
+        if( m_options.mapTextureCache )
+            imageOptions.ddsFileAccess = imageSource::DDSFileAccess::MEMORY_MAP;
+        if( m_options.readQueueDepth > 0 )
+            imageOptions.readEngine = imageSource::createAsyncReadEngine( static_cast<unsigned int>( m_options.readQueueDepth ) );
+        m_fileCache.setImageSourceOptions( imageOptions );
     }
     ~ImageSourceFactoryImpl() override = default;
 
@@ -38,11 +53,14 @@ class ImageSourceFactoryImpl : public ImageSourceFactory
     ImageSourceFactoryStatistics getStatistics() const override;
 
 private:
-    const Options&                m_options;
-    imageSource::ImageSourceCache m_fileCache;
-    imageSource::ImageSourceCache m_diffuseCache;
-    imageSource::ImageSourceCache m_alphaCache;
-    imageSource::ImageSourceCache m_skyboxCache;
+    const Options&                                               m_options;
+    std::unique_ptr<imageSource::CompressedTextureCacheManifest> m_textureCache;
+    imageSource::ImageSourceCache                                m_fileCache;
+    imageSource::ImageSourceCache                                m_diffuseCache;
+    imageSource::ImageSourceCache                                m_alphaCache;
+    imageSource::ImageSourceCache                                m_skyboxCache;
+
+    std::string getCachedFilePath( const std::string& path ) const;
 };
 
 bool fileExists( const std::string& path )
@@ -57,6 +75,21 @@ std::string replaceExtension( const std::string& path, const std::string& extens
     return path.substr( 0, dot ) + extension;
 }
 
+// Get the compressed texture cache file for an image, if it is cached and up to date.
+std::string ImageSourceFactoryImpl::getCachedFilePath( const std::string& path ) const
+{
+    if( !m_textureCache )
+        return path;
+    const std::string cachedPath = m_textureCache->findCacheFile( path );
+    if( cachedPath.empty() )
+        return path;
+    if( m_options.verboseTextureCreation )
+    {
+        std::cout << "Using cached texture " << cachedPath << " for " << path << '\n';
+    }
+    return cachedPath;
+}
+
 std::shared_ptr<imageSource::ImageSource> ImageSourceFactoryImpl::createDiffuseImageFromFile( const std::string& path )
 {
     // Prefer EXR file if available.
@@ -73,7 +106,7 @@ std::shared_ptr<imageSource::ImageSource> ImageSourceFactoryImpl::createDiffuseI
         std::cout << "Creating diffuse map from " << filePath << '\n';
     }
 
-    image = createTiledImageSource( m_fileCache.get( filePath ) );
+    image = createTiledImageSource( m_fileCache.get( getCachedFilePath( filePath ) ) );
     m_diffuseCache.set( path, image );
     return image;
 }
@@ -109,7 +142,7 @@ ImageSourcePtr ImageSourceFactoryImpl::createSkyboxImageFromFile( const std::str
         std::cout << "Creating skybox map from " << path << '\n';
     }
 
-    image = createTiledImageSource( m_fileCache.get( path ) );
+    image = createTiledImageSource( m_fileCache.get( getCachedFilePath( path ) ) );
     m_skyboxCache.set( path, image );
     return image;
 }
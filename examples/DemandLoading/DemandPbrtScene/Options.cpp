@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -29,6 +29,15 @@ namespace demandPbrtScene {
         "   --bg=<red>/<green>/<blue>   Set image background color; defaults to black\n"
         "   --warmup=<count>            Render <count> frames before saving to file\n"
         "   --face-forward              Flip the direction of back face normals\n"
+        "   --geometry-threads=<count>  Read meshes on <count> background threads; 0 reads them on the\n"
+        "                               render thread; defaults to 4\n"
+        "   --geometry-builds=<count>   Build at most <count> proxy geometries per interactive frame;\n"
+        "                               defaults to 64\n"
+        "   --no-compaction             Keep proxy geometry acceleration structures uncompacted\n"
+        "   --texture-cache=<folder>    Read textures from the compressed texture cache in <folder>\n"
+        "   --map-texture-cache         Memory map the files of the compressed texture cache\n"
+        "   --read-queue-depth=<count>  Keep up to <count> texture tile reads in flight with an asynchronous\n"
+        "                               read engine; 0 reads tiles on the request threads; defaults to 0\n"
         "   --render-mode=<mode>        Specify the initial rendering mode, where <mode> is one of:\n"
         "                               primary     Use primary ray only (default)\n"
         "                               near        Use near ambient occlusion\n"
@@ -130,6 +139,28 @@ Options parseOptions( int argc, char* argv[], const std::function<UsageFn>& usag
             }
             options.warmupFrames = warmup;
         }
+        else if( beginsWith( arg, "--geometry-threads=" ) )
+        {
+            std::istringstream str( extractValue( arg ) );
+            int                threads{};
+            str >> threads;
+            if( !str || threads < 0 )
+            {
+                usage( argv[0], "bad geometry thread count value" );
+            }
+            options.geometryThreads = threads;
+        }
+        else if( beginsWith( arg, "--geometry-builds=" ) )
+        {
+            std::istringstream str( extractValue( arg ) );
+            int                builds{};
+            str >> builds;
+            if( !str || builds <= 0 )
+            {
+                usage( argv[0], "bad geometry builds per frame value" );
+            }
+            options.geometryBuildsPerFrame = builds;
+        }
         else if( beginsWith( arg, "--debug" ) )
         {
             std::istringstream str( extractValue( arg ) );
@@ -188,6 +219,10 @@ Options parseOptions( int argc, char* argv[], const std::function<UsageFn>& usag
         {
             options.verboseLoading = true;
         }
+        else if( arg == "--no-compaction" )
+        {
+            options.compactGeometry = false;
+        }
         else if( arg == "--sort-proxies" )
         {
             options.sortProxies = true;
@@ -200,6 +235,29 @@ Options parseOptions( int argc, char* argv[], const std::function<UsageFn>& usag
         {
             options.faceForward = true;
         }
+        else if( beginsWith( arg, "--texture-cache=" ) )
+        {
+            options.textureCacheFolder = extractValue( arg );
+            if( options.textureCacheFolder.empty() )
+            {
+                usage( argv[0], "missing texture cache folder" );
+            }
+        }
+        else if( arg == "--map-texture-cache" )
+        {
+            options.mapTextureCache = true;
+        }
+        else if( beginsWith( arg, "--read-queue-depth=" ) )
+        {
+            std::istringstream str( extractValue( arg ) );
+            int                depth{};
+            str >> depth;
+            if( !str || depth < 0 )
+            {
+                usage( argv[0], "bad read queue depth value" );
+            }
+            options.readQueueDepth = depth;
+        }
         else if( beginsWith( arg, "--render-mode=" ) )
         {
             const std::string value{ extractValue( arg ) };
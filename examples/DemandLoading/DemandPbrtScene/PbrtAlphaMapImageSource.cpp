@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -76,6 +76,12 @@ bool PbrtAlphaMapImageSource::readTile( char* buffer, unsigned int mipLevel, con
     return true;
 }
 
+bool PbrtAlphaMapImageSource::readTiles( char* buffer, size_t tileStride, unsigned int mipLevel, const imageSource::Tile* tiles, unsigned int numTiles, CUstream stream )
+{
+    // Each tile is converted from the base pixels as it is read.
+    return ImageSource::readTiles( buffer, tileStride, mipLevel, tiles, numTiles, stream );
+}
+
 bool PbrtAlphaMapImageSource::readMipLevel( char* buffer, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream )
 {
     std::unique_lock<std::mutex> lock( m_dataMutex );
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -98,6 +98,7 @@ class WholeSceneProxy : public SceneProxy
     OptixAabb getBounds() const override { return toOptixAabb( m_scene->bounds ); }
     bool      isDecomposable() const override { return true; }
 
+    bool             prefetchGeometry() override { return true; }
     GeometryInstance createGeometry( OptixDeviceContext context, CUstream stream ) override;
 
     std::vector<SceneProxyPtr> decompose( ProxyFactoryPtr proxyFactory ) override;
@@ -129,6 +130,7 @@ class ShapeProxy : public SceneProxy
 
     virtual pbrt::Transform getTransform() const { return {}; }
 
+    bool             prefetchGeometry() override { return m_geometryCache->prefetchShape( getShape() ); }
     GeometryInstance createGeometry( OptixDeviceContext context, CUstream stream ) override;
 
     std::vector<SceneProxyPtr> decompose( ProxyFactoryPtr ) override { return {}; }
@@ -138,6 +140,7 @@ class ShapeProxy : public SceneProxy
     SceneDescriptionPtr m_scene;
     uint_t              m_shapeIndex;
 
+    virtual const ShapeDefinition& getShape() const { return m_scene->freeShapes[m_shapeIndex]; }
     GeometryInstance createGeometryFromShape( OptixDeviceContext context, CUstream stream, const ShapeDefinition& shape );
 
   private:
@@ -163,6 +166,9 @@ class InstanceShapeProxy : public ShapeProxy
 
     GeometryInstance createGeometry( OptixDeviceContext context, CUstream stream ) override;
 
+  protected:
+    const ShapeDefinition& getShape() const override { return m_shape; }
+
   private:
     ObjectInstanceDefinition& m_instance;
     ShapeDefinition&          m_shape;
@@ -194,6 +200,7 @@ class InstancePrimitiveProxy : public SceneProxy
     uint_t                     getPageId() const override { return m_pageId; }
     OptixAabb                  getBounds() const override { return m_bounds; }
     bool                       isDecomposable() const override { return false; }
+    bool                       prefetchGeometry() override;
     GeometryInstance           createGeometry( OptixDeviceContext context, CUstream stream ) override;
     std::vector<SceneProxyPtr> decompose( ProxyFactoryPtr proxyFactory ) override;
 
@@ -231,6 +238,11 @@ InstancePrimitiveProxy::InstancePrimitiveProxy( const Options&      options,
 {
 }
 
+bool InstancePrimitiveProxy::prefetchGeometry()
+{
+    return m_geometryCache->prefetchObject( m_object, m_scene->objectShapes[m_name], m_primitive, m_flags );
+}
+
 GeometryInstance InstancePrimitiveProxy::createGeometry( OptixDeviceContext context, CUstream stream )
 {
     if( m_options.proxyGranularity == ProxyGranularity::FINE )
@@ -284,6 +296,7 @@ class InstanceProxy : public SceneProxy
     OptixAabb getBounds() const override;
     bool      isDecomposable() const override;
 
+    bool             prefetchGeometry() override;
     GeometryInstance createGeometry( OptixDeviceContext context, CUstream stream ) override;
 
     std::vector<SceneProxyPtr> decompose( ProxyFactoryPtr proxyFactory ) override;
@@ -343,6 +356,15 @@ static std::string toString( GeometryPrimitive value )
     return "?Unknown (" + std::to_string( +value ) + ")";
 }
 
+bool InstanceProxy::prefetchGeometry()
+{
+    // A non-decomposable instance has shapes of a single primitive type and material flags.
+    const ShapeList&       shapes{ m_scene->objectShapes[m_name] };
+    const ShapeDefinition& firstShape{ shapes[0] };
+    return m_geometryCache->prefetchObject( m_scene->objects[m_name], shapes, primitiveForType( firstShape.type ),
+                                            shapeMaterialFlags( firstShape ) );
+}
+
 GeometryInstance InstanceProxy::createGeometry( OptixDeviceContext context, CUstream stream )
 {
     if( m_options.proxyGranularity == ProxyGranularity::FINE )
@@ -456,9 +478,7 @@ GeometryInstance ShapeProxy::createGeometryFromShape( OptixDeviceContext context
 
 GeometryInstance ShapeProxy::createGeometry( OptixDeviceContext context, CUstream stream )
 {
-    const ShapeDefinition& shape = m_scene->freeShapes[m_shapeIndex];
-
-    return createGeometryFromShape( context, stream, shape );
+    return createGeometryFromShape( context, stream, getShape() );
 }
 
 class ProxyFactoryImpl : public ProxyFactory
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -18,6 +18,8 @@ class FrameStopwatch
 
     void start() { m_frameStart = Clock::now(); }
 
+    bool isInteractive() const { return m_interactive; }
+
     bool expired() const
     {
         // infinite frame budget when rendering to a file
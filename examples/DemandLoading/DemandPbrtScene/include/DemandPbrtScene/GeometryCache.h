@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -35,6 +35,17 @@ class GeometryCache
   public:
     virtual ~GeometryCache() = default;
 
+    /// Start reading the meshes of a shape and building their host buffers on a background thread.
+    /// Returns true if getShape will not have to wait for the data.
+    virtual bool prefetchShape( const otk::pbrt::ShapeDefinition& shape ) = 0;
+
+    /// Start reading the meshes of an object on a background thread.  Returns true if getObject
+    /// will not have to wait for the data.
+    virtual bool prefetchObject( const otk::pbrt::ObjectDefinition& object,
+                                 const otk::pbrt::ShapeList&        shapes,
+                                 GeometryPrimitive                  primitive,
+                                 MaterialFlags                      flags ) = 0;
+
     virtual GeometryCacheEntry getShape( OptixDeviceContext context, CUstream stream, const otk::pbrt::ShapeDefinition& shape ) = 0;
 
     virtual GeometryCacheEntry getObject( OptixDeviceContext                 context,
@@ -59,6 +70,9 @@ using FileSystemInfoPtr = std::shared_ptr<FileSystemInfo>;
 
 FileSystemInfoPtr createFileSystemInfo();
 
-GeometryCachePtr createGeometryCache( FileSystemInfoPtr fileSystemInfo );
+/// Create a geometry cache that reads meshes on numLoadThreads background threads.  When
+/// numLoadThreads is zero, meshes are read synchronously by getShape and getObject.  When
+/// compactAccels is true, each GAS is compacted into a pooled device allocation after it is built.
+GeometryCachePtr createGeometryCache( FileSystemInfoPtr fileSystemInfo, unsigned int numLoadThreads = 0, bool compactAccels = false );
 
 }  // namespace demandPbrtScene
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -13,8 +13,11 @@ struct GeometryCacheStatistics
     unsigned int       numSpheres;
     unsigned int       numNormals;
     unsigned int       numUVs;
+    unsigned int       numSharedMeshes;           // triangle meshes that reused the GAS of an identical mesh
     unsigned long long totalBytesRead;
     double             totalReadTime;
+    unsigned long long totalAccelBytes;           // GAS output bytes as built
+    unsigned long long totalCompactedAccelBytes;  // GAS bytes retained after compaction
 };
 
 }  // namespace demandPbrtScene
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,6 +10,7 @@ struct GeometryResolverStatistics
 {
     unsigned int numProxyGeometriesResolved;
     unsigned int numGeometriesRealized;
+    unsigned int numGeometriesDeferred;  // resolutions put off to a later frame while mesh data was read
 };
 
 }  // namespace demandPbrtScene
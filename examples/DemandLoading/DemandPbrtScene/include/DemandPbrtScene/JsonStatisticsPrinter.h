@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -34,8 +34,11 @@ inline std::ostream& operator<<( std::ostream& str, const Json<GeometryCacheStat
     DUMP_JSON_MEMBER( numSpheres ) << ',';
     DUMP_JSON_MEMBER( numNormals ) << ',';
     DUMP_JSON_MEMBER( numUVs ) << ',';
+    DUMP_JSON_MEMBER( numSharedMeshes ) << ',';
     DUMP_JSON_MEMBER( totalBytesRead ) << ',';
-    DUMP_JSON_MEMBER( totalReadTime );
+    DUMP_JSON_MEMBER( totalReadTime ) << ',';
+    DUMP_JSON_MEMBER( totalAccelBytes ) << ',';
+    DUMP_JSON_MEMBER( totalCompactedAccelBytes );
     str << '}';
     return str;
 }
@@ -46,7 +49,11 @@ inline std::ostream& operator<<( std::ostream& str, const Json<imageSource::Cach
     DUMP_JSON_MEMBER( numImageSources ) << ',';
     DUMP_JSON_MEMBER( totalTilesRead ) << ',';
     DUMP_JSON_MEMBER( totalBytesRead ) << ',';
-    DUMP_JSON_MEMBER( totalReadTime );
+    DUMP_JSON_MEMBER( totalReadTime ) << ',';
+    DUMP_JSON_MEMBER( numOpenImageSources ) << ',';
+    DUMP_JSON_MEMBER( numClosed ) << ',';
+    DUMP_JSON_MEMBER( numReopened ) << ',';
+    DUMP_JSON_MEMBER( hostMemoryUsage );
     str << '}';
     return str;
 }
@@ -79,7 +86,8 @@ inline std::ostream& operator<<( std::ostream& str, const Json<GeometryResolverS
 {
     str << '{';
     DUMP_JSON_MEMBER( numProxyGeometriesResolved ) << ',';
-    DUMP_JSON_MEMBER( numGeometriesRealized );
+    DUMP_JSON_MEMBER( numGeometriesRealized ) << ',';
+    DUMP_JSON_MEMBER( numGeometriesDeferred );
     str << '}';
     return str;
 }
@@ -192,10 +200,14 @@ inline std::ostream& operator<<( std::ostream& str, const Json<Options>& json )
     DUMP_JSON_OBJECT( program ) << ',';
     DUMP_JSON_OBJECT( sceneFile ) << ',';
     DUMP_JSON_OBJECT( outFile ) << ',';
+    DUMP_JSON_OBJECT( textureCacheFolder ) << ',';
     DUMP_JSON_MEMBER( width ) << ',';
     DUMP_JSON_MEMBER( height ) << ',';
     DUMP_JSON_OBJECT( background ) << ',';
     DUMP_JSON_MEMBER( warmupFrames ) << ',';
+    DUMP_JSON_MEMBER( geometryThreads ) << ',';
+    DUMP_JSON_MEMBER( geometryBuildsPerFrame ) << ',';
+    DUMP_JSON_OBJECT( compactGeometry ) << ',';
     DUMP_JSON_OBJECT( oneShotGeometry ) << ',';
     DUMP_JSON_OBJECT( oneShotMaterial ) << ',';
     DUMP_JSON_OBJECT( verboseLoading ) << ',';
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -19,10 +19,16 @@ struct Options
     std::string      program;
     std::string      sceneFile;
     std::string      outFile;
+    std::string      textureCacheFolder;
     int              width{ 768 };
     int              height{ 512 };
     float3           background{};
     int              warmupFrames{ 0 };
+    int              geometryThreads{ 4 };
+    int              geometryBuildsPerFrame{ 64 };
+    bool             compactGeometry{ true };
+    bool             mapTextureCache{};
+    int              readQueueDepth{};
     bool             oneShotGeometry{};
     bool             oneShotMaterial{};
     bool             verboseLoading{};
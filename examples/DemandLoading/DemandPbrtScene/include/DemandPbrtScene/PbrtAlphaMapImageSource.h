@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -25,6 +25,8 @@ class PbrtAlphaMapImageSource : public imageSource::WrappedImageSource
 
     bool readTile( char* buffer, unsigned int mipLevel, const imageSource::Tile& tile, CUstream stream ) override;
 
+    bool readTiles( char* buffer, size_t tileStride, unsigned int mipLevel, const imageSource::Tile* tiles, unsigned int numTiles, CUstream stream ) override;
+
     bool readMipLevel( char* buffer, unsigned int mipLevel, unsigned int expectedWidth, unsigned int expectedHeight, CUstream stream ) override;
 
     bool readMipTail( char*        dest,
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -55,6 +55,10 @@ class SceneProxy
     /// Returns true if this proxy can be decomposed into further proxies.
     virtual bool isDecomposable() const = 0;
 
+    /// For a non-decomposable proxy, starts reading the geometry data in the background.  Returns
+    /// true if the data is ready and createGeometry will not have to wait for it.
+    virtual bool prefetchGeometry() = 0;
+
     /// For a non-decomposable proxy, creates an acceleration structure for the geometry and returns a GeometryInstance.
     virtual GeometryInstance createGeometry( OptixDeviceContext context, CUstream stream ) = 0;
 
@@ -30,7 +30,10 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <iterator>
+#include <thread>
 #include <type_traits>
 
 using namespace demandPbrtScene;
@@ -798,6 +801,114 @@ TEST_F( TestGeometryCache, constructTriangleASForTwoTriangleMesh )
     EXPECT_EQ( 2U, m_geom.primitiveGroupEndIndices[0] );
 }
 
+TEST_F( TestGeometryCache, identicalTriangleMeshesShareTriangleAS )
+{
+    MeshData          buffers;
+    ShapeDefinition   shape{ singleTriangleTriangleMesh( buffers ) };
+    ShapeDefinition   otherShape{ shape };
+    const auto        expectedOptions{ buildAllowsRandomVertexAccess() };
+    const auto        expectedInput{
+        AllOf( NotNull(), hasTriangleBuildInput( 0, hasAll( hasDeviceVertexCoords( buffers.vertexCoords ),
+                                                                   hasDeviceIndices( buffers.indices ), hasSbtFlags( m_expectedFlags ),
+                                                                   hasNoPreTransform(), hasNoSbtIndexOffsets(),
+                                                                   hasNoPrimitiveIndexOffset(), hasNoOpacityMap() ) ) ) };
+    configureAccelComputeMemoryUsage( expectedOptions, expectedInput );
+    configureAccelBuild( expectedOptions, expectedInput );
+
+    m_geom = m_geometryCache->getShape( m_fakeContext, m_stream, shape );
+    const GeometryCacheEntry otherGeom{ m_geometryCache->getShape( m_fakeContext, m_stream, otherShape ) };
+    OTK_ERROR_CHECK( cudaDeviceSynchronize() );
+    const Stats stats{ m_geometryCache->getStatistics() };
+
+    EXPECT_EQ( m_geom.accelBuffer, otherGeom.accelBuffer );
+    EXPECT_EQ( m_geom.traversable, otherGeom.traversable );
+    EXPECT_EQ( 1, stats.numTraversables );
+    EXPECT_EQ( 1, stats.numTriangles );
+    EXPECT_EQ( 1, stats.numSharedMeshes );
+}
+
+TEST_F( TestGeometryCache, differentTriangleMeshesHaveDifferentTriangleAS )
+{
+    MeshData          buffers;
+    ShapeDefinition   shape{ singleTriangleTriangleMesh( buffers ) };
+    MeshData          otherBuffers;
+    ShapeDefinition   otherShape{ singleTriangleTriangleMeshWithNormals( otherBuffers ) };
+    const auto        expectedOptions{ buildAllowsRandomVertexAccess() };
+    EXPECT_CALL( m_optix, accelComputeMemoryUsage( m_fakeContext, expectedOptions, NotNull(), 1, NotNull() ) )
+        .Times( 2 )
+        .WillRepeatedly( DoAll( SetArgPointee<4>( m_accelSizes ), Return( OPTIX_SUCCESS ) ) );
+    EXPECT_CALL( m_optix, accelBuild( m_fakeContext, m_stream, expectedOptions, NotNull(), 1, Ne( CUdeviceptr{} ),
+                                      m_accelSizes.tempSizeInBytes, Ne( CUdeviceptr{} ), m_accelSizes.outputSizeInBytes,
+                                      NotNull(), nullptr, 0 ) )
+        .Times( 2 )
+        .WillRepeatedly( DoAll( SetArgPointee<9>( m_fakeGeomAS ), Return( OPTIX_SUCCESS ) ) );
+
+    m_geom = m_geometryCache->getShape( m_fakeContext, m_stream, shape );
+    GeometryCacheEntry otherGeom{ m_geometryCache->getShape( m_fakeContext, m_stream, otherShape ) };
+    OTK_ERROR_CHECK( cudaDeviceSynchronize() );
+    const Stats stats{ m_geometryCache->getStatistics() };
+
+    EXPECT_NE( m_geom.accelBuffer, otherGeom.accelBuffer );
+    EXPECT_EQ( 2, stats.numTraversables );
+    EXPECT_EQ( 0, stats.numSharedMeshes );
+    OTK_ERROR_CHECK( cuMemFree( otherGeom.accelBuffer ) );
+    OTK_ERROR_CHECK( cudaFree( otherGeom.devNormals ) );
+}
+
+TEST_F( TestGeometryCache, constructCompactedTriangleASForTriangleMesh )
+{
+    const GeometryCachePtr       geometryCache{ createGeometryCache( m_fileSystemInfo, 0, /*compactAccels=*/true ) };
+    const std::uint64_t          compactedSize{ 1024U };
+    const OptixTraversableHandle compactedAS{ 0xc0ffeeU };
+    MeshData                     buffers;
+    ShapeDefinition              shape{ singleTriangleTriangleMesh( buffers ) };
+    const auto                   expectedOptions{ AllOf( buildAllowsRandomVertexAccess(), buildAllowsCompaction() ) };
+    const auto                   expectedInput{
+        AllOf( NotNull(), hasTriangleBuildInput( 0, hasAll( hasDeviceVertexCoords( buffers.vertexCoords ),
+                                                                              hasDeviceIndices( buffers.indices ), hasSbtFlags( m_expectedFlags ),
+                                                                              hasNoPreTransform(), hasNoSbtIndexOffsets(),
+                                                                              hasNoPrimitiveIndexOffset(), hasNoOpacityMap() ) ) ) };
+    const auto emitsCompactedSize{ Pointee( Field( &OptixAccelEmitDesc::type, OPTIX_PROPERTY_TYPE_COMPACTED_SIZE ) ) };
+    configureAccelComputeMemoryUsage( expectedOptions, expectedInput );
+    EXPECT_CALL( m_optix, accelBuild( m_fakeContext, m_stream, expectedOptions, expectedInput, 1, Ne( CUdeviceptr{} ),
+                                      m_accelSizes.tempSizeInBytes, Ne( CUdeviceptr{} ), m_accelSizes.outputSizeInBytes,
+                                      NotNull(), emitsCompactedSize, 1 ) )
+        .WillOnce( DoAll( SetArgPointee<9>( m_fakeGeomAS ), WithArg<10>( [=]( const OptixAccelEmitDesc* property ) {
+                              OTK_ERROR_CHECK( cuMemcpyHtoD( property->result, &compactedSize, sizeof( compactedSize ) ) );
+                          } ),
+                          Return( OPTIX_SUCCESS ) ) );
+    EXPECT_CALL( m_optix, accelCompact( m_fakeContext, m_stream, m_fakeGeomAS, Ne( CUdeviceptr{} ), compactedSize, NotNull() ) )
+        .WillOnce( DoAll( SetArgPointee<5>( compactedAS ), Return( OPTIX_SUCCESS ) ) );
+
+    // The compacted GAS is owned by the cache's pool, so it is not freed by TearDown.
+    const GeometryCacheEntry geom{ geometryCache->getShape( m_fakeContext, m_stream, shape ) };
+    OTK_ERROR_CHECK( cudaDeviceSynchronize() );
+    const Stats stats{ geometryCache->getStatistics() };
+
+    EXPECT_NE( CUdeviceptr{}, geom.accelBuffer );
+    EXPECT_EQ( compactedAS, geom.traversable );
+    EXPECT_EQ( 1, stats.numTraversables );
+    EXPECT_EQ( m_accelSizes.outputSizeInBytes, stats.totalAccelBytes );
+    EXPECT_EQ( compactedSize, stats.totalCompactedAccelBytes );
+}
+
+TEST_F( TestGeometryCache, uncompactedTriangleASReportsBuiltSize )
+{
+    MeshData          buffers;
+    ShapeDefinition   shape{ singleTriangleTriangleMesh( buffers ) };
+    const auto        expectedOptions{ AllOf( buildAllowsRandomVertexAccess(), Not( buildAllowsCompaction() ) ) };
+    const auto        expectedInput{ NotNull() };
+    configureAccelComputeMemoryUsage( expectedOptions, expectedInput );
+    configureAccelBuild( expectedOptions, expectedInput );
+
+    m_geom = m_geometryCache->getShape( m_fakeContext, m_stream, shape );
+    OTK_ERROR_CHECK( cudaDeviceSynchronize() );
+    const Stats stats{ m_geometryCache->getStatistics() };
+
+    EXPECT_EQ( m_accelSizes.outputSizeInBytes, stats.totalAccelBytes );
+    EXPECT_EQ( m_accelSizes.outputSizeInBytes, stats.totalCompactedAccelBytes );
+}
+
 TEST( TestHasDeviceTriangleNormals, normalsPointerIsNull )
 {
     TriangleMeshData triangleMesh{};
@@ -998,6 +1109,62 @@ TEST_F( TestGeometryCache, twoPlyInstancesShareSameGAS )
     EXPECT_EQ( 0, stats.numUVs );
 }
 
+TEST_F( TestGeometryCache, prefetchPlyMeshWithoutLoadThreadsIsReady )
+{
+    MockMeshLoaderPtr meshLoader{ createMockMeshLoader() };
+    ShapeDefinition   shape{};
+    shape.type    = SHAPE_TYPE_PLY_MESH;
+    shape.plyMesh = PlyMeshData{ ARBITRARY_PLY_FILENAME, meshLoader };
+
+    EXPECT_TRUE( m_geometryCache->prefetchShape( shape ) );
+}
+
+TEST_F( TestGeometryCache, prefetchTriangleMeshIsReady )
+{
+    const GeometryCachePtr geometryCache{ createGeometryCache( m_fileSystemInfo, 1 ) };
+    MeshData               buffers;
+
+    EXPECT_TRUE( geometryCache->prefetchShape( singleTriangleTriangleMesh( buffers ) ) );
+}
+
+TEST_F( TestGeometryCache, constructTriangleASForPrefetchedPlyMesh )
+{
+    expectPlyFileSizeReturned();
+    MockMeshLoaderPtr meshLoader{ createMockMeshLoader() };
+    MeshData          buffers;
+    MeshInfo          info{};
+    ShapeDefinition   shape{ singleTrianglePlyMeshWithNormals( meshLoader, buffers, info ) };
+    const auto        expectedOptions{ buildAllowsRandomVertexAccess() };
+    const auto        expectedInput{
+        AllOf( NotNull(), hasTriangleBuildInput( 0, hasAll( hasDeviceVertexCoords( buffers.vertexCoords ),
+                                                                   hasDeviceIndices( buffers.indices ), hasSbtFlags( m_expectedFlags ),
+                                                                   hasNoPreTransform(), hasNoSbtIndexOffsets(),
+                                                                   hasNoPrimitiveIndexOffset(), hasNoOpacityMap() ) ) ) };
+    configureAccelComputeMemoryUsage( expectedOptions, expectedInput );
+    configureAccelBuild( expectedOptions, expectedInput );
+    const GeometryCachePtr geometryCache{ createGeometryCache( m_fileSystemInfo, 2 ) };
+
+    // The mesh is read once on a load thread, however many times it is prefetched.
+    bool ready{ geometryCache->prefetchShape( shape ) };
+    for( int i = 0; !ready && i < 1000; ++i )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        ready = geometryCache->prefetchShape( shape );
+    }
+    ASSERT_TRUE( ready );
+    m_geom = geometryCache->getShape( m_fakeContext, m_stream, shape );
+    OTK_ERROR_CHECK( cudaDeviceSynchronize() );
+    const Stats stats{ geometryCache->getStatistics() };
+
+    EXPECT_EQ( m_fakeGeomAS, m_geom.traversable );
+    EXPECT_THAT( m_geom.devNormals, hasDevicePlyNormals( &buffers ) );
+    EXPECT_EQ( 1, stats.numTraversables );
+    EXPECT_EQ( 1, stats.numTriangles );
+    EXPECT_EQ( 3, stats.numNormals );
+    EXPECT_EQ( ARBITRARY_PLY_FILE_SIZE, stats.totalBytesRead );
+    EXPECT_TRUE( geometryCache->prefetchShape( shape ) );
+}
+
 TEST_F( TestGeometryCache, constructSphereASForSphere )
 {
     MockMeshLoaderPtr   meshLoader{ createMockMeshLoader() };
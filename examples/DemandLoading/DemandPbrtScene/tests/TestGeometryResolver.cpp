@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -60,6 +60,7 @@ class MockSceneProxy : public StrictMock<SceneProxy>
     MOCK_METHOD( uint_t, getPageId, (), ( const, override ) );
     MOCK_METHOD( OptixAabb, getBounds, (), ( const, override ) );
     MOCK_METHOD( bool, isDecomposable, (), ( const, override ) );
+    MOCK_METHOD( bool, prefetchGeometry, (), ( override ) );
     MOCK_METHOD( GeometryInstance, createGeometry, ( OptixDeviceContext, CUstream ), ( override ) );
     MOCK_METHOD( std::vector<SceneProxyPtr>, decompose, ( ProxyFactoryPtr proxyFactory ), ( override ) );
 };
@@ -194,6 +195,7 @@ TEST_F( TestGeometryResolverInitialized, resolveGeometry )
     EXPECT_CALL( *m_geometryLoader, requestedProxyIds() ).After( m_init ).WillOnce( Return( std::vector<uint_t>{ m_proxyPageId } ) );
     EXPECT_CALL( *m_geometryLoader, remove( m_proxyPageId ) ).After( m_init );
     EXPECT_CALL( *m_sceneProxy, isDecomposable() ).After( m_init ).WillOnce( Return( false ) );
+    EXPECT_CALL( *m_sceneProxy, prefetchGeometry() ).After( m_init ).WillOnce( Return( true ) );
     GeometryInstance geomInstance{};
     EXPECT_CALL( *m_sceneProxy, createGeometry( m_fakeContext, m_stream ) ).After( m_init ).WillOnce( Return( geomInstance ) );
     EXPECT_CALL( *m_materialResolver, resolveMaterialForGeometry( m_proxyPageId, _, _ ) ).After( m_init ).WillOnce( Return( false ) );
@@ -245,3 +247,56 @@ TEST_F( TestGeometryResolverInitialized, decomposeProxy )
     Mock::AllowLeak( child1.get() );
     Mock::AllowLeak( child2.get() );
 }
+
+TEST_F( TestGeometryResolverInitialized, resolveGeometryWaitsForDataWhenRenderingToFile )
+{
+    EXPECT_CALL( *m_geometryLoader, requestedProxyIds() ).After( m_init ).WillOnce( Return( std::vector<uint_t>{ m_proxyPageId } ) );
+    EXPECT_CALL( *m_geometryLoader, remove( m_proxyPageId ) ).After( m_init );
+    EXPECT_CALL( *m_sceneProxy, isDecomposable() ).After( m_init ).WillOnce( Return( false ) );
+    EXPECT_CALL( *m_sceneProxy, prefetchGeometry() ).After( m_init ).WillOnce( Return( false ) );
+    EXPECT_CALL( *m_sceneProxy, createGeometry( m_fakeContext, m_stream ) ).After( m_init ).WillOnce( Return( GeometryInstance{} ) );
+    EXPECT_CALL( *m_materialResolver, resolveMaterialForGeometry( m_proxyPageId, _, _ ) ).After( m_init ).WillOnce( Return( false ) );
+    EXPECT_CALL( *m_geometryLoader, clearRequestedProxyIds() ).Times( 1 ).After( m_init );
+    EXPECT_CALL( *m_geometryLoader, copyToDeviceAsync( m_stream ) ).Times( 1 ).After( m_init );
+    EXPECT_CALL( *m_geometryLoader, createTraversable( m_fakeContext, m_stream ) ).After( m_init ).WillOnce( Return( m_fakeProxyTraversable ) );
+    m_sync.topLevelInstances.resize( 1 );
+
+    const bool result{ m_resolver->resolveRequestedProxyGeometries( m_stream, m_fakeContext, m_timer, m_sync ) };
+
+    EXPECT_TRUE( result );
+    const GeometryResolverStatistics stats = m_resolver->getStatistics();
+    EXPECT_EQ( 1U, stats.numGeometriesRealized );
+    EXPECT_EQ( 0U, stats.numGeometriesDeferred );
+}
+
+TEST_F( TestGeometryResolverInitialized, interactiveFrameDefersGeometryUntilDataIsReady )
+{
+    FrameStopwatch interactiveTimer{ true };
+    interactiveTimer.start();
+    EXPECT_CALL( *m_geometryLoader, requestedProxyIds() )
+        .After( m_init )
+        .WillOnce( Return( std::vector<uint_t>{ m_proxyPageId } ) )
+        .WillOnce( Return( std::vector<uint_t>{} ) );
+    EXPECT_CALL( *m_sceneProxy, isDecomposable() ).After( m_init ).WillRepeatedly( Return( false ) );
+    EXPECT_CALL( *m_sceneProxy, prefetchGeometry() ).After( m_init ).WillOnce( Return( false ) ).WillOnce( Return( true ) );
+    EXPECT_CALL( *m_geometryLoader, clearRequestedProxyIds() ).Times( 2 ).After( m_init );
+    EXPECT_CALL( *m_geometryLoader, remove( m_proxyPageId ) ).After( m_init );
+    EXPECT_CALL( *m_sceneProxy, createGeometry( m_fakeContext, m_stream ) ).After( m_init ).WillOnce( Return( GeometryInstance{} ) );
+    EXPECT_CALL( *m_materialResolver, resolveMaterialForGeometry( m_proxyPageId, _, _ ) ).After( m_init ).WillOnce( Return( false ) );
+    EXPECT_CALL( *m_geometryLoader, copyToDeviceAsync( m_stream ) ).Times( 1 ).After( m_init );
+    EXPECT_CALL( *m_geometryLoader, createTraversable( m_fakeContext, m_stream ) ).After( m_init ).WillOnce( Return( m_fakeProxyTraversable ) );
+    m_sync.topLevelInstances.resize( 1 );
+
+    // The proxy is not requested again, but is resolved once its data is ready.
+    const bool result1{ m_resolver->resolveRequestedProxyGeometries( m_stream, m_fakeContext, interactiveTimer, m_sync ) };
+    const GeometryResolverStatistics stats1 = m_resolver->getStatistics();
+    const bool result2{ m_resolver->resolveRequestedProxyGeometries( m_stream, m_fakeContext, interactiveTimer, m_sync ) };
+    const GeometryResolverStatistics stats2 = m_resolver->getStatistics();
+
+    EXPECT_FALSE( result1 );
+    EXPECT_EQ( 1U, stats1.numGeometriesDeferred );
+    EXPECT_EQ( 0U, stats1.numGeometriesRealized );
+    EXPECT_TRUE( result2 );
+    EXPECT_EQ( 1U, stats2.numGeometriesDeferred );
+    EXPECT_EQ( 1U, stats2.numGeometriesRealized );
+}
@@ -33,10 +33,17 @@ void TestJsonStatisticsPrinter::SetUp()
     m_stats.geometryCache.numUVs = 5;
     m_stats.geometryCache.totalBytesRead = 6U;
     m_stats.geometryCache.totalReadTime = 7.0;
+    m_stats.geometryCache.numSharedMeshes = 30;
+    m_stats.geometryCache.totalAccelBytes = 31U;
+    m_stats.geometryCache.totalCompactedAccelBytes = 32U;
     m_stats.imageSourceFactory.fileSources.numImageSources = 8;
     m_stats.imageSourceFactory.fileSources.totalTilesRead = 9;
     m_stats.imageSourceFactory.fileSources.totalBytesRead = 10;
     m_stats.imageSourceFactory.fileSources.totalReadTime = 11;
+    m_stats.imageSourceFactory.fileSources.numOpenImageSources = 33;
+    m_stats.imageSourceFactory.fileSources.numClosed = 34;
+    m_stats.imageSourceFactory.fileSources.numReopened = 35;
+    m_stats.imageSourceFactory.fileSources.hostMemoryUsage = 36;
     m_stats.proxyFactory.numSceneProxiesCreated = 12;
     m_stats.proxyFactory.numShapeProxiesCreated = 13;
     m_stats.proxyFactory.numInstanceProxiesCreated = 14;
@@ -55,18 +62,19 @@ void TestJsonStatisticsPrinter::SetUp()
     m_stats.scene.numObjects = 26;
     m_stats.scene.numObjectShapes = 27;
     m_stats.scene.numObjectInstances = 28;
+    m_stats.geometry.numGeometriesDeferred = 29;
 
     // If this is a string literal inside EXPECT_EQ it fails to compile on msvc due to the fileName JSON value escapes.
     m_expectedStatsJson =
         // clang-format off
         R"json({)json"
         R"json("numFramesRendered":1234,)json"
-        R"json("geometryCache":{"numTraversables":1,"numTriangles":2,"numSpheres":3,"numNormals":4,"numUVs":5,"totalBytesRead":6,"totalReadTime":7},)json"
+        R"json("geometryCache":{"numTraversables":1,"numTriangles":2,"numSpheres":3,"numNormals":4,"numUVs":5,"numSharedMeshes":30,"totalBytesRead":6,"totalReadTime":7,"totalAccelBytes":31,"totalCompactedAccelBytes":32},)json"
         R"json("imageSourceFactory":{)json"
-        R"json("fileSources":{"numImageSources":8,"totalTilesRead":9,"totalBytesRead":10,"totalReadTime":11},)json"
-        R"json("alphaSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0},)json"
-        R"json("diffuseSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0},)json"
-        R"json("skyboxSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0})json"
+        R"json("fileSources":{"numImageSources":8,"totalTilesRead":9,"totalBytesRead":10,"totalReadTime":11,"numOpenImageSources":33,"numClosed":34,"numReopened":35,"hostMemoryUsage":36},)json"
+        R"json("alphaSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0,"numOpenImageSources":0,"numClosed":0,"numReopened":0,"hostMemoryUsage":0},)json"
+        R"json("diffuseSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0,"numOpenImageSources":0,"numClosed":0,"numReopened":0,"hostMemoryUsage":0},)json"
+        R"json("skyboxSources":{"numImageSources":0,"totalTilesRead":0,"totalBytesRead":0,"totalReadTime":0,"numOpenImageSources":0,"numClosed":0,"numReopened":0,"hostMemoryUsage":0})json"
         R"json(},)json"
         R"json("proxyFactory":{)json"
             R"json("numSceneProxiesCreated":12,)json"
@@ -78,7 +86,8 @@ void TestJsonStatisticsPrinter::SetUp()
         R"json(},)json"
         R"json("geometry":{)json"
             R"json("numProxyGeometriesResolved":18,)json"
-            R"json("numGeometriesRealized":19)json"
+            R"json("numGeometriesRealized":19,)json"
+            R"json("numGeometriesDeferred":29)json"
         R"json(},)json"
         R"json("materials":{)json"
             R"json("numPartialMaterialsRealized":20,)json"
@@ -154,8 +163,12 @@ TEST_F(TestJsonStatisticsPrinter, printOptions)
     options.program = "DemandPbrtScene";
     options.sceneFile = "scene.pbrt";
     options.outFile = "out.png";
+    options.textureCacheFolder = "cache";
     options.background = make_float3(1.0, 2.0, 3.0);
     options.warmupFrames = 4;
+    options.geometryThreads = 2;
+    options.geometryBuildsPerFrame = 32;
+    options.compactGeometry = true;
     options.oneShotGeometry = true;
     options.oneShotMaterial = true;
     options.verboseLoading = true;
@@ -180,10 +193,14 @@ TEST_F(TestJsonStatisticsPrinter, printOptions)
         R"json("program":"DemandPbrtScene",)json"
         R"json("sceneFile":"scene.pbrt",)json"
         R"json("outFile":"out.png",)json"
+        R"json("textureCacheFolder":"cache",)json"
         R"json("width":768,)json"
         R"json("height":512,)json"
         R"json("background":[1,2,3],)json"
         R"json("warmupFrames":4,)json"
+        R"json("geometryThreads":2,)json"
+        R"json("geometryBuildsPerFrame":32,)json"
+        R"json("compactGeometry":true,)json"
         R"json("oneShotGeometry":true,)json"
         R"json("oneShotMaterial":true,)json"
         R"json("verboseLoading":true,)json"
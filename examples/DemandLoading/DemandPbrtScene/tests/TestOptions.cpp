@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -468,3 +468,110 @@ TEST_F( TestOptions, unknownProxyGranularity )
     const demandPbrtScene::Options options =
         getOptions( { "DemandPbrtScene", "--proxy-granularity=foo", "scene.pbrt" } );
 }
+
+TEST_F( TestOptions, noTextureCacheByDefault )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "scene.pbrt" } );
+
+    EXPECT_TRUE( options.textureCacheFolder.empty() );
+}
+
+TEST_F( TestOptions, textureCacheFolder )
+{
+    const demandPbrtScene::Options options =
+        getOptions( { "DemandPbrtScene", "--texture-cache=compressedCache", "scene.pbrt" } );
+
+    EXPECT_EQ( "compressedCache", options.textureCacheFolder );
+}
+
+TEST_F( TestOptions, missingTextureCacheFolder )
+{
+    EXPECT_CALL( m_mockUsage, Call( StrEq( "DemandPbrtScene" ), StrEq( "missing texture cache folder" ) ) ).Times( 1 );
+
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--texture-cache=", "scene.pbrt" } );
+}
+
+TEST_F( TestOptions, textureCacheNotMappedByDefault )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "scene.pbrt" } );
+
+    EXPECT_FALSE( options.mapTextureCache );
+}
+
+TEST_F( TestOptions, mapTextureCache )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--map-texture-cache", "scene.pbrt" } );
+
+    EXPECT_TRUE( options.mapTextureCache );
+}
+
+TEST_F( TestOptions, noReadEngineByDefault )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "scene.pbrt" } );
+
+    EXPECT_EQ( 0, options.readQueueDepth );
+}
+
+TEST_F( TestOptions, readQueueDepth )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--read-queue-depth=128", "scene.pbrt" } );
+
+    EXPECT_EQ( 128, options.readQueueDepth );
+}
+
+TEST_F( TestOptions, badReadQueueDepth )
+{
+    EXPECT_CALL( m_mockUsage, Call( StrEq( "DemandPbrtScene" ), StrEq( "bad read queue depth value" ) ) ).Times( 1 );
+
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--read-queue-depth=-1", "scene.pbrt" } );
+}
+
+TEST_F( TestOptions, geometryThreadsDefaultsToFour )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "scene.pbrt" } );
+
+    EXPECT_EQ( 4, options.geometryThreads );
+    EXPECT_EQ( 64, options.geometryBuildsPerFrame );
+}
+
+TEST_F( TestOptions, geometryThreads )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--geometry-threads=0", "scene.pbrt" } );
+
+    EXPECT_EQ( 0, options.geometryThreads );
+}
+
+TEST_F( TestOptions, badGeometryThreads )
+{
+    EXPECT_CALL( m_mockUsage, Call( StrEq( "DemandPbrtScene" ), StrEq( "bad geometry thread count value" ) ) ).Times( 1 );
+
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--geometry-threads=-1", "scene.pbrt" } );
+}
+
+TEST_F( TestOptions, geometryBuildsPerFrame )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--geometry-builds=16", "scene.pbrt" } );
+
+    EXPECT_EQ( 16, options.geometryBuildsPerFrame );
+}
+
+TEST_F( TestOptions, badGeometryBuildsPerFrame )
+{
+    EXPECT_CALL( m_mockUsage, Call( StrEq( "DemandPbrtScene" ), StrEq( "bad geometry builds per frame value" ) ) ).Times( 1 );
+
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--geometry-builds=0", "scene.pbrt" } );
+}
+
+TEST_F( TestOptions, geometryCompactedByDefault )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "scene.pbrt" } );
+
+    EXPECT_TRUE( options.compactGeometry );
+}
+
+TEST_F( TestOptions, noCompaction )
+{
+    const demandPbrtScene::Options options = getOptions( { "DemandPbrtScene", "--no-compaction", "scene.pbrt" } );
+
+    EXPECT_FALSE( options.compactGeometry );
+}
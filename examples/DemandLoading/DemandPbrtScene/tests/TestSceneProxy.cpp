@@ -536,6 +536,11 @@ class MockGeometryCache : public StrictMock<GeometryCache>
   public:
     ~MockGeometryCache() override = default;
 
+    MOCK_METHOD( bool, prefetchShape, (const ShapeDefinition&), ( override ) );
+    MOCK_METHOD( bool,
+                 prefetchObject,
+                 ( const ObjectDefinition& object, const ShapeList& shapes, GeometryPrimitive primitive, MaterialFlags flags ),
+                 ( override ) );
     MOCK_METHOD( GeometryCacheEntry, getShape, (OptixDeviceContext, CUstream, const ShapeDefinition&), ( override ) );
     MOCK_METHOD( GeometryCacheEntry,
                  getObject,
@@ -1146,6 +1151,16 @@ TEST_F( TestSceneProxy, constructTriangleASForSinglePlyMesh )
     EXPECT_EQ( nullptr, geom.devUVs );
 }
 
+TEST_F( TestSceneProxy, prefetchGeometryForSinglePlyMesh )
+{
+    m_scene = singleTrianglePlyScene( createMockMeshLoader() );
+    expectProxyBoundsAdded( m_scene->bounds, m_pageId );
+    m_proxy = m_factory->scene( m_scene );
+    EXPECT_CALL( *m_geometryCache, prefetchShape( Ref( m_scene->freeShapes[0] ) ) ).WillOnce( Return( false ) );
+
+    EXPECT_FALSE( m_proxy->prefetchGeometry() );
+}
+
 TEST_F( TestSceneProxy, multipleInstancesSingleShapeGeometry )
 {
     m_scene = multipleInstancesSingleShape();
@@ -1309,6 +1324,20 @@ TEST_F( TestSceneProxy, coarseObjectSamePrimitiveYieldsSingleGeometry )
     EXPECT_EQ( triangles.devUVs, geom.devUVs );
 }
 
+TEST_F( TestSceneProxy, coarseObjectSamePrimitivePrefetchesObject )
+{
+    m_options.proxyGranularity = ProxyGranularity::COARSE;
+    m_scene                    = singleInstanceTwoTriangleShapeScene();
+    expectProxyBoundsAdded( m_scene->bounds, m_pageId );
+    m_proxy = m_factory->sceneInstance( m_scene, 0 );
+    const std::string& name{ m_scene->objects.begin()->first };
+    EXPECT_CALL( *m_geometryCache, prefetchObject( m_scene->objects[name], m_scene->objectShapes[name],
+                                                   GeometryPrimitive::TRIANGLE, MaterialFlags::NONE ) )
+        .WillOnce( Return( true ) );
+
+    EXPECT_TRUE( m_proxy->prefetchGeometry() );
+}
+
 TEST_F( TestSceneProxy, createSceneInstancePrimitiveProxy )
 {
     const std::string name{ "triangles" };
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -10,6 +10,7 @@
 #include <OptiXToolkit/DemandLoading/DemandLoadLogger.h>
 #include <OptiXToolkit/OTKAppBase/OTKApp.h>
 #include <OptiXToolkit/Error/cudaErrorCheck.h>
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
 #include <OptiXToolkit/ImageSource/MipMapImageSource.h>
 #include <OptiXToolkit/ImageSource/TiledImageSource.h>
 
@@ -65,7 +66,10 @@ ImageSourcePtr DemandTextureViewer::createImageSource( const std::string& textur
 
 void DemandTextureViewer::createTexture( const std::string& textureName, bool tile, bool mipmap )
 {
+    // Read each tile once for all devices.
     ImageSourcePtr imageSource( createImageSource( textureName, tile, mipmap ) );
+    const unsigned int numDevices = static_cast<unsigned int>( m_perDeviceOptixStates.size() );
+    imageSource                   = imageSource::createFanOutImageSource( imageSource, numDevices );
 
     demandLoading::TextureDescriptor texDesc = makeTextureDescriptor( CU_TR_ADDRESS_MODE_CLAMP, FILTER_BILINEAR );
     for( OTKAppPerDeviceOptixState& state : m_perDeviceOptixStates )
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -9,6 +9,7 @@
 #include <OptiXToolkit/OTKAppBase/OTKAppShapeMaker.h>
 #include <OptiXToolkit/Error/cudaErrorCheck.h>
 #include <OptiXToolkit/Error/optixErrorCheck.h>
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
 #include <OptiXToolkit/ImageSource/MultiCheckerImage.h>
 #include <OptiXToolkit/ShaderUtil/ray_cone.h>
 #include <OptiXToolkit/ShaderUtil/vec_math.h>
@@ -84,7 +85,11 @@ void RayConesApp::createTexture()
         std::cout << "ERROR: Could not find image " << m_textureName << ". Substituting procedural image.\n";
     if( !imageSource )
         imageSource.reset( new imageSource::MultiCheckerImage<uchar4>( 16384, 16384, 64, true ) );
-    
+
+    // Read each tile once for all devices.
+    const unsigned int numDevices = static_cast<unsigned int>( m_perDeviceOptixStates.size() );
+    imageSource                   = imageSource::createFanOutImageSource( imageSource, numDevices );
+
     demandLoading::TextureDescriptor texDesc = makeTextureDescriptor( CU_TR_ADDRESS_MODE_CLAMP, FILTER_BILINEAR );
 
     for( OTKAppPerDeviceOptixState& state : m_perDeviceOptixStates )
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2021-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -15,6 +15,7 @@
 #include <OptiXToolkit/Gui/CUDAOutputBuffer.h>
 #include <OptiXToolkit/Gui/Camera.h>
 #include <OptiXToolkit/Gui/Window.h>
+#include <OptiXToolkit/ImageSource/FanOutImageSource.h>
 #include <OptiXToolkit/OptiXMemory/CompileOptions.h>
 #include <OptiXToolkit/ShaderUtil/vec_math.h>
 #include <OptiXToolkit/Util/Logger.h>
@@ -558,6 +559,9 @@ int main( int argc, char* argv[] )
         std::string                  directory( getSourceDir() + "/Textures/" );
         std::shared_ptr<ImageSource> imageSource = imageSource::createImageSource( textureFile, directory );
 
+        // Read each tile once for all devices.
+        imageSource = imageSource::createFanOutImageSource( imageSource, static_cast<unsigned int>( states.size() ) );
+
         // Set up OptiX per-device states and demand loaders
         // The texture id is passed to the closest hit shader via a hit group record in the SBT.
         // The texture sampler array (indexed by texture id) is passed as a launch parameter.
@@ -0,0 +1,737 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "BinaryPlyReader.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace ply {
+
+/// A read-only memory mapping of a whole file.
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    /// Map the file.  Returns false if the file cannot be opened or mapped, or is empty.
+    bool open( const std::string& filename );
+
+    const char* data() const { return m_data; }
+    size_t      size() const { return m_size; }
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+
+  private:
+#ifdef _WIN32
+    HANDLE m_handle  = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+    const char* m_data = nullptr;
+    size_t      m_size = 0;
+};
+
+#ifdef _WIN32
+
+bool MappedFile::open( const std::string& filename )
+{
+    m_handle = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( m_handle == INVALID_HANDLE_VALUE )
+        return false;
+    LARGE_INTEGER fileSize;
+    if( !GetFileSizeEx( m_handle, &fileSize ) || fileSize.QuadPart == 0 )
+        return false;
+    m_mapping = CreateFileMappingA( m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    if( m_mapping == nullptr )
+        return false;
+    m_data = static_cast<const char*>( MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ) );
+    m_size = m_data != nullptr ? static_cast<size_t>( fileSize.QuadPart ) : 0;
+    return m_data != nullptr;
+}
+
+MappedFile::~MappedFile()
+{
+    if( m_data != nullptr )
+        UnmapViewOfFile( m_data );
+    if( m_mapping != nullptr )
+        CloseHandle( m_mapping );
+    if( m_handle != INVALID_HANDLE_VALUE )
+        CloseHandle( m_handle );
+}
+
+#else
+
+bool MappedFile::open( const std::string& filename )
+{
+    const int fd = ::open( filename.c_str(), O_RDONLY | O_CLOEXEC );
+    if( fd < 0 )
+        return false;
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) != 0 || fileStat.st_size == 0 )
+    {
+        ::close( fd );
+        return false;
+    }
+    void* data = mmap( nullptr, static_cast<size_t>( fileStat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );  // the mapping keeps the file open
+    if( data == MAP_FAILED )
+        return false;
+    // The whole file is read, so start reading ahead now.
+    madvise( data, static_cast<size_t>( fileStat.st_size ), MADV_WILLNEED );
+    m_data = static_cast<const char*>( data );
+    m_size = static_cast<size_t>( fileStat.st_size );
+    return true;
+}
+
+MappedFile::~MappedFile()
+{
+    if( m_data != nullptr )
+        munmap( const_cast<char*>( m_data ), m_size );
+}
+
+#endif
+
+namespace {
+
+// Number of faces in a chunk of the face block.  The face block has variable length records, so
+// it is scanned once to find the start of each chunk, after which chunks are decoded in parallel.
+const size_t FACES_PER_CHUNK = 64 * 1024;
+
+// Minimum number of vertices decoded by a thread.
+const size_t MIN_VERTICES_PER_TASK = 256 * 1024;
+
+// Number of vertices whose positions are decoded at once when computing the bounds.
+const size_t BOUNDS_BLOCK_SIZE = 4096;
+
+bool isLittleEndianHost()
+{
+    const uint16_t one = 1;
+    unsigned char  firstByte;
+    memcpy( &firstByte, &one, 1 );
+    return firstByte == 1;
+}
+
+// Byte swaps written as shifts, which compilers turn into bswap instructions, or vector shuffles
+// in loops.
+inline uint8_t byteSwap( uint8_t value )
+{
+    return value;
+}
+inline uint16_t byteSwap( uint16_t value )
+{
+    return static_cast<uint16_t>( ( value >> 8 ) | ( value << 8 ) );
+}
+inline uint32_t byteSwap( uint32_t value )
+{
+    return ( value >> 24 ) | ( ( value >> 8 ) & 0xFF00U ) | ( ( value << 8 ) & 0xFF0000U ) | ( value << 24 );
+}
+inline uint64_t byteSwap( uint64_t value )
+{
+    return ( static_cast<uint64_t>( byteSwap( static_cast<uint32_t>( value ) ) ) << 32 ) | byteSwap( static_cast<uint32_t>( value >> 32 ) );
+}
+
+template <size_t N>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1>
+{
+    using type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2>
+{
+    using type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4>
+{
+    using type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8>
+{
+    using type = uint64_t;
+};
+
+template <typename T>
+inline T loadValue( const char* src, bool swapBytes )
+{
+    using Bits = typename UnsignedOfSize<sizeof( T )>::type;
+    Bits bits;
+    memcpy( &bits, src, sizeof( T ) );
+    if( swapBytes )
+        bits = byteSwap( bits );
+    T value;
+    memcpy( &value, &bits, sizeof( T ) );
+    return value;
+}
+
+// Convert a strided column of values to floats.  The branch on byte order is hoisted out of the loop.
+template <typename T>
+void decodeColumn( const char* src, size_t stride, size_t count, bool swapBytes, float* dest, int destStride )
+{
+    if( swapBytes )
+    {
+        for( size_t i = 0; i < count; ++i )
+            dest[i * destStride] = static_cast<float>( loadValue<T>( src + i * stride, true ) );
+    }
+    else
+    {
+        for( size_t i = 0; i < count; ++i )
+            dest[i * destStride] = static_cast<float>( loadValue<T>( src + i * stride, false ) );
+    }
+}
+
+// Byte swap an array of floats in place.
+void byteSwapFloats( float* values, size_t count )
+{
+    for( size_t i = 0; i < count; ++i )
+    {
+        uint32_t bits;
+        memcpy( &bits, &values[i], sizeof( bits ) );
+        bits = byteSwap( bits );
+        memcpy( &values[i], &bits, sizeof( bits ) );
+    }
+}
+
+// The layout of face records, which have fixed size properties before and after the list of
+// vertex indices.
+struct FaceLayout
+{
+    size_t bytesBefore;
+    size_t bytesAfter;
+    size_t countSize;
+    bool   swapBytes;
+    size_t numVertices;
+};
+
+// Decode the faces of a chunk with vertex indices of type T, fan triangulating polygons.
+// Returns false if a vertex index is out of range.
+template <typename T>
+bool decodeFaceChunk( const FaceLayout& layout, const char* src, size_t numFaces, int* dest )
+{
+    auto readIndex = [&layout]( const char* p, bool& valid ) -> int {
+        const T index = loadValue<T>( p, layout.swapBytes );
+        valid         = valid && index >= 0 && static_cast<size_t>( index ) < layout.numVertices;
+        return static_cast<int>( index );
+    };
+    bool valid = true;
+    for( size_t face = 0; face < numFaces; ++face )
+    {
+        src += layout.bytesBefore;
+        size_t count;
+        if( layout.countSize == 1 )
+            count = static_cast<uint8_t>( *src );
+        else if( layout.countSize == 2 )
+            count = loadValue<uint16_t>( src, layout.swapBytes );
+        else
+            count = loadValue<uint32_t>( src, layout.swapBytes );
+        src += layout.countSize;
+        if( count >= 3 )
+        {
+            const int first = readIndex( src, valid );
+            int       prev  = readIndex( src + sizeof( T ), valid );
+            for( size_t i = 2; i < count; ++i )
+            {
+                const int next = readIndex( src + i * sizeof( T ), valid );
+                dest[0]        = first;
+                dest[1]        = prev;
+                dest[2]        = next;
+                dest += 3;
+                prev = next;
+            }
+        }
+        src += count * sizeof( T ) + layout.bytesAfter;
+    }
+    return valid;
+}
+
+}  // anonymous namespace
+
+size_t BinaryReader::getSize( Type type )
+{
+    const size_t sizes[] = { 0, 1, 1, 2, 2, 4, 4, 4, 8 };
+    return sizes[static_cast<int>( type )];
+}
+
+BinaryReader::BinaryReader( unsigned int numThreads )
+    : m_numThreads( numThreads != 0 ? numThreads : std::max( 1U, std::thread::hardware_concurrency() ) )
+{
+}
+
+BinaryReader::~BinaryReader() = default;
+
+void BinaryReader::error( const std::string& message ) const
+{
+    throw std::runtime_error( m_filename + ": " + message );
+}
+
+bool BinaryReader::open( const std::string& filename )
+{
+    m_filename = filename;
+    m_file.reset( new MappedFile );
+    if( !m_file->open( filename ) )
+        return false;
+
+    // Find the end of the header.  Files that don't start with a binary PLY header are left to rply.
+    const char* data = m_file->data();
+    const size_t size = m_file->size();
+    static const char formatPrefix[] = "ply\nformat binary_";
+    static const char formatPrefixCR[] = "ply\r\nformat binary_";
+    if( !( size >= sizeof( formatPrefix ) - 1 && memcmp( data, formatPrefix, sizeof( formatPrefix ) - 1 ) == 0 )
+        && !( size >= sizeof( formatPrefixCR ) - 1 && memcmp( data, formatPrefixCR, sizeof( formatPrefixCR ) - 1 ) == 0 ) )
+        return false;
+    static const char endHeader[] = "end_header";
+    const char*       headerEnd   = nullptr;
+    for( const char* line = data; line < data + size; )
+    {
+        const char* lineEnd = static_cast<const char*>( memchr( line, '\n', data + size - line ) );
+        if( lineEnd == nullptr )
+            break;
+        if( static_cast<size_t>( lineEnd - line ) >= sizeof( endHeader ) - 1 && memcmp( line, endHeader, sizeof( endHeader ) - 1 ) == 0 )
+        {
+            headerEnd = lineEnd + 1;
+            break;
+        }
+        line = lineEnd + 1;
+    }
+    if( headerEnd == nullptr )
+        error( "missing end_header" );
+    parseHeader( data, headerEnd );
+
+    // Find the element blocks, scanning those with lists.
+    size_t offset = static_cast<size_t>( headerEnd - data );
+    for( Element& element : m_elements )
+    {
+        element.dataOffset = offset;
+        if( element.stride != 0 )
+        {
+            if( element.count > ( size - offset ) / element.stride )
+                error( "truncated " + element.name + " data" );
+            element.dataSize = element.count * element.stride;
+        }
+        else
+        {
+            scanElement( element );
+        }
+        offset += element.dataSize;
+    }
+    return true;
+}
+
+void BinaryReader::parseHeader( const char* begin, const char* end )
+{
+    std::istringstream header( std::string( begin, end ) );
+    std::string        line;
+    std::getline( header, line );  // ply
+    auto parseType = [this]( const std::string& name ) -> Type {
+        const char* const names[][2] = { { "char", "int8" },    { "uchar", "uint8" },   { "short", "int16" },
+                                         { "ushort", "uint16" }, { "int", "int32" },     { "uint", "uint32" },
+                                         { "float", "float32" }, { "double", "float64" } };
+        for( int i = 0; i < 8; ++i )
+        {
+            if( name == names[i][0] || name == names[i][1] )
+                return static_cast<Type>( i + 1 );
+        }
+        error( "unknown property type " + name );
+    };
+
+    while( std::getline( header, line ) )
+    {
+        if( !line.empty() && line.back() == '\r' )
+            line.pop_back();
+        std::istringstream words( line );
+        std::string        keyword;
+        words >> keyword;
+        if( keyword == "format" )
+        {
+            std::string format;
+            words >> format;
+            if( format != "binary_little_endian" && format != "binary_big_endian" )
+                error( "unknown format " + format );
+            m_swapBytes = ( format == "binary_little_endian" ) != isLittleEndianHost();
+        }
+        else if( keyword == "element" )
+        {
+            Element element{};
+            if( !( words >> element.name >> element.count ) )
+                error( "bad element: " + line );
+            m_elements.push_back( element );
+        }
+        else if( keyword == "property" )
+        {
+            if( m_elements.empty() )
+                error( "property before element: " + line );
+            Element&    element = m_elements.back();
+            Property    property{};
+            std::string type;
+            words >> type;
+            if( type == "list" )
+            {
+                std::string countType;
+                words >> countType >> type;
+                property.countType = parseType( countType );
+                if( property.countType == Type::FLOAT32 || property.countType == Type::FLOAT64 )
+                    error( "bad list count type: " + line );
+            }
+            property.type   = parseType( type );
+            property.offset = element.stride;
+            if( !( words >> property.name ) )
+                error( "bad property: " + line );
+            element.properties.push_back( property );
+            element.stride += getSize( property.type );
+        }
+        else if( keyword == "end_header" )
+        {
+            break;
+        }
+        else if( keyword != "comment" && keyword != "obj_info" && !keyword.empty() )
+        {
+            error( "unknown header line: " + line );
+        }
+    }
+
+    // Elements with lists have variable size.
+    for( Element& element : m_elements )
+    {
+        for( const Property& property : element.properties )
+        {
+            if( property.countType != Type::NONE )
+                element.stride = 0;
+        }
+    }
+
+    // Find the properties of the mesh.
+    auto findProperty = []( const Element& element, const char* name ) -> const Property* {
+        for( const Property& property : element.properties )
+        {
+            if( property.name == name )
+                return &property;
+        }
+        return nullptr;
+    };
+    for( const Element& element : m_elements )
+    {
+        if( element.name == "vertex" )
+            m_vertices = &element;
+        else if( element.name == "face" )
+            m_faces = &element;
+    }
+    if( m_vertices == nullptr )
+        error( "missing vertex element" );
+    if( m_vertices->stride == 0 )
+        error( "unsupported list property in vertex element" );
+    const char* const positionNames[] = { "x", "y", "z" };
+    const char* const normalNames[]   = { "nx", "ny", "nz" };
+    for( int i = 0; i < 3; ++i )
+    {
+        m_positions[i] = findProperty( *m_vertices, positionNames[i] );
+        m_normals[i]   = findProperty( *m_vertices, normalNames[i] );
+        if( m_positions[i] == nullptr )
+            error( std::string( "missing vertex property " ) + positionNames[i] );
+    }
+    if( m_normals[0] == nullptr || m_normals[1] == nullptr || m_normals[2] == nullptr )
+        m_normals[0] = m_normals[1] = m_normals[2] = nullptr;
+    // variant texture coordinate names: (u,v), (s,t), (texture_u,texture_v), (texture_s,texture_t)
+    const char* const uNames[] = { "u", "s", "texture_u", "texture_s" };
+    const char* const vNames[] = { "v", "t", "texture_v", "texture_t" };
+    for( int i = 0; i < 4 && m_uvs[0] == nullptr; ++i )
+    {
+        m_uvs[0] = findProperty( *m_vertices, uNames[i] );
+        m_uvs[1] = findProperty( *m_vertices, vNames[i] );
+        if( m_uvs[1] == nullptr )
+            m_uvs[0] = nullptr;
+    }
+    if( m_faces != nullptr )
+    {
+        m_vertexIndices = findProperty( *m_faces, "vertex_indices" );
+        if( m_vertexIndices == nullptr )
+            m_vertexIndices = findProperty( *m_faces, "vertex_index" );
+        if( m_vertexIndices == nullptr || m_vertexIndices->countType == Type::NONE || m_vertexIndices->type == Type::FLOAT32
+            || m_vertexIndices->type == Type::FLOAT64 )
+            error( "missing or bad face vertex_indices property" );
+    }
+}
+
+// Scan an element with list properties to find its size.  The start of each chunk of faces and
+// the number of triangles are recorded for the face element.
+void BinaryReader::scanElement( Element& element )
+{
+    const char*  data    = m_file->data();
+    const size_t size    = m_file->size();
+    size_t       offset  = element.dataOffset;
+    const bool   isFaces = &element == m_faces;
+    for( size_t i = 0; i < element.count; ++i )
+    {
+        if( isFaces && i % FACES_PER_CHUNK == 0 )
+            m_faceChunks.push_back( FaceChunk{ offset, i, m_numTriangles } );
+        for( const Property& property : element.properties )
+        {
+            if( property.countType == Type::NONE )
+            {
+                offset += getSize( property.type );
+                continue;
+            }
+            const size_t countSize = getSize( property.countType );
+            if( offset > size || size - offset < countSize )
+                error( "truncated " + element.name + " data" );
+            const char* src = data + offset;
+            size_t      count;
+            switch( property.countType )
+            {
+                case Type::INT8:
+                case Type::UINT8:
+                    count = static_cast<uint8_t>( *src );
+                    break;
+                case Type::INT16:
+                case Type::UINT16:
+                    count = loadValue<uint16_t>( src, m_swapBytes );
+                    break;
+                default:
+                    count = loadValue<uint32_t>( src, m_swapBytes );
+                    break;
+            }
+            offset += countSize + count * getSize( property.type );
+            if( &property == m_vertexIndices && count >= 3 )
+                m_numTriangles += count - 2;
+        }
+        if( offset > size )
+            error( "truncated " + element.name + " data" );
+    }
+    element.dataSize = offset - element.dataOffset;
+}
+
+const char* BinaryReader::getData( const Element& element ) const
+{
+    return m_file->data() + element.dataOffset;
+}
+
+template <typename Fn>
+void BinaryReader::parallelFor( size_t count, size_t minPerTask, const Fn& fn ) const
+{
+    const size_t numTasks = std::max<size_t>( 1, std::min<size_t>( m_numThreads, count / std::max<size_t>( 1, minPerTask ) ) );
+    const size_t perTask  = ( count + numTasks - 1 ) / numTasks;
+    std::vector<std::thread> threads;
+    for( size_t task = 1; task < numTasks; ++task )
+    {
+        const size_t begin = std::min( count, task * perTask );
+        threads.emplace_back( fn, task, begin, std::min( count, begin + perTask ) );
+    }
+    fn( 0, 0, std::min( count, perTask ) );
+    for( std::thread& thread : threads )
+        thread.join();
+}
+
+// Decode the vertex properties for a range of vertices into consecutive vectors of floats.
+void BinaryReader::decodeVectors( const Property* const* properties, int numComponents, size_t begin, size_t end, float* dest ) const
+{
+    const size_t stride = m_vertices->stride;
+    const char*  src    = getData( *m_vertices ) + begin * stride;
+    const size_t count  = end - begin;
+
+    // Adjacent float components are copied in bulk, then byte swapped if necessary.
+    bool adjacentFloats = true;
+    for( int c = 0; c < numComponents; ++c )
+        adjacentFloats = adjacentFloats && properties[c]->type == Type::FLOAT32
+                         && properties[c]->offset == properties[0]->offset + c * sizeof( float );
+    if( adjacentFloats )
+    {
+        const size_t rowSize = numComponents * sizeof( float );
+        src += properties[0]->offset;
+        if( stride == rowSize )
+        {
+            memcpy( dest, src, count * rowSize );
+        }
+        else
+        {
+            for( size_t i = 0; i < count; ++i )
+                memcpy( dest + i * numComponents, src + i * stride, rowSize );
+        }
+        if( m_swapBytes )
+            byteSwapFloats( dest, count * numComponents );
+        return;
+    }
+
+    for( int c = 0; c < numComponents; ++c )
+    {
+        const char* column = src + properties[c]->offset;
+        switch( properties[c]->type )
+        {
+            case Type::INT8:
+                decodeColumn<int8_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::UINT8:
+                decodeColumn<uint8_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::INT16:
+                decodeColumn<int16_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::UINT16:
+                decodeColumn<uint16_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::INT32:
+                decodeColumn<int32_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::UINT32:
+                decodeColumn<uint32_t>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::FLOAT32:
+                decodeColumn<float>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::FLOAT64:
+                decodeColumn<double>( column, stride, count, m_swapBytes, dest + c, numComponents );
+                break;
+            case Type::NONE:
+                break;
+        }
+    }
+}
+
+void BinaryReader::decodeFaces( int* dest ) const
+{
+    // Get the sizes of the face properties before and after the vertex indices.  Other list
+    // properties are not supported.
+    FaceLayout layout{ 0, 0, getSize( m_vertexIndices->countType ), m_swapBytes, m_vertices->count };
+    bool       after = false;
+    for( const Property& property : m_faces->properties )
+    {
+        if( &property == m_vertexIndices )
+            after = true;
+        else if( property.countType != Type::NONE )
+            error( "unsupported list property " + property.name + " in face element" );
+        else
+            ( after ? layout.bytesAfter : layout.bytesBefore ) += getSize( property.type );
+    }
+
+    std::atomic<bool> valid( true );
+    parallelFor( m_faceChunks.size(), 1, [&]( size_t, size_t begin, size_t end ) {
+        for( size_t i = begin; i < end; ++i )
+        {
+            const FaceChunk& chunk    = m_faceChunks[i];
+            const size_t     numFaces = std::min( m_faces->count, chunk.firstFace + FACES_PER_CHUNK ) - chunk.firstFace;
+            const char*      src      = m_file->data() + chunk.dataOffset;
+            int*             triangles = dest + 3 * chunk.firstTriangle;
+            bool             chunkValid = true;
+            switch( m_vertexIndices->type )
+            {
+                case Type::INT8:
+                    chunkValid = decodeFaceChunk<int8_t>( layout, src, numFaces, triangles );
+                    break;
+                case Type::UINT8:
+                    chunkValid = decodeFaceChunk<uint8_t>( layout, src, numFaces, triangles );
+                    break;
+                case Type::INT16:
+                    chunkValid = decodeFaceChunk<int16_t>( layout, src, numFaces, triangles );
+                    break;
+                case Type::UINT16:
+                    chunkValid = decodeFaceChunk<uint16_t>( layout, src, numFaces, triangles );
+                    break;
+                case Type::INT32:
+                    chunkValid = decodeFaceChunk<int32_t>( layout, src, numFaces, triangles );
+                    break;
+                case Type::UINT32:
+                    chunkValid = decodeFaceChunk<uint32_t>( layout, src, numFaces, triangles );
+                    break;
+                default:
+                    break;
+            }
+            if( !chunkValid )
+                valid = false;
+        }
+    } );
+    if( !valid )
+        error( "vertex index out of range" );
+}
+
+otk::pbrt::MeshInfo BinaryReader::readInfo()
+{
+    otk::pbrt::MeshInfo info{};
+    info.numVertices           = static_cast<long>( m_vertices->count );
+    info.numNormals            = m_normals[0] != nullptr ? info.numVertices : 0;
+    info.numTextureCoordinates = m_uvs[0] != nullptr ? info.numVertices : 0;
+    info.numTriangles          = static_cast<long>( m_numTriangles );
+
+    // Each task finds the bounds of its vertices, a block at a time.
+    struct Bounds
+    {
+        float minCoord[3];
+        float maxCoord[3];
+    };
+    Bounds empty;
+    std::fill( std::begin( empty.minCoord ), std::end( empty.minCoord ), std::numeric_limits<float>::max() );
+    std::fill( std::begin( empty.maxCoord ), std::end( empty.maxCoord ), -std::numeric_limits<float>::max() );
+    std::vector<Bounds> taskBounds( m_numThreads, empty );
+    parallelFor( m_vertices->count, MIN_VERTICES_PER_TASK, [&]( size_t task, size_t begin, size_t end ) {
+        std::vector<float> positions( 3 * BOUNDS_BLOCK_SIZE );
+        Bounds&            bounds = taskBounds[task];
+        for( size_t blockBegin = begin; blockBegin < end; blockBegin += BOUNDS_BLOCK_SIZE )
+        {
+            const size_t blockEnd = std::min( end, blockBegin + BOUNDS_BLOCK_SIZE );
+            decodeVectors( m_positions, 3, blockBegin, blockEnd, positions.data() );
+            for( size_t i = 0; i < blockEnd - blockBegin; ++i )
+            {
+                for( int c = 0; c < 3; ++c )
+                {
+                    bounds.minCoord[c] = std::min( bounds.minCoord[c], positions[i * 3 + c] );
+                    bounds.maxCoord[c] = std::max( bounds.maxCoord[c], positions[i * 3 + c] );
+                }
+            }
+        }
+    } );
+    if( m_vertices->count > 0 )
+    {
+        std::copy( std::begin( empty.minCoord ), std::end( empty.minCoord ), info.minCoord );
+        std::copy( std::begin( empty.maxCoord ), std::end( empty.maxCoord ), info.maxCoord );
+        for( const Bounds& bounds : taskBounds )
+        {
+            for( int c = 0; c < 3; ++c )
+            {
+                info.minCoord[c] = std::min( info.minCoord[c], bounds.minCoord[c] );
+                info.maxCoord[c] = std::max( info.maxCoord[c], bounds.maxCoord[c] );
+            }
+        }
+    }
+    return info;
+}
+
+void BinaryReader::load( otk::pbrt::MeshData& buffers )
+{
+    const size_t numVertices = m_vertices->count;
+    buffers.vertexCoords.resize( numVertices * 3 );
+    buffers.normalCoords.resize( m_normals[0] != nullptr ? numVertices * 3 : 0 );
+    buffers.uvCoords.resize( m_uvs[0] != nullptr ? numVertices * 2 : 0 );
+    buffers.indices.resize( m_numTriangles * 3 );
+
+    parallelFor( numVertices, MIN_VERTICES_PER_TASK, [&]( size_t, size_t begin, size_t end ) {
+        decodeVectors( m_positions, 3, begin, end, buffers.vertexCoords.data() + begin * 3 );
+        if( m_normals[0] != nullptr )
+            decodeVectors( m_normals, 3, begin, end, buffers.normalCoords.data() + begin * 3 );
+        if( m_uvs[0] != nullptr )
+            decodeVectors( m_uvs, 2, begin, end, buffers.uvCoords.data() + begin * 2 );
+    } );
+    if( m_faces != nullptr )
+        decodeFaces( buffers.indices.data() );
+}
+
+}  // namespace ply
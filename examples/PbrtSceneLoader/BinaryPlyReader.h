@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <OptiXToolkit/PbrtSceneLoader/MeshReader.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ply {
+
+class MappedFile;
+
+/// Reads binary (little or big endian) PLY files from a memory mapping.  Element blocks are
+/// decoded with typed bulk copies and byte swaps rather than per-scalar callbacks, and large
+/// blocks are decoded in parallel.  Faces with more than three vertices are fan triangulated.
+class BinaryReader
+{
+  public:
+    /// Create a reader that decodes with up to numThreads threads (0 means the hardware concurrency).
+    explicit BinaryReader( unsigned int numThreads = 0 );
+    ~BinaryReader();
+
+    /// Map the file and parse its header and face sizes.  Returns false if the file is not a
+    /// binary PLY file, e.g. if it is an ASCII PLY file.  Throws std::runtime_error if the file
+    /// cannot be opened or is malformed.
+    bool open( const std::string& filename );
+
+    /// Get the element counts and the bounds of the vertex positions.
+    otk::pbrt::MeshInfo readInfo();
+
+    /// Decode the vertex positions, normals, texture coordinates, and triangle indices.
+    void load( otk::pbrt::MeshData& buffers );
+
+  private:
+    enum class Type
+    {
+        NONE,
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        FLOAT32,
+        FLOAT64
+    };
+
+    struct Property
+    {
+        std::string name;
+        Type        type;
+        Type        countType;  // NONE unless the property is a list
+        size_t      offset;     // byte offset within fixed size elements
+    };
+
+    struct Element
+    {
+        std::string           name;
+        size_t                count;
+        std::vector<Property> properties;
+        size_t                stride;      // bytes per element, or 0 if the element has lists
+        size_t                dataOffset;  // byte offset of the element block in the file
+        size_t                dataSize;    // byte size of the element block
+    };
+
+    // A run of faces decoded by one task, and the index of its first triangle.
+    struct FaceChunk
+    {
+        size_t dataOffset;
+        size_t firstFace;
+        size_t firstTriangle;
+    };
+
+    unsigned int                m_numThreads;
+    std::string                 m_filename;
+    std::unique_ptr<MappedFile> m_file;
+    bool                        m_swapBytes{};
+    std::vector<Element>        m_elements;
+    const Element*              m_vertices{};
+    const Element*              m_faces{};
+    const Property*             m_positions[3]{};
+    const Property*             m_normals[3]{};
+    const Property*             m_uvs[2]{};
+    const Property*             m_vertexIndices{};
+    size_t                      m_numTriangles{};
+    std::vector<FaceChunk>      m_faceChunks;
+
+    static size_t getSize( Type type );
+    void          parseHeader( const char* begin, const char* end );
+    void          scanElement( Element& element );
+    const char*   getData( const Element& element ) const;
+    void decodeVectors( const Property* const* properties, int numComponents, size_t begin, size_t end, float* dest ) const;
+    void decodeFaces( int* dest ) const;
+    template <typename Fn>
+    void parallelFor( size_t count, size_t minPerTask, const Fn& fn ) const;
+    [[noreturn]] void error( const std::string& message ) const;
+};
+
+}  // namespace ply
@@ -1,9 +1,11 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
 #include <OptiXToolkit/PbrtSceneLoader/PlyReader.h>
 
+#include "BinaryPlyReader.h"
+
 #include <OptiXToolkit/Memory/BitCast.h>
 
 #include <algorithm>
@@ -63,6 +65,46 @@ class MeshLoader : public ::otk::pbrt::MeshLoader
     static void s_errorCallback( p_ply ply, const char* message );
 };
 
+class BinaryMeshLoader : public ::otk::pbrt::MeshLoader
+{
+  public:
+    BinaryMeshLoader( const std::string& filename, otk::pbrt::MeshInfo info )
+        : m_filename( filename )
+        , m_meshInfo( info )
+    {
+    }
+    ~BinaryMeshLoader() override = default;
+
+    otk::pbrt::MeshInfo getMeshInfo() const override { return m_meshInfo; }
+
+    void load( otk::pbrt::MeshData& buffers ) override;
+
+  private:
+    std::string         m_filename;
+    otk::pbrt::MeshInfo m_meshInfo;
+};
+
+void BinaryMeshLoader::load( otk::pbrt::MeshData& buffers )
+{
+    BinaryReader reader;
+    if( !reader.open( m_filename ) )
+    {
+        throw std::runtime_error( m_filename + " is not a valid binary PLY file." );
+    }
+    reader.load( buffers );
+
+    const long numVertices = static_cast<long>( buffers.vertexCoords.size() / 3 );
+    const long numFaces    = static_cast<long>( buffers.indices.size() / 3 );
+    if( numVertices != m_meshInfo.numVertices || numFaces != m_meshInfo.numTriangles )
+    {
+        throw std::runtime_error( m_filename + ": Data count mismatch: expected " + std::to_string( m_meshInfo.numVertices )
+                                  + " vertices, got " + std::to_string( numVertices ) + "; expected "
+                                  + std::to_string( m_meshInfo.numTriangles ) + " triangles, got " + std::to_string( numFaces ) );
+    }
+
+    std::cout << "Loaded " << m_filename << '\n';
+}
+
 int readFloat( p_ply_argument arg )
 {
     std::vector<float>* buffer{};
@@ -190,6 +232,14 @@ void InfoReader::s_errorCallback( p_ply ply, const char* message )
 
 otk::pbrt::MeshInfo InfoReader::read( const std::string& filename )
 {
+    BinaryReader binaryReader;
+    m_binary = binaryReader.open( filename );
+    if( m_binary )
+    {
+        m_meshInfo = binaryReader.readInfo();
+        return m_meshInfo;
+    }
+
     PlyHandle ply( ply_open( filename.c_str(), InfoReader::s_errorCallback, 0, nullptr ) );
     if( ply == nullptr )
     {
@@ -227,6 +277,8 @@ otk::pbrt::MeshInfo InfoReader::read( const std::string& filename )
 
 otk::pbrt::MeshLoaderPtr InfoReader::getLoader( const std::string& filename )
 {
+    if( m_binary )
+        return std::make_shared<BinaryMeshLoader>( filename, m_meshInfo );
     return std::make_shared<MeshLoader>( filename, m_meshInfo );
 }
 
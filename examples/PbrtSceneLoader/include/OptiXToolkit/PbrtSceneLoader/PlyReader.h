@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
@@ -14,6 +14,8 @@ namespace ply {
 
 /// Used to scan a PLY file and obtain aggregate information
 /// (bounding box, number of faces, number of vertices, etc.).
+/// Binary PLY files are read directly from a memory mapping;
+/// ASCII PLY files are read with rply.
 class InfoReader : public ::otk::pbrt::MeshInfoReader
 {
   public:
@@ -31,6 +33,7 @@ private:
 
     otk::pbrt::MeshInfo m_meshInfo{};
     bool                m_firstVertex[3]{};
+    bool                m_binary{};
 };
 
 }  // namespace ply
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <OptiXToolkit/PbrtSceneLoader/MeshReader.h>
+#include <OptiXToolkit/PbrtSceneLoader/PlyReader.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace otk::pbrt;
+using namespace testing;
+
+namespace {
+
+// Builds the data of a binary PLY file in either byte order.
+class PlyWriter
+{
+  public:
+    explicit PlyWriter( bool bigEndian )
+        : m_bigEndian( bigEndian )
+    {
+    }
+
+    template <typename T>
+    PlyWriter& put( T value )
+    {
+        char bytes[sizeof( T )];
+        memcpy( bytes, &value, sizeof( T ) );
+        if( m_bigEndian )
+            std::reverse( bytes, bytes + sizeof( T ) );
+        m_data.append( bytes, sizeof( T ) );
+        return *this;
+    }
+
+    void write( const std::string& fileName, const std::string& header ) const
+    {
+        std::ofstream file( fileName, std::ios::binary );
+        file << "ply\nformat " << ( m_bigEndian ? "binary_big_endian" : "binary_little_endian" ) << " 1.0\n"
+             << header << "end_header\n"
+             << m_data;
+    }
+
+  private:
+    bool        m_bigEndian;
+    std::string m_data;
+};
+
+class TestPlyReader : public Test
+{
+  public:
+    void TearDown() override { std::remove( m_fileName.c_str() ); }
+
+  protected:
+    const std::string m_fileName{ "TestPlyReader.ply" };
+    ply::InfoReader   m_reader;
+
+    MeshData load()
+    {
+        MeshData data;
+        m_reader.getLoader( m_fileName )->load( data );
+        return data;
+    }
+};
+
+}  // namespace
+
+TEST_F( TestPlyReader, trianglesWithNormalsAndUVs )
+{
+    PlyWriter ply( false );
+    const float vertices[3][8] = { { 0, 0, 0, 0, 0, 1, 0, 0 }, { 1, 0, 2, 0, 1, 0, 1, 0 }, { 0, -1, 0, 1, 0, 0, 0, 1 } };
+    for( const auto& vertex : vertices )
+        for( float value : vertex )
+            ply.put( value );
+    ply.put<unsigned char>( 3 ).put( 0 ).put( 1 ).put( 2 );
+    ply.write( m_fileName,
+               "element vertex 3\n"
+               "property float x\nproperty float y\nproperty float z\n"
+               "property float nx\nproperty float ny\nproperty float nz\n"
+               "property float u\nproperty float v\n"
+               "element face 1\n"
+               "property list uchar int vertex_indices\n" );
+
+    const MeshInfo info = m_reader.read( m_fileName );
+    EXPECT_EQ( 3, info.numVertices );
+    EXPECT_EQ( 3, info.numNormals );
+    EXPECT_EQ( 3, info.numTextureCoordinates );
+    EXPECT_EQ( 1, info.numTriangles );
+    EXPECT_THAT( info.minCoord, ElementsAre( 0.0f, -1.0f, 0.0f ) );
+    EXPECT_THAT( info.maxCoord, ElementsAre( 1.0f, 0.0f, 2.0f ) );
+
+    const MeshData data = load();
+    EXPECT_EQ( ( std::vector<float>{ 0, 0, 0, 1, 0, 2, 0, -1, 0 } ), data.vertexCoords );
+    EXPECT_EQ( ( std::vector<float>{ 0, 0, 1, 0, 1, 0, 1, 0, 0 } ), data.normalCoords );
+    EXPECT_EQ( ( std::vector<float>{ 0, 0, 1, 0, 0, 1 } ), data.uvCoords );
+    EXPECT_EQ( ( std::vector<int>{ 0, 1, 2 } ), data.indices );
+}
+
+TEST_F( TestPlyReader, bigEndianQuadsAreTriangulated )
+{
+    // Double positions, texture coordinates named s and t, and an extra face property before the indices.
+    PlyWriter ply( true );
+    for( int i = 0; i < 5; ++i )
+        ply.put<double>( i ).put<double>( -i ).put<double>( 2 * i ).put<float>( 0.25f * i ).put<float>( 0.5f );
+    ply.put<unsigned char>( 7 ).put<unsigned short>( 4 ).put<unsigned int>( 0 ).put<unsigned int>( 1 ).put<unsigned int>( 2 ).put<unsigned int>( 3 );
+    ply.put<unsigned char>( 8 ).put<unsigned short>( 3 ).put<unsigned int>( 2 ).put<unsigned int>( 3 ).put<unsigned int>( 4 );
+    ply.write( m_fileName,
+               "comment quads\n"
+               "element vertex 5\n"
+               "property double x\nproperty double y\nproperty double z\n"
+               "property float s\nproperty float t\n"
+               "element face 2\n"
+               "property uchar flags\n"
+               "property list ushort uint vertex_indices\n" );
+
+    const MeshInfo info = m_reader.read( m_fileName );
+    EXPECT_EQ( 5, info.numVertices );
+    EXPECT_EQ( 0, info.numNormals );
+    EXPECT_EQ( 5, info.numTextureCoordinates );
+    EXPECT_EQ( 3, info.numTriangles );
+    EXPECT_THAT( info.minCoord, ElementsAre( 0.0f, -4.0f, 0.0f ) );
+    EXPECT_THAT( info.maxCoord, ElementsAre( 4.0f, 0.0f, 8.0f ) );
+
+    const MeshData data = load();
+    EXPECT_EQ( ( std::vector<float>{ 0, 0, 0, 1, -1, 2, 2, -2, 4, 3, -3, 6, 4, -4, 8 } ), data.vertexCoords );
+    EXPECT_TRUE( data.normalCoords.empty() );
+    EXPECT_EQ( ( std::vector<float>{ 0, 0.5f, 0.25f, 0.5f, 0.5f, 0.5f, 0.75f, 0.5f, 1.0f, 0.5f } ), data.uvCoords );
+    EXPECT_EQ( ( std::vector<int>{ 0, 1, 2, 0, 2, 3, 2, 3, 4 } ), data.indices );
+}
+
+TEST_F( TestPlyReader, manyFacesAreDecodedInChunks )
+{
+    // A grid of quads large enough to span several face chunks and threads.
+    const int gridSize = 400;
+    PlyWriter ply( false );
+    for( int y = 0; y <= gridSize; ++y )
+        for( int x = 0; x <= gridSize; ++x )
+            ply.put<float>( x ).put<float>( y ).put<float>( 0 );
+    for( int y = 0; y < gridSize; ++y )
+    {
+        for( int x = 0; x < gridSize; ++x )
+        {
+            const int v = y * ( gridSize + 1 ) + x;
+            if( ( x + y ) % 2 == 0 )
+                ply.put<unsigned char>( 4 ).put( v ).put( v + 1 ).put( v + gridSize + 2 ).put( v + gridSize + 1 );
+            else
+                ply.put<unsigned char>( 3 ).put( v ).put( v + 1 ).put( v + gridSize + 2 );
+        }
+    }
+    const int numVertices = ( gridSize + 1 ) * ( gridSize + 1 );
+    const int numQuads    = gridSize * gridSize / 2;
+    const int numFaces    = gridSize * gridSize;
+    ply.write( m_fileName, "element vertex " + std::to_string( numVertices )
+                               + "\nproperty float x\nproperty float y\nproperty float z\n"
+                                 "element face "
+                               + std::to_string( numFaces ) + "\nproperty list uchar int vertex_indices\n" );
+
+    const MeshInfo info = m_reader.read( m_fileName );
+    EXPECT_EQ( numVertices, info.numVertices );
+    EXPECT_EQ( numFaces + numQuads, info.numTriangles );
+    EXPECT_THAT( info.maxCoord, ElementsAre( float( gridSize ), float( gridSize ), 0.0f ) );
+
+    const MeshData data = load();
+    ASSERT_EQ( static_cast<size_t>( 3 * ( numFaces + numQuads ) ), data.indices.size() );
+    size_t triangle = 0;
+    for( int y = 0; y < gridSize; ++y )
+    {
+        for( int x = 0; x < gridSize; ++x )
+        {
+            const int v = y * ( gridSize + 1 ) + x;
+            ASSERT_EQ( v, data.indices[triangle * 3] );
+            ASSERT_EQ( v + 1, data.indices[triangle * 3 + 1] );
+            ASSERT_EQ( v + gridSize + 2, data.indices[triangle * 3 + 2] );
+            ++triangle;
+            if( ( x + y ) % 2 == 0 )
+            {
+                ASSERT_EQ( v, data.indices[triangle * 3] );
+                ASSERT_EQ( v + gridSize + 2, data.indices[triangle * 3 + 1] );
+                ASSERT_EQ( v + gridSize + 1, data.indices[triangle * 3 + 2] );
+                ++triangle;
+            }
+        }
+    }
+}
+
+TEST_F( TestPlyReader, badVertexIndexThrows )
+{
+    PlyWriter ply( false );
+    for( int i = 0; i < 9; ++i )
+        ply.put<float>( i );
+    ply.put<unsigned char>( 3 ).put( 0 ).put( 1 ).put( 3 );
+    ply.write( m_fileName,
+               "element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+               "element face 1\nproperty list uchar int vertex_indices\n" );
+
+    m_reader.read( m_fileName );
+    EXPECT_THROW( load(), std::runtime_error );
+}
+
+TEST_F( TestPlyReader, truncatedFileThrows )
+{
+    PlyWriter ply( false );
+    for( int i = 0; i < 9; ++i )
+        ply.put<float>( i );
+    ply.put<unsigned char>( 3 ).put( 0 ).put( 1 );
+    ply.write( m_fileName,
+               "element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+               "element face 1\nproperty list uchar int vertex_indices\n" );
+
+    EXPECT_THROW( m_reader.read( m_fileName ), std::runtime_error );
+}